@@ -57,12 +57,30 @@ hipsparseStatus_t hipsparse_record_output(const std::string& s)
     }
 }
 
+hipsparseStatus_t hipsparse_record_output_field(const char* name, const std::string& value)
+{
+    auto* s_bench_app = hipsparse_bench_app::instance();
+    if(s_bench_app)
+    {
+        return s_bench_app->record_output_field(name, value);
+    }
+    else
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
 hipsparseStatus_t hipsparse_record_timing(double msec, double gflops, double gbs)
 {
     auto* s_bench_app = hipsparse_bench_app::instance();
     if(s_bench_app)
     {
-        return s_bench_app->record_timing(msec, gflops, gbs);
+        auto status = s_bench_app->record_timing(msec, gflops, gbs);
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        return s_bench_app->record_timing_stats(hipsparse_last_timing_stats());
     }
     else
     {
@@ -24,6 +24,8 @@
 
 #include "hipsparse_arguments_config.hpp"
 
+#include <sstream>
+
 hipsparse_arguments_config::hipsparse_arguments_config()
 {
     {
@@ -165,6 +167,10 @@ void hipsparse_arguments_config::set_description(options_description& desc)
      value<std::string>(&this->filename)->default_value(""),
      "read from file with file extension detection.")
 
+    ("matrix",
+     value<std::string>(&this->filename)->default_value(""),
+     "generate the matrix from a spec instead of a file: laplace2d:n[:5|9], laplace3d:n[:7|27], banded:m:bw, block:mb:bd:blocks_per_row, rmat:scale:edge_factor[:a:b:c] or random:m:n:nnz, each optionally followed by :seed=s.")
+
     ("alpha",
      value<double>(&this->alpha)->default_value(1.0), "specifies the scalar alpha")
 
@@ -248,6 +254,10 @@ void hipsparse_arguments_config::set_description(options_description& desc)
      value<int>(&this->iters)->default_value(10),
      "Iterations to run inside timing loop")
 
+    ("warmup",
+     value<int>(&this->warmup)->default_value(2),
+     "Untimed iterations to run before the timing loop")
+
     ("device,d",
      value<int>(&this->device_id)->default_value(0),
      "Set default device to be used for subsequent program runs")
@@ -488,3 +498,93 @@ int hipsparse_arguments_config::parse(int&argc,char**&argv, options_description&
     return 0;
 }
 
+
+void hipsparse_arguments_config::get_fields(
+    std::vector<std::pair<std::string, std::string>>& fields) const
+{
+    fields.clear();
+
+    auto add = [&fields](const char* name, const auto& value) {
+        std::ostringstream os;
+        os << value;
+        fields.emplace_back(name, os.str());
+    };
+
+    add("function", this->function_name);
+    add("precision", this->precision);
+    add("indextype", this->indextype);
+    add("device_id", this->device_id);
+    add("filename", this->filename);
+
+    add("M", this->M);
+    add("N", this->N);
+    add("K", this->K);
+    add("nnz", this->nnz);
+    add("block_dim", this->block_dim);
+    add("row_block_dimA", this->row_block_dimA);
+    add("col_block_dimA", this->col_block_dimA);
+    add("row_block_dimB", this->row_block_dimB);
+    add("col_block_dimB", this->col_block_dimB);
+    add("lda", this->lda);
+    add("ldb", this->ldb);
+    add("ldc", this->ldc);
+    add("batch_count", this->batch_count);
+
+    add("index_type_I", hipsparse_indextype2string(this->index_type_I));
+    add("index_type_J", hipsparse_indextype2string(this->index_type_J));
+    add("compute_type", hipsparse_datatype2string(this->compute_type));
+
+    add("alpha", this->alpha);
+    add("alphai", this->alphai);
+    add("beta", this->beta);
+    add("betai", this->betai);
+    add("threshold", this->threshold);
+    add("percentage", this->percentage);
+
+    add("transA", hipsparse_operation2string(this->transA));
+    add("transB", hipsparse_operation2string(this->transB));
+    add("baseA", hipsparse_indexbase2string(this->baseA));
+    add("baseB", hipsparse_indexbase2string(this->baseB));
+    add("baseC", hipsparse_indexbase2string(this->baseC));
+    add("baseD", hipsparse_indexbase2string(this->baseD));
+
+    add("action", hipsparse_action2string(this->action));
+    add("part", hipsparse_partition2string(this->part));
+    add("diag_type", hipsparse_diagtype2string(this->diag_type));
+    add("fill_mode", hipsparse_fillmode2string(this->fill_mode));
+    add("solve_policy", hipsparse_solvepolicy2string(this->solve_policy));
+    add("execution_policy", static_cast<int>(this->execution_policy));
+
+    add("dirA", hipsparse_direction2string(this->dirA));
+    add("orderA", hipsparse_order2string(this->orderA));
+    add("orderB", hipsparse_order2string(this->orderB));
+    add("orderC", hipsparse_order2string(this->orderC));
+    add("formatA", hipsparse_format2string(this->formatA));
+    add("formatB", hipsparse_format2string(this->formatB));
+
+    add("csr2csc_alg", this->csr2csc_alg);
+    add("dense2sparse_alg", this->dense2sparse_alg);
+    add("sparse2dense_alg", this->sparse2dense_alg);
+    add("sddmm_alg", this->sddmm_alg);
+    add("spgemm_alg", this->spgemm_alg);
+    add("spgemm_mode", this->spgemm_mode);
+    add("spmm_alg", this->spmm_alg);
+    add("spmv_alg", this->spmv_alg);
+    add("spsm_alg", this->spsm_alg);
+    add("spsv_alg", this->spsv_alg);
+
+    add("numericboost", this->numericboost);
+    add("boosttol", this->boosttol);
+    add("boostval", this->boostval);
+    add("boostvali", this->boostvali);
+
+    add("ell_width", this->ell_width);
+    add("permute", this->permute);
+    add("gtsv_alg", this->gtsv_alg);
+    add("gpsv_alg", this->gpsv_alg);
+
+    add("unit_check", this->unit_check);
+    add("timing", this->timing);
+    add("warmup", this->warmup);
+    add("iters", this->iters);
+}
@@ -26,6 +26,10 @@
 #include "hipsparse_arguments.hpp"
 #include "program_options.hpp"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 struct hipsparse_arguments_config : Arguments
 {
 
@@ -58,4 +62,9 @@ public:
     void set_description(options_description& desc);
     int  parse(int& argc, char**& argv, options_description& desc);
     int  parse_no_default(int& argc, char**& argv, options_description& desc);
+
+    //
+    // @brief Every argument as a (name, value) pair, enumerations as strings.
+    //
+    void get_fields(std::vector<std::pair<std::string, std::string>>& fields) const;
 };
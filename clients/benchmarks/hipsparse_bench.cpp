@@ -107,6 +107,11 @@ int hipsparse_bench::get_device_id() const
     return this->config.device_id;
 }
 
+const hipsparse_arguments_config& hipsparse_bench::get_config() const
+{
+    return this->config;
+}
+
 // This is used for backward compatibility.
 void hipsparse_bench::info_devices(std::ostream& out_) const
 {
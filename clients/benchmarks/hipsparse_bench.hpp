@@ -29,6 +29,7 @@
 struct gpu_config
 {
     char name[32];
+    char arch[32];
     long memory_MB;
     long clockRate_MHz;
     long major;
@@ -37,10 +38,17 @@ struct gpu_config
     long sharedMemPerBlock_KB;
     long maxThreadsPerBlock;
     long warpSize;
+    long multiProcessorCount;
+    long l2Cache_KB;
+    long memoryClockRate_MHz;
+    long memoryBusWidth;
 
     explicit gpu_config(const hipDeviceProp_t& prop)
     {
-        strcpy(this->name, prop.name);
+        strncpy(this->name, prop.name, sizeof(this->name) - 1);
+        this->name[sizeof(this->name) - 1] = '\0';
+        strncpy(this->arch, prop.gcnArchName, sizeof(this->arch) - 1);
+        this->arch[sizeof(this->arch) - 1] = '\0';
         this->memory_MB            = (prop.totalGlobalMem >> 20);
         this->clockRate_MHz        = prop.clockRate / 1000;
         this->major                = prop.major;
@@ -49,6 +57,10 @@ struct gpu_config
         this->sharedMemPerBlock_KB = (prop.sharedMemPerBlock >> 10);
         this->maxThreadsPerBlock   = prop.maxThreadsPerBlock;
         this->warpSize             = prop.warpSize;
+        this->multiProcessorCount  = prop.multiProcessorCount;
+        this->l2Cache_KB           = (prop.l2CacheSize >> 10);
+        this->memoryClockRate_MHz  = prop.memoryClockRate / 1000;
+        this->memoryBusWidth       = prop.memoryBusWidth;
     }
 
     void print(std::ostream& out_)
@@ -72,6 +84,10 @@ struct gpu_config
         out << std::endl
             << "\"config gpu\": {" << std::endl
 
+            << "  \"name\"               : \"" << this->name << "\"," << std::endl
+
+            << "  \"arch\"               : \"" << this->arch << "\"," << std::endl
+
             << "  \"memory\"             : \"" << this->memory_MB << "\"," << std::endl
 
             << "  \"clockrate\"          : \"" << this->clockRate_MHz << "\"," << std::endl
@@ -85,7 +101,15 @@ struct gpu_config
 
             << "  \"max thread per block\": \"" << this->maxThreadsPerBlock << "\"," << std::endl
 
-            << "  \"wavefront size\"     : \"" << this->warpSize << "\"}," << std::endl;
+            << "  \"wavefront size\"     : \"" << this->warpSize << "\"," << std::endl
+
+            << "  \"compute units\"      : \"" << this->multiProcessorCount << "\"," << std::endl
+
+            << "  \"l2 cache\"           : \"" << this->l2Cache_KB << "\"," << std::endl
+
+            << "  \"memory clockrate\"   : \"" << this->memoryClockRate_MHz << "\"," << std::endl
+
+            << "  \"memory bus width\"   : \"" << this->memoryBusWidth << "\"}," << std::endl;
     }
 };
 
@@ -101,10 +125,11 @@ private:
 public:
     hipsparse_bench();
     hipsparse_bench(int& argc, char**& argv);
-    hipsparse_bench&  operator()(int& argc, char**& argv);
-    hipsparseStatus_t run();
-    int               get_device_id() const;
-    void              info_devices(std::ostream& out_) const;
+    hipsparse_bench&                  operator()(int& argc, char**& argv);
+    hipsparseStatus_t                 run();
+    int                               get_device_id() const;
+    const hipsparse_arguments_config& get_config() const;
+    void                              info_devices(std::ostream& out_) const;
 };
 
 std::string hipsparse_get_version();
@@ -24,9 +24,12 @@
 
 #include "hipsparse_bench_app.hpp"
 #include "hipsparse_bench.hpp"
+#include "display.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <random>
+#include <set>
 
 hipsparse_bench_app* hipsparse_bench_app::s_instance = nullptr;
 
@@ -40,7 +43,214 @@ hipsparse_bench_app_base::hipsparse_bench_app_base(int argc, char** argv)
 hipsparseStatus_t hipsparse_bench_app_base::run_case(int isample, int irun, int argc, char** argv)
 {
     hipsparse_bench bench(argc, argv);
-    return bench.run();
+
+    //
+    // The displayed fields are recorded again by each run.
+    //
+    auto& item = this->m_bench_timing[isample];
+    item.fields.clear();
+
+    hipsparseStatus_t status = bench.run();
+    item.record_arguments(bench.get_config());
+    return status;
+}
+
+//
+// Escape a string to be written as a JSON string.
+//
+static std::string json_escape(const std::string& s)
+{
+    std::ostringstream os;
+    for(char c : s)
+    {
+        switch(c)
+        {
+        case '"':
+        {
+            os << "\\\"";
+            break;
+        }
+        case '\\':
+        {
+            os << "\\\\";
+            break;
+        }
+        case '\n':
+        {
+            os << "\\n";
+            break;
+        }
+        case '\t':
+        {
+            os << "\\t";
+            break;
+        }
+        default:
+        {
+            os << c;
+            break;
+        }
+        }
+    }
+    return os.str();
+}
+
+//
+// Quote a CSV field if it contains a separator, a quote or a space.
+//
+static std::string csv_escape(const std::string& s)
+{
+    if(s.find_first_of(",\" \n") == std::string::npos)
+    {
+        return s;
+    }
+    std::string q("\"");
+    for(char c : s)
+    {
+        if(c == '"')
+        {
+            q += '"';
+        }
+        q += c;
+    }
+    q += '"';
+    return q;
+}
+
+static const std::string* find_field(const std::vector<std::pair<std::string, std::string>>& v,
+                                     const char*                                             name)
+{
+    for(const auto& p : v)
+    {
+        if(p.first == name)
+        {
+            return &p.second;
+        }
+    }
+    return nullptr;
+}
+
+//
+// Matrix statistics, the displayed sizes take precedence over the arguments since
+// these are the ones of the generated or loaded matrix.
+//
+static void get_matrix_fields(const hipsparse_bench_timing_t::item_t&           item,
+                              std::vector<std::pair<std::string, std::string>>& matrix)
+{
+    matrix.clear();
+
+    const std::string* filename = find_field(item.arguments, "filename");
+    std::string        name("");
+    if(filename != nullptr && !filename->empty())
+    {
+        std::vector<char> buffer(filename->size() + 1);
+        hipsparse_get_matrixname(filename->c_str(), buffer.data());
+        name = buffer.data();
+    }
+    matrix.emplace_back("name", name);
+
+    double sizes[3]{};
+    const char* keys[3] = {"M", "N", "nnz"};
+    for(int k = 0; k < 3; ++k)
+    {
+        const std::string* v = find_field(item.fields, keys[k]);
+        if(v == nullptr)
+        {
+            v = find_field(item.arguments, keys[k]);
+        }
+        if(v != nullptr)
+        {
+            sizes[k] = atof(v->c_str());
+            matrix.emplace_back(keys[k], *v);
+        }
+    }
+
+    std::ostringstream nnz_per_row, density;
+    nnz_per_row << ((sizes[0] > 0) ? sizes[2] / sizes[0] : 0.0);
+    density << ((sizes[0] > 0 && sizes[1] > 0) ? sizes[2] / (sizes[0] * sizes[1]) : 0.0);
+    matrix.emplace_back("nnz_per_row", nnz_per_row.str());
+    matrix.emplace_back("density", density.str());
+}
+
+//
+// Aggregate the timer statistics over the runs: minimum of the minima, median of the
+// medians, mean of the means, maximum of the tails and number of unstable runs.
+//
+static void get_timer_fields(const hipsparse_bench_timing_t::item_t&           item,
+                             std::vector<std::pair<std::string, std::string>>& timer)
+{
+    timer.clear();
+
+    const int           N = item.m_nruns;
+    std::vector<double> medians;
+    double              min_us = 0.0, mean_us = 0.0, p90_us = 0.0, p99_us = 0.0;
+    double              stddev_us = 0.0;
+    int                 unstable = 0, warmup = 0, iters = 0;
+    for(int i = 0; i < N; ++i)
+    {
+        const hipsparse_timing_stats& t = item.timer[i];
+        if(t.iters <= 0)
+        {
+            continue;
+        }
+        min_us = medians.empty() ? t.min_us : std::min(min_us, t.min_us);
+        medians.push_back(t.median_us);
+        mean_us += t.mean_us;
+        p90_us    = std::max(p90_us, t.p90_us);
+        p99_us    = std::max(p99_us, t.p99_us);
+        stddev_us = std::max(stddev_us, t.stddev_us);
+        unstable += t.unstable ? 1 : 0;
+        warmup = t.warmup;
+        iters  = t.iters;
+    }
+
+    double median_us = 0.0;
+    if(!medians.empty())
+    {
+        const size_t n = medians.size();
+        std::sort(medians.begin(), medians.end());
+        median_us = (n % 2 == 0) ? (medians[n / 2 - 1] + medians[n / 2]) * 0.5 : medians[n / 2];
+        mean_us /= n;
+    }
+
+    auto add = [&timer](const char* name, double value) {
+        std::ostringstream os;
+        os << value;
+        timer.emplace_back(name, os.str());
+    };
+    add("runs", N);
+    add("warmup", warmup);
+    add("iters", iters);
+    add("min_us", min_us);
+    add("median_us", median_us);
+    add("mean_us", mean_us);
+    add("p90_us", p90_us);
+    add("p99_us", p99_us);
+    add("stddev_us", stddev_us);
+    add("unstable_runs", unstable);
+}
+
+static void export_fields_json(std::ostream&                                           out,
+                               const char*                                             name,
+                               const std::vector<std::pair<std::string, std::string>>& v)
+{
+    out << "  \"" << name << "\": {";
+    for(size_t i = 0; i < v.size(); ++i)
+    {
+        out << ((i > 0) ? ", " : "") << "\"" << json_escape(v[i].first) << "\": \""
+            << json_escape(v[i].second) << "\"";
+    }
+    out << "}," << std::endl;
+}
+
+static void export_samples_json(std::ostream& out, const char* name, const std::vector<double>& v)
+{
+    out << "\"" << name << "\": [";
+    for(size_t i = 0; i < v.size(); ++i)
+    {
+        out << ((i > 0) ? ", " : "") << v[i];
+    }
+    out << "]";
 }
 
 hipsparseStatus_t hipsparse_bench_app_base::run_cases()
@@ -153,37 +363,47 @@ void hipsparse_bench_app::confidence_interval(const double               alpha,
 #undef median_value
 }
 
+//
+// Median and bootstrap confidence interval of the median, the samples are sorted.
+//
+void hipsparse_bench_app::summarize(std::vector<double>& v, double values[3])
+{
+    const int N = v.size();
+    if(N > 1)
+    {
+        const double alpha  = 0.95;
+        const int    nboots = 200;
+        std::sort(v.begin(), v.end());
+        values[0] = (N % 2 == 0) ? (v[N / 2 - 1] + v[N / 2]) * 0.5 : v[N / 2];
+        confidence_interval(alpha, 10, nboots, v, values + 1);
+    }
+    else
+    {
+        values[0] = v[0];
+        values[1] = v[0];
+        values[2] = v[0];
+    }
+}
+
 void hipsparse_bench_app::export_item(std::ostream& out, hipsparse_bench_timing_t::item_t& item)
 {
     //
     //
     //
-    auto N = item.m_nruns;
+    auto   N = item.m_nruns;
+    double msec[3], gflops[3], gbs[3];
+    summarize(item.msec, msec);
+    summarize(item.gflops, gflops);
+    summarize(item.gbs, gbs);
     if(N > 1)
     {
-        const double alpha = 0.95;
-        std::sort(item.msec.begin(), item.msec.end());
-        std::sort(item.gflops.begin(), item.gflops.end());
-        std::sort(item.gbs.begin(), item.gbs.end());
-        double msec
-            = (N % 2 == 0) ? (item.msec[N / 2 - 1] + item.msec[N / 2]) * 0.5 : item.msec[N / 2];
-        double gflops = (N % 2 == 0) ? (item.gflops[N / 2 - 1] + item.gflops[N / 2]) * 0.5
-                                     : item.gflops[N / 2];
-        double gbs = (N % 2 == 0) ? (item.gbs[N / 2 - 1] + item.gbs[N / 2]) * 0.5 : item.gbs[N / 2];
-
-        double interval_msec[2], interval_gflops[2], interval_gbs[2];
-        int    nboots = 200;
-        confidence_interval(alpha, 10, nboots, item.msec, interval_msec);
-        confidence_interval(alpha, 10, nboots, item.gflops, interval_gflops);
-        confidence_interval(alpha, 10, nboots, item.gbs, interval_gbs);
-
         out << std::endl
-            << "    \"time\": [\"" << msec << "\", \"" << interval_msec[0] << "\", \""
-            << interval_msec[1] << "\"]," << std::endl;
-        out << "    \"flops\": [\"" << gflops << "\", \"" << interval_gflops[0] << "\", \""
-            << interval_gflops[1] << "\"]," << std::endl;
-        out << "    \"bandwidth\": [\"" << gbs << "\", \"" << interval_gbs[0] << "\", \""
-            << interval_gbs[1] << "\"]";
+            << "    \"time\": [\"" << msec[0] << "\", \"" << msec[1] << "\", \"" << msec[2]
+            << "\"]," << std::endl;
+        out << "    \"flops\": [\"" << gflops[0] << "\", \"" << gflops[1] << "\", \"" << gflops[2]
+            << "\"]," << std::endl;
+        out << "    \"bandwidth\": [\"" << gbs[0] << "\", \"" << gbs[1] << "\", \"" << gbs[2]
+            << "\"]";
 
         if(!no_rawdata())
         {
@@ -196,12 +416,11 @@ void hipsparse_bench_app::export_item(std::ostream& out, hipsparse_bench_timing_
     else
     {
         out << std::endl
-            << "\"time\": [\"" << item.msec[0] << "\", \"" << item.msec[0] << "\", \""
-            << item.msec[0] << "\"]," << std::endl;
-        out << "\"flops\": [\"" << item.gflops[0] << "\", \"" << item.gflops[0] << "\", \""
-            << item.gflops[0] << "\"]," << std::endl;
-        out << "\"bandwidth\": [\"" << item.gbs[0] << "\", \"" << item.gbs[0] << "\", \""
-            << item.gbs[0] << "\"]";
+            << "\"time\": [\"" << msec[0] << "\", \"" << msec[1] << "\", \"" << msec[2] << "\"],"
+            << std::endl;
+        out << "\"flops\": [\"" << gflops[0] << "\", \"" << gflops[1] << "\", \"" << gflops[2]
+            << "\"]," << std::endl;
+        out << "\"bandwidth\": [\"" << gbs[0] << "\", \"" << gbs[1] << "\", \"" << gbs[2] << "\"]";
         if(!no_rawdata())
         {
             out << ",";
@@ -214,6 +433,135 @@ void hipsparse_bench_app::export_item(std::ostream& out, hipsparse_bench_timing_
     }
 }
 
+//
+// Structured record of a case, written before the timing summary sorts the samples.
+//
+void hipsparse_bench_app::export_record_json(std::ostream&                     out,
+                                             hipsparse_bench_timing_t::item_t& item)
+{
+    std::vector<std::pair<std::string, std::string>> matrix, timer;
+    get_matrix_fields(item, matrix);
+    get_timer_fields(item, timer);
+
+    const std::string* function = find_field(item.arguments, "function");
+    out << "  \"function\": \"" << json_escape((function != nullptr) ? *function : "") << "\","
+        << std::endl;
+    out << "  \"device_id\": \"" << item.device_id << "\"," << std::endl;
+    export_fields_json(out, "arguments", item.arguments);
+    export_fields_json(out, "fields", item.fields);
+    export_fields_json(out, "matrix", matrix);
+    export_fields_json(out, "timer", timer);
+    out << "  \"samples\": {";
+    export_samples_json(out, "time", item.msec);
+    out << ", ";
+    export_samples_json(out, "flops", item.gflops);
+    out << ", ";
+    export_samples_json(out, "bandwidth", item.gbs);
+    out << "}," << std::endl;
+}
+
+//
+// One row per case, the columns are the union of the recorded names over all cases.
+//
+hipsparseStatus_t hipsparse_bench_app::export_csv(std::ostream& out)
+{
+    typedef std::vector<std::pair<std::string, std::string>> fields_t;
+
+    const int             nsamples = this->m_bench_timing.size();
+    std::vector<fields_t> rows(nsamples);
+
+    int   sample_argc;
+    char* sample_argv[64];
+
+    std::ostringstream version;
+    version << hipsparse_get_version();
+    for(int isample = 0; isample < nsamples; ++isample)
+    {
+        auto&     item = this->m_bench_timing[isample];
+        fields_t& row  = rows[isample];
+
+        this->m_bench_cmdlines.get(isample, sample_argc, sample_argv);
+        std::string cmdline(sample_argv[0]);
+        for(int i = 1; i < sample_argc; ++i)
+        {
+            cmdline += std::string(" ") + sample_argv[i];
+        }
+        row.emplace_back("cmdline", cmdline);
+        row.emplace_back("hipsparse_version", version.str());
+        row.emplace_back("device_id", std::to_string(item.device_id));
+
+        fields_t matrix, timer;
+        get_matrix_fields(item, matrix);
+        get_timer_fields(item, timer);
+
+        for(const auto& p : item.arguments)
+        {
+            row.emplace_back("arg." + p.first, p.second);
+        }
+        for(const auto& p : item.fields)
+        {
+            row.emplace_back("field." + p.first, p.second);
+        }
+        for(const auto& p : matrix)
+        {
+            row.emplace_back("matrix." + p.first, p.second);
+        }
+        for(const auto& p : timer)
+        {
+            row.emplace_back("timer." + p.first, p.second);
+        }
+
+        double      values[3];
+        const char* suffixes[3] = {"", "_lo", "_hi"};
+        std::pair<const char*, std::vector<double>*> results[3]
+            = {{"msec", &item.msec}, {"gflops", &item.gflops}, {"gbs", &item.gbs}};
+        for(auto& r : results)
+        {
+            summarize(*r.second, values);
+            for(int k = 0; k < 3; ++k)
+            {
+                std::ostringstream os;
+                os << values[k];
+                row.emplace_back(std::string(r.first) + suffixes[k], os.str());
+            }
+        }
+    }
+
+    //
+    // Header.
+    //
+    std::vector<std::string> columns;
+    std::set<std::string>    known;
+    for(const auto& row : rows)
+    {
+        for(const auto& p : row)
+        {
+            if(known.insert(p.first).second)
+            {
+                columns.push_back(p.first);
+            }
+        }
+    }
+
+    for(size_t j = 0; j < columns.size(); ++j)
+    {
+        out << ((j > 0) ? "," : "") << csv_escape(columns[j]);
+    }
+    out << std::endl;
+
+    for(const auto& row : rows)
+    {
+        for(size_t j = 0; j < columns.size(); ++j)
+        {
+            const std::string* v = find_field(row, columns[j].c_str());
+            out << ((j > 0) ? "," : "") << ((v != nullptr) ? csv_escape(*v) : "");
+        }
+        out << std::endl;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparse_bench_app::export_file()
 {
     const char* ofilename = this->m_bench_cmdlines.get_ofilename();
@@ -229,6 +577,24 @@ hipsparseStatus_t hipsparse_bench_app::export_file()
 
     std::ofstream out(ofilename);
 
+    //
+    // The output format is selected by the extension of the filename.
+    //
+    const size_t ofilename_len = strlen(ofilename);
+    if(ofilename_len > 4 && !strcmp(ofilename + ofilename_len - 4, ".csv"))
+    {
+        if(static_cast<size_t>(m_bench_cmdlines.get_nsamples()) != m_bench_timing.size())
+        {
+            std::cerr << "incompatible sizes at line " << __LINE__ << " "
+                      << m_bench_cmdlines.get_nsamples() << " " << m_bench_timing.size()
+                      << std::endl;
+            exit(1);
+        }
+        hipsparseStatus_t status = this->export_csv(out);
+        out.close();
+        return status;
+    }
+
     int   sample_argc;
     char* sample_argv[64];
 
@@ -292,10 +658,11 @@ hipsparseStatus_t
         out << "," << std::endl;
     out << std::endl;
     out << "{ \"cmdline\": \"";
-    out << argv[0];
+    out << json_escape(argv[0]);
     for(int i = 1; i < argc; ++i)
-        out << " " << argv[i];
+        out << " " << json_escape(argv[i]);
     out << " \"," << std::endl;
+    this->export_record_json(out, this->m_bench_timing[isample]);
     out << "  \"timing\": ";
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -322,13 +689,11 @@ hipsparseStatus_t hipsparse_bench_app::define_results_json(std::ostream& out)
     out << "\"date\": \"" << str << "\"," << std::endl;
     out << "\"hipSPARSE version\": \"" << hipsparse_get_version() << "\"," << std::endl;
 
-    //
-    // !!! To fix, not necessarily the gpu used from hipsparse_bench.
-    //
-    hipDeviceProp_t prop;
-    hipGetDeviceProperties(&prop, 0);
-    gpu_config g(prop);
-    g.print_json(out);
+    hipsparseStatus_t status = this->define_environment_json(out);
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return status;
+    }
 
     out << std::endl << "\"cmdline\": \"" << this->m_initial_argv[0];
 
@@ -439,6 +804,31 @@ hipsparseStatus_t hipsparse_bench_app::define_results_json(std::ostream& out)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+//
+// Runtime versions and properties of the device used by the cases.
+//
+hipsparseStatus_t hipsparse_bench_app::define_environment_json(std::ostream& out)
+{
+    int device_id = (this->m_bench_timing.size() > 0) ? this->m_bench_timing[0].device_id : 0;
+    int runtime_version = 0, driver_version = 0;
+    hipRuntimeGetVersion(&runtime_version);
+    hipDriverGetVersion(&driver_version);
+
+    out << "\"hip runtime version\": \"" << runtime_version << "\"," << std::endl;
+    out << "\"hip driver version\": \"" << driver_version << "\"," << std::endl;
+    out << "\"device id\": \"" << device_id << "\"," << std::endl;
+
+    hipDeviceProp_t prop;
+    if(hipGetDeviceProperties(&prop, device_id) != hipSuccess)
+    {
+        std::cerr << "cannot get the properties of device " << device_id << std::endl;
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+    gpu_config g(prop);
+    g.print_json(out);
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparse_bench_app::close_results_json(std::ostream& out)
 {
     out << "]" << std::endl;
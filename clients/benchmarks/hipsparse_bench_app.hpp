@@ -24,8 +24,12 @@
 #pragma once
 
 #include "hipsparse.h"
+#include "hipsparse_arguments_config.hpp"
 #include "hipsparse_bench_cmdlines.hpp"
+#include "utility.hpp"
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
 
 //
@@ -44,6 +48,15 @@ struct hipsparse_bench_timing_t
         std::vector<double>      gbs{};
         std::vector<std::string> outputs{};
         std::string              outputs_legend{};
+
+        //
+        // Structured record: timer statistics of each run, every argument
+        // and the displayed (name, value) pairs of the last run.
+        //
+        std::vector<hipsparse_timing_stats>              timer{};
+        std::vector<std::pair<std::string, std::string>> arguments{};
+        std::vector<std::pair<std::string, std::string>> fields{};
+        int                                              device_id{};
         item_t(){};
 
         explicit item_t(int nruns_)
@@ -51,7 +64,8 @@ struct hipsparse_bench_timing_t
             , msec(nruns_)
             , gflops(nruns_)
             , gbs(nruns_)
-            , outputs(nruns_){};
+            , outputs(nruns_)
+            , timer(nruns_){};
 
         item_t& operator()(int nruns_)
         {
@@ -60,9 +74,34 @@ struct hipsparse_bench_timing_t
             this->gflops.resize(nruns_);
             this->gbs.resize(nruns_);
             this->outputs.resize(nruns_);
+            this->timer.resize(nruns_);
             return *this;
         };
 
+        hipsparseStatus_t record(int irun, const hipsparse_timing_stats& stats)
+        {
+            if(irun >= 0 && irun < m_nruns)
+            {
+                this->timer[irun] = stats;
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+            else
+            {
+                return HIPSPARSE_STATUS_INTERNAL_ERROR;
+            }
+        }
+        hipsparseStatus_t record_field(const char* name, const std::string& value)
+        {
+            this->fields.emplace_back(name, value);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        hipsparseStatus_t record_arguments(const hipsparse_arguments_config& config)
+        {
+            config.get_fields(this->arguments);
+            this->device_id = config.device_id;
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
         hipsparseStatus_t record(int irun, double msec_, double gflops_, double gbs_)
         {
             if(irun >= 0 && irun < m_nruns)
@@ -223,6 +262,14 @@ public:
     {
         return this->m_bench_timing[this->m_isample].record(this->m_irun, msec, gflops, bandwidth);
     }
+    hipsparseStatus_t record_timing_stats(const hipsparse_timing_stats& stats)
+    {
+        return this->m_bench_timing[this->m_isample].record(this->m_irun, stats);
+    }
+    hipsparseStatus_t record_output_field(const char* name, const std::string& value)
+    {
+        return this->m_bench_timing[this->m_isample].record_field(name, value);
+    }
     hipsparseStatus_t record_output(const std::string& s)
     {
         return this->m_bench_timing[this->m_isample].record(this->m_irun, s);
@@ -233,7 +280,11 @@ public:
     }
 
 protected:
+    void              summarize(std::vector<double>& v, double values[3]);
     void              export_item(std::ostream& out, hipsparse_bench_timing_t::item_t& item);
+    void              export_record_json(std::ostream& out, hipsparse_bench_timing_t::item_t& item);
+    hipsparseStatus_t export_csv(std::ostream& out);
+    hipsparseStatus_t define_environment_json(std::ostream& out);
     hipsparseStatus_t define_case_json(std::ostream& out, int isample, int argc, char** argv);
     hipsparseStatus_t close_case_json(std::ostream& out, int isample, int argc, char** argv);
     hipsparseStatus_t define_results_json(std::ostream& out);
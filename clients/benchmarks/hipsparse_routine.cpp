@@ -225,17 +225,30 @@ constexpr const char* hipsparse_routine::to_string() const
 #include "testing_dense_to_sparse_coo.hpp"
 #include "testing_dense_to_sparse_csc.hpp"
 #include "testing_dense_to_sparse_csr.hpp"
+#include "testing_sddmm_coo.hpp"
+#include "testing_sddmm_coo_aos.hpp"
+#include "testing_sddmm_csc.hpp"
+#include "testing_sddmm_csr.hpp"
 #include "testing_sparse_to_dense_coo.hpp"
 #include "testing_sparse_to_dense_csc.hpp"
 #include "testing_sparse_to_dense_csr.hpp"
+#include "testing_spgemm_csr.hpp"
+#include "testing_spgemmreuse_csr.hpp"
+#include "testing_spmm_batched_coo.hpp"
+#include "testing_spmm_batched_csc.hpp"
+#include "testing_spmm_batched_csr.hpp"
+#include "testing_spmm_bell.hpp"
 #include "testing_spmm_coo.hpp"
 #include "testing_spmm_csc.hpp"
 #include "testing_spmm_csr.hpp"
 #include "testing_spmv_coo.hpp"
+#include "testing_spmv_coo_aos.hpp"
 #include "testing_spmv_csr.hpp"
 #include "testing_spsm_coo.hpp"
 #include "testing_spsm_csr.hpp"
+#include "testing_spsv_coo.hpp"
 #include "testing_spsv_csr.hpp"
+#include "testing_spvv.hpp"
 
 bool hipsparse_routine::is_routine_supported(hipsparse_routine::value_type FNAME)
 {
@@ -256,15 +269,21 @@ bool hipsparse_routine::is_routine_supported(hipsparse_routine::value_type FNAME
         return routine_support::is_roti_supported();
     case sctr:
         return routine_support::is_sctr_supported();
+    case spvv:
+        return routine_support::is_spvv_supported();
     // Level 2
     case bsrsv2:
         return routine_support::is_bsrsv2_supported();
     case coomv:
         return routine_support::is_coomv_supported();
+    case coomv_aos:
+        return routine_support::is_coomv_aos_supported();
     case csrmv:
         return routine_support::is_csrmv_supported();
     case csrsv:
         return routine_support::is_csrsv_supported();
+    case coosv:
+        return routine_support::is_coosv_supported();
     case gemvi:
         return routine_support::is_gemvi_supported();
     case hybmv:
@@ -276,10 +295,18 @@ bool hipsparse_routine::is_routine_supported(hipsparse_routine::value_type FNAME
         return routine_support::is_bsrsm2_supported();
     case coomm:
         return routine_support::is_coomm_supported();
+    case coomm_batched:
+        return routine_support::is_coomm_batched_supported();
     case cscmm:
         return routine_support::is_cscmm_supported();
+    case cscmm_batched:
+        return routine_support::is_cscmm_batched_supported();
     case csrmm:
         return routine_support::is_csrmm_supported();
+    case csrmm_batched:
+        return routine_support::is_csrmm_batched_supported();
+    case bellmm:
+        return routine_support::is_bellmm_supported();
     case coosm:
         return routine_support::is_coosm_supported();
     case csrsm:
@@ -291,6 +318,18 @@ bool hipsparse_routine::is_routine_supported(hipsparse_routine::value_type FNAME
         return routine_support::is_csrgeam_supported();
     case csrgemm:
         return routine_support::is_csrgemm_supported();
+    case spgemm:
+        return routine_support::is_spgemm_supported();
+    case spgemm_reuse:
+        return routine_support::is_spgemm_reuse_supported();
+    case sddmm_coo:
+        return routine_support::is_sddmm_coo_supported();
+    case sddmm_coo_aos:
+        return routine_support::is_sddmm_coo_aos_supported();
+    case sddmm_csc:
+        return routine_support::is_sddmm_csc_supported();
+    case sddmm_csr:
+        return routine_support::is_sddmm_csr_supported();
     // Precond
     case bsric02:
         return routine_support::is_bsric02_supported();
@@ -378,6 +417,9 @@ void hipsparse_routine::print_routine_support_info(hipsparse_routine::value_type
     case sctr:
         routine_support::print_sctr_support_warning();
         break;
+    case spvv:
+        routine_support::print_spvv_support_warning();
+        break;
     // Level 2
     case bsrsv2:
         routine_support::print_bsrsv2_support_warning();
@@ -385,12 +427,18 @@ void hipsparse_routine::print_routine_support_info(hipsparse_routine::value_type
     case coomv:
         routine_support::print_coomv_support_warning();
         break;
+    case coomv_aos:
+        routine_support::print_coomv_aos_support_warning();
+        break;
     case csrmv:
         routine_support::print_csrmv_support_warning();
         break;
     case csrsv:
         routine_support::print_csrsv_support_warning();
         break;
+    case coosv:
+        routine_support::print_coosv_support_warning();
+        break;
     case gemvi:
         routine_support::print_gemvi_support_warning();
         break;
@@ -407,12 +455,24 @@ void hipsparse_routine::print_routine_support_info(hipsparse_routine::value_type
     case coomm:
         routine_support::print_coomm_support_warning();
         break;
+    case coomm_batched:
+        routine_support::print_coomm_batched_support_warning();
+        break;
     case cscmm:
         routine_support::print_cscmm_support_warning();
         break;
+    case cscmm_batched:
+        routine_support::print_cscmm_batched_support_warning();
+        break;
     case csrmm:
         routine_support::print_csrmm_support_warning();
         break;
+    case csrmm_batched:
+        routine_support::print_csrmm_batched_support_warning();
+        break;
+    case bellmm:
+        routine_support::print_bellmm_support_warning();
+        break;
     case coosm:
         routine_support::print_coosm_support_warning();
         break;
@@ -429,6 +489,24 @@ void hipsparse_routine::print_routine_support_info(hipsparse_routine::value_type
     case csrgemm:
         routine_support::print_csrgemm_support_warning();
         break;
+    case spgemm:
+        routine_support::print_spgemm_support_warning();
+        break;
+    case spgemm_reuse:
+        routine_support::print_spgemm_reuse_support_warning();
+        break;
+    case sddmm_coo:
+        routine_support::print_sddmm_coo_support_warning();
+        break;
+    case sddmm_coo_aos:
+        routine_support::print_sddmm_coo_aos_support_warning();
+        break;
+    case sddmm_csc:
+        routine_support::print_sddmm_csc_support_warning();
+        break;
+    case sddmm_csr:
+        routine_support::print_sddmm_csr_support_warning();
+        break;
     // Precond
     case bsric02:
         routine_support::print_bsric02_support_warning();
@@ -648,12 +726,15 @@ hipsparseStatus_t hipsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(gthrz);
         DEFINE_CASE_T_REAL_ONLY(roti);
         DEFINE_CASE_T(sctr);
+        DEFINE_CASE_IT_X(spvv, testing_spvv);
 
         // Level2
         DEFINE_CASE_T(bsrsv2);
         DEFINE_CASE_IT_X(coomv, testing_spmv_coo);
+        DEFINE_CASE_IT_X(coomv_aos, testing_spmv_coo_aos);
         DEFINE_CASE_IJT_X(csrmv, testing_spmv_csr);
         DEFINE_CASE_IJT_X(csrsv, testing_spsv_csr);
+        DEFINE_CASE_IT_X(coosv, testing_spsv_coo);
         DEFINE_CASE_T(gemvi);
         DEFINE_CASE_T(hybmv);
 
@@ -661,8 +742,12 @@ hipsparseStatus_t hipsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(bsrmm);
         DEFINE_CASE_T(bsrsm2);
         DEFINE_CASE_IT_X(coomm, testing_spmm_coo);
+        DEFINE_CASE_IT_X(coomm_batched, testing_spmm_batched_coo);
         DEFINE_CASE_IJT_X(cscmm, testing_spmm_csc);
+        DEFINE_CASE_IJT_X(cscmm_batched, testing_spmm_batched_csc);
         DEFINE_CASE_IJT_X(csrmm, testing_spmm_csr);
+        DEFINE_CASE_IJT_X(csrmm_batched, testing_spmm_batched_csr);
+        DEFINE_CASE_IT_X(bellmm, testing_spmm_bell);
         DEFINE_CASE_IT_X(coosm, testing_spsm_coo);
         DEFINE_CASE_IJT_X(csrsm, testing_spsm_csr);
         DEFINE_CASE_T(gemmi);
@@ -670,6 +755,12 @@ hipsparseStatus_t hipsparse_routine::dispatch_call(const Arguments& arg)
         // Extra
         DEFINE_CASE_T(csrgeam);
         DEFINE_CASE_T(csrgemm);
+        DEFINE_CASE_IJT_X(spgemm, testing_spgemm_csr);
+        DEFINE_CASE_IJT_X(spgemm_reuse, testing_spgemmreuse_csr);
+        DEFINE_CASE_IT_X(sddmm_coo, testing_sddmm_coo);
+        DEFINE_CASE_IT_X(sddmm_coo_aos, testing_sddmm_coo_aos);
+        DEFINE_CASE_IJT_X(sddmm_csc, testing_sddmm_csc);
+        DEFINE_CASE_IJT_X(sddmm_csr, testing_sddmm_csr);
 
         // Precond
         DEFINE_CASE_T(bsric02);
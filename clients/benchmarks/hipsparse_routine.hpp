@@ -33,22 +33,35 @@ HIPSPARSE_DO_ROUTINE(gthr)          \
 HIPSPARSE_DO_ROUTINE(gthrz)         \
 HIPSPARSE_DO_ROUTINE(roti)          \
 HIPSPARSE_DO_ROUTINE(sctr)          \
+HIPSPARSE_DO_ROUTINE(spvv)          \
 HIPSPARSE_DO_ROUTINE(bsrsv2)        \
 HIPSPARSE_DO_ROUTINE(coomv)         \
+HIPSPARSE_DO_ROUTINE(coomv_aos)     \
 HIPSPARSE_DO_ROUTINE(csrmv)         \
 HIPSPARSE_DO_ROUTINE(csrsv)         \
+HIPSPARSE_DO_ROUTINE(coosv)         \
 HIPSPARSE_DO_ROUTINE(gemvi)         \
 HIPSPARSE_DO_ROUTINE(hybmv)         \
 HIPSPARSE_DO_ROUTINE(bsrmm)         \
 HIPSPARSE_DO_ROUTINE(bsrsm2)        \
 HIPSPARSE_DO_ROUTINE(coomm)         \
+HIPSPARSE_DO_ROUTINE(coomm_batched) \
 HIPSPARSE_DO_ROUTINE(cscmm)         \
+HIPSPARSE_DO_ROUTINE(cscmm_batched) \
 HIPSPARSE_DO_ROUTINE(csrmm)         \
+HIPSPARSE_DO_ROUTINE(csrmm_batched) \
+HIPSPARSE_DO_ROUTINE(bellmm)        \
 HIPSPARSE_DO_ROUTINE(coosm)         \
 HIPSPARSE_DO_ROUTINE(csrsm)         \
 HIPSPARSE_DO_ROUTINE(gemmi)         \
 HIPSPARSE_DO_ROUTINE(csrgeam)       \
 HIPSPARSE_DO_ROUTINE(csrgemm)       \
+HIPSPARSE_DO_ROUTINE(spgemm)        \
+HIPSPARSE_DO_ROUTINE(spgemm_reuse)  \
+HIPSPARSE_DO_ROUTINE(sddmm_coo)     \
+HIPSPARSE_DO_ROUTINE(sddmm_coo_aos) \
+HIPSPARSE_DO_ROUTINE(sddmm_csc)     \
+HIPSPARSE_DO_ROUTINE(sddmm_csr)     \
 HIPSPARSE_DO_ROUTINE(bsric02)       \
 HIPSPARSE_DO_ROUTINE(bsrilu02)      \
 HIPSPARSE_DO_ROUTINE(csric02)       \
@@ -3814,6 +3814,190 @@ namespace hipsparse
                                  csrRowPtrC,
                                  csrColIndC);
     }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                                hipsparseOperation_t      transA,
+                                                hipsparseOperation_t      transB,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const float*              csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const float*              csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const hipsparseMatDescr_t descrC,
+                                                float*                    csrValC,
+                                                const int*                csrRowPtrC,
+                                                int*                      csrColIndC,
+                                                csrgemmPlan_t             plan)
+    {
+        return hipsparseScsrgemmWithPlan(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         descrA,
+                                         nnzA,
+                                         csrValA,
+                                         csrRowPtrA,
+                                         csrColIndA,
+                                         descrB,
+                                         nnzB,
+                                         csrValB,
+                                         csrRowPtrB,
+                                         csrColIndB,
+                                         descrC,
+                                         csrValC,
+                                         csrRowPtrC,
+                                         csrColIndC,
+                                         plan);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                                hipsparseOperation_t      transA,
+                                                hipsparseOperation_t      transB,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const double*             csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const double*             csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const hipsparseMatDescr_t descrC,
+                                                double*                   csrValC,
+                                                const int*                csrRowPtrC,
+                                                int*                      csrColIndC,
+                                                csrgemmPlan_t             plan)
+    {
+        return hipsparseDcsrgemmWithPlan(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         descrA,
+                                         nnzA,
+                                         csrValA,
+                                         csrRowPtrA,
+                                         csrColIndA,
+                                         descrB,
+                                         nnzB,
+                                         csrValB,
+                                         csrRowPtrB,
+                                         csrColIndB,
+                                         descrC,
+                                         csrValC,
+                                         csrRowPtrC,
+                                         csrColIndC,
+                                         plan);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                                hipsparseOperation_t      transA,
+                                                hipsparseOperation_t      transB,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const hipComplex*         csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const hipComplex*         csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const hipsparseMatDescr_t descrC,
+                                                hipComplex*               csrValC,
+                                                const int*                csrRowPtrC,
+                                                int*                      csrColIndC,
+                                                csrgemmPlan_t             plan)
+    {
+        return hipsparseCcsrgemmWithPlan(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         descrA,
+                                         nnzA,
+                                         csrValA,
+                                         csrRowPtrA,
+                                         csrColIndA,
+                                         descrB,
+                                         nnzB,
+                                         csrValB,
+                                         csrRowPtrB,
+                                         csrColIndB,
+                                         descrC,
+                                         csrValC,
+                                         csrRowPtrC,
+                                         csrColIndC,
+                                         plan);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                                hipsparseOperation_t      transA,
+                                                hipsparseOperation_t      transB,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const hipDoubleComplex*   csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const hipDoubleComplex*   csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const hipsparseMatDescr_t descrC,
+                                                hipDoubleComplex*         csrValC,
+                                                const int*                csrRowPtrC,
+                                                int*                      csrColIndC,
+                                                csrgemmPlan_t             plan)
+    {
+        return hipsparseZcsrgemmWithPlan(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         descrA,
+                                         nnzA,
+                                         csrValA,
+                                         csrRowPtrA,
+                                         csrColIndA,
+                                         descrB,
+                                         nnzB,
+                                         csrValB,
+                                         csrRowPtrB,
+                                         csrColIndB,
+                                         descrC,
+                                         csrValC,
+                                         csrRowPtrC,
+                                         csrColIndC,
+                                         plan);
+    }
 #endif
 
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 12000)
@@ -7239,6 +7423,120 @@ namespace hipsparse
                                  bsrColIndC);
     }
 
+#if(!defined(CUDART_VERSION))
+    template <>
+    hipsparseStatus_t hipsparseXcsr2sell(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         int                       sliceSize,
+                                         const int*                sellSliceOffsets,
+                                         const int*                perm,
+                                         int*                      sellColInd,
+                                         float*                    sellVal)
+    {
+        return hipsparseScsr2sell(handle,
+                                  m,
+                                  n,
+                                  descrA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  sliceSize,
+                                  sellSliceOffsets,
+                                  perm,
+                                  sellColInd,
+                                  sellVal);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsr2sell(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         int                       sliceSize,
+                                         const int*                sellSliceOffsets,
+                                         const int*                perm,
+                                         int*                      sellColInd,
+                                         double*                   sellVal)
+    {
+        return hipsparseDcsr2sell(handle,
+                                  m,
+                                  n,
+                                  descrA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  sliceSize,
+                                  sellSliceOffsets,
+                                  perm,
+                                  sellColInd,
+                                  sellVal);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsr2sell(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         int                       sliceSize,
+                                         const int*                sellSliceOffsets,
+                                         const int*                perm,
+                                         int*                      sellColInd,
+                                         hipComplex*               sellVal)
+    {
+        return hipsparseCcsr2sell(handle,
+                                  m,
+                                  n,
+                                  descrA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  sliceSize,
+                                  sellSliceOffsets,
+                                  perm,
+                                  sellColInd,
+                                  sellVal);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsr2sell(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         int                       sliceSize,
+                                         const int*                sellSliceOffsets,
+                                         const int*                perm,
+                                         int*                      sellColInd,
+                                         hipDoubleComplex*         sellVal)
+    {
+        return hipsparseZcsr2sell(handle,
+                                  m,
+                                  n,
+                                  descrA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  sliceSize,
+                                  sellSliceOffsets,
+                                  perm,
+                                  sellColInd,
+                                  sellVal);
+    }
+#endif
+
     template <>
     hipsparseStatus_t hipsparseXbsr2csr(hipsparseHandle_t         handle,
                                         hipsparseDirection_t      dirA,
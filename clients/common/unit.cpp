@@ -24,9 +24,19 @@
 #include "unit.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <hip/hip_runtime_api.h>
 #include <hipsparse.h>
+#include <iomanip>
+#include <iostream>
 #include <limits>
+#include <sstream>
+#include <string.h>
+#include <type_traits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #ifdef GOOGLE_TEST
 #include <gtest/gtest.h>
@@ -43,213 +53,581 @@
 /* ========================================Gtest Unit Check
  * ==================================================== */
 
-/*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, sincer assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
-
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
+namespace
 {
-    for(int64_t j = 0; j < N; j++)
+    // Components of the compared types. unit_check_general accepts floating point components
+    // that are at most max_ulp units in the last place apart, as ASSERT_FLOAT_EQ and
+    // ASSERT_DOUBLE_EQ do, and integers that are equal.
+    template <typename T>
+    struct unit_type;
+
+    template <typename T>
+    struct unit_scalar
     {
-        for(int64_t i = 0; i < M; i++)
+        using real = T;
+
+        static constexpr int components = 1;
+        static T             component(T x, int)
         {
-#ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
+            return x;
+        }
+    };
+
+    template <>
+    struct unit_type<float> : unit_scalar<float>
+    {
+        static constexpr double rel     = 1e-3;
+        static constexpr double max_ulp = 4;
+    };
+
+    template <>
+    struct unit_type<double> : unit_scalar<double>
+    {
+        static constexpr double rel     = 1e-10;
+        static constexpr double max_ulp = 4;
+    };
+
+    template <>
+    struct unit_type<int> : unit_scalar<int>
+    {
+        static constexpr double rel     = 0;
+        static constexpr double max_ulp = 0;
+    };
+
+    template <>
+    struct unit_type<int64_t> : unit_scalar<int64_t>
+    {
+        static constexpr double rel     = 0;
+        static constexpr double max_ulp = 0;
+    };
+
+    template <>
+    struct unit_type<size_t> : unit_scalar<size_t>
+    {
+        static constexpr double rel     = 0;
+        static constexpr double max_ulp = 0;
+    };
+
+    template <>
+    struct unit_type<hipComplex>
+    {
+        using real = float;
+
+        static constexpr int    components = 2;
+        static constexpr double rel        = 1e-3;
+        static constexpr double max_ulp    = 4;
+        static float            component(hipComplex x, int c)
+        {
+            return c == 0 ? x.x : x.y;
+        }
+    };
+
+    template <>
+    struct unit_type<hipDoubleComplex>
+    {
+        using real = double;
+
+        static constexpr int    components = 2;
+        static constexpr double rel        = 1e-10;
+        static constexpr double max_ulp    = 4;
+        static double           component(hipDoubleComplex x, int c)
+        {
+            return c == 0 ? x.x : x.y;
         }
+    };
+
+    // Maps the sign and magnitude representation of a floating point number to an unsigned
+    // integer, in which adjacent numbers are adjacent integers
+    template <typename U>
+    U biased(U bits)
+    {
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        return (bits & sign) ? ~bits + 1 : sign | bits;
     }
-}
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
-{
-    for(int64_t j = 0; j < N; j++)
+    template <typename U, typename F>
+    uint64_t ulp_distance_bits(F a, F b)
     {
-        for(int64_t i = 0; i < M; i++)
+        if(std::isnan(a) || std::isnan(b))
         {
-#ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+            return std::numeric_limits<uint64_t>::max();
+        }
+
+        U ua;
+        U ub;
+        memcpy(&ua, &a, sizeof(U));
+        memcpy(&ub, &b, sizeof(U));
+
+        ua = biased(ua);
+        ub = biased(ub);
+
+        return ua > ub ? ua - ub : ub - ua;
+    }
+
+    uint64_t ulp_distance(float a, float b)
+    {
+        return ulp_distance_bits<uint32_t>(a, b);
+    }
+
+    uint64_t ulp_distance(double a, double b)
+    {
+        return ulp_distance_bits<uint64_t>(a, b);
+    }
+
+    // Integers are as many units in the last place apart as their difference
+    template <typename I>
+    uint64_t ulp_distance(I a, I b)
+    {
+        return a > b ? static_cast<uint64_t>(a - b) : static_cast<uint64_t>(b - a);
+    }
+
+    // Ordering of the offenders, worst first and then by position
+    bool unit_worse(const unit_check_offender& a, const unit_check_offender& b)
+    {
+        if(a.ratio != b.ratio)
+        {
+            return a.ratio > b.ratio;
+        }
+
+        return a.j < b.j || (a.j == b.j && a.i < b.i);
+    }
+
+    // Compares the entries of the two matrices in parallel. ratio(component, cpu, gpu, ulp)
+    // returns the error of a component relative to its tolerance, entries fail if any of their
+    // components exceeds one. Every thread keeps a heap of its worst entries, they are merged at
+    // the end. floor bounds the denominator of the relative errors from below.
+    template <typename T, typename F>
+    unit_check_report unit_compare(int64_t  M,
+                                   int64_t  N,
+                                   int64_t  lda,
+                                   const T* hCPU,
+                                   const T* hGPU,
+                                   double   floor,
+                                   int64_t  worst,
+                                   F&&      ratio)
+    {
+        using traits = unit_type<T>;
+        using real   = typename traits::real;
+
+        unit_check_report report;
+
+        int64_t  count         = M * N;
+        int64_t  failures      = 0;
+        double   max_abs_error = 0.0;
+        double   max_rel_error = 0.0;
+        double   sum_rel_error = 0.0;
+        double   sum_diff      = 0.0;
+        double   sum_cpu       = 0.0;
+        uint64_t max_ulp       = 0;
+
+        int nthreads = 1;
+#ifdef _OPENMP
+        nthreads = omp_get_max_threads();
+#endif
+
+        std::vector<std::vector<unit_check_offender>> heaps(nthreads);
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : failures, sum_rel_error, sum_diff, sum_cpu) \
+    reduction(max : max_abs_error, max_rel_error, max_ulp)
+#endif
+        {
+            int tid = 0;
+#ifdef _OPENMP
+            tid = omp_get_thread_num();
+#endif
+            std::vector<unit_check_offender>& heap = heaps[tid];
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
 #endif
+            for(int64_t k = 0; k < count; ++k)
+            {
+                int64_t i = k % M;
+                int64_t j = k / M;
+
+                T cpu = hCPU[i + j * lda];
+                T gpu = hGPU[i + j * lda];
+
+                unit_check_offender entry;
+
+                entry.i     = i;
+                entry.j     = j;
+                entry.ulp   = 0;
+                entry.ratio = 0.0;
+                entry.cpu[1] = 0.0;
+                entry.gpu[1] = 0.0;
+
+                double diff2 = 0.0;
+                double cpu2  = 0.0;
+                for(int c = 0; c < traits::components; ++c)
+                {
+                    real     x   = traits::component(cpu, c);
+                    real     y   = traits::component(gpu, c);
+                    uint64_t ulp = ulp_distance(x, y);
+                    double   r   = ratio(x, y, ulp);
+
+                    double d = static_cast<double>(x) - static_cast<double>(y);
+
+                    entry.cpu[c] = static_cast<double>(x);
+                    entry.gpu[c] = static_cast<double>(y);
+                    entry.ulp    = std::max(entry.ulp, ulp);
+                    entry.ratio  = (r > entry.ratio || std::isnan(r)) ? r : entry.ratio;
+
+                    diff2 += d * d;
+                    cpu2 += static_cast<double>(x) * static_cast<double>(x);
+                }
+
+                if(std::isnan(entry.ratio))
+                {
+                    entry.ratio = std::numeric_limits<double>::infinity();
+                }
+
+                if(std::isnan(diff2))
+                {
+                    diff2 = std::numeric_limits<double>::infinity();
+                }
+
+                entry.abs_error = std::sqrt(diff2);
+
+                double rel_error = entry.abs_error / std::max(std::sqrt(cpu2), floor);
+
+                failures += (entry.ratio > 1.0);
+                sum_rel_error += rel_error;
+                sum_diff += diff2;
+                sum_cpu += cpu2;
+                max_abs_error = std::max(max_abs_error, entry.abs_error);
+                max_rel_error = std::max(max_rel_error, rel_error);
+                max_ulp       = std::max(max_ulp, entry.ulp);
+
+                // Keep the worst entries
+                if(static_cast<int64_t>(heap.size()) < worst)
+                {
+                    heap.push_back(entry);
+                    std::push_heap(heap.begin(), heap.end(), unit_worse);
+                }
+                else if(worst > 0 && unit_worse(entry, heap.front()))
+                {
+                    std::pop_heap(heap.begin(), heap.end(), unit_worse);
+                    heap.back() = entry;
+                    std::push_heap(heap.begin(), heap.end(), unit_worse);
+                }
+            }
         }
+
+        for(const auto& heap : heaps)
+        {
+            report.worst.insert(report.worst.end(), heap.begin(), heap.end());
+        }
+
+        std::sort(report.worst.begin(), report.worst.end(), unit_worse);
+        if(static_cast<int64_t>(report.worst.size()) > worst)
+        {
+            report.worst.resize(worst);
+        }
+
+        report.count          = count;
+        report.failures       = failures;
+        report.max_abs_error  = max_abs_error;
+        report.max_rel_error  = max_rel_error;
+        report.mean_rel_error = count > 0 ? sum_rel_error / count : 0.0;
+        report.norm_error     = sum_cpu > 0.0 ? std::sqrt(sum_diff / sum_cpu)
+                                : sum_diff > 0.0 ? std::numeric_limits<double>::infinity()
+                                                 : 0.0;
+        report.max_ulp        = max_ulp;
+
+        return report;
     }
-}
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
-{
-    for(int64_t j = 0; j < N; j++)
+    // Relative and absolute tolerance of unit_check_near
+    template <typename T>
+    void unit_near_tolerance(const unit_check_tolerance& tol, double& rel, double& abs)
     {
-        for(int64_t i = 0; i < M; i++)
+        using real = typename unit_type<T>::real;
+
+        double eps = std::numeric_limits<real>::epsilon();
+
+        rel = tol.rel < 0.0 ? unit_type<T>::rel : tol.rel;
+        abs = tol.abs < 0.0 ? 10 * eps : tol.abs;
+        rel = std::max(rel,
+                       static_cast<double>(std::max(tol.row_length, int64_t(1)))
+                           * std::max(tol.condition, 1.0) * eps);
+    }
+
+    // Reports a comparison that failed
+    void unit_report_failure(const char*              check,
+                             const unit_check_report& r,
+                             int                      components,
+                             const char*              criterion)
+    {
+        std::ostringstream msg;
+
+        msg << std::setprecision(17) << check << ": " << r.failures << " of " << r.count
+            << " entries are out of tolerance (" << criterion << ")\n"
+            << "  max abs error " << std::setprecision(3) << r.max_abs_error
+            << ", max rel error " << r.max_rel_error << ", mean rel error " << r.mean_rel_error
+            << ", norm-wise error " << r.norm_error << ", max ulp " << r.max_ulp << "\n"
+            << "  worst entries (row, column): expected, result, abs error, ulp\n"
+            << std::setprecision(17);
+
+        for(const auto& e : r.worst)
         {
+            if(e.ratio <= 1.0)
+            {
+                break;
+            }
+
+            msg << "    (" << e.i << ", " << e.j << "): ";
+            if(components == 2)
+            {
+                msg << "(" << e.cpu[0] << ", " << e.cpu[1] << "), (" << e.gpu[0] << ", "
+                    << e.gpu[1] << ")";
+            }
+            else
+            {
+                msg << e.cpu[0] << ", " << e.gpu[0];
+            }
+            msg << ", " << std::setprecision(3) << e.abs_error << ", " << e.ulp << "\n"
+                << std::setprecision(17);
+        }
+
 #ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
+        ADD_FAILURE() << msg.str();
 #else
-            assert(hCPU[i + j * lda].x == hGPU[i + j * lda].x);
-            assert(hCPU[i + j * lda].y == hGPU[i + j * lda].y);
+        std::cerr << msg.str() << std::flush;
+        assert(r.failures == 0);
 #endif
+    }
+
+    template <typename T>
+    void unit_check_general_impl(int64_t M, int64_t N, int64_t lda, const T* hCPU, const T* hGPU)
+    {
+        using real = typename unit_type<T>::real;
+
+        constexpr double max_ulp = unit_type<T>::max_ulp;
+
+        unit_check_report r = unit_compare(M,
+                                           N,
+                                           lda,
+                                           hCPU,
+                                           hGPU,
+                                           std::is_integral<real>::value
+                                               ? 1.0
+                                               : std::numeric_limits<real>::min(),
+                                           10,
+                                           [](real, real, uint64_t ulp) {
+                                               return ulp <= max_ulp
+                                                          ? 0.0
+                                                          : std::numeric_limits<double>::infinity();
+                                           });
+
+        if(r.failures != 0)
+        {
+            std::ostringstream criterion;
+            criterion << "max ulp " << max_ulp;
+            unit_report_failure(
+                "unit_check_general", r, unit_type<T>::components, criterion.str().c_str());
+        }
+    }
+
+    template <typename T>
+    unit_check_report unit_check_near_compare(int64_t                     M,
+                                              int64_t                     N,
+                                              int64_t                     lda,
+                                              const T*                    hCPU,
+                                              const T*                    hGPU,
+                                              const unit_check_tolerance& tol,
+                                              int64_t                     worst,
+                                              double&                     rel,
+                                              double&                     abs)
+    {
+        using real = typename unit_type<T>::real;
+
+        unit_near_tolerance<T>(tol, rel, abs);
+
+        // Tolerances are evaluated in the precision of the data, as ASSERT_NEAR was called with
+        real rel_t = static_cast<real>(rel);
+        real abs_t = static_cast<real>(abs);
+
+        return unit_compare(M, N, lda, hCPU, hGPU, abs, worst, [=](real x, real y, uint64_t) {
+            double t = std::max(std::abs(x * rel_t), abs_t);
+            double d = std::abs(static_cast<double>(x) - static_cast<double>(y));
+
+            if(d <= t)
+            {
+                return t > 0.0 ? d / t : 0.0;
+            }
+
+            return t > 0.0 && !std::isnan(d) ? d / t : std::numeric_limits<double>::infinity();
+        });
+    }
+
+    template <typename T>
+    void unit_check_near_impl(int64_t                     M,
+                              int64_t                     N,
+                              int64_t                     lda,
+                              const T*                    hCPU,
+                              const T*                    hGPU,
+                              const unit_check_tolerance& tol)
+    {
+        double rel;
+        double abs;
+
+        unit_check_report r = unit_check_near_compare(M, N, lda, hCPU, hGPU, tol, 10, rel, abs);
+
+        if(r.failures != 0)
+        {
+            std::ostringstream criterion;
+            criterion << std::setprecision(3) << "rel " << rel << ", abs " << abs;
+            unit_report_failure(
+                "unit_check_near", r, unit_type<T>::components, criterion.str().c_str());
         }
     }
 }
 
+template <typename T>
+unit_check_report unit_check_compare(int64_t                     M,
+                                     int64_t                     N,
+                                     int64_t                     lda,
+                                     const T*                    hCPU,
+                                     const T*                    hGPU,
+                                     const unit_check_tolerance& tol,
+                                     int64_t                     worst)
+{
+    double rel;
+    double abs;
+    return unit_check_near_compare(M, N, lda, hCPU, hGPU, tol, worst, rel, abs);
+}
+
+#define INSTANTIATE(T)                                                                     \
+    template unit_check_report unit_check_compare(int64_t                     M,           \
+                                                  int64_t                     N,           \
+                                                  int64_t                     lda,         \
+                                                  const T*                    hCPU,        \
+                                                  const T*                    hGPU,        \
+                                                  const unit_check_tolerance& tol,         \
+                                                  int64_t                     worst)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(hipComplex);
+INSTANTIATE(hipDoubleComplex);
+#undef INSTANTIATE
+
+/*! \brief Template: gtest unit compare two matrices float/double/complex. The entries are
+ *  compared in parallel and all entries out of tolerance are reported, with the worst ones. */
+
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
+{
+    unit_check_general_impl(M, N, lda, hCPU, hGPU);
+}
+
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
+{
+    unit_check_general_impl(M, N, lda, hCPU, hGPU);
+}
+
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
+{
+    unit_check_general_impl(M, N, lda, hCPU, hGPU);
+}
+
 template <>
 void unit_check_general(
     int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
-#else
-            assert(hCPU[i + j * lda].x == hGPU[i + j * lda].x);
-            assert(hCPU[i + j * lda].y == hGPU[i + j * lda].y);
-#endif
-        }
-    }
+    unit_check_general_impl(M, N, lda, hCPU, hGPU);
 }
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, int* hCPU, int* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
-        }
-    }
+    unit_check_general_impl(M, N, lda, hCPU, hGPU);
 }
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, int64_t* hCPU, int64_t* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
-        }
-    }
+    unit_check_general_impl(M, N, lda, hCPU, hGPU);
 }
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, size_t* hCPU, size_t* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
-        }
-    }
+    unit_check_general_impl(M, N, lda, hCPU, hGPU);
 }
 
-/*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, since assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+/*! \brief Template: gtest unit compare two matrices float/double/complex within the tolerance
+ *  of unit_check_tolerance. */
 
 template <>
 void unit_check_near(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-            float compare_val = std::max(std::abs(hCPU[i + j * lda] * 1e-3f),
-                                         10 * std::numeric_limits<float>::epsilon());
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
-#else
-            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
-#endif
-        }
-    }
+    unit_check_near_impl(M, N, lda, hCPU, hGPU, unit_check_tolerance());
 }
 
 template <>
 void unit_check_near(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-            double compare_val = std::max(std::abs(hCPU[i + j * lda] * 1e-10),
-                                          10 * std::numeric_limits<double>::epsilon());
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
-#else
-            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
-#endif
-        }
-    }
+    unit_check_near_impl(M, N, lda, hCPU, hGPU, unit_check_tolerance());
 }
 
 template <>
 void unit_check_near(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-            hipComplex compare_val
-                = make_hipFloatComplex(std::max(std::abs(hCPU[i + j * lda].x * 1e-3f),
-                                                10 * std::numeric_limits<float>::epsilon()),
-                                       std::max(std::abs(hCPU[i + j * lda].y * 1e-3f),
-                                                10 * std::numeric_limits<float>::epsilon()));
-
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val.x);
-            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val.y);
-#else
-            assert(std::abs(hCPU[i + j * lda].x - hGPU[i + j * lda].x) < compare_val.x);
-            assert(std::abs(hCPU[i + j * lda].y - hGPU[i + j * lda].y) < compare_val.y);
-#endif
-        }
-    }
+    unit_check_near_impl(M, N, lda, hCPU, hGPU, unit_check_tolerance());
 }
 
 template <>
 void unit_check_near(
     int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-            hipDoubleComplex compare_val
-                = make_hipDoubleComplex(std::max(std::abs(hCPU[i + j * lda].x * 1e-10),
-                                                 10 * std::numeric_limits<double>::epsilon()),
-                                        std::max(std::abs(hCPU[i + j * lda].y * 1e-10),
-                                                 10 * std::numeric_limits<double>::epsilon()));
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val.x);
-            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val.y);
-#else
-            assert(std::abs(hCPU[i + j * lda].x - hGPU[i + j * lda].x) < compare_val.x);
-            assert(std::abs(hCPU[i + j * lda].y - hGPU[i + j * lda].y) < compare_val.y);
-#endif
-        }
-    }
+    unit_check_near_impl(M, N, lda, hCPU, hGPU, unit_check_tolerance());
+}
+
+template <>
+void unit_check_near(int64_t                     M,
+                     int64_t                     N,
+                     int64_t                     lda,
+                     float*                      hCPU,
+                     float*                      hGPU,
+                     const unit_check_tolerance& tol)
+{
+    unit_check_near_impl(M, N, lda, hCPU, hGPU, tol);
+}
+
+template <>
+void unit_check_near(int64_t                     M,
+                     int64_t                     N,
+                     int64_t                     lda,
+                     double*                     hCPU,
+                     double*                     hGPU,
+                     const unit_check_tolerance& tol)
+{
+    unit_check_near_impl(M, N, lda, hCPU, hGPU, tol);
+}
+
+template <>
+void unit_check_near(int64_t                     M,
+                     int64_t                     N,
+                     int64_t                     lda,
+                     hipComplex*                 hCPU,
+                     hipComplex*                 hGPU,
+                     const unit_check_tolerance& tol)
+{
+    unit_check_near_impl(M, N, lda, hCPU, hGPU, tol);
+}
+
+template <>
+void unit_check_near(int64_t                     M,
+                     int64_t                     N,
+                     int64_t                     lda,
+                     hipDoubleComplex*           hCPU,
+                     hipDoubleComplex*           hGPU,
+                     const unit_check_tolerance& tol)
+{
+    unit_check_near_impl(M, N, lda, hCPU, hGPU, tol);
 }
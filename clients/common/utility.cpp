@@ -27,7 +27,9 @@
 #endif
 #include "utility.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdlib>
 
 #ifdef WIN32
@@ -235,3 +237,106 @@ double get_time_us_sync(hipStream_t stream)
 #ifdef __cplusplus
 }
 #endif
+
+hipsparse_timing_stats hipsparse_compute_timing_stats(std::vector<double> samples_us, int warmup)
+{
+    hipsparse_timing_stats stats;
+    stats.warmup = warmup;
+    stats.iters  = static_cast<int>(samples_us.size());
+
+    if(samples_us.empty())
+    {
+        return stats;
+    }
+
+    std::sort(samples_us.begin(), samples_us.end());
+
+    // Nearest rank percentile
+    auto percentile = [&](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p * samples_us.size()));
+        return samples_us[std::min(std::max(rank, size_t(1)), samples_us.size()) - 1];
+    };
+
+    size_t n   = samples_us.size();
+    double sum = 0.0;
+    for(double t : samples_us)
+    {
+        sum += t;
+    }
+
+    stats.min_us = samples_us[0];
+    stats.median_us
+        = (n % 2) ? samples_us[n / 2] : 0.5 * (samples_us[n / 2 - 1] + samples_us[n / 2]);
+    stats.mean_us = sum / n;
+    stats.p90_us    = percentile(0.90);
+    stats.p99_us    = percentile(0.99);
+
+    double var = 0.0;
+    for(double t : samples_us)
+    {
+        var += (t - stats.mean_us) * (t - stats.mean_us);
+    }
+
+    stats.stddev_us = (n > 1) ? std::sqrt(var / (n - 1)) : 0.0;
+    stats.unstable
+        = (stats.stddev_us > 0.1 * stats.mean_us) || (stats.p90_us > 1.25 * stats.median_us);
+
+    return stats;
+}
+
+hipsparse_timing_stats& hipsparse_last_timing_stats()
+{
+    static hipsparse_timing_stats stats;
+    return stats;
+}
+
+hipsparse_event_timer::hipsparse_event_timer(hipsparseHandle_t handle, int iters, int warmup)
+    : m_warmup(warmup)
+    , m_start(std::max(iters, 0))
+    , m_stop(std::max(iters, 0))
+{
+    hipsparseGetStream(handle, &m_stream);
+
+    for(size_t i = 0; i < m_start.size(); ++i)
+    {
+        CHECK_HIP_ERROR(hipEventCreate(&m_start[i]));
+        CHECK_HIP_ERROR(hipEventCreate(&m_stop[i]));
+    }
+}
+
+hipsparse_event_timer::~hipsparse_event_timer()
+{
+    for(size_t i = 0; i < m_start.size(); ++i)
+    {
+        hipEventDestroy(m_start[i]);
+        hipEventDestroy(m_stop[i]);
+    }
+}
+
+void hipsparse_event_timer::start(int iter)
+{
+    CHECK_HIP_ERROR(hipEventRecord(m_start[iter], m_stream));
+}
+
+void hipsparse_event_timer::stop(int iter)
+{
+    CHECK_HIP_ERROR(hipEventRecord(m_stop[iter], m_stream));
+}
+
+double hipsparse_event_timer::finish()
+{
+    std::vector<double> samples_us(m_start.size());
+
+    for(size_t i = 0; i < m_start.size(); ++i)
+    {
+        float msec;
+        CHECK_HIP_ERROR(hipEventSynchronize(m_stop[i]));
+        CHECK_HIP_ERROR(hipEventElapsedTime(&msec, m_start[i], m_stop[i]));
+
+        samples_us[i] = 1e3 * msec;
+    }
+
+    hipsparse_last_timing_stats() = hipsparse_compute_timing_stats(samples_us, m_warmup);
+
+    return hipsparse_last_timing_stats().median_us;
+}
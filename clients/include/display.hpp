@@ -47,6 +47,7 @@ static constexpr const char* s_analysis_timing_info_time = "analysis msec";
 
 hipsparseStatus_t hipsparse_record_output_legend(const std::string& s);
 hipsparseStatus_t hipsparse_record_output(const std::string& s);
+hipsparseStatus_t hipsparse_record_output_field(const char* name, const std::string& value);
 hipsparseStatus_t hipsparse_record_timing(double msec, double gflops, double gbs);
 bool              display_timing_info_is_stdout_disabled();
 
@@ -95,6 +96,7 @@ struct display_key_t
         ell_width,
         ell_nnz,
         coo_nnz,
+        sell_size,
         nnz,
         nnzA,
         nnzB,
@@ -109,6 +111,8 @@ struct display_key_t
         col_block_dim,
         col_block_dimA,
         col_block_dimC,
+        slice_size,
+        sigma,
         batch_count,
         batch_countA,
         batch_countB,
@@ -235,6 +239,10 @@ struct display_key_t
         {
             return "coo_nnz";
         }
+        case sell_size:
+        {
+            return "sell_size";
+        }
         case nnz:
         {
             return "nnz";
@@ -291,6 +299,14 @@ struct display_key_t
         {
             return "col_block_dimC";
         }
+        case slice_size:
+        {
+            return "slice_size";
+        }
+        case sigma:
+        {
+            return "sigma";
+        }
         case batch_count:
         {
             return "batch_count";
@@ -482,6 +498,35 @@ inline void display_timing_info_values_noresults(std::ostream& out, int n, S nam
     display_timing_info_values_noresults(out, n, ts...);
 }
 
+//
+// Record every displayed (name, value) pair but the results.
+//
+template <typename S, typename T>
+inline void display_timing_info_record_field(S name_, T t)
+{
+    const char* name = display_to_string(name_);
+    if(strcmp(name, s_timing_info_perf) && strcmp(name, s_timing_info_bandwidth)
+       && strcmp(name, s_timing_info_time))
+    {
+        std::ostringstream out;
+        out << t;
+        hipsparse_record_output_field(name, out.str());
+    }
+}
+
+template <typename S, typename T, typename... Ts>
+inline void display_timing_info_record_fields(S name, T t)
+{
+    display_timing_info_record_field(name, t);
+}
+
+template <typename S, typename T, typename... Ts>
+inline void display_timing_info_record_fields(S name, T t, Ts... ts)
+{
+    display_timing_info_record_field(name, t);
+    display_timing_info_record_fields(ts...);
+}
+
 template <typename T>
 inline void grab_results(double values[3], display_key_t::key_t key, T t)
 {
@@ -612,6 +657,8 @@ inline void display_timing_info_main(S name, Ts... ts)
         }
     }
 
+    display_timing_info_record_fields(name, ts...);
+
     std::ostringstream out;
     out.precision(2);
     out.setf(std::ios::fixed);
@@ -663,26 +710,75 @@ inline void hipsparse_get_matrixname(const char* f, char* name)
     name[ddir - cdir] = '\0';
 }
 
-#define display_timing_info(...)                                                \
-    do                                                                          \
-    {                                                                           \
-        const char* ctypename = hipsparse_datatype2string(argus.compute_type);  \
-        const char* itypename = hipsparse_indextype2string(argus.index_type_I); \
-        const char* jtypename = hipsparse_indextype2string(argus.index_type_J); \
-                                                                                \
-        display_timing_info_main(__VA_ARGS__,                                   \
-                                 display_key_t::iters,                          \
-                                 argus.iters,                                   \
-                                 "verified",                                    \
-                                 (argus.unit_check ? "yes" : "no"),             \
-                                 display_key_t::function,                       \
-                                 &argus.function_name[0],                       \
-                                 display_key_t::ctype,                          \
-                                 ctypename,                                     \
-                                 display_key_t::itype,                          \
-                                 itypename,                                     \
-                                 display_key_t::jtype,                          \
-                                 jtypename);                                    \
+//
+// Statistics of the last hipsparse_event_timer run are appended when available.
+//
+#define display_timing_info(...)                                                        \
+    do                                                                                  \
+    {                                                                                   \
+        const char* ctypename = hipsparse_datatype2string(argus.compute_type);          \
+        const char* itypename = hipsparse_indextype2string(argus.index_type_I);         \
+        const char* jtypename = hipsparse_indextype2string(argus.index_type_J);         \
+                                                                                        \
+        hipsparse_timing_stats& timing_stats = hipsparse_last_timing_stats();           \
+                                                                                        \
+        if(timing_stats.iters > 0)                                                      \
+        {                                                                               \
+            display_timing_info_main(__VA_ARGS__,                                       \
+                                     display_key_t::iters,                              \
+                                     argus.iters,                                       \
+                                     "warmup",                                          \
+                                     timing_stats.warmup,                               \
+                                     "min usec",                                        \
+                                     timing_stats.min_us,                               \
+                                     "median usec",                                     \
+                                     timing_stats.median_us,                            \
+                                     "mean usec",                                       \
+                                     timing_stats.mean_us,                              \
+                                     "p90 usec",                                        \
+                                     timing_stats.p90_us,                               \
+                                     "p99 usec",                                        \
+                                     timing_stats.p99_us,                               \
+                                     "stddev usec",                                     \
+                                     timing_stats.stddev_us,                            \
+                                     "stable",                                          \
+                                     (timing_stats.unstable ? "no" : "yes"),            \
+                                     "verified",                                        \
+                                     (argus.unit_check ? "yes" : "no"),                 \
+                                     display_key_t::function,                           \
+                                     &argus.function_name[0],                           \
+                                     display_key_t::ctype,                              \
+                                     ctypename,                                         \
+                                     display_key_t::itype,                              \
+                                     itypename,                                         \
+                                     display_key_t::jtype,                              \
+                                     jtypename);                                        \
+                                                                                        \
+            if(timing_stats.unstable)                                                   \
+            {                                                                           \
+                std::cerr << "# warning: unstable timing for " << argus.function_name   \
+                          << ", increase --iters or check for other device activity"    \
+                          << std::endl;                                                 \
+            }                                                                           \
+        }                                                                               \
+        else                                                                            \
+        {                                                                               \
+            display_timing_info_main(__VA_ARGS__,                                       \
+                                     display_key_t::iters,                              \
+                                     argus.iters,                                       \
+                                     "verified",                                        \
+                                     (argus.unit_check ? "yes" : "no"),                 \
+                                     display_key_t::function,                           \
+                                     &argus.function_name[0],                           \
+                                     display_key_t::ctype,                              \
+                                     ctypename,                                         \
+                                     display_key_t::itype,                              \
+                                     itypename,                                         \
+                                     display_key_t::jtype,                              \
+                                     jtypename);                                        \
+        }                                                                               \
+                                                                                        \
+        timing_stats = hipsparse_timing_stats();                                        \
     } while(false)
 
 #endif // DISPLAY_HPP
@@ -109,6 +109,17 @@ constexpr double bsrmv_gbyte_count(J mb, J nb, I nnzb, J block_dim, bool beta =
     return bsrmv_gbyte_count<T, T, T>(mb, nb, nnzb, block_dim, beta);
 }
 
+template <typename T, typename I, typename J>
+constexpr double gebsrmv_gbyte_count(
+    J mb, J nb, I nnzb, J row_block_dim, J col_block_dim, bool beta = false)
+{
+    return (sizeof(I) * (mb + 1) + sizeof(J) * nnzb
+            + sizeof(T) * nnzb * row_block_dim * col_block_dim
+            + sizeof(T) * (mb * row_block_dim + (beta ? mb * row_block_dim : 0))
+            + sizeof(T) * (nb * col_block_dim))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double bsrsv_gbyte_count(int mb, int nnzb, int bsr_dim)
 {
@@ -156,6 +167,15 @@ constexpr double csrmv_gbyte_count(J M, J N, I nnz, bool beta = false)
     return csrmv_gbyte_count<T, T, T>(M, N, nnz, beta);
 }
 
+// Padded entries of the sliced ELL matrix are read as well
+template <typename T, typename I>
+constexpr double sellmv_gbyte_count(I M, I N, I nslices, int64_t sell_size, bool beta = false)
+{
+    return (sizeof(I) * (nslices + 1 + sell_size) + sizeof(T) * sell_size
+            + sizeof(T) * (M + (beta ? M : 0) + N))
+           / 1e9;
+}
+
 template <typename T, typename I>
 constexpr double gemvi_gbyte_count(I m, I nnz, bool beta = false)
 {
@@ -181,6 +201,55 @@ constexpr double
     return (reads + writes) / 1e9;
 }
 
+template <typename T>
+constexpr double gebsrmm_gbyte_count(int  Mb,
+                                     int  nnzb,
+                                     int  row_block_dim,
+                                     int  col_block_dim,
+                                     int  nnz_B,
+                                     int  nnz_C,
+                                     bool beta = false)
+{
+    //reads
+    size_t reads = (Mb + 1 + nnzb) * sizeof(int)
+                   + (row_block_dim * col_block_dim * nnzb + nnz_B + (beta ? nnz_C : 0))
+                         * sizeof(T);
+
+    //writes
+    size_t writes = nnz_C * sizeof(T);
+
+    return (reads + writes) / 1e9;
+}
+
+template <typename T, typename I>
+constexpr double
+    bellmm_gbyte_count(int64_t Mb, I ell_blocks, I block_dim, I nnz_B, I nnz_C, bool beta = false)
+{
+    //reads
+    size_t reads = Mb * ell_blocks * sizeof(I)
+                   + (Mb * ell_blocks * block_dim * block_dim + nnz_B + (beta ? nnz_C : 0))
+                         * sizeof(T);
+
+    //writes
+    size_t writes = nnz_C * sizeof(T);
+
+    return (reads + writes) / 1e9;
+}
+
+template <typename T, typename I>
+constexpr double
+    sellmm_gbyte_count(I nslices, int64_t sell_size, I nnz_B, I nnz_C, bool beta = false)
+{
+    //reads
+    size_t reads = (nslices + 1 + sell_size) * sizeof(I)
+                   + (sell_size + nnz_B + (beta ? nnz_C : 0)) * sizeof(T);
+
+    //writes
+    size_t writes = nnz_C * sizeof(T);
+
+    return (reads + writes) / 1e9;
+}
+
 template <typename T, typename I, typename J>
 constexpr double csrmm_gbyte_count(J M, I nnz_A, I nnz_B, I nnz_C, bool beta = false)
 {
@@ -621,6 +621,29 @@ namespace hipsparse
                                         T*                        csrValC,
                                         const int*                csrRowPtrC,
                                         int*                      csrColIndC);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                                hipsparseOperation_t      transA,
+                                                hipsparseOperation_t      transB,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const T*                  csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const T*                  csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const hipsparseMatDescr_t descrC,
+                                                T*                        csrValC,
+                                                const int*                csrRowPtrC,
+                                                int*                      csrColIndC,
+                                                csrgemmPlan_t             plan);
 #endif
 
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 12000)
@@ -1197,6 +1220,22 @@ namespace hipsparse
                                         int*                      bsrRowPtrC,
                                         int*                      bsrColIndC);
 
+#if(!defined(CUDART_VERSION))
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsr2sell(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         const hipsparseMatDescr_t descrA,
+                                         const T*                  csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         int                       sliceSize,
+                                         const int*                sellSliceOffsets,
+                                         const int*                perm,
+                                         int*                      sellColInd,
+                                         T*                        sellVal);
+#endif
+
     template <typename T>
     hipsparseStatus_t hipsparseXbsr2csr(hipsparseHandle_t         handle,
                                         hipsparseDirection_t      dirA,
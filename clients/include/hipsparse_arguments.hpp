@@ -79,11 +79,12 @@ struct Arguments
     hipsparseIndexBase_t baseC;
     hipsparseIndexBase_t baseD;
 
-    hipsparseAction_t       action;
-    hipsparseHybPartition_t part;
-    hipsparseDiagType_t     diag_type;
-    hipsparseFillMode_t     fill_mode;
-    hipsparseSolvePolicy_t  solve_policy;
+    hipsparseAction_t          action;
+    hipsparseHybPartition_t    part;
+    hipsparseDiagType_t        diag_type;
+    hipsparseFillMode_t        fill_mode;
+    hipsparseSolvePolicy_t     solve_policy;
+    hipsparseExecutionPolicy_t execution_policy;
 
     hipsparseDirection_t dirA;
     hipsparseOrder_t     orderA;
@@ -97,6 +98,7 @@ struct Arguments
     int sparse2dense_alg;
     int sddmm_alg;
     int spgemm_alg;
+    int spgemm_mode;
     int spmm_alg;
     int spmv_alg;
     int spsm_alg;
@@ -109,11 +111,13 @@ struct Arguments
 
     int ell_width;
     int permute;
+    int sigma;
     int gtsv_alg;
     int gpsv_alg;
 
     int unit_check;
     int timing;
+    int warmup;
     int iters;
 
     std::string filename;
@@ -155,11 +159,12 @@ struct Arguments
         this->baseC  = HIPSPARSE_INDEX_BASE_ZERO;
         this->baseD  = HIPSPARSE_INDEX_BASE_ZERO;
 
-        this->action       = HIPSPARSE_ACTION_NUMERIC;
-        this->part         = HIPSPARSE_HYB_PARTITION_AUTO;
-        this->diag_type    = HIPSPARSE_DIAG_TYPE_NON_UNIT;
-        this->fill_mode    = HIPSPARSE_FILL_MODE_LOWER;
-        this->solve_policy = HIPSPARSE_SOLVE_POLICY_NO_LEVEL;
+        this->action           = HIPSPARSE_ACTION_NUMERIC;
+        this->part             = HIPSPARSE_HYB_PARTITION_AUTO;
+        this->diag_type        = HIPSPARSE_DIAG_TYPE_NON_UNIT;
+        this->fill_mode        = HIPSPARSE_FILL_MODE_LOWER;
+        this->solve_policy     = HIPSPARSE_SOLVE_POLICY_NO_LEVEL;
+        this->execution_policy = HIPSPARSE_EXECUTION_POLICY_BLOCKING;
 
         this->dirA    = HIPSPARSE_DIRECTION_ROW;
         this->orderA  = HIPSPARSE_ORDER_COL;
@@ -173,6 +178,7 @@ struct Arguments
         this->sparse2dense_alg = sparse2dense_alg_support::get_default_algorithm();
         this->sddmm_alg        = sddmm_alg_support::get_default_algorithm();
         this->spgemm_alg       = spgemm_alg_support::get_default_algorithm();
+        this->spgemm_mode      = HIPSPARSE_SPGEMM_MODE_DEFAULT;
         this->spmm_alg         = spmm_alg_support::get_default_algorithm();
         this->spmv_alg         = spmv_alg_support::get_default_algorithm();
         this->spsm_alg         = spsm_alg_support::get_default_algorithm();
@@ -185,11 +191,13 @@ struct Arguments
 
         this->ell_width = 0;
         this->permute   = 0;
+        this->sigma     = 1;
         this->gtsv_alg  = 0;
         this->gpsv_alg  = 0;
 
         this->unit_check = 1;
         this->timing     = 0;
+        this->warmup     = 2;
         this->iters      = 10;
 
         this->filename      = "";
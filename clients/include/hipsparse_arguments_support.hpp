@@ -86,6 +86,24 @@ static void print_cuda_10_0_0_to_11_8_0_support_string()
     std::cout << table << std::endl;
 }
 
+static void print_cuda_11_0_0_to_12_5_1_support_string()
+{
+    std::cout << "Warning: You are using CUDA version: " << TOSTRING(CUDART_VERSION)
+              << " but this routine is not supported. See CUDA support table for this"
+              << " routine below: " << std::endl;
+    std::string table = "                      CUDA Version                    \n"
+                        "|10.1.2|10.2.0|11.0.1|11.0.2|...|12.4.1|12.5.0|12.5.1|\n"
+                        "              |<--------------supported------------->|  ";
+    std::cout << table << std::endl;
+}
+
+static void print_cuda_not_supported_string()
+{
+    std::cout << "Warning: You are using CUDA version: " << TOSTRING(CUDART_VERSION)
+              << " but this routine is only available with the rocSPARSE backend."
+              << std::endl;
+}
+
 static void print_cuda_10_0_0_to_10_2_0_support_string()
 {
     std::cout << "Warning: You are using CUDA version: " << TOSTRING(CUDART_VERSION)
@@ -160,6 +178,15 @@ struct routine_support
         return false;
 #endif
     }
+    static bool is_spvv_supported()
+    {
+#if(!defined(CUDART_VERSION) || CUDART_VERSION > 10010 \
+    || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
+        return true;
+#else
+        return false;
+#endif
+    }
 
     // Level2
     static bool is_bsrsv2_supported()
@@ -177,6 +204,14 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_coomv_aos_supported()
+    {
+#if(!defined(CUDART_VERSION) || (CUDART_VERSION >= 10010 && CUDART_VERSION < 12000))
+        return true;
+#else
+        return false;
 #endif
     }
     static bool is_csrmv_supported()
@@ -194,6 +229,14 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_coosv_supported()
+    {
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11030)
+        return true;
+#else
+        return false;
 #endif
     }
     static bool is_gemvi_supported()
@@ -236,6 +279,14 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_coomm_batched_supported()
+    {
+#if(!defined(CUDART_VERSION))
+        return true;
+#else
+        return false;
 #endif
     }
     static bool is_cscmm_supported()
@@ -244,6 +295,14 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_cscmm_batched_supported()
+    {
+#if(!defined(CUDART_VERSION))
+        return true;
+#else
+        return false;
 #endif
     }
     static bool is_csrmm_supported()
@@ -252,6 +311,22 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_csrmm_batched_supported()
+    {
+#if(!defined(CUDART_VERSION))
+        return true;
+#else
+        return false;
+#endif
+    }
+    static bool is_bellmm_supported()
+    {
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+        return true;
+#else
+        return false;
 #endif
     }
     static bool is_coosm_supported()
@@ -293,6 +368,54 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_spgemm_supported()
+    {
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+        return true;
+#else
+        return false;
+#endif
+    }
+    static bool is_spgemm_reuse_supported()
+    {
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+        return true;
+#else
+        return false;
+#endif
+    }
+    static bool is_sddmm_coo_supported()
+    {
+#if(!defined(CUDART_VERSION))
+        return true;
+#else
+        return false;
+#endif
+    }
+    static bool is_sddmm_coo_aos_supported()
+    {
+#if(!defined(CUDART_VERSION))
+        return true;
+#else
+        return false;
+#endif
+    }
+    static bool is_sddmm_csc_supported()
+    {
+#if(!defined(CUDART_VERSION))
+        return true;
+#else
+        return false;
+#endif
+    }
+    static bool is_sddmm_csr_supported()
+    {
+#if(!defined(CUDART_VERSION))
+        return true;
+#else
+        return false;
 #endif
     }
     // Precond
@@ -463,6 +586,12 @@ struct routine_support
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_11_8_0_support_string();
+#endif
+    }
+    static void print_spvv_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_10_0_0_to_12_5_1_support_string();
 #endif
     }
     // Level 2
@@ -476,6 +605,12 @@ struct routine_support
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_12_5_1_support_string();
+#endif
+    }
+    static void print_coomv_aos_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_10_0_0_to_11_8_0_support_string();
 #endif
     }
     static void print_csrmv_support_warning()
@@ -488,6 +623,12 @@ struct routine_support
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_11_8_0_support_string();
+#endif
+    }
+    static void print_coosv_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_11_3_1_to_12_5_1_support_string();
 #endif
     }
     static void print_gemvi_support_warning()
@@ -519,18 +660,42 @@ struct routine_support
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_12_5_1_support_string();
+#endif
+    }
+    static void print_coomm_batched_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_not_supported_string();
 #endif
     }
     static void print_cscmm_support_warning()
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_12_5_1_support_string();
+#endif
+    }
+    static void print_cscmm_batched_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_not_supported_string();
 #endif
     }
     static void print_csrmm_support_warning()
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_12_5_1_support_string();
+#endif
+    }
+    static void print_csrmm_batched_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_not_supported_string();
+#endif
+    }
+    static void print_bellmm_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_11_2_0_to_12_5_1_support_string();
 #endif
     }
     static void print_coosm_support_warning()
@@ -562,6 +727,42 @@ struct routine_support
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_10_2_0_support_string();
+#endif
+    }
+    static void print_spgemm_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_11_0_0_to_12_5_1_support_string();
+#endif
+    }
+    static void print_spgemm_reuse_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_11_3_1_to_12_5_1_support_string();
+#endif
+    }
+    static void print_sddmm_coo_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_not_supported_string();
+#endif
+    }
+    static void print_sddmm_coo_aos_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_not_supported_string();
+#endif
+    }
+    static void print_sddmm_csc_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_not_supported_string();
+#endif
+    }
+    static void print_sddmm_csr_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_not_supported_string();
 #endif
     }
     // Precond
@@ -961,14 +1162,14 @@ struct spmv_alg_support
     {
 #if(!defined(CUDART_VERSION))
         return "Indicates what algorithm to use when running spmv. Possible choices are default: "
-               "0, COO Alg1: 1, CSR Alg1: 2, CSR Alg2: 3, COO Alg2: 4 (default:0)";
+               "0, COO Alg1: 1, CSR Alg1: 2, CSR Alg2: 3, COO Alg2: 4, Auto: 5 (default:0)";
 #else
 #if(CUDART_VERSION >= 12000)
         return "Indicates what algorithm to use when running spmv. Possible choices are default: "
-               "0, COO Alg1: 1, CSR Alg1: 2, CSR Alg2: 3, COO Alg2: 4 (default:0)";
+               "0, COO Alg1: 1, CSR Alg1: 2, CSR Alg2: 3, COO Alg2: 4, Auto: 5 (default:0)";
 #elif(CUDART_VERSION >= 11021 && CUDART_VERSION < 12000)
         return "Indicates what algorithm to use when running spmv. Possible choices are default: "
-               "0, COO Alg1: 1, CSR Alg1: 2, CSR Alg2: 3, COO Alg2: 4 (default:0)";
+               "0, COO Alg1: 1, CSR Alg1: 2, CSR Alg2: 3, COO Alg2: 4, Auto: 5 (default:0)";
 #elif(CUDART_VERSION >= 10010 && CUDART_VERSION < 11021)
         return "Indicates what algorithm to use when running spmv. Possible choices are default: "
                "0, COO Alg: 1, CSR Alg1: 2, CSR Alg2: 3 (default:0)";
@@ -53,6 +53,14 @@ constexpr auto hipsparse_datatype2string(hipDataType type)
         return "f32_c";
     case HIP_C_64F:
         return "f64_c";
+    case HIP_R_16F:
+        return "f16_r";
+    case HIP_R_16BF:
+        return "bf16_r";
+    case HIP_R_8I:
+        return "i8_r";
+    case HIP_R_32I:
+        return "i32_r";
     default:
         return "invalid";
     }
@@ -149,6 +157,10 @@ constexpr auto hipsparse_format2string(hipsparseFormat_t format)
         return "csc";
     case HIPSPARSE_FORMAT_BLOCKED_ELL:
         return "bell";
+    case HIPSPARSE_FORMAT_SLICED_ELLPACK:
+        return "sell";
+    case HIPSPARSE_FORMAT_BSR:
+        return "bsr";
     }
     return "invalid";
 }
@@ -166,6 +178,10 @@ constexpr auto hipsparse_format2string(hipsparseFormat_t format)
         return "csc";
     case HIPSPARSE_FORMAT_BLOCKED_ELL:
         return "bell";
+    case HIPSPARSE_FORMAT_SLICED_ELLPACK:
+        return "sell";
+    case HIPSPARSE_FORMAT_BSR:
+        return "bsr";
     }
     return "invalid";
 }
@@ -417,6 +433,8 @@ constexpr auto hipsparse_spmvalg2string(hipsparseSpMVAlg_t alg)
         return "csr_alg1";
     case HIPSPARSE_SPMV_CSR_ALG2:
         return "csr_alg2";
+    case HIPSPARSE_SPMV_ALG_AUTO:
+        return "auto";
     }
     return "invalid";
 }
@@ -436,6 +454,8 @@ constexpr auto hipsparse_spmvalg2string(hipsparseSpMVAlg_t alg)
         return "csr_alg1";
     case HIPSPARSE_SPMV_CSR_ALG2:
         return "csr_alg2";
+    case HIPSPARSE_SPMV_ALG_AUTO:
+        return "auto";
     }
     return "invalid";
 }
@@ -454,6 +474,8 @@ constexpr auto hipsparse_spmvalg2string(hipsparseSpMVAlg_t alg)
         return "csr_alg1";
     case HIPSPARSE_SPMV_CSR_ALG2:
         return "csr_alg2";
+    case HIPSPARSE_SPMV_ALG_AUTO:
+        return "auto";
     }
     return "invalid";
 }
@@ -476,6 +498,52 @@ constexpr auto hipsparse_spmvalg2string(hipsparseSpMVAlg_t alg)
 #endif
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+constexpr auto hipsparse_spgemmalg2string(hipsparseSpGEMMAlg_t alg)
+{
+    switch(alg)
+    {
+    case HIPSPARSE_SPGEMM_DEFAULT:
+        return "default";
+    case HIPSPARSE_SPGEMM_CSR_ALG_DETERMINISTIC:
+        return "csr_deterministic";
+    case HIPSPARSE_SPGEMM_CSR_ALG_NONDETERMINISTIC:
+        return "csr_nondeterministic";
+    case HIPSPARSE_SPGEMM_ALG1:
+        return "alg1";
+    case HIPSPARSE_SPGEMM_ALG2:
+        return "alg2";
+    case HIPSPARSE_SPGEMM_ALG3:
+        return "alg3";
+    }
+    return "invalid";
+}
+#elif(CUDART_VERSION >= 11031)
+constexpr auto hipsparse_spgemmalg2string(hipsparseSpGEMMAlg_t alg)
+{
+    switch(alg)
+    {
+    case HIPSPARSE_SPGEMM_DEFAULT:
+        return "default";
+    case HIPSPARSE_SPGEMM_CSR_ALG_DETERMINISTIC:
+        return "csr_deterministic";
+    case HIPSPARSE_SPGEMM_CSR_ALG_NONDETERMINISTIC:
+        return "csr_nondeterministic";
+    }
+    return "invalid";
+}
+#elif(CUDART_VERSION >= 11000)
+constexpr auto hipsparse_spgemmalg2string(hipsparseSpGEMMAlg_t alg)
+{
+    switch(alg)
+    {
+    case HIPSPARSE_SPGEMM_DEFAULT:
+        return "default";
+    }
+    return "invalid";
+}
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
 constexpr auto hipsparse_spsmalg2string(hipsparseSpSMAlg_t alg)
 {
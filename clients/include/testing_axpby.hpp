@@ -170,7 +170,7 @@ hipsparseStatus_t testing_axpby(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -179,15 +179,17 @@ hipsparseStatus_t testing_axpby(Arguments argus)
             CHECK_HIPSPARSE_ERROR(hipsparseAxpby(handle, &alpha, x, &beta, y));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseAxpby(handle, &alpha, x, &beta, y));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = axpby_gflop_count(nnz);
         double gbyte_count = axpby_gbyte_count<T>(nnz);
@@ -154,7 +154,7 @@ hipsparseStatus_t testing_axpyi(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -166,16 +166,18 @@ hipsparseStatus_t testing_axpyi(Arguments argus)
                 hipsparseXaxpyi(handle, nnz, &h_alpha, dxVal, dxInd, dy_1, idx_base));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(
                 hipsparseXaxpyi(handle, nnz, &h_alpha, dxVal, dxInd, dy_1, idx_base));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = axpyi_gflop_count(nnz);
         double gbyte_count = axpby_gbyte_count<T>(nnz);
@@ -658,7 +658,7 @@ hipsparseStatus_t testing_bsric02(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -686,7 +686,7 @@ hipsparseStatus_t testing_bsric02(Arguments argus)
         }
 
         // Solve run
-        double gpu_time_used = 0;
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
             CHECK_HIP_ERROR(hipMemcpy(dbsr_val_1,
@@ -694,7 +694,7 @@ hipsparseStatus_t testing_bsric02(Arguments argus)
                                       sizeof(T) * nnzb * block_dim * block_dim,
                                       hipMemcpyHostToDevice));
 
-            double temp = get_time_us();
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXbsric02(handle,
                                                     dir,
                                                     mb,
@@ -707,10 +707,10 @@ hipsparseStatus_t testing_bsric02(Arguments argus)
                                                     info,
                                                     policy,
                                                     dbuffer));
-            gpu_time_used += (get_time_us() - temp);
+            timer.stop(iter);
         }
 
-        gpu_time_used = gpu_time_used / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = bsric0_gbyte_count<T>(mb, block_dim, nnzb);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
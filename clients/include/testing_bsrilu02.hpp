@@ -678,7 +678,7 @@ hipsparseStatus_t testing_bsrilu02(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -707,7 +707,7 @@ hipsparseStatus_t testing_bsrilu02(Arguments argus)
                                                      dbuffer));
         }
 
-        double gpu_time_used = 0;
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Solve run
         for(int iter = 0; iter < number_hot_calls; ++iter)
@@ -717,7 +717,7 @@ hipsparseStatus_t testing_bsrilu02(Arguments argus)
                                       sizeof(T) * nnzb * block_dim * block_dim,
                                       hipMemcpyHostToDevice));
 
-            double temp = get_time_us();
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrilu02(handle,
                                                      dir,
                                                      mb,
@@ -730,10 +730,10 @@ hipsparseStatus_t testing_bsrilu02(Arguments argus)
                                                      info,
                                                      policy,
                                                      dbuffer));
-            gpu_time_used += (get_time_us() - temp);
+            timer.stop(iter);
         }
 
-        gpu_time_used = gpu_time_used / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = bsrilu0_gbyte_count<T>(mb, block_dim, nnzb);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -648,7 +648,7 @@ hipsparseStatus_t testing_bsrmm(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -677,11 +677,12 @@ hipsparseStatus_t testing_bsrmm(Arguments argus)
                                                   ldc));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrmm(handle,
                                                   dirA,
                                                   transA,
@@ -701,9 +702,10 @@ hipsparseStatus_t testing_bsrmm(Arguments argus)
                                                   &h_beta,
                                                   dC_1,
                                                   ldc));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count
             = bsrmm_gflop_count(n, nnzb, block_dim, m * n, h_beta != make_DataType<T>(0.0));
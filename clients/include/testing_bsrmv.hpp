@@ -496,7 +496,7 @@ hipsparseStatus_t testing_bsrmv(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -521,11 +521,12 @@ hipsparseStatus_t testing_bsrmv(Arguments argus)
                                                   dy_1));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrmv(handle,
                                                   dir,
                                                   transA,
@@ -541,9 +542,10 @@ hipsparseStatus_t testing_bsrmv(Arguments argus)
                                                   dx,
                                                   &h_beta,
                                                   dy_1));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count
             = spmv_gflop_count(m, nnzb * block_dim * block_dim, h_beta != make_DataType<T>(0.0));
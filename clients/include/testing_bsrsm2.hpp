@@ -816,7 +816,7 @@ hipsparseStatus_t testing_bsrsm2(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -846,11 +846,12 @@ hipsparseStatus_t testing_bsrsm2(Arguments argus)
                                                          dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrsm2_solve(handle,
                                                          dir,
                                                          transA,
@@ -871,9 +872,10 @@ hipsparseStatus_t testing_bsrsm2(Arguments argus)
                                                          ldx,
                                                          HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
                                                          dbuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = csrsv_gflop_count(m,
                                                size_t(nnzb) * block_dim * block_dim,
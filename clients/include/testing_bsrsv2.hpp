@@ -706,7 +706,7 @@ hipsparseStatus_t testing_bsrsv2(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -732,11 +732,12 @@ hipsparseStatus_t testing_bsrsv2(Arguments argus)
                                                          dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrsv2_solve(handle,
                                                          dir,
                                                          trans,
@@ -753,9 +754,10 @@ hipsparseStatus_t testing_bsrsv2(Arguments argus)
                                                          dy_1,
                                                          policy,
                                                          dbuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count
             = csrsv_gflop_count(mb * block_dim, size_t(nnzb) * block_dim * block_dim, diag_type);
@@ -289,7 +289,7 @@ hipsparseStatus_t testing_coosort(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -307,11 +307,12 @@ hipsparseStatus_t testing_coosort(Arguments argus)
             }
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             if(by_row)
             {
                 CHECK_HIPSPARSE_ERROR(hipsparseXcoosortByRow(
@@ -322,9 +323,10 @@ hipsparseStatus_t testing_coosort(Arguments argus)
                 CHECK_HIPSPARSE_ERROR(hipsparseXcoosortByColumn(
                     handle, m, n, nnz, dcoo_row_ind, dcoo_col_ind, dperm, dbuffer));
             }
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = coosort_gbyte_count(nnz, permute);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -545,7 +545,7 @@ hipsparseStatus_t testing_csr2bsr(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -568,11 +568,12 @@ hipsparseStatus_t testing_csr2bsr(Arguments argus)
                                                     dbsr_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2bsr(handle,
                                                     dir,
                                                     m,
@@ -586,9 +587,10 @@ hipsparseStatus_t testing_csr2bsr(Arguments argus)
                                                     dbsr_val,
                                                     dbsr_row_ptr,
                                                     dbsr_col_ind));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = csr2bsr_gbyte_count<T>(m, mb, nnz, hbsr_nnzb, block_dim);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -301,7 +301,7 @@ hipsparseStatus_t testing_csr2csc(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -321,11 +321,12 @@ hipsparseStatus_t testing_csr2csc(Arguments argus)
                                                     idx_base));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2csc(handle,
                                                     m,
                                                     n,
@@ -338,9 +339,10 @@ hipsparseStatus_t testing_csr2csc(Arguments argus)
                                                     dcsc_col_ptr,
                                                     action,
                                                     idx_base));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = csr2csc_gbyte_count<T>(m, n, nnz, action);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
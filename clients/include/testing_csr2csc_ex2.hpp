@@ -439,7 +439,7 @@ hipsparseStatus_t testing_csr2csc_ex2(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -462,11 +462,12 @@ hipsparseStatus_t testing_csr2csc_ex2(Arguments argus)
                                                       dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseCsr2cscEx2(handle,
                                                       m,
                                                       n,
@@ -482,9 +483,10 @@ hipsparseStatus_t testing_csr2csc_ex2(Arguments argus)
                                                       idx_base,
                                                       alg,
                                                       dbuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = csr2csc_gbyte_count<T>(m, n, nnz, action);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
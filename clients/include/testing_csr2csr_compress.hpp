@@ -453,7 +453,7 @@ hipsparseStatus_t testing_csr2csr_compress(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -489,11 +489,12 @@ hipsparseStatus_t testing_csr2csr_compress(Arguments argus)
                                                              tol));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2csr_compress(handle,
                                                              m,
                                                              n,
@@ -507,9 +508,10 @@ hipsparseStatus_t testing_csr2csr_compress(Arguments argus)
                                                              dcsr_col_ind_C,
                                                              dcsr_row_ptr_C,
                                                              tol));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = csr2csr_compress_gbyte_count<T>(m, hnnz_A, hnnz_C);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
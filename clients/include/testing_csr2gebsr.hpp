@@ -596,7 +596,7 @@ hipsparseStatus_t testing_csr2gebsr(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -619,11 +619,12 @@ hipsparseStatus_t testing_csr2gebsr(Arguments argus)
                                                       dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2gebsr(handle,
                                                       dir,
                                                       m,
@@ -639,9 +640,10 @@ hipsparseStatus_t testing_csr2gebsr(Arguments argus)
                                                       row_block_dim,
                                                       col_block_dim,
                                                       dbuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count
             = csr2gebsr_gbyte_count<T>(m, mb, nnz, hbsr_nnzb, row_block_dim, col_block_dim);
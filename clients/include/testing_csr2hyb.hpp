@@ -374,7 +374,7 @@ hipsparseStatus_t testing_csr2hyb(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -392,11 +392,12 @@ hipsparseStatus_t testing_csr2hyb(Arguments argus)
                                                     part));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2hyb(handle,
                                                     m,
                                                     n,
@@ -407,9 +408,10 @@ hipsparseStatus_t testing_csr2hyb(Arguments argus)
                                                     hyb,
                                                     user_ell_width,
                                                     part));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = csr2hyb_gbyte_count<T>(m, nnz, ell_nnz, coo_nnz);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -933,7 +933,7 @@ hipsparseStatus_t testing_csrgemm(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -963,11 +963,12 @@ hipsparseStatus_t testing_csrgemm(Arguments argus)
                                                     dCcol));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm(handle,
                                                     trans_A,
                                                     trans_B,
@@ -988,9 +989,10 @@ hipsparseStatus_t testing_csrgemm(Arguments argus)
                                                     dCval,
                                                     dCptr,
                                                     dCcol));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = csrgemm_gflop_count<T, int, int>(
             M, hcsr_row_ptr_A.data(), hcsr_col_ind_A.data(), hcsr_row_ptr_B.data(), idx_base_A);
@@ -0,0 +1,437 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRGEMM_PLAN_HPP
+#define TESTING_CSRGEMM_PLAN_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "testing_csrgemm.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_csrgemm_plan_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int                  M         = 1;
+    int                  N         = 1;
+    int                  K         = 1;
+    int                  nnz_A     = 1;
+    int                  nnz_B     = 1;
+    hipsparseOperation_t trans_A   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOperation_t trans_B   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    int                  safe_size = 1;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_A(new descr_struct);
+    hipsparseMatDescr_t           descr_A = unique_ptr_descr_A->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_B(new descr_struct);
+    hipsparseMatDescr_t           descr_B = unique_ptr_descr_B->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_C(new descr_struct);
+    hipsparseMatDescr_t           descr_C = unique_ptr_descr_C->descr;
+
+    auto dAptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (safe_size + 1)), device_free};
+    auto dAcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dAval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dBptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (safe_size + 1)), device_free};
+    auto dBcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dBval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dCptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (safe_size + 1)), device_free};
+    auto dCcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dCval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    int* dAptr = (int*)dAptr_managed.get();
+    int* dAcol = (int*)dAcol_managed.get();
+    T*   dAval = (T*)dAval_managed.get();
+    int* dBptr = (int*)dBptr_managed.get();
+    int* dBcol = (int*)dBcol_managed.get();
+    T*   dBval = (T*)dBval_managed.get();
+    int* dCptr = (int*)dCptr_managed.get();
+    int* dCcol = (int*)dCcol_managed.get();
+    T*   dCval = (T*)dCval_managed.get();
+
+    int nnz_C;
+
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateCsrgemmPlan((csrgemmPlan_t*)nullptr),
+                                            "Error: plan is nullptr");
+    verify_hipsparse_status_success(hipsparseDestroyCsrgemmPlan((csrgemmPlan_t) nullptr),
+                                    "Error: destroying a nullptr plan must succeed");
+
+    verify_hipsparse_status_invalid_pointer(hipsparseXcsrgemmNnzWithPlan(handle,
+                                                                         trans_A,
+                                                                         trans_B,
+                                                                         M,
+                                                                         N,
+                                                                         K,
+                                                                         descr_A,
+                                                                         nnz_A,
+                                                                         dAptr,
+                                                                         dAcol,
+                                                                         descr_B,
+                                                                         nnz_B,
+                                                                         dBptr,
+                                                                         dBcol,
+                                                                         descr_C,
+                                                                         dCptr,
+                                                                         &nnz_C,
+                                                                         (csrgemmPlan_t) nullptr),
+                                            "Error: plan is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseXcsrgemmWithPlan(handle,
+                                                                      trans_A,
+                                                                      trans_B,
+                                                                      M,
+                                                                      N,
+                                                                      K,
+                                                                      descr_A,
+                                                                      nnz_A,
+                                                                      dAval,
+                                                                      dAptr,
+                                                                      dAcol,
+                                                                      descr_B,
+                                                                      nnz_B,
+                                                                      dBval,
+                                                                      dBptr,
+                                                                      dBcol,
+                                                                      descr_C,
+                                                                      dCval,
+                                                                      dCptr,
+                                                                      dCcol,
+                                                                      (csrgemmPlan_t) nullptr),
+                                            "Error: plan is nullptr");
+
+    // A plan that has not been analysed cannot be used for the numeric phase
+    csrgemmPlan_t plan;
+    verify_hipsparse_status_success(hipsparseCreateCsrgemmPlan(&plan),
+                                    "Error: creating plan failed");
+    verify_hipsparse_status_invalid_value(hipsparseXcsrgemmWithPlan(handle,
+                                                                    trans_A,
+                                                                    trans_B,
+                                                                    M,
+                                                                    N,
+                                                                    K,
+                                                                    descr_A,
+                                                                    nnz_A,
+                                                                    dAval,
+                                                                    dAptr,
+                                                                    dAcol,
+                                                                    descr_B,
+                                                                    nnz_B,
+                                                                    dBval,
+                                                                    dBptr,
+                                                                    dBcol,
+                                                                    descr_C,
+                                                                    dCval,
+                                                                    dCptr,
+                                                                    dCcol,
+                                                                    plan),
+                                          "Error: plan has not been analysed");
+    verify_hipsparse_status_success(hipsparseDestroyCsrgemmPlan(plan),
+                                    "Error: destroying plan failed");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_csrgemm_plan(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  M          = argus.M;
+    int                  N          = argus.N;
+    int                  K          = argus.K;
+    hipsparseOperation_t trans_A    = argus.transA;
+    hipsparseOperation_t trans_B    = argus.transB;
+    hipsparseIndexBase_t idx_base_A = argus.baseA;
+    hipsparseIndexBase_t idx_base_B = argus.baseB;
+    hipsparseIndexBase_t idx_base_C = argus.baseC;
+    std::string          filename   = argus.filename;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_A(new descr_struct);
+    hipsparseMatDescr_t           descr_A = unique_ptr_descr_A->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_B(new descr_struct);
+    hipsparseMatDescr_t           descr_B = unique_ptr_descr_B->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_C(new descr_struct);
+    hipsparseMatDescr_t           descr_C = unique_ptr_descr_C->descr;
+
+    // Set matrix index base
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_A, idx_base_A));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_B, idx_base_B));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_C, idx_base_C));
+
+    srand(12345ULL);
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr_A;
+    std::vector<int> hcsr_col_ind_A;
+    std::vector<T>   hcsr_val_A;
+
+    // Read or construct CSR matrix
+    int nnz_A = 0;
+    if(!generate_csr_matrix(
+           filename, M, K, nnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idx_base_A))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // B = A^T so that we can compute the square of A
+    N                      = M;
+    int              nnz_B = nnz_A;
+    std::vector<int> hcsr_row_ptr_B(K + 1, 0);
+    std::vector<int> hcsr_col_ind_B(nnz_B);
+    std::vector<T>   hcsr_val_B(nnz_B);
+
+    // B = A^T
+    transpose_csr(M,
+                  K,
+                  nnz_A,
+                  hcsr_row_ptr_A.data(),
+                  hcsr_col_ind_A.data(),
+                  hcsr_val_A.data(),
+                  hcsr_row_ptr_B.data(),
+                  hcsr_col_ind_B.data(),
+                  hcsr_val_B.data(),
+                  idx_base_A,
+                  idx_base_B);
+
+    // Allocate memory on device
+    auto dAptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto dAcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_A), device_free};
+    auto dAval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto dBptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (K + 1)), device_free};
+    auto dBcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_B), device_free};
+    auto dBval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dCptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+
+    int* dAptr = (int*)dAptr_managed.get();
+    int* dAcol = (int*)dAcol_managed.get();
+    T*   dAval = (T*)dAval_managed.get();
+    int* dBptr = (int*)dBptr_managed.get();
+    int* dBcol = (int*)dBcol_managed.get();
+    T*   dBval = (T*)dBval_managed.get();
+    int* dCptr = (int*)dCptr_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAptr, hcsr_row_ptr_A.data(), sizeof(int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAcol, hcsr_col_ind_A.data(), sizeof(int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAval, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dBptr, hcsr_row_ptr_B.data(), sizeof(int) * (K + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dBcol, hcsr_col_ind_B.data(), sizeof(int) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBval, hcsr_val_B.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+
+    csrgemmPlan_t plan;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsrgemmPlan(&plan));
+
+    // Symbolic phase, analysed once
+    int hnnz_C;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemmNnzWithPlan(handle,
+                                                       trans_A,
+                                                       trans_B,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       descr_A,
+                                                       nnz_A,
+                                                       dAptr,
+                                                       dAcol,
+                                                       descr_B,
+                                                       nnz_B,
+                                                       dBptr,
+                                                       dBcol,
+                                                       descr_C,
+                                                       dCptr,
+                                                       &hnnz_C,
+                                                       plan));
+
+    // Allocate result matrix
+    auto dCcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * hnnz_C), device_free};
+    auto dCval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * hnnz_C), device_free};
+
+    int* dCcol = (int*)dCcol_managed.get();
+    T*   dCval = (T*)dCval_managed.get();
+
+    if(argus.unit_check)
+    {
+        // Compute csrgemm host structure once, both passes below reuse it
+        host_csrgemm2_pattern<int, int> C_gold;
+        host_csrgemm2_symbolic(M,
+                               N,
+                               true,
+                               hcsr_row_ptr_A.data(),
+                               hcsr_col_ind_A.data(),
+                               hcsr_row_ptr_B.data(),
+                               hcsr_col_ind_B.data(),
+                               false,
+                               (const int*)nullptr,
+                               (const int*)nullptr,
+                               idx_base_A,
+                               idx_base_B,
+                               idx_base_C,
+                               HIPSPARSE_INDEX_BASE_ZERO,
+                               C_gold);
+
+        int nnz_C_gold = C_gold.nnz();
+
+        unit_check_general(1, 1, 1, &nnz_C_gold, &hnnz_C);
+
+        std::vector<int> hcsr_row_ptr_C(M + 1);
+        std::vector<int> hcsr_col_ind_C(hnnz_C);
+        std::vector<T>   hcsr_val_C(hnnz_C);
+        std::vector<T>   hcsr_val_C_gold(nnz_C_gold);
+
+        T one = make_DataType<T>(1.0);
+
+        // Numeric phase, executed twice on the same plan: first in host pointer mode, then
+        // in device pointer mode with updated values of A
+        for(int pass = 0; pass < 2; ++pass)
+        {
+            if(pass == 1)
+            {
+                T two = make_DataType<T>(2.0);
+
+                for(int i = 0; i < nnz_A; ++i)
+                {
+                    hcsr_val_A[i] = testing_mult(two, hcsr_val_A[i]);
+                }
+
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dAval, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+                CHECK_HIPSPARSE_ERROR(
+                    hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            }
+
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemmWithPlan(handle,
+                                                            trans_A,
+                                                            trans_B,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            descr_A,
+                                                            nnz_A,
+                                                            dAval,
+                                                            dAptr,
+                                                            dAcol,
+                                                            descr_B,
+                                                            nnz_B,
+                                                            dBval,
+                                                            dBptr,
+                                                            dBcol,
+                                                            descr_C,
+                                                            dCval,
+                                                            dCptr,
+                                                            dCcol,
+                                                            plan));
+
+            // Copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(
+                hcsr_row_ptr_C.data(), dCptr, sizeof(int) * (M + 1), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hcsr_col_ind_C.data(), dCcol, sizeof(int) * hnnz_C, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsr_val_C.data(), dCval, sizeof(T) * hnnz_C, hipMemcpyDeviceToHost));
+
+            // Compute csrgemm host values
+            host_csrgemm2_numeric(C_gold,
+                                  &one,
+                                  hcsr_row_ptr_A.data(),
+                                  hcsr_col_ind_A.data(),
+                                  hcsr_val_A.data(),
+                                  hcsr_row_ptr_B.data(),
+                                  hcsr_col_ind_B.data(),
+                                  hcsr_val_B.data(),
+                                  (const T*)nullptr,
+                                  (const int*)nullptr,
+                                  (const int*)nullptr,
+                                  (const T*)nullptr,
+                                  hcsr_val_C_gold.data(),
+                                  idx_base_A,
+                                  idx_base_B,
+                                  HIPSPARSE_INDEX_BASE_ZERO);
+
+            // Check structure and entries of C
+            unit_check_general(1, M + 1, 1, C_gold.row_ptr.data(), hcsr_row_ptr_C.data());
+            unit_check_general(1, nnz_C_gold, 1, C_gold.col_ind.data(), hcsr_col_ind_C.data());
+            unit_check_near(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+        }
+
+        // A plan does not accept a product of different shape
+        if(M > 0)
+        {
+            verify_hipsparse_status_invalid_value(hipsparseXcsrgemmWithPlan(handle,
+                                                                            trans_A,
+                                                                            trans_B,
+                                                                            M - 1,
+                                                                            N,
+                                                                            K,
+                                                                            descr_A,
+                                                                            nnz_A,
+                                                                            dAval,
+                                                                            dAptr,
+                                                                            dAcol,
+                                                                            descr_B,
+                                                                            nnz_B,
+                                                                            dBval,
+                                                                            dBptr,
+                                                                            dBcol,
+                                                                            descr_C,
+                                                                            dCval,
+                                                                            dCptr,
+                                                                            dCcol,
+                                                                            plan),
+                                                  "Error: plan analysed for a different size");
+        }
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyCsrgemmPlan(plan));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSRGEMM_PLAN_HPP
@@ -336,7 +336,7 @@ hipsparseStatus_t testing_csrilu02(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -351,7 +351,7 @@ hipsparseStatus_t testing_csrilu02(Arguments argus)
                 handle, m, nnz, descr, dval1, dptr, dcol, info, policy, dbuffer));
         }
 
-        double gpu_time_used = 0;
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
@@ -359,13 +359,13 @@ hipsparseStatus_t testing_csrilu02(Arguments argus)
             CHECK_HIP_ERROR(
                 hipMemcpy(dval1, hcsr_val_orig.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
 
-            double temp = get_time_us();
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02(
                 handle, m, nnz, descr, dval1, dptr, dcol, info, policy, dbuffer));
-            gpu_time_used += (get_time_us() - temp);
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = csrilu0_gbyte_count<T>(m, nnz);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -247,7 +247,7 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -270,11 +270,12 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
                                                   dy_1));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrmv(handle,
                                                   transA,
                                                   nrow,
@@ -288,9 +289,10 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
                                                   dx,
                                                   &h_beta,
                                                   dy_1));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = spmv_gflop_count(nrow, nnz, h_beta != make_DataType<T>(0.0));
         double gbyte_count = csrmv_gbyte_count<T>(nrow, ncol, nnz, h_beta != make_DataType<T>(0.0));
@@ -861,7 +861,7 @@ hipsparseStatus_t testing_csrsm2(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -888,11 +888,12 @@ hipsparseStatus_t testing_csrsm2(Arguments argus)
                                                          dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrsm2_solve(handle,
                                                          0,
                                                          transA,
@@ -910,9 +911,10 @@ hipsparseStatus_t testing_csrsm2(Arguments argus)
                                                          info,
                                                          policy,
                                                          dbuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = csrsv_gflop_count(m, nnz, diag) * nrhs;
         double gbyte_count = csrsv_gbyte_count<T>(m, nnz) * nrhs;
@@ -532,7 +532,7 @@ hipsparseStatus_t testing_csrsv2(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -556,11 +556,12 @@ hipsparseStatus_t testing_csrsv2(Arguments argus)
                                                          dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_solve(handle,
                                                          trans,
                                                          m,
@@ -575,9 +576,10 @@ hipsparseStatus_t testing_csrsv2(Arguments argus)
                                                          dy_1,
                                                          policy,
                                                          dbuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = csrsv_gflop_count(m, nnz, diag_type);
         double gbyte_count = csrsv_gbyte_count<T>(m, nnz);
@@ -0,0 +1,477 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_DENSE_TO_SPARSE_BSR_HPP
+#define TESTING_DENSE_TO_SPARSE_BSR_HPP
+
+#include "display.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_dense_to_sparse_bsr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t safe_size = 100;
+    int32_t mb        = 5;
+    int32_t nb        = 5;
+    int32_t block_dim = 2;
+    int64_t m         = mb * block_dim;
+    int64_t n         = nb * block_dim;
+    int64_t ld        = m;
+
+    hipsparseIndexBase_t        idxBase = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseDenseToSparseAlg_t alg     = HIPSPARSE_DENSETOSPARSE_ALG_DEFAULT;
+    hipsparseOrder_t            order   = HIPSPARSE_ORDER_COL;
+
+    // Index and data type
+    hipsparseIndexType_t iType    = HIPSPARSE_INDEX_32I;
+    hipsparseIndexType_t jType    = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType = HIP_R_32F;
+
+    // Create handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto ddense_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dbsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int32_t) * safe_size), device_free};
+    auto dbuf_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    float*   ddense_val   = (float*)ddense_val_managed.get();
+    int32_t* dbsr_row_ptr = (int32_t*)dbsr_row_ptr_managed.get();
+    void*    dbuf         = (void*)dbuf_managed.get();
+
+    // Matrix structures
+    hipsparseDnMatDescr_t matA;
+    hipsparseSpMatDescr_t matB;
+
+    size_t bsize;
+
+    // Create matrix structures
+    verify_hipsparse_status_success(
+        hipsparseCreateDnMat(&matA, m, n, ld, ddense_val, dataType, order), "success");
+    verify_hipsparse_status_success(hipsparseCreateBsr(&matB,
+                                                       mb,
+                                                       nb,
+                                                       0,
+                                                       block_dim,
+                                                       block_dim,
+                                                       dbsr_row_ptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       iType,
+                                                       jType,
+                                                       idxBase,
+                                                       dataType,
+                                                       HIPSPARSE_ORDER_ROW),
+                                    "success");
+
+    // denseToSparse buffer size
+    verify_hipsparse_status_invalid_handle(
+        hipsparseDenseToSparse_bufferSize(nullptr, matA, matB, alg, &bsize));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDenseToSparse_bufferSize(handle, matA, matB, alg, nullptr),
+        "Error: bsize is nullptr");
+
+    // denseToSparse analysis
+    verify_hipsparse_status_invalid_handle(
+        hipsparseDenseToSparse_analysis(nullptr, matA, matB, alg, dbuf));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDenseToSparse_analysis(handle, nullptr, matB, alg, dbuf),
+        "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDenseToSparse_analysis(handle, matA, nullptr, alg, dbuf),
+        "Error: matB is nullptr");
+
+    // denseToSparse_convert
+    verify_hipsparse_status_invalid_handle(
+        hipsparseDenseToSparse_convert(nullptr, matA, matB, alg, dbuf));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDenseToSparse_convert(handle, matA, matB, alg, nullptr), "Error: dbuf is nullptr");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroyDnMat(matA), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(matB), "success");
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_dense_to_sparse_bsr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    J                           m             = argus.M;
+    J                           n             = argus.N;
+    J                           row_block_dim = argus.row_block_dimA;
+    J                           col_block_dim = argus.col_block_dimA;
+    hipsparseDirection_t        dir           = argus.dirA;
+    hipsparseIndexBase_t        idx_base      = argus.baseA;
+    hipsparseDenseToSparseAlg_t alg
+        = static_cast<hipsparseDenseToSparseAlg_t>(argus.dense2sparse_alg);
+    hipsparseSparseToDenseAlg_t alg_s2d = HIPSPARSE_SPARSETODENSE_ALG_DEFAULT;
+    hipsparseOrder_t            order   = argus.orderA;
+
+    // Blocks stored in the row direction are row major
+    hipsparseOrder_t block_order
+        = (dir == HIPSPARSE_DIRECTION_ROW) ? HIPSPARSE_ORDER_ROW : HIPSPARSE_ORDER_COL;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // The dense matrix spans whole blocks
+    J mb = (m + row_block_dim - 1) / row_block_dim;
+    J nb = (n + col_block_dim - 1) / col_block_dim;
+
+    m = mb * row_block_dim;
+    n = nb * col_block_dim;
+
+    I ld = (order == HIPSPARSE_ORDER_COL) ? m : n;
+
+    // Host structures
+    std::vector<T> hdense_val(m * n);
+
+    srand(0);
+    gen_dense_random_sparsity_pattern(m, n, hdense_val.data(), ld, order, 0.2);
+
+    auto dense_at = [&](J i, J j) {
+        return (order == HIPSPARSE_ORDER_COL) ? hdense_val[j * ld + i] : hdense_val[i * ld + j];
+    };
+
+    // Host conversion, every block that holds a nonzero is stored
+    int              nnzb_gold;
+    std::vector<int> hbsr_row_ptr_gold;
+    std::vector<int> hbsr_col_ind_gold;
+    std::vector<T>   hbsr_val_gold;
+
+    host_gebsr_compress(
+        dir,
+        mb,
+        nb,
+        row_block_dim,
+        col_block_dim,
+        [&](int i, auto&& visit) {
+            for(J row = row_block_dim * i; row < row_block_dim * (i + 1); ++row)
+            {
+                for(J col = 0; col < n; ++col)
+                {
+                    if(dense_at(row, col) != make_DataType<T>(0.0))
+                    {
+                        visit(row, col, dense_at(row, col));
+                    }
+                }
+            }
+        },
+        nnzb_gold,
+        idx_base,
+        hbsr_row_ptr_gold,
+        hbsr_col_ind_gold,
+        hbsr_val_gold);
+
+    // allocate memory on device
+    auto dptr_managed   = hipsparse_unique_ptr{device_malloc(sizeof(I) * (mb + 1)), device_free};
+    auto ddense_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m * n), device_free};
+    auto ddense_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m * n), device_free};
+
+    I* dptr     = (I*)dptr_managed.get();
+    T* ddense   = (T*)ddense_managed.get();
+    T* ddense_2 = (T*)ddense_2_managed.get();
+
+    // Copy host dense matrix to device
+    CHECK_HIP_ERROR(hipMemcpy(ddense, hdense_val.data(), sizeof(T) * m * n, hipMemcpyHostToDevice));
+
+    // Create dense matrix
+    hipsparseDnMatDescr_t matA;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&matA, m, n, ld, ddense, typeT, order));
+
+    // Create matrices
+    hipsparseSpMatDescr_t matB;
+    hipsparseStatus_t     status = hipsparseCreateBsr(&matB,
+                                                  mb,
+                                                  nb,
+                                                  0,
+                                                  row_block_dim,
+                                                  col_block_dim,
+                                                  dptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  typeI,
+                                                  typeJ,
+                                                  idx_base,
+                                                  typeT,
+                                                  block_order);
+
+#if !defined(HIPSPARSE_TEST_HOST_BACKEND)
+    // rocSPARSE blocks are square, rectangular blocks are rejected
+    if(row_block_dim != col_block_dim)
+    {
+        verify_hipsparse_status(status, HIPSPARSE_STATUS_NOT_SUPPORTED, "Error: rectangular blocks");
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matA));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+#endif
+    CHECK_HIPSPARSE_ERROR(status);
+
+    // Converting back to a dense matrix of the other order gives the original matrix
+    auto sparse_to_dense_check = [&]() -> hipsparseStatus_t {
+        hipsparseOrder_t order_2
+            = (order == HIPSPARSE_ORDER_COL) ? HIPSPARSE_ORDER_ROW : HIPSPARSE_ORDER_COL;
+        I ld_2 = (order_2 == HIPSPARSE_ORDER_COL) ? m : n;
+
+        std::vector<T> hdense_val_2(m * n, make_DataType<T>(-1));
+        CHECK_HIP_ERROR(
+            hipMemcpy(ddense_2, hdense_val_2.data(), sizeof(T) * m * n, hipMemcpyHostToDevice));
+
+        hipsparseDnMatDescr_t matC;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&matC, m, n, ld_2, ddense_2, typeT, order_2));
+
+        size_t bufferSize_s2d;
+
+#if !defined(HIPSPARSE_TEST_HOST_BACKEND)
+        // rocSPARSE converts BSR matrices with 32 bit indices only
+        if(typeI != HIPSPARSE_INDEX_32I || typeJ != HIPSPARSE_INDEX_32I)
+        {
+            verify_hipsparse_status(
+                hipsparseSparseToDense_bufferSize(handle, matB, matC, alg_s2d, &bufferSize_s2d),
+                HIPSPARSE_STATUS_NOT_SUPPORTED,
+                "Error: BSR to dense conversion with 64 bit indices");
+            CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matC));
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+#endif
+
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSparseToDense_bufferSize(handle, matB, matC, alg_s2d, &bufferSize_s2d));
+
+        void* buffer_s2d;
+        CHECK_HIP_ERROR(hipMalloc(&buffer_s2d, bufferSize_s2d));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSparseToDense(handle, matB, matC, alg_s2d, buffer_s2d));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hdense_val_2.data(), ddense_2, sizeof(T) * m * n, hipMemcpyDeviceToHost));
+
+        std::vector<T> hdense_val_gold(m * n);
+        for(J i = 0; i < m; ++i)
+        {
+            for(J j = 0; j < n; ++j)
+            {
+                if(order_2 == HIPSPARSE_ORDER_COL)
+                {
+                    hdense_val_gold[j * ld_2 + i] = dense_at(i, j);
+                }
+                else
+                {
+                    hdense_val_gold[i * ld_2 + j] = dense_at(i, j);
+                }
+            }
+        }
+
+        unit_check_general(1, m * n, 1, hdense_val_gold.data(), hdense_val_2.data());
+
+        CHECK_HIP_ERROR(hipFree(buffer_s2d));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matC));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    };
+
+    // Query DenseToSparse buffer
+    size_t bufferSize;
+
+#if !defined(HIPSPARSE_TEST_HOST_BACKEND)
+    // rocSPARSE has no dense to BSR conversion, the conversion back to a dense matrix runs on
+    // the BSR matrix of the host conversion instead
+    verify_hipsparse_status(hipsparseDenseToSparse_bufferSize(handle, matA, matB, alg, &bufferSize),
+                            HIPSPARSE_STATUS_NOT_SUPPORTED,
+                            "Error: dense to BSR conversion");
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(matB));
+
+    int64_t nnzb_val_gold = int64_t(nnzb_gold) * row_block_dim * col_block_dim;
+
+    auto dcol_gold_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnzb_gold), device_free};
+    auto dval_gold_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnzb_val_gold), device_free};
+
+    J* dcol_gold = (J*)dcol_gold_managed.get();
+    T* dval_gold = (T*)dval_gold_managed.get();
+
+    std::vector<I> hbsr_row_ptr_gold_I(hbsr_row_ptr_gold.begin(), hbsr_row_ptr_gold.end());
+    std::vector<J> hbsr_col_ind_gold_J(hbsr_col_ind_gold.begin(), hbsr_col_ind_gold.end());
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hbsr_row_ptr_gold_I.data(), sizeof(I) * (mb + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol_gold, hbsr_col_ind_gold_J.data(), sizeof(J) * nnzb_gold, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dval_gold, hbsr_val_gold.data(), sizeof(T) * nnzb_val_gold, hipMemcpyHostToDevice));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateBsr(&matB,
+                                             mb,
+                                             nb,
+                                             nnzb_gold,
+                                             row_block_dim,
+                                             col_block_dim,
+                                             dptr,
+                                             dcol_gold,
+                                             dval_gold,
+                                             typeI,
+                                             typeJ,
+                                             idx_base,
+                                             typeT,
+                                             block_order));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(sparse_to_dense_check());
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matA));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(matB));
+    return HIPSPARSE_STATUS_SUCCESS;
+#endif
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_bufferSize(handle, matA, matB, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_analysis(handle, matA, matB, alg, buffer));
+
+    // The number of stored blocks is reported as the number of non-zeros
+    int64_t rows, cols, nnzb;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetSize(matB, &rows, &cols, &nnzb));
+
+    int64_t nnzb_val = nnzb * row_block_dim * col_block_dim;
+
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnzb), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnzb_val), device_free};
+
+    J* dcol = (J*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseBsrSetPointers(matB, dptr, dcol, dval));
+
+    if(argus.unit_check)
+    {
+        int64_t nnzb_gold_64 = nnzb_gold;
+        unit_check_general(1, 1, 1, &nnzb_gold_64, &nnzb);
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_convert(handle, matA, matB, alg, buffer));
+
+        // copy output from device to CPU
+        std::vector<I> hbsr_row_ptr(mb + 1);
+        std::vector<J> hbsr_col_ind(nnzb);
+        std::vector<T> hbsr_val(nnzb_val);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hbsr_row_ptr.data(), dptr, sizeof(I) * (mb + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hbsr_col_ind.data(), dcol, sizeof(J) * nnzb, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hbsr_val.data(), dval, sizeof(T) * nnzb_val, hipMemcpyDeviceToHost));
+
+        std::vector<I> hbsr_row_ptr_cpu(hbsr_row_ptr_gold.begin(), hbsr_row_ptr_gold.end());
+        std::vector<J> hbsr_col_ind_cpu(hbsr_col_ind_gold.begin(), hbsr_col_ind_gold.end());
+
+        unit_check_general(1, (mb + 1), 1, hbsr_row_ptr_cpu.data(), hbsr_row_ptr.data());
+        unit_check_general(1, nnzb, 1, hbsr_col_ind_cpu.data(), hbsr_col_ind.data());
+        unit_check_general(1, nnzb_val, 1, hbsr_val_gold.data(), hbsr_val.data());
+
+        CHECK_HIPSPARSE_ERROR(sparse_to_dense_check());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        // Warm-up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_convert(handle, matA, matB, alg, buffer));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_convert(handle, matA, matB, alg, buffer));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gbyte_count = dense2csx_gbyte_count<HIPSPARSE_DIRECTION_ROW, T>(m, n, nnzb_val);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::nnzb,
+                            nnzb,
+                            display_key_t::row_block_dimA,
+                            row_block_dim,
+                            display_key_t::col_block_dimA,
+                            col_block_dim,
+                            display_key_t::direction,
+                            dir,
+                            display_key_t::order,
+                            order,
+                            display_key_t::algorithm,
+                            hipsparse_densetosparsealg2string(alg),
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matA));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(matB));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_DENSE_TO_SPARSE_BSR_HPP
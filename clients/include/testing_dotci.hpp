@@ -153,7 +153,7 @@ hipsparseStatus_t testing_dotci(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -166,17 +166,19 @@ hipsparseStatus_t testing_dotci(Arguments argus)
             CHECK_HIP_ERROR(hipStreamSynchronize(stream));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(
                 hipsparseXdotci(handle, nnz, dx_val, dx_ind, dy, &hresult_1, idx_base));
             CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = doti_gflop_count(nnz);
         double gbyte_count = doti_gbyte_count<T, T>(nnz);
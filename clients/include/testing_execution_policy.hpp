@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_EXECUTION_POLICY_HPP
+#define TESTING_EXECUTION_POLICY_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_execution_policy_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    hipsparseExecutionPolicy_t policy;
+
+    verify_hipsparse_status_invalid_handle(hipsparseSetExecutionPolicy(
+        (hipsparseHandle_t) nullptr, HIPSPARSE_EXECUTION_POLICY_ASYNC));
+    verify_hipsparse_status_invalid_handle(
+        hipsparseGetExecutionPolicy((hipsparseHandle_t) nullptr, &policy));
+    verify_hipsparse_status_invalid_value(
+        hipsparseSetExecutionPolicy(handle, (hipsparseExecutionPolicy_t)3),
+        "Error: policy is invalid");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseGetExecutionPolicy(handle, (hipsparseExecutionPolicy_t*)nullptr),
+        "Error: policy is nullptr");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_execution_policy(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                        N        = argus.N;
+    int                        nnz      = argus.nnz;
+    hipsparseIndexBase_t       idx_base = argus.baseA;
+    hipsparseExecutionPolicy_t policy   = argus.execution_policy;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Grab stream used by handle
+    hipStream_t stream;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetExecutionPolicy(handle, policy));
+
+    // The environment variable takes precedence over the handle policy
+    if(getenv("HIPSPARSE_EXECUTION_POLICY") == nullptr)
+    {
+        hipsparseExecutionPolicy_t handle_policy;
+        CHECK_HIPSPARSE_ERROR(hipsparseGetExecutionPolicy(handle, &handle_policy));
+
+        int expected = policy;
+        int actual   = handle_policy;
+        unit_check_general(1, 1, 1, &expected, &actual);
+    }
+
+    // Host structures
+    std::vector<int> hx_ind(nnz);
+    std::vector<T>   hx_val(nnz);
+    std::vector<T>   hy(N);
+
+    T hresult_1;
+    T hresult_2;
+    T hresult_gold;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    hipsparseInitIndex(hx_ind.data(), nnz, 1, N);
+    hipsparseInit<T>(hx_val, 1, nnz);
+    hipsparseInit<T>(hy, 1, N);
+
+    // allocate memory on device
+    auto dx_ind_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dx_val_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dy_managed        = hipsparse_unique_ptr{device_malloc(sizeof(T) * N), device_free};
+    auto dresult_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dx_ind    = (int*)dx_ind_managed.get();
+    T*   dx_val    = (T*)dx_val_managed.get();
+    T*   dy        = (T*)dy_managed.get();
+    T*   dresult_2 = (T*)dresult_2_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // HIPSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, &hresult_1, idx_base));
+
+        // HIPSPARSE pointer mode device
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, dresult_2, idx_base));
+
+        // With an asynchronous policy, the caller is responsible for synchronization
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(&hresult_2, dresult_2, sizeof(T), hipMemcpyDeviceToHost));
+
+        // CPU
+        hresult_gold = make_DataType<T>(0.0);
+        for(int i = 0; i < nnz; ++i)
+        {
+            hresult_gold = hresult_gold + testing_mult(hy[hx_ind[i] - idx_base], hx_val[i]);
+        }
+
+        unit_check_general(1, 1, 1, &hresult_gold, &hresult_1);
+        unit_check_general(1, 1, 1, &hresult_gold, &hresult_2);
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_EXECUTION_POLICY_HPP
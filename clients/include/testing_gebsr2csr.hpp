@@ -468,7 +468,7 @@ hipsparseStatus_t testing_gebsr2csr(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -490,11 +490,12 @@ hipsparseStatus_t testing_gebsr2csr(Arguments argus)
                                                       dcsr_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXgebsr2csr(handle,
                                                       dir,
                                                       mb,
@@ -509,9 +510,10 @@ hipsparseStatus_t testing_gebsr2csr(Arguments argus)
                                                       dcsr_val,
                                                       dcsr_row_ptr,
                                                       dcsr_col_ind));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = gebsr2csr_gbyte_count<T>(mb, row_block_dim, col_block_dim, nnzb);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
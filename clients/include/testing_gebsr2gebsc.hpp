@@ -582,7 +582,7 @@ hipsparseStatus_t testing_gebsr2gebsc(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -605,11 +605,12 @@ hipsparseStatus_t testing_gebsr2gebsc(Arguments argus)
                                                            dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXgebsr2gebsc<T>(handle,
                                                            mb,
                                                            nb,
@@ -625,9 +626,10 @@ hipsparseStatus_t testing_gebsr2gebsc(Arguments argus)
                                                            action,
                                                            base,
                                                            dbuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count
             = gebsr2gebsc_gbyte_count<T>(mb, nb, nnzb, row_block_dim, col_block_dim, action);
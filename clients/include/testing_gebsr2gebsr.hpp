@@ -1203,7 +1203,7 @@ hipsparseStatus_t testing_gebsr2gebsr(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -1231,11 +1231,12 @@ hipsparseStatus_t testing_gebsr2gebsr(Arguments argus)
                                                         dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXgebsr2gebsr(handle,
                                                         dir,
                                                         mb,
@@ -1254,9 +1255,10 @@ hipsparseStatus_t testing_gebsr2gebsr(Arguments argus)
                                                         row_block_dim_C,
                                                         col_block_dim_C,
                                                         dbuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = gebsr2gebsr_gbyte_count<T>(mb,
                                                         mb_C,
@@ -223,7 +223,7 @@ hipsparseStatus_t testing_gemvi(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -245,11 +245,12 @@ hipsparseStatus_t testing_gemvi(Arguments argus)
                                                   externalBuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXgemvi(handle,
                                                   trans,
                                                   m,
@@ -264,9 +265,10 @@ hipsparseStatus_t testing_gemvi(Arguments argus)
                                                   dy,
                                                   idxBase,
                                                   externalBuffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = gemvi_gflop_count(m, nnz);
         double gbyte_count
@@ -240,7 +240,7 @@ hipsparseStatus_t testing_gpsv_interleaved_batch(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         // Warm up
@@ -250,16 +250,18 @@ hipsparseStatus_t testing_gpsv_interleaved_batch(Arguments argus)
                 handle, algo, m, dds, ddl, dd, ddu, ddw, dx, batch_count, buffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXgpsvInterleavedBatch(
                 handle, algo, m, dds, ddl, dd, ddu, ddw, dx, batch_count, buffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = gpsv_interleaved_batch_gbyte_count<T>(m, batch_count);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -730,7 +730,7 @@ hipsparseStatus_t testing_prune_csr2csr(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -754,11 +754,12 @@ hipsparseStatus_t testing_prune_csr2csr(Arguments argus)
                                                          d_temp_buffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXpruneCsr2csr(handle,
                                                          M,
                                                          N,
@@ -773,9 +774,10 @@ hipsparseStatus_t testing_prune_csr2csr(Arguments argus)
                                                          d_csr_row_ptr_C,
                                                          d_csr_col_ind_C,
                                                          d_temp_buffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count = prune_csr2csr_gbyte_count<T>(M, nnz_A, h_nnz_total_dev_host_ptr[0]);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
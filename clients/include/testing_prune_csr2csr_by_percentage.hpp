@@ -826,7 +826,7 @@ hipsparseStatus_t testing_prune_csr2csr_by_percentage(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -851,11 +851,12 @@ hipsparseStatus_t testing_prune_csr2csr_by_percentage(Arguments argus)
                                                                      d_temp_buffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseXpruneCsr2csrByPercentage(handle,
                                                                      M,
                                                                      N,
@@ -871,9 +872,10 @@ hipsparseStatus_t testing_prune_csr2csr_by_percentage(Arguments argus)
                                                                      d_csr_col_ind_C,
                                                                      info,
                                                                      d_temp_buffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gbyte_count
             = prune_csr2csr_by_percentage_gbyte_count<T>(M, nnz_A, h_nnz_total_dev_host_ptr[0]);
@@ -25,6 +25,10 @@
 #ifndef TESTING_SPGEMM_CSR_HPP
 #define TESTING_SPGEMM_CSR_HPP
 
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
 #include "hipsparse_arguments.hpp"
 #include "hipsparse_test_unique_ptr.hpp"
 #include "unit.hpp"
@@ -323,6 +327,18 @@ void testing_spgemm_csr_bad_arg(void)
             handle, transA, transB, &alpha, A, B, &beta, nullptr, dataType, alg, descr),
         "Error: C is nullptr");
 
+    // SpGEMM mode
+    hipsparseSpGEMMMode_t mode;
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_setMode(nullptr, HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGEMM_setMode(descr, (hipsparseSpGEMMMode_t)2), "Error: mode is invalid");
+    verify_hipsparse_status_invalid_pointer(hipsparseSpGEMM_getMode(nullptr, &mode),
+                                            "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseSpGEMM_getMode(descr, nullptr),
+                                            "Error: mode is nullptr");
+
     // Destruct
     verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
     verify_hipsparse_status_success(hipsparseDestroySpMat(B), "success");
@@ -334,14 +350,15 @@ template <typename I, typename J, typename T>
 hipsparseStatus_t testing_spgemm_csr(Arguments argus)
 {
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
-    J                    m        = argus.M;
-    J                    k        = argus.K;
-    T                    h_alpha  = make_DataType<T>(argus.alpha);
-    hipsparseIndexBase_t idxBaseA = argus.baseA;
-    hipsparseIndexBase_t idxBaseB = argus.baseB;
-    hipsparseIndexBase_t idxBaseC = argus.baseC;
-    hipsparseSpGEMMAlg_t alg      = static_cast<hipsparseSpGEMMAlg_t>(argus.spgemm_alg);
-    std::string          filename = argus.filename;
+    J                     m        = argus.M;
+    J                     k        = argus.K;
+    T                     h_alpha  = make_DataType<T>(argus.alpha);
+    hipsparseIndexBase_t  idxBaseA = argus.baseA;
+    hipsparseIndexBase_t  idxBaseB = argus.baseB;
+    hipsparseIndexBase_t  idxBaseC = argus.baseC;
+    hipsparseSpGEMMAlg_t  alg      = static_cast<hipsparseSpGEMMAlg_t>(argus.spgemm_alg);
+    hipsparseSpGEMMMode_t mode     = static_cast<hipsparseSpGEMMMode_t>(argus.spgemm_mode);
+    std::string           filename = argus.filename;
 
     T                    h_beta = make_DataType<T>(0);
     hipsparseOperation_t transA = HIPSPARSE_OPERATION_NON_TRANSPOSE;
@@ -359,6 +376,12 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
     std::unique_ptr<spgemm_struct> unique_ptr_descr(new spgemm_struct);
     hipsparseSpGEMMDescr_t         descr = unique_ptr_descr->descr;
 
+    std::unique_ptr<spgemm_struct> unique_ptr_descr_2(new spgemm_struct);
+    hipsparseSpGEMMDescr_t         descr_2 = unique_ptr_descr_2->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_setMode(descr, mode));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_setMode(descr_2, mode));
+
     // Host structures
     std::vector<I> hcsr_row_ptr_A;
     std::vector<J> hcsr_col_ind_A;
@@ -466,8 +489,22 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
                                              typeT));
     CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
         &C1, m, n, 0, dcsr_row_ptr_C_1, nullptr, nullptr, typeI, typeJ, idxBaseC, typeT));
-    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
-        &C2, m, n, 0, dcsr_row_ptr_C_2, nullptr, nullptr, typeI, typeJ, idxBaseC, typeT));
+
+    // In single arena mode, C2 has no row pointer array until the copy, so that its row
+    // pointers are computed in the arena
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&C2,
+                                             m,
+                                             n,
+                                             0,
+                                             (mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+                                                 ? nullptr
+                                                 : dcsr_row_ptr_C_2,
+                                             nullptr,
+                                             nullptr,
+                                             typeI,
+                                             typeJ,
+                                             idxBaseC,
+                                             typeT));
 
     // Query SpGEMM work estimation buffer
     size_t bufferSize1;
@@ -496,7 +533,7 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
                                                          C2,
                                                          typeT,
                                                          alg,
-                                                         descr,
+                                                         descr_2,
                                                          &bufferSize1,
                                                          nullptr));
 
@@ -529,7 +566,7 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
                                                          C2,
                                                          typeT,
                                                          alg,
-                                                         descr,
+                                                         descr_2,
                                                          &bufferSize1,
                                                          externalBuffer1));
 
@@ -560,10 +597,19 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
                                                   C2,
                                                   typeT,
                                                   alg,
-                                                  descr,
+                                                  descr_2,
                                                   &bufferSize2,
                                                   nullptr));
 
+#if(!defined(CUDART_VERSION))
+    // In single arena mode, the first buffer is the only temporary storage
+    if(mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        size_t zero = 0;
+        unit_check_general(1, 1, 1, &zero, &bufferSize2);
+    }
+#endif
+
     void* externalBuffer2;
     CHECK_HIP_ERROR(hipMalloc(&externalBuffer2, bufferSize2));
 
@@ -593,7 +639,7 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
                                                   C2,
                                                   typeT,
                                                   alg,
-                                                  descr,
+                                                  descr_2,
                                                   &bufferSize2,
                                                   externalBuffer2));
 
@@ -630,11 +676,25 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
 
     // SpGEMM copy
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+#if(!defined(CUDART_VERSION))
+    // In single arena mode, the values of C are overwritten and a non-zero beta is rejected
+    if(mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        T h_one = make_DataType<T>(1.0);
+        verify_hipsparse_status_not_supported(
+            hipsparseSpGEMM_copy(
+                handle, transA, transB, &h_alpha, A, B, &h_one, C1, typeT, alg, descr),
+            "Error: beta is not zero");
+    }
+#endif
+
     CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_copy(
         handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, descr));
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
-    CHECK_HIPSPARSE_ERROR(
-        hipsparseSpGEMM_copy(handle, transA, transB, d_alpha, A, B, d_beta, C2, typeT, alg, descr));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_copy(
+        handle, transA, transB, d_alpha, A, B, d_beta, C2, typeT, alg, descr_2));
 
     // Copy output from device to CPU
     std::vector<I> hcsr_row_ptr_C_1(m + 1);
@@ -715,6 +775,98 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
     unit_check_general(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C_1.data());
     unit_check_general(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C_2.data());
 
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Full SpGEMM pipeline into C1, using a fresh SpGEMM descriptor per call
+        auto spgemm_pipeline = [&]() {
+            std::unique_ptr<spgemm_struct> unique_ptr_timing_descr(new spgemm_struct);
+            hipsparseSpGEMMDescr_t         timing_descr = unique_ptr_timing_descr->descr;
+
+            CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_setMode(timing_descr, mode));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 &h_alpha,
+                                                                 A,
+                                                                 B,
+                                                                 &h_beta,
+                                                                 C1,
+                                                                 typeT,
+                                                                 alg,
+                                                                 timing_descr,
+                                                                 &bufferSize1,
+                                                                 externalBuffer1));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_compute(handle,
+                                                          transA,
+                                                          transB,
+                                                          &h_alpha,
+                                                          A,
+                                                          B,
+                                                          &h_beta,
+                                                          C1,
+                                                          typeT,
+                                                          alg,
+                                                          timing_descr,
+                                                          &bufferSize2,
+                                                          externalBuffer2));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_copy(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, timing_descr));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(spgemm_pipeline());
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(spgemm_pipeline());
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = csrgemm_gflop_count<T, I, J>(
+            m, hcsr_row_ptr_A.data(), hcsr_col_ind_A.data(), hcsr_row_ptr_B.data(), idxBaseA);
+        double gbyte_count = csrgemm_gbyte_count<T, I, J>(m, n, k, nnz_A, nnz_B, (I)nnz_C_1);
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::K,
+                            k,
+                            display_key_t::nnzA,
+                            nnz_A,
+                            display_key_t::nnzB,
+                            nnz_B,
+                            display_key_t::nnzC,
+                            nnz_C_1,
+                            display_key_t::algorithm,
+                            hipsparse_spgemmalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
     // Free buffers
     CHECK_HIP_ERROR(hipFree(externalBuffer1));
     CHECK_HIP_ERROR(hipFree(externalBuffer2));
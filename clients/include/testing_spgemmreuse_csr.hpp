@@ -25,6 +25,10 @@
 #ifndef TESTING_SPGEMMREUSE_CSR_HPP
 #define TESTING_SPGEMMREUSE_CSR_HPP
 
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
 #include "hipsparse_arguments.hpp"
 #include "hipsparse_test_unique_ptr.hpp"
 #include "unit.hpp"
@@ -436,6 +440,64 @@ hipsparseStatus_t testing_spgemmreuse_csr(Arguments argus)
     CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_compute(
         handle, transA, transB, &h_alpha, A, B, &h_beta, C, typeT, alg, descr));
 
+    // The numerical phase is the part being reused, so that is what gets timed. It still needs
+    // the buffers of the copy phase.
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_compute(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C, typeT, alg, descr));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_compute(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C, typeT, alg, descr));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = csrgemm_gflop_count<T, I, J>(
+            m, hcsr_row_ptr_A.data(), hcsr_col_ind_A.data(), hcsr_row_ptr_B.data(), idxBaseA);
+        double gbyte_count = csrgemm_gbyte_count<T, I, J>(m, n, k, nnz_A, nnz_B, (I)nnz_C);
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::K,
+                            k,
+                            display_key_t::nnzA,
+                            nnz_A,
+                            display_key_t::nnzB,
+                            nnz_B,
+                            display_key_t::nnzC,
+                            nnz_C,
+                            display_key_t::algorithm,
+                            hipsparse_spgemmalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
     externalBuffer4_managed.reset(nullptr);
     externalBuffer4 = nullptr;
 
@@ -454,57 +516,52 @@ hipsparseStatus_t testing_spgemmreuse_csr(Arguments argus)
     CHECK_HIP_ERROR(
         hipMemcpy(hcsr_val_C.data(), dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
 
-    // Compute SpGEMM nnz of C on host
-    std::vector<I> hcsr_row_ptr_C_gold(m + 1);
-
-    int64_t nnz_C_gold = host_csrgemm2_nnz(m,
-                                           n,
-                                           k,
-                                           &h_alpha,
-                                           hcsr_row_ptr_A.data(),
-                                           hcsr_col_ind_A.data(),
-                                           hcsr_row_ptr_B.data(),
-                                           hcsr_col_ind_B.data(),
-                                           (const T*)nullptr,
-                                           (const I*)nullptr,
-                                           (const J*)nullptr,
-                                           hcsr_row_ptr_C_gold.data(),
-                                           idxBaseA,
-                                           idxBaseB,
-                                           idxBaseC,
-                                           HIPSPARSE_INDEX_BASE_ZERO);
+    // Compute the structure of C on host, then its values on that structure, as the reuse
+    // routines do
+    host_csrgemm2_pattern<I, J> C_gold;
+    host_csrgemm2_symbolic(m,
+                           n,
+                           true,
+                           hcsr_row_ptr_A.data(),
+                           hcsr_col_ind_A.data(),
+                           hcsr_row_ptr_B.data(),
+                           hcsr_col_ind_B.data(),
+                           false,
+                           (const I*)nullptr,
+                           (const J*)nullptr,
+                           idxBaseA,
+                           idxBaseB,
+                           idxBaseC,
+                           HIPSPARSE_INDEX_BASE_ZERO,
+                           C_gold);
+
+    int64_t nnz_C_gold = C_gold.nnz();
+
     // Verify nnz and row pointer array
     unit_check_general(1, 1, 1, &nnz_C_gold, &nnz_C);
-    unit_check_general(1, m + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+    unit_check_general(1, m + 1, 1, C_gold.row_ptr.data(), hcsr_row_ptr_C.data());
 
-    // Compute SpGEMM on host
-    std::vector<J> hcsr_col_ind_C_gold(nnz_C_gold);
     std::vector<T> hcsr_val_C_gold(nnz_C_gold);
 
-    host_csrgemm2(m,
-                  n,
-                  k,
-                  &h_alpha,
-                  hcsr_row_ptr_A.data(),
-                  hcsr_col_ind_A.data(),
-                  hcsr_val_A.data(),
-                  hcsr_row_ptr_B.data(),
-                  hcsr_col_ind_B.data(),
-                  hcsr_val_B.data(),
-                  (const T*)nullptr,
-                  (const I*)nullptr,
-                  (const J*)nullptr,
-                  (const T*)nullptr,
-                  hcsr_row_ptr_C_gold.data(),
-                  hcsr_col_ind_C_gold.data(),
-                  hcsr_val_C_gold.data(),
-                  idxBaseA,
-                  idxBaseB,
-                  idxBaseC,
-                  HIPSPARSE_INDEX_BASE_ZERO);
+    host_csrgemm2_numeric(C_gold,
+                          &h_alpha,
+                          hcsr_row_ptr_A.data(),
+                          hcsr_col_ind_A.data(),
+                          hcsr_val_A.data(),
+                          hcsr_row_ptr_B.data(),
+                          hcsr_col_ind_B.data(),
+                          hcsr_val_B.data(),
+                          (const T*)nullptr,
+                          (const I*)nullptr,
+                          (const J*)nullptr,
+                          (const T*)nullptr,
+                          hcsr_val_C_gold.data(),
+                          idxBaseA,
+                          idxBaseB,
+                          HIPSPARSE_INDEX_BASE_ZERO);
 
     // Verify column and value array
-    unit_check_general(1, nnz_C_gold, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+    unit_check_general(1, nnz_C_gold, 1, C_gold.col_ind.data(), hcsr_col_ind_C.data());
     unit_check_general(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
 
     // Clean up
@@ -179,15 +179,11 @@ hipsparseStatus_t testing_spmm_batched_coo(Arguments argus)
     hipsparseOrder_t     orderC   = argus.orderC;
     hipsparseIndexBase_t idx_base = argus.baseA;
 
-    I batch_count_A = 1;
-    I batch_count_B = 10;
-    I batch_count_C = 10;
+    hipsparseSpMMAlg_t alg = static_cast<hipsparseSpMMAlg_t>(argus.spmm_alg);
 
-#if(CUDART_VERSION >= 11003)
-    hipsparseSpMMAlg_t alg = HIPSPARSE_SPMM_COO_ALG1;
-#else
-    hipsparseSpMMAlg_t alg = HIPSPARSE_COOMM_ALG1;
-#endif
+    I batch_count_A = 1;
+    I batch_count_B = argus.batch_count;
+    I batch_count_C = argus.batch_count;
 
     std::string filename = argus.filename;
 
@@ -441,7 +437,7 @@ hipsparseStatus_t testing_spmm_batched_coo(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -453,16 +449,18 @@ hipsparseStatus_t testing_spmm_batched_coo(Arguments argus)
                 handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
                 handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count
             = batch_count_C
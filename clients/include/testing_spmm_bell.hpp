@@ -25,12 +25,16 @@
 #ifndef TESTING_SPMM_BELL_HPP
 #define TESTING_SPMM_BELL_HPP
 
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
 #include "hipsparse.hpp"
 #include "hipsparse_arguments.hpp"
 #include "hipsparse_test_unique_ptr.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
 
+#include <algorithm>
 #include <hipsparse.h>
 #include <string>
 #include <typeinfo>
@@ -384,4 +388,324 @@ hipsparseStatus_t testing_spmm_bell()
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmm_bell(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+    I                    m         = argus.M;
+    I                    n         = argus.N;
+    I                    k         = argus.K;
+    I                    block_dim = argus.block_dim;
+    T                    h_alpha   = make_DataType<T>(argus.alpha);
+    T                    h_beta    = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA    = argus.transA;
+    hipsparseOperation_t transB    = argus.transB;
+    hipsparseOrder_t     orderB    = argus.orderB;
+    hipsparseOrder_t     orderC    = argus.orderC;
+    hipsparseIndexBase_t idx_base  = argus.baseA;
+    hipsparseSpMMAlg_t   alg       = HIPSPARSE_SPMM_BLOCKED_ELL_ALG1;
+    std::string          filename  = argus.filename;
+
+    // Blocked ELL SpMM is only defined for non-transposed A
+    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE || block_dim <= 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+#if(defined(CUDART_VERSION))
+    if(orderB != orderC || orderB != HIPSPARSE_ORDER_COL)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+#endif
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz_A;
+    if(!generate_csr_matrix(
+           filename, m, k, nnz_A, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Pad A with empty rows and columns to a multiple of the block dimension
+    I mb = (m + block_dim - 1) / block_dim;
+    I kb = (k + block_dim - 1) / block_dim;
+
+    m = mb * block_dim;
+    k = kb * block_dim;
+
+    hcsr_row_ptr.resize(m + 1, hcsr_row_ptr.back());
+
+    // Blocked ELL width is the largest number of distinct column blocks in a block row
+    std::vector<std::vector<I>> block_cols(mb);
+
+    for(I i = 0; i < m; ++i)
+    {
+        std::vector<I>& cols = block_cols[i / block_dim];
+
+        for(I j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            cols.push_back((hcsr_col_ind[j] - idx_base) / block_dim);
+        }
+    }
+
+    I ell_blocks = 0;
+    for(I i = 0; i < mb; ++i)
+    {
+        std::sort(block_cols[i].begin(), block_cols[i].end());
+        block_cols[i].erase(std::unique(block_cols[i].begin(), block_cols[i].end()),
+                            block_cols[i].end());
+
+        ell_blocks = std::max(ell_blocks, (I)block_cols[i].size());
+    }
+
+    I ell_cols = ell_blocks * block_dim;
+
+    // Unused slots hold the column index base - 1 and zero blocks
+    std::vector<I> hbell_ind(mb * ell_blocks, static_cast<I>(idx_base) - 1);
+    std::vector<T> hbell_val(m * ell_cols, make_DataType<T>(0));
+
+    for(I i = 0; i < mb; ++i)
+    {
+        for(size_t p = 0; p < block_cols[i].size(); ++p)
+        {
+            hbell_ind[i * ell_blocks + p] = block_cols[i][p] + idx_base;
+        }
+    }
+
+    for(I i = 0; i < m; ++i)
+    {
+        const std::vector<I>& cols = block_cols[i / block_dim];
+
+        for(I j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            I col = hcsr_col_ind[j] - idx_base;
+            I p   = std::lower_bound(cols.begin(), cols.end(), col / block_dim) - cols.begin();
+            I r   = i % block_dim;
+            I c   = col % block_dim;
+
+#if(!defined(CUDART_VERSION))
+            // rocSPARSE stores each block contiguously and column major (hipsparseCreateBlockedEll
+            // uses the column direction)
+            hbell_val[(i / block_dim * ell_blocks + p) * block_dim * block_dim + c * block_dim + r]
+                = hcsr_val[j];
+#else
+            // cuSPARSE stores the values as a row major m x ell_cols array
+            hbell_val[i * ell_cols + p * block_dim + c] = hcsr_val[j];
+#endif
+        }
+    }
+
+    // Some matrix properties
+    I B_m = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : n;
+    I B_n = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : k;
+    I C_m = m;
+    I C_n = n;
+
+    I ldb = std::max((I)1, (orderB == HIPSPARSE_ORDER_COL) ? B_m : B_n);
+    I ldc = std::max((I)1, (orderC == HIPSPARSE_ORDER_COL) ? C_m : C_n);
+
+    I nnz_B = B_m * B_n;
+    I nnz_C = C_m * C_n;
+
+    // Allocate host memory for matrices
+    std::vector<T> hB(nnz_B);
+    std::vector<T> hC_1(nnz_C);
+    std::vector<T> hC_2(nnz_C);
+    std::vector<T> hC_gold(nnz_C);
+
+    hipsparseInit<T>(hB, nnz_B, 1);
+    hipsparseInit<T>(hC_1, nnz_C, 1);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // allocate memory on device
+    auto dbell_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * mb * ell_blocks), device_free};
+    auto dbell_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(T) * m * ell_cols), device_free};
+    auto dB_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dC_1_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+    auto dC_2_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dbell_ind = (I*)dbell_ind_managed.get();
+    T* dbell_val = (T*)dbell_val_managed.get();
+    T* dB        = (T*)dB_managed.get();
+    T* dC_1      = (T*)dC_1_managed.get();
+    T* dC_2      = (T*)dC_2_managed.get();
+    T* d_alpha   = (T*)d_alpha_managed.get();
+    T* d_beta    = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbell_ind, hbell_ind.data(), sizeof(I) * mb * ell_blocks, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbell_val, hbell_val.data(), sizeof(T) * m * ell_cols, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateBlockedEll(
+        &A, m, k, block_dim, ell_cols, dbell_ind, dbell_val, typeI, idx_base, typeT));
+
+    // Create dense matrices
+    hipsparseDnMatDescr_t B, C1, C2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, B_m, B_n, ldb, dB, typeT, orderB));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C1, C_m, C_n, ldc, dC_1, typeT, orderC));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C2, C_m, C_n, ldc, dC_2, typeT, orderC));
+
+    // Query SpMM buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_bufferSize(
+        handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, &bufferSize));
+
+    //When using cusparse backend, cant pass nullptr for buffer to preprocess
+    if(bufferSize == 0)
+    {
+        bufferSize = 4;
+    }
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_preprocess(
+        handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMM(handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMM(handle, transA, transB, d_alpha, A, B, d_beta, C2, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+        // CPU, on the padded CSR matrix
+        host_csrmm(m,
+                   n,
+                   k,
+                   transA,
+                   transB,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcsr_col_ind.data(),
+                   hcsr_val.data(),
+                   hB.data(),
+                   ldb,
+                   orderB,
+                   h_beta,
+                   hC_gold.data(),
+                   ldc,
+                   orderC,
+                   idx_base,
+                   false);
+
+        // Blocked ELL rows sum the padded zeros as well
+        unit_check_tolerance tol;
+        tol.row_length = ell_cols;
+
+        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_1.data(), tol);
+        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_2.data(), tol);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = spmm_gflop_count(n, nnz_A, nnz_C, h_beta != make_DataType<T>(0));
+        double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = bellmm_gbyte_count<T>(
+            mb, ell_blocks, block_dim, nnz_B, nnz_C, h_beta != make_DataType<T>(0));
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::K,
+                            k,
+                            display_key_t::nnzA,
+                            nnz_A,
+                            display_key_t::block_dim,
+                            block_dim,
+                            display_key_t::ell_width,
+                            ell_cols,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::algorithm,
+                            hipsparse_spmmalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 #endif // TESTING_SPMM_BELL_HPP
@@ -0,0 +1,472 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMM_BSR_HPP
+#define TESTING_SPMM_BSR_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_spmm_bsr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              mb        = 50;
+    int64_t              kb        = 50;
+    int64_t              nnzb      = 50;
+    int64_t              block_dim = 2;
+    int64_t              n         = 10;
+    int64_t              safe_size = 1000;
+    float                alpha     = 0.6;
+    float                beta      = 0.2;
+    hipsparseOperation_t transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOperation_t transB    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOrder_t     order     = HIPSPARSE_ORDER_COL;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+    hipsparseSpMMAlg_t   alg       = HIPSPARSE_SPMM_ALG_DEFAULT;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dB_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dC_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dbuf_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dB   = (float*)dB_managed.get();
+    float* dC   = (float*)dC_managed.get();
+    void*  dbuf = (void*)dbuf_managed.get();
+
+    // SpMM structures
+    hipsparseSpMatDescr_t A;
+    hipsparseDnMatDescr_t B, C;
+
+    size_t bsize;
+
+    int64_t m = mb * block_dim;
+    int64_t k = kb * block_dim;
+
+    // Create SpMM structures
+    verify_hipsparse_status_success(hipsparseCreateBsr(&A,
+                                                       mb,
+                                                       kb,
+                                                       nnzb,
+                                                       block_dim,
+                                                       block_dim,
+                                                       dptr,
+                                                       dcol,
+                                                       dval,
+                                                       idxType,
+                                                       idxType,
+                                                       idxBase,
+                                                       dataType,
+                                                       HIPSPARSE_ORDER_ROW),
+                                    "success");
+    verify_hipsparse_status_success(hipsparseCreateDnMat(&B, k, n, k, dB, dataType, order),
+                                    "success");
+    verify_hipsparse_status_success(hipsparseCreateDnMat(&C, m, n, m, dC, dataType, order),
+                                    "success");
+
+    // SpMM buffer
+    verify_hipsparse_status_invalid_handle(hipsparseSpMM_bufferSize(
+        nullptr, transA, transB, &alpha, A, B, &beta, C, dataType, alg, &bsize));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMM_bufferSize(
+            handle, transA, transB, nullptr, A, B, &beta, C, dataType, alg, &bsize),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMM_bufferSize(
+            handle, transA, transB, &alpha, nullptr, B, &beta, C, dataType, alg, &bsize),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMM_bufferSize(
+            handle, transA, transB, &alpha, A, B, &beta, C, dataType, alg, nullptr),
+        "Error: bsize is nullptr");
+
+    // SpMM
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpMM(nullptr, transA, transB, &alpha, A, B, &beta, C, dataType, alg, dbuf));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMM(handle, transA, transB, nullptr, A, B, &beta, C, dataType, alg, dbuf),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMM(handle, transA, transB, &alpha, nullptr, B, &beta, C, dataType, alg, dbuf),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMM(handle, transA, transB, &alpha, A, nullptr, &beta, C, dataType, alg, dbuf),
+        "Error: B is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMM(handle, transA, transB, &alpha, A, B, &beta, nullptr, dataType, alg, dbuf),
+        "Error: C is nullptr");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnMat(B), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnMat(C), "success");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_spmm_bsr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  m             = argus.M;
+    int                  n             = argus.N;
+    int                  k             = argus.K;
+    int                  row_block_dim = argus.row_block_dimA;
+    int                  col_block_dim = argus.col_block_dimA;
+    hipsparseOrder_t     orderA        = argus.orderA;
+    T                    h_alpha       = make_DataType<T>(argus.alpha);
+    T                    h_beta        = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA        = argus.transA;
+    hipsparseOperation_t transB        = argus.transB;
+    hipsparseOrder_t     orderB        = argus.orderB;
+    hipsparseOrder_t     orderC        = argus.orderC;
+    hipsparseIndexBase_t idx_base      = argus.baseA;
+    hipsparseSpMMAlg_t   alg           = HIPSPARSE_SPMM_ALG_DEFAULT;
+    std::string          filename      = argus.filename;
+
+    // Blocks stored in row major order match the row direction of the legacy BSR routines
+    hipsparseDirection_t dir = (orderA == HIPSPARSE_ORDER_ROW) ? HIPSPARSE_DIRECTION_ROW
+                                                               : HIPSPARSE_DIRECTION_COLUMN;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<int>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    int nnz_A;
+    if(!generate_csr_matrix(
+           filename, m, k, nnz_A, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Host conversion
+    int mb = (m + row_block_dim - 1) / row_block_dim;
+    int kb = (k + col_block_dim - 1) / col_block_dim;
+
+    int              nnzb;
+    std::vector<int> hbsr_row_ptr;
+    std::vector<int> hbsr_col_ind;
+    std::vector<T>   hbsr_val;
+
+    host_csr_to_gebsr(dir,
+                      m,
+                      k,
+                      row_block_dim,
+                      col_block_dim,
+                      nnzb,
+                      idx_base,
+                      hcsr_row_ptr,
+                      hcsr_col_ind,
+                      hcsr_val,
+                      idx_base,
+                      hbsr_row_ptr,
+                      hbsr_col_ind,
+                      hbsr_val);
+
+    // The BSR matrix spans whole blocks, the reference is its CSR expansion with the zeros of
+    // the blocks kept explicitly
+    m = mb * row_block_dim;
+    k = kb * col_block_dim;
+
+    std::vector<int> hexp_row_ptr;
+    std::vector<int> hexp_col_ind;
+    std::vector<T>   hexp_val;
+
+    host_gebsr_to_csr(dir,
+                      mb,
+                      kb,
+                      nnzb,
+                      hbsr_val,
+                      hbsr_row_ptr,
+                      hbsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      idx_base,
+                      hexp_val,
+                      hexp_row_ptr,
+                      hexp_col_ind,
+                      idx_base);
+
+    int nnzb_val = nnzb * row_block_dim * col_block_dim;
+
+    // Some matrix properties
+    int A_m = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : k;
+    int A_k = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : m;
+    int B_m = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? A_k : n;
+    int B_n = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : A_k;
+    int C_m = A_m;
+    int C_n = n;
+
+    int ldb = std::max(1, (orderB == HIPSPARSE_ORDER_COL) ? B_m : B_n);
+    int ldc = std::max(1, (orderC == HIPSPARSE_ORDER_COL) ? C_m : C_n);
+
+    int nnz_B = B_m * B_n;
+    int nnz_C = C_m * C_n;
+
+    // Allocate host memory for matrices
+    std::vector<T> hB(nnz_B);
+    std::vector<T> hC_1(nnz_C);
+    std::vector<T> hC_2(nnz_C);
+    std::vector<T> hC_gold(nnz_C);
+
+    hipsparseInit<T>(hB, nnz_B, 1);
+    hipsparseInit<T>(hC_1, nnz_C, 1);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // allocate memory on device
+    auto dbsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (mb + 1)), device_free};
+    auto dbsr_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnzb), device_free};
+    auto dbsr_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnzb_val), device_free};
+    auto dB_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dC_1_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+    auto dC_2_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+    auto d_alpha_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dbsr_row_ptr = (int*)dbsr_row_ptr_managed.get();
+    int* dbsr_col_ind = (int*)dbsr_col_ind_managed.get();
+    T*   dbsr_val     = (T*)dbsr_val_managed.get();
+    T*   dB           = (T*)dB_managed.get();
+    T*   dC_1         = (T*)dC_1_managed.get();
+    T*   dC_2         = (T*)dC_2_managed.get();
+    T*   d_alpha      = (T*)d_alpha_managed.get();
+    T*   d_beta       = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr, hbsr_row_ptr.data(), sizeof(int) * (mb + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_col_ind, hbsr_col_ind.data(), sizeof(int) * nnzb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_val, hbsr_val.data(), sizeof(T) * nnzb_val, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    hipsparseStatus_t     status = hipsparseCreateBsr(&A,
+                                                  mb,
+                                                  kb,
+                                                  nnzb,
+                                                  row_block_dim,
+                                                  col_block_dim,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  dbsr_val,
+                                                  typeI,
+                                                  typeI,
+                                                  idx_base,
+                                                  typeT,
+                                                  orderA);
+
+#if !defined(HIPSPARSE_TEST_HOST_BACKEND)
+    // rocSPARSE blocks are square, rectangular blocks are rejected
+    if(row_block_dim != col_block_dim)
+    {
+        verify_hipsparse_status(status, HIPSPARSE_STATUS_NOT_SUPPORTED, "Error: rectangular blocks");
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+#endif
+    CHECK_HIPSPARSE_ERROR(status);
+
+    // Create dense matrices
+    hipsparseDnMatDescr_t B, C1, C2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, B_m, B_n, ldb, dB, typeT, orderB));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C1, C_m, C_n, ldc, dC_1, typeT, orderC));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C2, C_m, C_n, ldc, dC_2, typeT, orderC));
+
+    // Query SpMM buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_bufferSize(
+        handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_preprocess(
+        handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMM(handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMM(handle, transA, transB, d_alpha, A, B, d_beta, C2, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+        // CPU, on the expanded CSR matrix
+        host_csrmm(A_m,
+                   n,
+                   A_k,
+                   transA,
+                   transB,
+                   h_alpha,
+                   hexp_row_ptr.data(),
+                   hexp_col_ind.data(),
+                   hexp_val.data(),
+                   hB.data(),
+                   ldb,
+                   orderB,
+                   h_beta,
+                   hC_gold.data(),
+                   ldc,
+                   orderC,
+                   idx_base,
+                   false);
+
+        // Rows with many entries are summed in a different order on the device
+        unit_check_tolerance tol;
+        tol.row_length = host_csr_max_sum_length(
+            transA, m, k, hexp_row_ptr.data(), hexp_col_ind.data(), idx_base);
+
+        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_1.data(), tol);
+        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_2.data(), tol);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = spmm_gflop_count(n, nnzb_val, nnz_C, h_beta != make_DataType<T>(0));
+        double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = gebsrmm_gbyte_count<T>(mb,
+                                                    nnzb,
+                                                    row_block_dim,
+                                                    col_block_dim,
+                                                    nnz_B,
+                                                    nnz_C,
+                                                    h_beta != make_DataType<T>(0));
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::K,
+                            k,
+                            display_key_t::nnzbA,
+                            nnzb,
+                            display_key_t::row_block_dimA,
+                            row_block_dim,
+                            display_key_t::col_block_dimA,
+                            col_block_dim,
+                            display_key_t::order,
+                            orderA,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::algorithm,
+                            hipsparse_spmmalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMM_BSR_HPP
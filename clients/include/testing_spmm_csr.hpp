@@ -391,13 +391,18 @@ hipsparseStatus_t testing_spmm_csr(Arguments argus)
                    idx_base,
                    false);
 
-        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_1.data());
-        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_2.data());
+        // Rows with many entries are summed in a different order on the device
+        unit_check_tolerance tol;
+        tol.row_length = host_csr_max_sum_length(
+            transA, A_m, A_n, hcsr_row_ptr.data(), hcsr_col_ind.data(), idx_base);
+
+        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_1.data(), tol);
+        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_2.data(), tol);
     }
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -409,16 +414,18 @@ hipsparseStatus_t testing_spmm_csr(Arguments argus)
                 handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
                 handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count
             = spmm_gflop_count(n, nnz_A, (I)C_m * (I)C_n, h_beta != make_DataType<T>(0));
@@ -0,0 +1,307 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMM_SELL_HPP
+#define TESTING_SPMM_SELL_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmm_sell(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    I                    m          = argus.M;
+    I                    n          = argus.N;
+    I                    k          = argus.K;
+    I                    slice_size = argus.block_dim;
+    I                    sigma      = argus.sigma;
+    T                    h_alpha    = make_DataType<T>(argus.alpha);
+    T                    h_beta     = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA     = argus.transA;
+    hipsparseOperation_t transB     = argus.transB;
+    hipsparseOrder_t     orderB     = argus.orderB;
+    hipsparseOrder_t     orderC     = argus.orderC;
+    hipsparseIndexBase_t idx_base   = argus.baseA;
+    hipsparseSpMMAlg_t   alg        = HIPSPARSE_SPMM_ALG_DEFAULT;
+    std::string          filename   = argus.filename;
+
+    // Sliced ELL SpMM is only defined for non-transposed A
+    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE || slice_size <= 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz_A;
+    if(!generate_csr_matrix(
+           filename, m, k, nnz_A, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Sliced ELL matrix, C holds the rows of A in the sliced ELL order
+    std::vector<I> hsell_offsets;
+    std::vector<I> hperm;
+    std::vector<I> hsell_col_ind;
+    std::vector<T> hsell_val;
+
+    host_csr_to_sell(m,
+                     hcsr_row_ptr,
+                     hcsr_col_ind,
+                     hcsr_val,
+                     slice_size,
+                     sigma,
+                     hsell_offsets,
+                     hperm,
+                     hsell_col_ind,
+                     hsell_val,
+                     idx_base);
+
+    I nslices   = (m + slice_size - 1) / slice_size;
+    I sell_size = hsell_offsets[nslices];
+
+    // Some matrix properties
+    I B_m = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : n;
+    I B_n = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : k;
+    I C_m = m;
+    I C_n = n;
+
+    I ldb = std::max((I)1, (orderB == HIPSPARSE_ORDER_COL) ? B_m : B_n);
+    I ldc = std::max((I)1, (orderC == HIPSPARSE_ORDER_COL) ? C_m : C_n);
+
+    I nnz_B = B_m * B_n;
+    I nnz_C = C_m * C_n;
+
+    // Allocate host memory for matrices
+    std::vector<T> hB(nnz_B);
+    std::vector<T> hC_1(nnz_C);
+    std::vector<T> hC_2(nnz_C);
+    std::vector<T> hC_gold(nnz_C);
+
+    hipsparseInit<T>(hB, nnz_B, 1);
+    hipsparseInit<T>(hC_1, nnz_C, 1);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // allocate memory on device
+    auto dsell_offsets_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (nslices + 1)), device_free};
+    auto dsell_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * sell_size), device_free};
+    auto dsell_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * sell_size), device_free};
+    auto dB_managed        = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dC_1_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+    auto dC_2_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+    auto d_alpha_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dsell_offsets = (I*)dsell_offsets_managed.get();
+    I* dsell_col_ind = (I*)dsell_col_ind_managed.get();
+    T* dsell_val     = (T*)dsell_val_managed.get();
+    T* dB            = (T*)dB_managed.get();
+    T* dC_1          = (T*)dC_1_managed.get();
+    T* dC_2          = (T*)dC_2_managed.get();
+    T* d_alpha       = (T*)d_alpha_managed.get();
+    T* d_beta        = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dsell_offsets, hsell_offsets.data(), sizeof(I) * (nslices + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dsell_col_ind, hsell_col_ind.data(), sizeof(I) * sell_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dsell_val, hsell_val.data(), sizeof(T) * sell_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateSlicedEll(&A,
+                                                   m,
+                                                   k,
+                                                   nnz_A,
+                                                   sell_size,
+                                                   slice_size,
+                                                   dsell_offsets,
+                                                   dsell_col_ind,
+                                                   dsell_val,
+                                                   typeI,
+                                                   typeI,
+                                                   idx_base,
+                                                   typeT));
+
+    // Create dense matrices
+    hipsparseDnMatDescr_t B, C1, C2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, B_m, B_n, ldb, dB, typeT, orderB));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C1, C_m, C_n, ldc, dC_1, typeT, orderC));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C2, C_m, C_n, ldc, dC_2, typeT, orderC));
+
+    // Query SpMM buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_bufferSize(
+        handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMM(handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMM(handle, transA, transB, d_alpha, A, B, d_beta, C2, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+        host_sellmm(m,
+                    n,
+                    transB,
+                    h_alpha,
+                    hsell_offsets.data(),
+                    hsell_col_ind.data(),
+                    hsell_val.data(),
+                    slice_size,
+                    hB.data(),
+                    ldb,
+                    orderB,
+                    h_beta,
+                    hC_gold.data(),
+                    ldc,
+                    orderC,
+                    idx_base);
+
+        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_1.data());
+        unit_check_near(1, nnz_C, 1, hC_gold.data(), hC_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
+                handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = spmm_gflop_count(n, nnz_A, nnz_C, h_beta != make_DataType<T>(0));
+        double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = sellmm_gbyte_count<T>(
+            nslices, (int64_t)sell_size, nnz_B, nnz_C, h_beta != make_DataType<T>(0));
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::K,
+                            k,
+                            display_key_t::nnzA,
+                            nnz_A,
+                            display_key_t::slice_size,
+                            slice_size,
+                            display_key_t::sigma,
+                            sigma,
+                            display_key_t::sell_size,
+                            sell_size,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::algorithm,
+                            hipsparse_spmmalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMM_SELL_HPP
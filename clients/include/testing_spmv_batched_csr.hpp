@@ -0,0 +1,323 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_BATCHED_CSR_HPP
+#define TESTING_SPMV_BATCHED_CSR_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_spmv_batched_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    int64_t              m         = 10;
+    int64_t              n         = 10;
+    int64_t              nnz       = 10;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+
+    // Batch partitions of the 10 x 10 matrix
+    int64_t rows[]       = {0, 4, 10};
+    int64_t cols[]       = {0, 3, 10};
+    int64_t short_rows[] = {0, 4, 9};
+    int64_t decr_rows[]  = {0, 6, 4, 10};
+    int64_t decr_cols[]  = {0, 3, 5, 10};
+
+    hipsparseSpMatDescr_t A, B;
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(
+        hipsparseCreateCoo(&B, m, n, nnz, dptr, dcol, dval, idxType, idxBase, dataType),
+        "success");
+
+    // hipsparseCsrSetVariableBatch
+    verify_hipsparse_status_invalid_pointer(hipsparseCsrSetVariableBatch(nullptr, 2, rows, cols),
+                                            "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCsrSetVariableBatch(A, 2, nullptr, cols),
+                                            "Error: batchRowOffsets is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCsrSetVariableBatch(A, 2, rows, nullptr),
+                                            "Error: batchColOffsets is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsrSetVariableBatch(A, 0, rows, cols),
+                                          "Error: batchCount is 0");
+    verify_hipsparse_status_invalid_value(hipsparseCsrSetVariableBatch(A, 2, short_rows, cols),
+                                          "Error: batchRowOffsets does not end at m");
+    verify_hipsparse_status_invalid_value(hipsparseCsrSetVariableBatch(A, 3, decr_rows, decr_cols),
+                                          "Error: batchRowOffsets is decreasing");
+    verify_hipsparse_status_invalid_value(hipsparseCsrSetVariableBatch(B, 2, rows, cols),
+                                          "Error: B is not a CSR matrix");
+    verify_hipsparse_status_success(hipsparseCsrSetVariableBatch(A, 2, rows, cols), "success");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(B), "success");
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_batched_csr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    int                  batch_count = argus.batch_count;
+    J                    max_m       = argus.M;
+    J                    max_n       = argus.N;
+    T                    h_alpha     = make_DataType<T>(argus.alpha);
+    T                    h_beta      = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA      = argus.transA;
+    hipsparseIndexBase_t idx_base    = argus.baseA;
+    hipsparseSpMVAlg_t   alg         = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<int64_t> hbatch_rows;
+    std::vector<int64_t> hbatch_cols;
+    std::vector<I>       hcsr_row_ptr;
+    std::vector<J>       hcol_ind;
+    std::vector<T>       hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    gen_csr_variable_batch(batch_count,
+                           max_m,
+                           max_n,
+                           false,
+                           false,
+                           hbatch_rows,
+                           hbatch_cols,
+                           hcsr_row_ptr,
+                           hcol_ind,
+                           hval,
+                           idx_base);
+
+    J m   = hbatch_rows[batch_count];
+    J n   = hbatch_cols[batch_count];
+    I nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Sizes of x and y
+    J size_x = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    J size_y = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    std::vector<T> hx(size_x);
+    std::vector<T> hy_1(size_y);
+    std::vector<T> hy_2(size_y);
+    std::vector<T> hy_gold(size_y);
+
+    hipsparseInit<T>(hx, 1, size_x);
+    hipsparseInit<T>(hy_1, 1, size_y);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dy_1_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+    auto dy_2_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dptr    = (I*)dptr_managed.get();
+    J* dcol    = (J*)dcol_managed.get();
+    T* dval    = (T*)dval_managed.get();
+    T* dx      = (T*)dx_managed.get();
+    T* dy_1    = (T*)dy_1_managed.get();
+    T* dy_2    = (T*)dy_2_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCsrSetVariableBatch(A, batch_count, hbatch_rows.data(), hbatch_cols.data()));
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, size_x, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, size_y, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, size_y, dy_2, typeT));
+
+    // Query SpMV buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    // Preprocess (optional)
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV_preprocess(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+    if(argus.unit_check)
+    {
+        // HIPSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+        // HIPSPARSE pointer mode device
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, d_alpha, A, x, d_beta, y2, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+        // The batches do not interact, the reference is the product of the block diagonal matrix
+        host_csrmv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        unit_check_tolerance tol;
+        tol.row_length = host_csr_max_sum_length(
+            transA, m, n, hcsr_row_ptr.data(), hcol_ind.data(), idx_base);
+
+        unit_check_near(1, size_y, 1, hy_gold.data(), hy_1.data(), tol);
+        unit_check_near(1, size_y, 1, hy_gold.data(), hy_2.data(), tol);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = spmv_gflop_count(m, nnz, h_beta != make_DataType<T>(0.0));
+        double gbyte_count = csrmv_gbyte_count<T>(m, n, nnz, h_beta != make_DataType<T>(0.0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::batch_count,
+                            batch_count,
+                            display_key_t::transA,
+                            transA,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::algorithm,
+                            hipsparse_spmvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMV_BATCHED_CSR_HPP
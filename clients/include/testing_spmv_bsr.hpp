@@ -0,0 +1,565 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_BSR_HPP
+#define TESTING_SPMV_BSR_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_spmv_bsr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              mb        = 100;
+    int64_t              nb        = 100;
+    int64_t              nnzb      = 100;
+    int64_t              block_dim = 2;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+    hipsparseOrder_t     order     = HIPSPARSE_ORDER_ROW;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+
+    hipsparseSpMatDescr_t A;
+
+    // Create BSR structures
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateBsr(nullptr,
+                                                               mb,
+                                                               nb,
+                                                               nnzb,
+                                                               block_dim,
+                                                               block_dim,
+                                                               dptr,
+                                                               dcol,
+                                                               dval,
+                                                               idxType,
+                                                               idxType,
+                                                               idxBase,
+                                                               dataType,
+                                                               order),
+                                            "Error: A is nullptr");
+    verify_hipsparse_status_invalid_size(hipsparseCreateBsr(&A,
+                                                            -1,
+                                                            nb,
+                                                            nnzb,
+                                                            block_dim,
+                                                            block_dim,
+                                                            dptr,
+                                                            dcol,
+                                                            dval,
+                                                            idxType,
+                                                            idxType,
+                                                            idxBase,
+                                                            dataType,
+                                                            order),
+                                         "Error: brows is < 0");
+    verify_hipsparse_status_invalid_size(hipsparseCreateBsr(&A,
+                                                            mb,
+                                                            nb,
+                                                            nnzb,
+                                                            0,
+                                                            0,
+                                                            dptr,
+                                                            dcol,
+                                                            dval,
+                                                            idxType,
+                                                            idxType,
+                                                            idxBase,
+                                                            dataType,
+                                                            order),
+                                         "Error: rowBlockSize is 0");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateBsr(&A,
+                                                               mb,
+                                                               nb,
+                                                               nnzb,
+                                                               block_dim,
+                                                               block_dim,
+                                                               nullptr,
+                                                               dcol,
+                                                               dval,
+                                                               idxType,
+                                                               idxType,
+                                                               idxBase,
+                                                               dataType,
+                                                               order),
+                                            "Error: bsrRowOffsets is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateBsr(&A,
+                                                               mb,
+                                                               nb,
+                                                               nnzb,
+                                                               block_dim,
+                                                               block_dim,
+                                                               dptr,
+                                                               nullptr,
+                                                               dval,
+                                                               idxType,
+                                                               idxType,
+                                                               idxBase,
+                                                               dataType,
+                                                               order),
+                                            "Error: bsrColInd is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateBsr(&A,
+                                                               mb,
+                                                               nb,
+                                                               nnzb,
+                                                               block_dim,
+                                                               block_dim,
+                                                               dptr,
+                                                               dcol,
+                                                               nullptr,
+                                                               idxType,
+                                                               idxType,
+                                                               idxBase,
+                                                               dataType,
+                                                               order),
+                                            "Error: bsrValues is nullptr");
+
+    // Query BSR structures
+    verify_hipsparse_status_success(hipsparseCreateBsr(&A,
+                                                       mb,
+                                                       nb,
+                                                       nnzb,
+                                                       block_dim,
+                                                       block_dim,
+                                                       dptr,
+                                                       dcol,
+                                                       dval,
+                                                       idxType,
+                                                       idxType,
+                                                       idxBase,
+                                                       dataType,
+                                                       order),
+                                    "success");
+
+    int64_t              brows, bcols, bnnz, rbd, cbd;
+    void*                ptr;
+    void*                col;
+    void*                val;
+    hipsparseIndexType_t ptrType, colType;
+    hipsparseIndexBase_t base;
+    hipDataType          valType;
+    hipsparseOrder_t     blockOrder;
+
+    verify_hipsparse_status_invalid_pointer(hipsparseBsrGet(A,
+                                                            &brows,
+                                                            &bcols,
+                                                            &bnnz,
+                                                            &rbd,
+                                                            nullptr,
+                                                            &ptr,
+                                                            &col,
+                                                            &val,
+                                                            &ptrType,
+                                                            &colType,
+                                                            &base,
+                                                            &valType,
+                                                            &blockOrder),
+                                            "Error: colBlockSize is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseBsrGet(A,
+                                                            &brows,
+                                                            &bcols,
+                                                            &bnnz,
+                                                            &rbd,
+                                                            &cbd,
+                                                            &ptr,
+                                                            &col,
+                                                            &val,
+                                                            &ptrType,
+                                                            &colType,
+                                                            &base,
+                                                            &valType,
+                                                            nullptr),
+                                            "Error: order is nullptr");
+
+    verify_hipsparse_status_success(hipsparseBsrGet(A,
+                                                    &brows,
+                                                    &bcols,
+                                                    &bnnz,
+                                                    &rbd,
+                                                    &cbd,
+                                                    &ptr,
+                                                    &col,
+                                                    &val,
+                                                    &ptrType,
+                                                    &colType,
+                                                    &base,
+                                                    &valType,
+                                                    &blockOrder),
+                                    "success");
+    unit_check_general(1, 1, 1, &mb, &brows);
+    unit_check_general(1, 1, 1, &nb, &bcols);
+    unit_check_general(1, 1, 1, &nnzb, &bnnz);
+    unit_check_general(1, 1, 1, &block_dim, &rbd);
+    unit_check_general(1, 1, 1, &block_dim, &cbd);
+
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_spmv_bsr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  m             = argus.M;
+    int                  n             = argus.N;
+    int                  row_block_dim = argus.row_block_dimA;
+    int                  col_block_dim = argus.col_block_dimA;
+    hipsparseOrder_t     order         = argus.orderA;
+    T                    h_alpha       = make_DataType<T>(argus.alpha);
+    T                    h_beta        = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA        = argus.transA;
+    hipsparseIndexBase_t idx_base      = argus.baseA;
+    hipsparseSpMVAlg_t   alg           = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename      = argus.filename;
+
+    // Blocks stored in row major order match the row direction of the legacy BSR routines
+    hipsparseDirection_t dir = (order == HIPSPARSE_ORDER_ROW) ? HIPSPARSE_DIRECTION_ROW
+                                                              : HIPSPARSE_DIRECTION_COLUMN;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<int>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    int nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Host conversion
+    int mb = (m + row_block_dim - 1) / row_block_dim;
+    int nb = (n + col_block_dim - 1) / col_block_dim;
+
+    int              nnzb;
+    std::vector<int> hbsr_row_ptr;
+    std::vector<int> hbsr_col_ind;
+    std::vector<T>   hbsr_val;
+
+    host_csr_to_gebsr(dir,
+                      m,
+                      n,
+                      row_block_dim,
+                      col_block_dim,
+                      nnzb,
+                      idx_base,
+                      hcsr_row_ptr,
+                      hcsr_col_ind,
+                      hcsr_val,
+                      idx_base,
+                      hbsr_row_ptr,
+                      hbsr_col_ind,
+                      hbsr_val);
+
+    // The BSR matrix spans whole blocks, the reference is its CSR expansion with the zeros of
+    // the blocks kept explicitly
+    int              M = mb * row_block_dim;
+    int              N = nb * col_block_dim;
+    std::vector<int> hexp_row_ptr;
+    std::vector<int> hexp_col_ind;
+    std::vector<T>   hexp_val;
+
+    host_gebsr_to_csr(dir,
+                      mb,
+                      nb,
+                      nnzb,
+                      hbsr_val,
+                      hbsr_row_ptr,
+                      hbsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      idx_base,
+                      hexp_val,
+                      hexp_row_ptr,
+                      hexp_col_ind,
+                      idx_base);
+
+    int nnzb_val = nnzb * row_block_dim * col_block_dim;
+    int x_size   = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? N : M;
+    int y_size   = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? M : N;
+
+    std::vector<T> hx(x_size);
+    std::vector<T> hy_1(y_size);
+    std::vector<T> hy_2(y_size);
+    std::vector<T> hy_gold(y_size);
+
+    hipsparseInit<T>(hx, 1, x_size);
+    hipsparseInit<T>(hy_1, 1, y_size);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dbsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (mb + 1)), device_free};
+    auto dbsr_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnzb), device_free};
+    auto dbsr_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnzb_val), device_free};
+    auto dx_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T) * x_size), device_free};
+    auto dy_1_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * y_size), device_free};
+    auto dy_2_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * y_size), device_free};
+    auto d_alpha_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dbsr_row_ptr = (int*)dbsr_row_ptr_managed.get();
+    int* dbsr_col_ind = (int*)dbsr_col_ind_managed.get();
+    T*   dbsr_val     = (T*)dbsr_val_managed.get();
+    T*   dx           = (T*)dx_managed.get();
+    T*   dy_1         = (T*)dy_1_managed.get();
+    T*   dy_2         = (T*)dy_2_managed.get();
+    T*   d_alpha      = (T*)d_alpha_managed.get();
+    T*   d_beta       = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr, hbsr_row_ptr.data(), sizeof(int) * (mb + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_col_ind, hbsr_col_ind.data(), sizeof(int) * nnzb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_val, hbsr_val.data(), sizeof(T) * nnzb_val, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * x_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    hipsparseStatus_t     status = hipsparseCreateBsr(&A,
+                                                  mb,
+                                                  nb,
+                                                  nnzb,
+                                                  row_block_dim,
+                                                  col_block_dim,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  dbsr_val,
+                                                  typeI,
+                                                  typeI,
+                                                  idx_base,
+                                                  typeT,
+                                                  order);
+
+#if !defined(HIPSPARSE_TEST_HOST_BACKEND)
+    // rocSPARSE blocks are square, rectangular blocks are rejected
+    if(row_block_dim != col_block_dim)
+    {
+        verify_hipsparse_status(status, HIPSPARSE_STATUS_NOT_SUPPORTED, "Error: rectangular blocks");
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+#endif
+    CHECK_HIPSPARSE_ERROR(status);
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, x_size, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, y_size, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, y_size, dy_2, typeT));
+
+    // Query SpMV buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    if(argus.unit_check)
+    {
+        // The descriptor reports the block dimensions of the matrix
+        int64_t              brows, bcols, bnnz, rbd, cbd;
+        void*                ptr;
+        void*                col;
+        void*                val;
+        hipsparseIndexType_t ptrType, colType;
+        hipsparseIndexBase_t base;
+        hipDataType          valType;
+        hipsparseOrder_t     blockOrder;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseBsrGet(A,
+                                              &brows,
+                                              &bcols,
+                                              &bnnz,
+                                              &rbd,
+                                              &cbd,
+                                              &ptr,
+                                              &col,
+                                              &val,
+                                              &ptrType,
+                                              &colType,
+                                              &base,
+                                              &valType,
+                                              &blockOrder));
+
+        int64_t mb_64  = mb;
+        int64_t nb_64  = nb;
+        int64_t rbd_64 = row_block_dim;
+        int64_t cbd_64 = col_block_dim;
+        unit_check_general(1, 1, 1, &mb_64, &brows);
+        unit_check_general(1, 1, 1, &nb_64, &bcols);
+        unit_check_general(1, 1, 1, &rbd_64, &rbd);
+        unit_check_general(1, 1, 1, &cbd_64, &cbd);
+
+        // HIPSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+        // HIPSPARSE pointer mode device
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, d_alpha, A, x, d_beta, y2, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+
+        host_csrmv(transA,
+                   M,
+                   N,
+                   nnzb_val,
+                   h_alpha,
+                   hexp_row_ptr.data(),
+                   hexp_col_ind.data(),
+                   hexp_val.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        // Rows with many entries are summed in a different order on the device
+        unit_check_tolerance tol;
+        tol.row_length = host_csr_max_sum_length(
+            transA, M, N, hexp_row_ptr.data(), hexp_col_ind.data(), idx_base);
+
+        unit_check_near(1, y_size, 1, hy_gold.data(), hy_1.data(), tol);
+        unit_check_near(1, y_size, 1, hy_gold.data(), hy_2.data(), tol);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = spmv_gflop_count(M, nnzb_val, h_beta != make_DataType<T>(0.0));
+        double gbyte_count = gebsrmv_gbyte_count<T>(
+            mb, nb, nnzb, row_block_dim, col_block_dim, h_beta != make_DataType<T>(0.0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::nnzb,
+                            nnzb,
+                            display_key_t::row_block_dimA,
+                            row_block_dim,
+                            display_key_t::col_block_dimA,
+                            col_block_dim,
+                            display_key_t::order,
+                            order,
+                            display_key_t::transA,
+                            transA,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::algorithm,
+                            hipsparse_spmvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMV_BSR_HPP
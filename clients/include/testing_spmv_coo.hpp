@@ -272,20 +272,18 @@ hipsparseStatus_t testing_spmv_coo(Arguments argus)
         CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
 
         // Host SpMV
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(I i = 0; i < m; ++i)
-        {
-            hy_gold[i] = testing_mult(h_beta, hy_gold[i]);
-        }
-
-        for(I i = 0; i < nnz; ++i)
-        {
-            hy_gold[hrow_ind[i] - idx_base] = testing_fma(testing_mult(h_alpha, hval[i]),
-                                                          hx[hcol_ind[i] - idx_base],
-                                                          hy_gold[hrow_ind[i] - idx_base]);
-        }
+        host_coomv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hrow_ind.data(),
+                   hcol_ind.data(),
+                   hval.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
 
         unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
         unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
@@ -293,7 +291,7 @@ hipsparseStatus_t testing_spmv_coo(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -305,16 +303,18 @@ hipsparseStatus_t testing_spmv_coo(Arguments argus)
                 hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(
                 hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = spmv_gflop_count(m, nnz, h_beta != make_DataType<T>(0.0));
         double gbyte_count = coomv_gbyte_count<T>(m, n, nnz, h_beta != make_DataType<T>(0.0));
@@ -33,6 +33,10 @@
 #include "unit.hpp"
 #include "utility.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <hipsparse.h>
 #include <string>
 #include <typeinfo>
@@ -171,6 +175,154 @@ void testing_spmv_csr_bad_arg(void)
 #endif
 }
 
+#if(!defined(CUDART_VERSION)) && !defined(HIPSPARSE_TEST_HOST_BACKEND)
+// Round trips HIPSPARSE_SPMV_TUNING_CACHE: the first HIPSPARSE_SPMV_ALG_AUTO run stores its
+// choice, a new descriptor on the same matrix finds it there instead of tuning again.
+hipsparseStatus_t testing_spmv_csr_tuning_cache(void)
+{
+    int                  m        = 64;
+    int                  n        = 64;
+    int                  nnz      = 3 * m - 2;
+    float                h_alpha  = 2.0f;
+    float                h_beta   = 1.0f;
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseSpMVAlg_t   alg      = HIPSPARSE_SPMV_ALG_AUTO;
+    std::string          path     = "hipsparse_spmv_tuning_cache_test.txt";
+
+    std::remove(path.c_str());
+    setenv("HIPSPARSE_SPMV_TUNING_CACHE", path.c_str(), 1);
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Tridiagonal matrix
+    std::vector<int>   hcsr_row_ptr(m + 1, 0);
+    std::vector<int>   hcol_ind;
+    std::vector<float> hval;
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = std::max(i - 1, 0); j <= std::min(i + 1, n - 1); ++j)
+        {
+            hcol_ind.push_back(j);
+            hval.push_back(static_cast<float>(i - j + 2));
+        }
+        hcsr_row_ptr[i + 1] = static_cast<int>(hcol_ind.size());
+    }
+
+    std::vector<float> hx(n);
+    std::vector<float> hy(m);
+    hipsparseInit<float>(hx, 1, n);
+    hipsparseInit<float>(hy, 1, m);
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * n), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(float) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+
+    hipsparseDnVecDescr_t x, y;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, n, dx, HIP_R_32F));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, m, dy, HIP_R_32F));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    std::vector<std::string> lines;
+    for(int run = 0; run < 2; ++run)
+    {
+        hipsparseSpMatDescr_t A;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 dptr,
+                                                 dcol,
+                                                 dval,
+                                                 HIPSPARSE_INDEX_32I,
+                                                 HIPSPARSE_INDEX_32I,
+                                                 idx_base,
+                                                 HIP_R_32F));
+
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+
+        size_t bufferSize;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+            handle, transA, &h_alpha, A, x, &h_beta, y, HIP_R_32F, alg, &bufferSize));
+
+        void* buffer;
+        CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMV_preprocess(
+            handle, transA, &h_alpha, A, x, &h_beta, y, HIP_R_32F, alg, buffer));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y, HIP_R_32F, alg, buffer));
+
+        std::vector<float> hy_result(m);
+        CHECK_HIP_ERROR(hipMemcpy(hy_result.data(), dy, sizeof(float) * m, hipMemcpyDeviceToHost));
+
+        std::vector<float> hy_gold = hy;
+        host_csrmv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_result.data());
+
+        CHECK_HIP_ERROR(hipFree(buffer));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+
+        // The first run stores one "<fingerprint> <algorithm>" line, the second finds it
+        std::ifstream file(path);
+        std::string   line;
+        lines.clear();
+        while(std::getline(file, line))
+        {
+            lines.push_back(line);
+        }
+
+        int64_t line_count = lines.size();
+        int64_t one        = 1;
+        unit_check_general(1, 1, 1, &one, &line_count);
+
+        unsigned long long fingerprint;
+        int                stored;
+        int                fields = (line_count == 1)
+                                        ? sscanf(lines[0].c_str(), "%llx %d", &fingerprint, &stored)
+                                        : 0;
+        int                two    = 2;
+        unit_check_general(1, 1, 1, &two, &fields);
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+
+    unsetenv("HIPSPARSE_SPMV_TUNING_CACHE");
+    std::remove(path.c_str());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
 template <typename I, typename J, typename T>
 hipsparseStatus_t testing_spmv_csr(Arguments argus)
 {
@@ -290,88 +442,31 @@ hipsparseStatus_t testing_spmv_csr(Arguments argus)
         CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
 
-        // Query for warpSize
-        hipDeviceProp_t prop;
-        hipGetDeviceProperties(&prop, 0);
-
-        int WF_SIZE;
-        I   nnz_per_row = nnz / m;
-
-        if(prop.warpSize == 32)
-        {
-            if(nnz_per_row < 4)
-                WF_SIZE = 2;
-            else if(nnz_per_row < 8)
-                WF_SIZE = 4;
-            else if(nnz_per_row < 16)
-                WF_SIZE = 8;
-            else if(nnz_per_row < 32)
-                WF_SIZE = 16;
-            else
-                WF_SIZE = 32;
-        }
-        else if(prop.warpSize == 64)
-        {
-            if(nnz_per_row < 4)
-                WF_SIZE = 2;
-            else if(nnz_per_row < 8)
-                WF_SIZE = 4;
-            else if(nnz_per_row < 16)
-                WF_SIZE = 8;
-            else if(nnz_per_row < 32)
-                WF_SIZE = 16;
-            else if(nnz_per_row < 64)
-                WF_SIZE = 32;
-            else
-                WF_SIZE = 64;
-        }
-        else
-        {
-            return HIPSPARSE_STATUS_INTERNAL_ERROR;
-        }
-
-        for(J i = 0; i < m; ++i)
-        {
-            std::vector<T> sum(WF_SIZE, make_DataType<T>(0.0));
-
-            for(I j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; j += WF_SIZE)
-            {
-                for(int k = 0; k < WF_SIZE; ++k)
-                {
-                    if(j + k < hcsr_row_ptr[i + 1] - idx_base)
-                    {
-                        sum[k] = testing_fma(testing_mult(h_alpha, hval[j + k]),
-                                             hx[hcol_ind[j + k] - idx_base],
-                                             sum[k]);
-                    }
-                }
-            }
-
-            for(int j = 1; j < WF_SIZE; j <<= 1)
-            {
-                for(int k = 0; k < WF_SIZE - j; ++k)
-                {
-                    sum[k] = sum[k] + sum[k + j];
-                }
-            }
-
-            if(h_beta == make_DataType<T>(0.0))
-            {
-                hy_gold[i] = sum[0];
-            }
-            else
-            {
-                hy_gold[i] = testing_fma(h_beta, hy_gold[i], sum[0]);
-            }
-        }
-
-        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
-        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+        host_csrmv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        // Rows with many entries are summed in a different order on the device
+        unit_check_tolerance tol;
+        tol.row_length = host_csr_max_sum_length(
+            transA, m, n, hcsr_row_ptr.data(), hcol_ind.data(), idx_base);
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data(), tol);
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data(), tol);
     }
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -383,16 +478,18 @@ hipsparseStatus_t testing_spmv_csr(Arguments argus)
                 hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(
                 hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = spmv_gflop_count(m, nnz, h_beta != make_DataType<T>(0.0));
         double gbyte_count = csrmv_gbyte_count<T>(m, n, nnz, h_beta != make_DataType<T>(0.0));
@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_CSR_MIXED_HPP
+#define TESTING_SPMV_CSR_MIXED_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+// Mixed precision SpMV: A and x are stored in type A, y in type Y and the computation
+// is done in type C, which is also the type of alpha and beta
+template <typename I, typename A, typename Y, typename C>
+hipsparseStatus_t testing_spmv_csr_mixed(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    I                    m        = argus.M;
+    I                    n        = argus.N;
+    C                    h_alpha  = static_cast<C>(argus.alpha);
+    C                    h_beta   = static_cast<C>(argus.beta);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   alg      = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+
+    // Index and data types
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeA = getDataType<A>();
+    hipDataType          typeY = getDataType<Y>();
+    hipDataType          typeC = getDataType<C>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Sparsity pattern, values are replaced by small integers that are exact in every type
+    std::vector<I>     hcsr_row_ptr;
+    std::vector<I>     hcol_ind;
+    std::vector<float> hval_float;
+
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(
+           std::string(""), m, n, nnz, hcsr_row_ptr, hcol_ind, hval_float, idx_base))
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    I xsize = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    I ysize = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    std::vector<A> hval(nnz);
+    std::vector<A> hx(xsize);
+    std::vector<Y> hy(ysize);
+
+    for(I i = 0; i < nnz; ++i)
+    {
+        hval[i] = convert_DataType<A>(static_cast<float>(rand() % 5 - 2));
+    }
+    for(I i = 0; i < xsize; ++i)
+    {
+        hx[i] = convert_DataType<A>(static_cast<float>(rand() % 5 - 2));
+    }
+    for(I i = 0; i < ysize; ++i)
+    {
+        hy[i] = convert_DataType<Y>(static_cast<float>(rand() % 5 - 2));
+    }
+
+    std::vector<Y> hy_gold = hy;
+
+    // Allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(A) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(A) * xsize), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(Y) * ysize), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    I* dcol = (I*)dcol_managed.get();
+    A* dval = (A*)dval_managed.get();
+    A* dx   = (A*)dx_managed.get();
+    Y* dy   = (Y*)dy_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(A) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(A) * xsize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Y) * ysize, hipMemcpyHostToDevice));
+
+    // Create descriptors
+    hipsparseSpMatDescr_t matA;
+    hipsparseDnVecDescr_t x, y;
+
+#if defined(HIPSPARSE_TEST_HOST_BACKEND)
+    // The host backend only computes in float, double and their complex types, descriptors
+    // holding any other value type are rejected
+    verify_hipsparse_status_not_supported(
+        hipsparseCreateCsr(&matA, m, n, nnz, dptr, dcol, dval, typeI, typeI, idx_base, typeA),
+        "Error: the value type of A is not supported");
+    verify_hipsparse_status_not_supported(hipsparseCreateDnVec(&x, xsize, dx, typeA),
+                                          "Error: the value type of x is not supported");
+
+    return HIPSPARSE_STATUS_SUCCESS;
+#endif
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&matA, m, n, nnz, dptr, dcol, dval, typeI, typeI, idx_base, typeA));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, xsize, dx, typeA));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, ysize, dy, typeY));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, matA, x, &h_beta, y, typeC, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_preprocess(
+        handle, transA, &h_alpha, matA, x, &h_beta, y, typeC, alg, buffer));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV(handle, transA, &h_alpha, matA, x, &h_beta, y, typeC, alg, buffer));
+
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(Y) * ysize, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        host_csrmv_mixed(transA,
+                         m,
+                         n,
+                         h_alpha,
+                         hcsr_row_ptr.data(),
+                         hcol_ind.data(),
+                         hval.data(),
+                         hx.data(),
+                         h_beta,
+                         hy_gold.data(),
+                         idx_base);
+
+        // All operands are small integers, so the result is exact in every compute type. The
+        // comparison is done in the compute type, 16 bit values have no unit_check_general
+        std::vector<C> hy_gold_c(ysize);
+        std::vector<C> hy_c(ysize);
+        for(I i = 0; i < ysize; ++i)
+        {
+            hy_gold_c[i] = convert_DataType<C>(hy_gold[i]);
+            hy_c[i]      = convert_DataType<C>(hy[i]);
+        }
+
+        unit_check_general(1, ysize, 1, hy_gold_c.data(), hy_c.data());
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(matA));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMV_CSR_MIXED_HPP
@@ -0,0 +1,583 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_FUSED_CSR_HPP
+#define TESTING_SPMV_FUSED_CSR_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <limits>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_spmv_fused_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    float                alpha     = 0.6;
+    float                beta      = 0.2;
+    float                result;
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idxBase  = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType  = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType = HIP_R_32F;
+    hipsparseSpMVAlg_t   alg      = HIPSPARSE_SPMV_ALG_DEFAULT;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto db_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dr_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dbuf_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+    float* db   = (float*)db_managed.get();
+    float* dr   = (float*)dr_managed.get();
+    void*  dbuf = (void*)dbuf_managed.get();
+
+    // The matrix is empty, so that the size checks can run on uninitialized arrays
+    CHECK_HIP_ERROR(hipMemset(dptr, 0, sizeof(int) * (m + 1)));
+
+    // Fused SpMV structures
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x, y, b, r, s;
+
+    size_t bsize;
+
+    // Create fused SpMV structures
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dx, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, dy, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&b, m, db, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&r, m, dr, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&s, m / 2, dr, dataType), "success");
+
+    // SpMVDot buffer
+    verify_hipsparse_status_invalid_handle(hipsparseSpMVDot_bufferSize(
+        nullptr, transA, &alpha, A, x, &beta, y, dataType, alg, &bsize));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot_bufferSize(
+            handle, transA, nullptr, A, x, &beta, y, dataType, alg, &bsize),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot_bufferSize(
+            handle, transA, &alpha, nullptr, x, &beta, y, dataType, alg, &bsize),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot_bufferSize(
+            handle, transA, &alpha, A, nullptr, &beta, y, dataType, alg, &bsize),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot_bufferSize(
+            handle, transA, &alpha, A, x, nullptr, y, dataType, alg, &bsize),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot_bufferSize(
+            handle, transA, &alpha, A, x, &beta, nullptr, dataType, alg, &bsize),
+        "Error: y is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot_bufferSize(
+            handle, transA, &alpha, A, x, &beta, y, dataType, alg, nullptr),
+        "Error: bsize is nullptr");
+
+    // SpMVDot
+    verify_hipsparse_status_invalid_handle(hipsparseSpMVDot(
+        nullptr, transA, &alpha, A, x, &beta, y, &result, dataType, alg, dbuf));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(handle, transA, nullptr, A, x, &beta, y, &result, dataType, alg, dbuf),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, nullptr, x, &beta, y, &result, dataType, alg, dbuf),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, A, nullptr, &beta, y, &result, dataType, alg, dbuf),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(handle, transA, &alpha, A, x, nullptr, y, &result, dataType, alg, dbuf),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, A, x, &beta, nullptr, &result, dataType, alg, dbuf),
+        "Error: y is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(handle, transA, &alpha, A, x, &beta, y, nullptr, dataType, alg, dbuf),
+        "Error: result is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, A, x, &beta, y, &result, dataType, alg, nullptr),
+        "Error: dbuf is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVDot(handle, transA, &alpha, A, x, &beta, s, &result, dataType, alg, dbuf),
+        "Error: y and x have different sizes");
+
+    // SpMVResidual buffer
+    verify_hipsparse_status_invalid_handle(hipsparseSpMVResidual_bufferSize(
+        nullptr, transA, &alpha, A, x, &beta, y, b, r, dataType, alg, &bsize));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual_bufferSize(
+            handle, transA, nullptr, A, x, &beta, y, b, r, dataType, alg, &bsize),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual_bufferSize(
+            handle, transA, &alpha, nullptr, x, &beta, y, b, r, dataType, alg, &bsize),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual_bufferSize(
+            handle, transA, &alpha, A, nullptr, &beta, y, b, r, dataType, alg, &bsize),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual_bufferSize(
+            handle, transA, &alpha, A, x, nullptr, y, b, r, dataType, alg, &bsize),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual_bufferSize(
+            handle, transA, &alpha, A, x, &beta, nullptr, b, r, dataType, alg, &bsize),
+        "Error: y is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual_bufferSize(
+            handle, transA, &alpha, A, x, &beta, y, nullptr, r, dataType, alg, &bsize),
+        "Error: b is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual_bufferSize(
+            handle, transA, &alpha, A, x, &beta, y, b, nullptr, dataType, alg, &bsize),
+        "Error: r is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual_bufferSize(
+            handle, transA, &alpha, A, x, &beta, y, b, r, dataType, alg, nullptr),
+        "Error: bsize is nullptr");
+
+    // SpMVResidual
+    verify_hipsparse_status_invalid_handle(hipsparseSpMVResidual(
+        nullptr, transA, &alpha, A, x, &beta, y, b, r, &result, dataType, alg, dbuf));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, nullptr, A, x, &beta, y, b, r, &result, dataType, alg, dbuf),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, nullptr, x, &beta, y, b, r, &result, dataType, alg, dbuf),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, nullptr, &beta, y, b, r, &result, dataType, alg, dbuf),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, x, nullptr, y, b, r, &result, dataType, alg, dbuf),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, x, &beta, nullptr, b, r, &result, dataType, alg, dbuf),
+        "Error: y is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, x, &beta, y, nullptr, r, &result, dataType, alg, dbuf),
+        "Error: b is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, x, &beta, y, b, nullptr, &result, dataType, alg, dbuf),
+        "Error: r is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, x, &beta, y, b, r, nullptr, dataType, alg, dbuf),
+        "Error: result is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, x, &beta, y, b, r, &result, dataType, alg, nullptr),
+        "Error: dbuf is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, x, &beta, y, s, r, &result, dataType, alg, dbuf),
+        "Error: b and y have different sizes");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVResidual(
+            handle, transA, &alpha, A, x, &beta, y, b, s, &result, dataType, alg, dbuf),
+        "Error: r and y have different sizes");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(b), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(r), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(s), "success");
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_fused_csr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    J                    m        = argus.M;
+    J                    n        = argus.M;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   alg      = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename = argus.filename;
+
+    typedef hipsparse::floating_data_t<T> S;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    srand(12345ULL);
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    // Read or construct CSR matrix
+    I nnz = 0;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // op(A) is square
+    if(m != n)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    std::vector<T> hx(m);
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+    std::vector<T> hy_gold(m);
+    std::vector<T> hb(m);
+    std::vector<T> hr_1(m);
+    std::vector<T> hr_2(m);
+    std::vector<T> hr_gold(m);
+
+    hipsparseInit<T>(hx, 1, m);
+    hipsparseInit<T>(hy_1, 1, m);
+    hipsparseInit<T>(hb, 1, m);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_1_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto db_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dr_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_dot_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_nrm_managed   = hipsparse_unique_ptr{device_malloc(sizeof(S)), device_free};
+
+    I* dptr    = (I*)dptr_managed.get();
+    J* dcol    = (J*)dcol_managed.get();
+    T* dval    = (T*)dval_managed.get();
+    T* dx      = (T*)dx_managed.get();
+    T* dy_1    = (T*)dy_1_managed.get();
+    T* dy_2    = (T*)dy_2_managed.get();
+    T* db      = (T*)db_managed.get();
+    T* dr      = (T*)dr_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+    T* d_dot   = (T*)d_dot_managed.get();
+    S* d_nrm   = (S*)d_nrm_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2, b, r;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, m, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, m, dy_2, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&b, m, db, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&r, m, dr, typeT));
+
+    // Query fused SpMV buffers
+    size_t bufferSize_dot;
+    size_t bufferSize_residual;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMVDot_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize_dot));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMVResidual_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, b, r, typeT, alg, &bufferSize_residual));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, std::max(bufferSize_dot, bufferSize_residual)));
+
+    if(argus.unit_check)
+    {
+        T h_dot_1, h_dot_2;
+        S h_nrm_1, h_nrm_2;
+
+        // HIPSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMVDot(
+            handle, transA, &h_alpha, A, x, &h_beta, y1, &h_dot_1, typeT, alg, buffer));
+
+        // HIPSPARSE pointer mode device
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMVDot(
+            handle, transA, d_alpha, A, x, d_beta, y2, d_dot, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&h_dot_2, d_dot, sizeof(T), hipMemcpyDeviceToHost));
+
+        // CPU
+        host_csrmv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        T      h_dot_gold = make_DataType<T>(0.0);
+        double dot_bound  = 0.0;
+        for(J i = 0; i < m; ++i)
+        {
+            h_dot_gold = h_dot_gold + testing_conj(hx[i]) * hy_gold[i];
+            dot_bound += testing_abs(hx[i]) * testing_abs(hy_gold[i]);
+        }
+
+        unit_check_tolerance tol;
+        tol.row_length = host_csr_max_sum_length(
+            transA, m, n, hcsr_row_ptr.data(), hcol_ind.data(), idx_base);
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data(), tol);
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data(), tol);
+
+        // The components of a complex dot product can cancel, their error is bounded by the
+        // one of the sum of the moduli
+        unit_check_tolerance dot_tol;
+        dot_tol.row_length = tol.row_length + m;
+        dot_tol.abs        = dot_tol.row_length * std::numeric_limits<S>::epsilon() * dot_bound;
+
+        unit_check_near(1, 1, 1, &h_dot_gold, &h_dot_1, dot_tol);
+        unit_check_near(1, 1, 1, &h_dot_gold, &h_dot_2, dot_tol);
+
+        // The residual is computed from y := alpha * op(A) * x + beta * y, starting over from
+        // the same y
+        hy_1    = hy_gold;
+        hy_2    = hy_gold;
+        hr_gold = hb;
+
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+        // HIPSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMVResidual(
+            handle, transA, &h_alpha, A, x, &h_beta, y1, b, r, &h_nrm_1, typeT, alg, buffer));
+
+        // HIPSPARSE pointer mode device, the residual overwrites b
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMVResidual(
+            handle, transA, d_alpha, A, x, d_beta, y2, b, b, d_nrm, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hr_1.data(), dr, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hr_2.data(), db, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&h_nrm_2, d_nrm, sizeof(S), hipMemcpyDeviceToHost));
+
+        // CPU
+        host_csrmv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        double h_nrm2_gold = 0.0;
+        double nrm2_bound  = 0.0;
+        for(J i = 0; i < m; ++i)
+        {
+            double abs_b = testing_abs(hr_gold[i]);
+            double abs_y = testing_abs(hy_gold[i]);
+
+            hr_gold[i] = hr_gold[i] - hy_gold[i];
+            h_nrm2_gold += testing_abs(hr_gold[i]) * testing_abs(hr_gold[i]);
+            nrm2_bound += (abs_b + abs_y) * (abs_b + abs_y);
+        }
+
+        S h_nrm_gold = static_cast<S>(std::sqrt(h_nrm2_gold));
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data(), tol);
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data(), tol);
+
+        // b - y can cancel, its error is bounded by the one of |b| + |y|
+        unit_check_tolerance r_tol = tol;
+        r_tol.row_length += 1;
+        r_tol.abs = r_tol.row_length * std::numeric_limits<S>::epsilon()
+                    * std::sqrt(nrm2_bound / std::max(m, static_cast<J>(1)));
+
+        unit_check_near(1, m, 1, hr_gold.data(), hr_1.data(), r_tol);
+        unit_check_near(1, m, 1, hr_gold.data(), hr_2.data(), r_tol);
+
+        unit_check_tolerance nrm_tol;
+        nrm_tol.row_length = r_tol.row_length + m;
+        nrm_tol.abs        = nrm_tol.row_length * std::numeric_limits<S>::epsilon()
+                      * std::sqrt(nrm2_bound);
+
+        unit_check_near(1, 1, 1, &h_nrm_gold, &h_nrm_1, nrm_tol);
+        unit_check_near(1, 1, 1, &h_nrm_gold, &h_nrm_2, nrm_tol);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        S h_nrm;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVResidual(
+                handle, transA, &h_alpha, A, x, &h_beta, y1, b, r, &h_nrm, typeT, alg, buffer));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVResidual(
+                handle, transA, &h_alpha, A, x, &h_beta, y1, b, r, &h_nrm, typeT, alg, buffer));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        // The epilogue adds a subtraction and a multiply-add per entry, and reads b and writes r
+        double gflop_count
+            = spmv_gflop_count(m, nnz, h_beta != make_DataType<T>(0.0)) + 3.0 * m / 1e9;
+        double gbyte_count = csrmv_gbyte_count<T>(m, n, nnz, h_beta != make_DataType<T>(0.0))
+                             + 2.0 * m * sizeof(T) / 1e9;
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::transA,
+                            transA,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::algorithm,
+                            hipsparse_spmvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(b));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(r));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMV_FUSED_CSR_HPP
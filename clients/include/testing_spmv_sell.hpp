@@ -0,0 +1,470 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_SELL_HPP
+#define TESTING_SPMV_SELL_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_spmv_sell_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m          = 100;
+    int64_t              n          = 100;
+    int64_t              nnz        = 100;
+    int64_t              sell_size  = 100;
+    int64_t              slice_size = 4;
+    int64_t              safe_size  = 100;
+    hipsparseIndexBase_t idxBase    = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType    = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType   = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    auto doff_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dperm_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+
+    int*   doff  = (int*)doff_managed.get();
+    int*   dptr  = (int*)dptr_managed.get();
+    int*   dcol  = (int*)dcol_managed.get();
+    float* dval  = (float*)dval_managed.get();
+    int*   dperm = (int*)dperm_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    int                   size;
+
+    // Create sliced ELL structures
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateSlicedEll(nullptr,
+                                                                     m,
+                                                                     n,
+                                                                     nnz,
+                                                                     sell_size,
+                                                                     slice_size,
+                                                                     doff,
+                                                                     dcol,
+                                                                     dval,
+                                                                     idxType,
+                                                                     idxType,
+                                                                     idxBase,
+                                                                     dataType),
+                                            "Error: A is nullptr");
+    verify_hipsparse_status_invalid_size(hipsparseCreateSlicedEll(&A,
+                                                                  m,
+                                                                  n,
+                                                                  nnz,
+                                                                  sell_size,
+                                                                  0,
+                                                                  doff,
+                                                                  dcol,
+                                                                  dval,
+                                                                  idxType,
+                                                                  idxType,
+                                                                  idxBase,
+                                                                  dataType),
+                                         "Error: sliceSize is 0");
+    verify_hipsparse_status_invalid_size(hipsparseCreateSlicedEll(&A,
+                                                                  m,
+                                                                  n,
+                                                                  nnz,
+                                                                  nnz - 1,
+                                                                  slice_size,
+                                                                  doff,
+                                                                  dcol,
+                                                                  dval,
+                                                                  idxType,
+                                                                  idxType,
+                                                                  idxBase,
+                                                                  dataType),
+                                         "Error: sellValuesSize is smaller than nnz");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateSlicedEll(&A,
+                                                                     m,
+                                                                     n,
+                                                                     nnz,
+                                                                     sell_size,
+                                                                     slice_size,
+                                                                     nullptr,
+                                                                     dcol,
+                                                                     dval,
+                                                                     idxType,
+                                                                     idxType,
+                                                                     idxBase,
+                                                                     dataType),
+                                            "Error: sellSliceOffsets is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateSlicedEll(&A,
+                                                                     m,
+                                                                     n,
+                                                                     nnz,
+                                                                     sell_size,
+                                                                     slice_size,
+                                                                     doff,
+                                                                     nullptr,
+                                                                     dval,
+                                                                     idxType,
+                                                                     idxType,
+                                                                     idxBase,
+                                                                     dataType),
+                                            "Error: sellColInd is nullptr");
+
+    // CSR to sliced ELL conversion
+    verify_hipsparse_status_invalid_handle(
+        hipsparseXcsr2sellNnz(nullptr, m, n, descr, dptr, slice_size, 1, doff, dperm, &size));
+    verify_hipsparse_status_invalid_size(
+        hipsparseXcsr2sellNnz(handle, m, n, descr, dptr, 0, 1, doff, dperm, &size),
+        "Error: sliceSize is 0");
+    verify_hipsparse_status_invalid_size(
+        hipsparseXcsr2sellNnz(handle, m, n, descr, dptr, slice_size, 0, doff, dperm, &size),
+        "Error: sigma is 0");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsr2sellNnz(handle, m, n, descr, nullptr, slice_size, 1, doff, dperm, &size),
+        "Error: csrRowPtrA is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsr2sellNnz(handle, m, n, descr, dptr, slice_size, 4, doff, nullptr, &size),
+        "Error: perm is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsr2sellNnz(handle, m, n, descr, dptr, slice_size, 1, doff, dperm, nullptr),
+        "Error: sellValuesSize is nullptr");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_spmv_sell(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  m          = argus.M;
+    int                  n          = argus.N;
+    int                  slice_size = argus.block_dim;
+    int                  sigma      = argus.sigma;
+    T                    h_alpha    = make_DataType<T>(argus.alpha);
+    T                    h_beta     = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA     = argus.transA;
+    hipsparseIndexBase_t idx_base   = argus.baseA;
+    hipsparseSpMVAlg_t   alg        = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename   = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<int>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle and CSR matrix descriptor
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, idx_base));
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    int nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    int nslices = (m + slice_size - 1) / slice_size;
+
+    // Host conversion
+    std::vector<int> hsell_offsets_gold;
+    std::vector<int> hperm_gold;
+    std::vector<int> hsell_col_ind_gold;
+    std::vector<T>   hsell_val_gold;
+
+    host_csr_to_sell(m,
+                     hcsr_row_ptr,
+                     hcsr_col_ind,
+                     hcsr_val,
+                     slice_size,
+                     sigma,
+                     hsell_offsets_gold,
+                     hperm_gold,
+                     hsell_col_ind_gold,
+                     hsell_val_gold,
+                     idx_base);
+
+    int x_size = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    int y_size = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    std::vector<T> hx(x_size);
+    std::vector<T> hy_1(y_size);
+    std::vector<T> hy_2(y_size);
+    std::vector<T> hy_gold(y_size);
+
+    hipsparseInit<T>(hx, 1, x_size);
+    hipsparseInit<T>(hy_1, 1, y_size);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dsell_offsets_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (nslices + 1)), device_free};
+    auto dperm_managed   = hipsparse_unique_ptr{device_malloc(sizeof(int) * m), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * x_size), device_free};
+    auto dy_1_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * y_size), device_free};
+    auto dy_2_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * y_size), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dcsr_row_ptr  = (int*)dcsr_row_ptr_managed.get();
+    int* dcsr_col_ind  = (int*)dcsr_col_ind_managed.get();
+    T*   dcsr_val      = (T*)dcsr_val_managed.get();
+    int* dsell_offsets = (int*)dsell_offsets_managed.get();
+    int* dperm         = (int*)dperm_managed.get();
+    T*   dx            = (T*)dx_managed.get();
+    T*   dy_1          = (T*)dy_1_managed.get();
+    T*   dy_2          = (T*)dy_2_managed.get();
+    T*   d_alpha       = (T*)d_alpha_managed.get();
+    T*   d_beta        = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * x_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Convert CSR to sliced ELL
+    int sell_size;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsr2sellNnz(
+        handle, m, n, descr, dcsr_row_ptr, slice_size, sigma, dsell_offsets, dperm, &sell_size));
+
+    auto dsell_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * sell_size), device_free};
+    auto dsell_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * sell_size), device_free};
+
+    int* dsell_col_ind = (int*)dsell_col_ind_managed.get();
+    T*   dsell_val     = (T*)dsell_val_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsr2sell(handle,
+                                             m,
+                                             n,
+                                             descr,
+                                             dcsr_val,
+                                             dcsr_row_ptr,
+                                             dcsr_col_ind,
+                                             slice_size,
+                                             dsell_offsets,
+                                             dperm,
+                                             dsell_col_ind,
+                                             dsell_val));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateSlicedEll(&A,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   sell_size,
+                                                   slice_size,
+                                                   dsell_offsets,
+                                                   dsell_col_ind,
+                                                   dsell_val,
+                                                   typeI,
+                                                   typeI,
+                                                   idx_base,
+                                                   typeT));
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, x_size, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, y_size, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, y_size, dy_2, typeT));
+
+    // Query SpMV buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    if(argus.unit_check)
+    {
+        // Check the conversion against the host one
+        std::vector<int> hsell_offsets(nslices + 1);
+        std::vector<int> hperm(m);
+        std::vector<int> hsell_col_ind(sell_size);
+        std::vector<T>   hsell_val(sell_size);
+
+        CHECK_HIP_ERROR(hipMemcpy(hsell_offsets.data(),
+                                  dsell_offsets,
+                                  sizeof(int) * (nslices + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hperm.data(), dperm, sizeof(int) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hsell_col_ind.data(),
+                                  dsell_col_ind,
+                                  sizeof(int) * sell_size,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hsell_val.data(), dsell_val, sizeof(T) * sell_size, hipMemcpyDeviceToHost));
+
+        unit_check_general(1, nslices + 1, 1, hsell_offsets_gold.data(), hsell_offsets.data());
+        unit_check_general(1, m, 1, hperm_gold.data(), hperm.data());
+        unit_check_general(1, sell_size, 1, hsell_col_ind_gold.data(), hsell_col_ind.data());
+        unit_check_general(1, sell_size, 1, hsell_val_gold.data(), hsell_val.data());
+
+        // HIPSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+        // HIPSPARSE pointer mode device
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, d_alpha, A, x, d_beta, y2, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+
+        // Host SpMV, the result is ordered as the sliced ELL rows
+        host_sellmv(transA,
+                    m,
+                    n,
+                    h_alpha,
+                    hsell_offsets_gold.data(),
+                    hsell_col_ind_gold.data(),
+                    hsell_val_gold.data(),
+                    slice_size,
+                    hx.data(),
+                    h_beta,
+                    hy_gold.data(),
+                    idx_base);
+
+        unit_check_near(1, y_size, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, y_size, 1, hy_gold.data(), hy_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = spmv_gflop_count(m, nnz, h_beta != make_DataType<T>(0.0));
+        double gbyte_count = sellmv_gbyte_count<T>(
+            m, n, nslices, (int64_t)sell_size, h_beta != make_DataType<T>(0.0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::slice_size,
+                            slice_size,
+                            display_key_t::sigma,
+                            sigma,
+                            display_key_t::sell_size,
+                            sell_size,
+                            display_key_t::transA,
+                            transA,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::algorithm,
+                            hipsparse_spmvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMV_SELL_HPP
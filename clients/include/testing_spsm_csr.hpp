@@ -386,7 +386,7 @@ hipsparseStatus_t testing_spsm_csr(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -398,16 +398,18 @@ hipsparseStatus_t testing_spsm_csr(Arguments argus)
                 handle, transA, transB, &h_alpha, A, B, C1, typeT, alg, descr, buffer));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(hipsparseSpSM_solve(
                 handle, transA, transB, &h_alpha, A, B, C1, typeT, alg, descr, buffer));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = spsv_gflop_count(m, nnz, diag) * k;
         double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
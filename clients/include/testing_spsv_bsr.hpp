@@ -0,0 +1,324 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPSV_BSR_HPP
+#define TESTING_SPSV_BSR_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+hipsparseStatus_t testing_spsv_bsr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  m         = argus.M;
+    int                  n         = argus.N;
+    int                  block_dim = argus.block_dim;
+    hipsparseOrder_t     order     = argus.orderA;
+    T                    h_alpha   = make_DataType<T>(argus.alpha);
+    hipsparseOperation_t transA    = argus.transA;
+    hipsparseIndexBase_t idx_base  = argus.baseA;
+    hipsparseDiagType_t  diag      = argus.diag_type;
+    hipsparseFillMode_t  uplo      = argus.fill_mode;
+    hipsparseSpSVAlg_t   alg       = static_cast<hipsparseSpSVAlg_t>(argus.spsv_alg);
+    std::string          filename  = argus.filename;
+
+    // Blocks stored in row major order match the row direction of the legacy BSR routines
+    hipsparseDirection_t dir = (order == HIPSPARSE_ORDER_ROW) ? HIPSPARSE_DIRECTION_ROW
+                                                              : HIPSPARSE_DIRECTION_COLUMN;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<int>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    int nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Host conversion, the blocks are square
+    int mb = (m + block_dim - 1) / block_dim;
+
+    int              nnzb;
+    std::vector<int> hbsr_row_ptr;
+    std::vector<int> hbsr_col_ind;
+    std::vector<T>   hbsr_val;
+
+    host_csr_to_gebsr(dir,
+                      m,
+                      m,
+                      block_dim,
+                      block_dim,
+                      nnzb,
+                      idx_base,
+                      hcsr_row_ptr,
+                      hcsr_col_ind,
+                      hcsr_val,
+                      idx_base,
+                      hbsr_row_ptr,
+                      hbsr_col_ind,
+                      hbsr_val);
+
+    // The reference solves with the CSR expansion of the blocks. Padded rows have a zero
+    // diagonal, which is reported as a numerical pivot.
+    m = mb * block_dim;
+
+    std::vector<int> hexp_row_ptr;
+    std::vector<int> hexp_col_ind;
+    std::vector<T>   hexp_val;
+
+    host_gebsr_to_csr(dir,
+                      mb,
+                      mb,
+                      nnzb,
+                      hbsr_val,
+                      hbsr_row_ptr,
+                      hbsr_col_ind,
+                      block_dim,
+                      block_dim,
+                      idx_base,
+                      hexp_val,
+                      hexp_row_ptr,
+                      hexp_col_ind,
+                      idx_base);
+
+    int nnzb_val = nnzb * block_dim * block_dim;
+
+    std::vector<T> hx(m);
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+    std::vector<T> hy_gold(m);
+
+    hipsparseInit<T>(hx, 1, m);
+    hipsparseInit<T>(hy_1, 1, m);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * (mb + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnzb), device_free};
+    auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnzb_val), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_1_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dptr    = (int*)dptr_managed.get();
+    int* dcol    = (int*)dcol_managed.get();
+    T*   dval    = (T*)dval_managed.get();
+    T*   dx      = (T*)dx_managed.get();
+    T*   dy_1    = (T*)dy_1_managed.get();
+    T*   dy_2    = (T*)dy_2_managed.get();
+    T*   d_alpha = (T*)d_alpha_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hbsr_row_ptr.data(), sizeof(int) * (mb + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hbsr_col_ind.data(), sizeof(int) * nnzb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hbsr_val.data(), sizeof(T) * nnzb_val, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    hipsparseSpSVDescr_t descr;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_createDescr(&descr));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateBsr(&A,
+                                             mb,
+                                             mb,
+                                             nnzb,
+                                             block_dim,
+                                             block_dim,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             typeI,
+                                             typeI,
+                                             idx_base,
+                                             typeT,
+                                             order));
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, m, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, m, dy_2, typeT));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &uplo, sizeof(uplo)));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_DIAG_TYPE, &diag, sizeof(diag)));
+
+    // Query SpSV buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_bufferSize(
+        handle, transA, &h_alpha, A, x, y1, typeT, alg, descr, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    // HIPSPARSE pointer mode host
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpSV_analysis(handle, transA, &h_alpha, A, x, y1, typeT, alg, descr, buffer));
+
+    if(argus.unit_check)
+    {
+        // HIPSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpSV_solve(handle, transA, &h_alpha, A, x, y1, typeT, alg, descr));
+
+        // HIPSPARSE pointer mode device
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpSV_solve(handle, transA, d_alpha, A, x, y2, typeT, alg, descr));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        int struct_pivot  = -1;
+        int numeric_pivot = -1;
+        host_csrsv(transA,
+                   m,
+                   nnzb_val,
+                   h_alpha,
+                   hexp_row_ptr.data(),
+                   hexp_col_ind.data(),
+                   hexp_val.data(),
+                   hx.data(),
+                   hy_gold.data(),
+                   diag,
+                   uplo,
+                   idx_base,
+                   &struct_pivot,
+                   &numeric_pivot);
+
+        if(struct_pivot == -1 && numeric_pivot == -1)
+        {
+            unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+            unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpSV_solve(handle, transA, &h_alpha, A, x, y1, typeT, alg, descr));
+        }
+
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            timer.start(iter);
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpSV_solve(handle, transA, &h_alpha, A, x, y1, typeT, alg, descr));
+            timer.stop(iter);
+        }
+
+        double gpu_time_used = timer.finish();
+
+        double gflop_count = spsv_gflop_count(m, nnzb_val, diag);
+        double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = bsrsv_gbyte_count<T>(mb, nnzb, block_dim);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::nnzb,
+                            nnzb,
+                            display_key_t::block_dim,
+                            block_dim,
+                            display_key_t::order,
+                            order,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::algorithm,
+                            hipsparse_spsvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPSV_BSR_HPP
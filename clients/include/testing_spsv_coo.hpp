@@ -324,7 +324,7 @@ hipsparseStatus_t testing_spsv_coo(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
 
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -336,16 +336,18 @@ hipsparseStatus_t testing_spsv_coo(Arguments argus)
                 hipsparseSpSV_solve(handle, transA, &h_alpha, A, x, y1, typeT, alg, descr));
         }
 
-        double gpu_time_used = get_time_us();
+        hipsparse_event_timer timer(handle, number_hot_calls, number_cold_calls);
 
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
+            timer.start(iter);
             CHECK_HIPSPARSE_ERROR(
                 hipsparseSpSV_solve(handle, transA, &h_alpha, A, x, y1, typeT, alg, descr));
+            timer.stop(iter);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used = timer.finish();
 
         double gflop_count = spsv_gflop_count(m, nnz, diag);
         double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_WORKSPACE_POOL_HPP
+#define TESTING_WORKSPACE_POOL_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_workspace_pool_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    size_t size;
+    size_t high_water;
+
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSetWorkspacePoolSize((hipsparseHandle_t) nullptr, 1024));
+    verify_hipsparse_status_invalid_handle(
+        hipsparseGetWorkspacePoolInfo((hipsparseHandle_t) nullptr, &size, &high_water));
+    verify_hipsparse_status_invalid_handle(hipsparseTrimWorkspacePool((hipsparseHandle_t) nullptr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseGetWorkspacePoolInfo(handle, (size_t*)nullptr, &high_water),
+        "Error: size is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseGetWorkspacePoolInfo(handle, &size, (size_t*)nullptr),
+        "Error: highWaterMark is nullptr");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_workspace_pool(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  m        = argus.M;
+    int                  n        = argus.N;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    std::string          filename = argus.filename;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    srand(12345ULL);
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    // Read or construct CSR matrix
+    int nnz = 0;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsc_row_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsc_col_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (n + 1)), device_free};
+    auto dcsc_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    int* dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int* dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    T*   dcsr_val     = (T*)dcsr_val_managed.get();
+    int* dcsc_row_ind = (int*)dcsc_row_ind_managed.get();
+    int* dcsc_col_ptr = (int*)dcsc_col_ptr_managed.get();
+    T*   dcsc_val     = (T*)dcsc_val_managed.get();
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        size_t zero = 0;
+        size_t size;
+        size_t high_water;
+
+        // A fresh handle does not hold any workspace
+        CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspacePoolInfo(handle, &size, &high_water));
+        unit_check_general(1, 1, 1, &zero, &size);
+        unit_check_general(1, 1, 1, &zero, &high_water);
+
+        // First conversion populates the pool
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsr2csc(handle,
+                                                m,
+                                                n,
+                                                nnz,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                dcsc_val,
+                                                dcsc_row_ind,
+                                                dcsc_col_ptr,
+                                                HIPSPARSE_ACTION_NUMERIC,
+                                                idx_base));
+
+        size_t size_1;
+        size_t high_water_1;
+        CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspacePoolInfo(handle, &size_1, &high_water_1));
+
+        if(size_1 < high_water_1)
+        {
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+
+        // Repeated conversions must be served from the pool without growing it
+        for(int iter = 0; iter < 4; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsr2csc(handle,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    dcsc_val,
+                                                    dcsc_row_ind,
+                                                    dcsc_col_ptr,
+                                                    HIPSPARSE_ACTION_NUMERIC,
+                                                    idx_base));
+        }
+
+        size_t size_2;
+        size_t high_water_2;
+        CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspacePoolInfo(handle, &size_2, &high_water_2));
+
+        unit_check_general(1, 1, 1, &size_1, &size_2);
+        unit_check_general(1, 1, 1, &high_water_1, &high_water_2);
+
+        // Trimming releases everything
+        CHECK_HIPSPARSE_ERROR(hipsparseTrimWorkspacePool(handle));
+        CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspacePoolInfo(handle, &size, &high_water));
+        unit_check_general(1, 1, 1, &zero, &size);
+        unit_check_general(1, 1, 1, &zero, &high_water);
+
+        // Pre-sizing with the high-water mark covers the next conversion
+        CHECK_HIPSPARSE_ERROR(hipsparseSetWorkspacePoolSize(handle, high_water_1));
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsr2csc(handle,
+                                                m,
+                                                n,
+                                                nnz,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                dcsc_val,
+                                                dcsc_row_ind,
+                                                dcsc_col_ptr,
+                                                HIPSPARSE_ACTION_NUMERIC,
+                                                idx_base));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspacePoolInfo(handle, &size, &high_water));
+
+        if(size < high_water_1)
+        {
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_WORKSPACE_POOL_HPP
@@ -26,6 +26,7 @@
 #define UNIT_HPP
 
 #include <hipsparse.h>
+#include <vector>
 
 /* =====================================================================
 
@@ -50,4 +51,60 @@ void unit_check_general(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU);
 template <typename T>
 void unit_check_near(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU);
 
+/*! \brief Tolerance of unit_check_near. Every component of an entry passes if its distance to the
+ *  CPU result is at most max(rel * |CPU result|, abs). Negative rel and abs select the defaults of
+ *  the precision, 1e-3 and 1e-10 for single and double precision and 10 machine epsilon. Results
+ *  that accumulate row_length terms of a problem with the given condition estimate raise rel to
+ *  at least row_length * condition * epsilon. */
+struct unit_check_tolerance
+{
+    double  rel        = -1.0;
+    double  abs        = -1.0;
+    int64_t row_length = 1;
+    double  condition  = 1.0;
+};
+
+/*! \brief Entry of a comparison with its position and error. */
+struct unit_check_offender
+{
+    int64_t  i;
+    int64_t  j;
+    double   cpu[2];
+    double   gpu[2];
+    double   abs_error;
+    uint64_t ulp;
+    double   ratio; // Error relative to the tolerance, larger than one if out of tolerance
+};
+
+/*! \brief Statistics of a comparison of two M x N matrices. The errors of complex entries are
+ *  the moduli of their differences, their ULP distance the larger one of their components. The
+ *  norm-wise error is ||GPU - CPU||_F / ||CPU||_F. The worst entries are sorted by their error
+ *  relative to the tolerance. */
+struct unit_check_report
+{
+    int64_t                          count          = 0;
+    int64_t                          failures       = 0;
+    double                           max_abs_error  = 0.0;
+    double                           max_rel_error  = 0.0;
+    double                           mean_rel_error = 0.0;
+    double                           norm_error     = 0.0;
+    uint64_t                         max_ulp        = 0;
+    std::vector<unit_check_offender> worst;
+};
+
+/*! \brief Compares two matrices in parallel with the tolerance of unit_check_near and keeps the
+ *  worst entries. */
+template <typename T>
+unit_check_report unit_check_compare(int64_t                     M,
+                                     int64_t                     N,
+                                     int64_t                     lda,
+                                     const T*                    hCPU,
+                                     const T*                    hGPU,
+                                     const unit_check_tolerance& tol,
+                                     int64_t                     worst = 10);
+
+template <typename T>
+void unit_check_near(
+    int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU, const unit_check_tolerance& tol);
+
 #endif // UNIT_HPP
@@ -28,13 +28,16 @@
 #include <algorithm>
 #include <assert.h>
 #include <complex>
+#include <hip/hip_fp16.h>
 #include <hip/hip_runtime_api.h>
 #include <hipsparse/hipsparse.h>
 #include <math.h>
 #include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <iostream>
@@ -46,6 +49,17 @@
 #ifdef _OPENMP
 #include <omp.h>
 #endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if(!defined(CUDART_VERSION))
+#include <hip/hip_bfloat16.h>
+#endif
 std::string hipsparse_exepath();
 /*!\file
  * \brief provide data initialization and timing utilities.
@@ -276,6 +290,41 @@ inline T make_DataType(double real, double imag = 0.0)
     return make_DataType2<T>(real, imag);
 }
 
+/* ============================================================================================ */
+/*! \brief Convert between the storage and compute types of mixed precision routines. 16 bit
+ *  floating point values go through float, the host has no arithmetic for them. */
+template <typename To, typename From>
+inline To convert_DataType(From v)
+{
+    return static_cast<To>(v);
+}
+
+template <>
+inline float convert_DataType<float, __half>(__half v)
+{
+    return __half2float(v);
+}
+
+template <>
+inline __half convert_DataType<__half, float>(float v)
+{
+    return __float2half(v);
+}
+
+#if(!defined(CUDART_VERSION))
+template <>
+inline float convert_DataType<float, hip_bfloat16>(hip_bfloat16 v)
+{
+    return static_cast<float>(v);
+}
+
+template <>
+inline hip_bfloat16 convert_DataType<hip_bfloat16, float>(float v)
+{
+    return hip_bfloat16(v);
+}
+#endif
+
 /* ============================================================================================ */
 /*! \brief mult */
 template <typename T>
@@ -591,7 +640,112 @@ void gen_dense_random_sparsity_pattern(
 }
 
 /* ============================================================================================ */
-/*! \brief  Generate a random sparse matrix in COO format */
+/*! \brief  Counter based random number generator. Draw k of a stream only depends on the seed,
+ *  the stream and k, so generated matrices can be filled by any number of threads in any order
+ *  and are reproduced exactly from their seed. Draws are the outputs of splitmix64. */
+class host_counter_rng
+{
+public:
+    host_counter_rng(uint64_t seed, uint64_t stream)
+        : m_key(mix(seed ^ mix(stream + golden)))
+    {
+    }
+
+    // Draw k of the stream
+    uint64_t operator()(uint64_t k) const
+    {
+        return mix(m_key + (k + 1) * golden);
+    }
+
+    // Draw k of the stream, uniformly distributed in (0, 1]
+    double uniform(uint64_t k) const
+    {
+        return static_cast<double>(((*this)(k) >> 11) + 1) * (1.0 / 9007199254740992.0);
+    }
+
+private:
+    static constexpr uint64_t golden = 0x9e3779b97f4a7c15ULL;
+
+    static uint64_t mix(uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t m_key;
+};
+
+/*! \brief  Value of draw k, with real and imaginary parts in [1, 10] as in random_generator,
+ *  times sign. */
+template <typename T>
+inline T host_random_value(const host_counter_rng& rng, uint64_t k, double sign = 1.0)
+{
+    uint64_t r = rng(k);
+    return make_DataType<T>(sign * (r % 10 + 1), sign * ((r >> 32) % 10 + 1));
+}
+
+/*! \brief  Seed for generated matrices that do not name one. It is drawn from rand(), so tests
+ *  that call srand() keep generating the same matrices. */
+inline uint64_t host_random_seed()
+{
+    uint64_t hi = rand();
+    uint64_t lo = rand();
+    return (hi << 32) ^ lo;
+}
+
+/* ============================================================================================ */
+/*! \brief  Turns the counts in ptr[1], ..., ptr[n] into offsets that start at base, in place.
+ *  Chunks of ptr are scanned in parallel and then shifted by the total of the chunks before
+ *  them. */
+template <typename I, typename J>
+inline void host_prefix_sum(J n, I* ptr, I base)
+{
+    constexpr J chunk   = 16384;
+    J           nchunks = (n + chunk - 1) / chunk;
+
+    std::vector<I> partial(nchunks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(J c = 0; c < nchunks; ++c)
+    {
+        I sum = 0;
+        for(J i = c * chunk; i < std::min(n, (c + 1) * chunk); ++i)
+        {
+            sum += ptr[i + 1];
+            ptr[i + 1] = sum;
+        }
+
+        partial[c + 1] = sum;
+    }
+
+    partial[0] = base;
+    for(J c = 0; c < nchunks; ++c)
+    {
+        partial[c + 1] += partial[c];
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(J c = 0; c < nchunks; ++c)
+    {
+        for(J i = c * chunk; i < std::min(n, (c + 1) * chunk); ++i)
+        {
+            ptr[i + 1] += partial[c];
+        }
+    }
+
+    ptr[0] = base;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate a random sparse matrix in COO format. Rows are uniformly distributed and the
+ *  columns of every row are normally distributed around the diagonal, with a deviation of the
+ *  number of entries in the row. All draws come from host_counter_rng, so the matrix only depends
+ *  on the seed and the rows are sampled in parallel. */
 template <typename I, typename T>
 void gen_matrix_coo(I                    m,
                     I                    n,
@@ -599,445 +753,756 @@ void gen_matrix_coo(I                    m,
                     std::vector<I>&      row_ind,
                     std::vector<I>&      col_ind,
                     std::vector<T>&      val,
-                    hipsparseIndexBase_t idx_base)
+                    hipsparseIndexBase_t idx_base,
+                    uint64_t             seed)
 {
-    if((I)row_ind.size() != nnz)
-    {
-        row_ind.resize(nnz);
-    }
-    if((I)col_ind.size() != nnz)
-    {
-        col_ind.resize(nnz);
-    }
-    if((I)val.size() != nnz)
+    assert(nnz >= 0 && static_cast<int64_t>(nnz) <= static_cast<int64_t>(m) * n);
+
+    row_ind.resize(nnz);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+    if(nnz == 0)
     {
-        val.resize(nnz);
+        return;
     }
 
+    host_counter_rng row_rng(seed, 0);
+    host_counter_rng val_rng(seed, 1);
+
     // Uniform distributed row indices
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for(I i = 0; i < nnz; ++i)
     {
-        row_ind[i] = rand() % m;
+        row_ind[i] = static_cast<I>(row_rng(i) % m);
     }
 
-    // Sort row indices
-    std::sort(row_ind.begin(), row_ind.end());
-
-    // Sample column indices
-    std::vector<bool> check(nnz, false);
+    std::vector<I> row_ptr(m + 1, 0);
+    for(I i = 0; i < nnz; ++i)
+    {
+        ++row_ptr[row_ind[i] + 1];
+    }
 
+    // A row cannot hold more than n entries, its surplus moves on to the next rows
+    I surplus = 0;
+    for(int pass = 0; pass < 2; ++pass)
     {
-        I i = 0;
-        while(i < nnz)
+        for(I i = 0; i < m; ++i)
         {
-            I begin = i;
-            while(row_ind[i] == row_ind[begin])
+            I& count = row_ptr[i + 1];
+            if(count > n)
             {
-                ++i;
-                if(i >= nnz)
-                {
-                    break;
-                }
+                surplus += count - n;
+                count = n;
+            }
+            else
+            {
+                I take = std::min(surplus, n - count);
+                count += take;
+                surplus -= take;
             }
+        }
+    }
+
+    host_prefix_sum(m, row_ptr.data(), static_cast<I>(0));
+
+    // Sample disjunct column indices of every row
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<bool> check(n, false);
 
-            // Sample i disjunct column indices
-            I idx = begin;
-            while(idx < i)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for(I i = 0; i < m; ++i)
+        {
+            I begin = row_ptr[i];
+            I end   = row_ptr[i + 1];
+            I count = end - begin;
+
+            host_counter_rng rng(seed, 2 + static_cast<uint64_t>(i));
+
+            I        idx       = begin;
+            uint64_t max_draws = 64 * static_cast<uint64_t>(count) + 64;
+            for(uint64_t k = 0; idx < end && k < max_draws; k += 2)
             {
-#define MM_PI 3.1415
                 // Normal distribution around the diagonal
-                I rng = (i - begin) * sqrt(-2.0 * log((double)rand() / RAND_MAX))
-                        * cos(2.0 * MM_PI * (double)rand() / RAND_MAX);
+                double r = std::trunc(count * sqrt(-2.0 * log(rng.uniform(k)))
+                                      * cos(2.0 * 3.14159265358979323846 * rng.uniform(k + 1)));
 
                 if(m <= n)
                 {
-                    rng += row_ind[begin];
+                    r += i;
                 }
 
                 // Repeat if running out of bounds
-                if(rng < 0 || rng > n - 1)
+                if(r < 0 || r > n - 1)
                 {
                     continue;
                 }
 
                 // Check for disjunct column index in current row
-                if(!check[rng])
+                I c = static_cast<I>(r);
+                if(!check[c])
+                {
+                    check[c]     = true;
+                    col_ind[idx] = c;
+                    ++idx;
+                }
+            }
+
+            // Rows that fill up most of their columns run out of draws, they take the lowest
+            // unused columns
+            for(I c = 0; idx < end; ++c)
+            {
+                if(!check[c])
                 {
-                    check[rng]   = true;
-                    col_ind[idx] = rng;
+                    check[c]     = true;
+                    col_ind[idx] = c;
                     ++idx;
                 }
             }
 
             // Reset disjunct check array
-            for(I j = begin; j < i; ++j)
+            for(I j = begin; j < end; ++j)
             {
                 check[col_ind[j]] = false;
+                row_ind[j]        = i;
             }
 
-            // Partially sort column indices
-            std::sort(&col_ind[begin], &col_ind[i]);
-        }
-    }
-
-    // Correct index base accordingly
-    if(idx_base == HIPSPARSE_INDEX_BASE_ONE)
-    {
-        for(I i = 0; i < nnz; ++i)
-        {
-            ++row_ind[i];
-            ++col_ind[i];
+            std::sort(&col_ind[begin], &col_ind[end]);
         }
     }
 
-    // Sample random values
+    // Correct index base accordingly and sample random values
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for(I i = 0; i < nnz; ++i)
     {
-        val[i] = random_generator<T>(); //(double) rand() / RAND_MAX;
+        row_ind[i] += idx_base;
+        col_ind[i] += idx_base;
+        val[i] = host_random_value<T>(val_rng, i);
     }
 }
 
-/* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
-template <typename I>
-static void read_mtx_value(std::istringstream& is, I& row, I& col, float& val)
-{
-    is >> row >> col >> val;
-}
-
-template <typename I>
-static void read_mtx_value(std::istringstream& is, I& row, I& col, double& val)
-{
-    is >> row >> col >> val;
-}
-
-template <typename I>
-static void read_mtx_value(std::istringstream& is, I& row, I& col, hipComplex& val)
-{
-    float real;
-    float imag;
-
-    is >> row >> col >> real >> imag;
-
-    val = make_DataType<hipComplex>(real, imag);
-}
-
-template <typename I>
-static void read_mtx_value(std::istringstream& is, I& row, I& col, hipDoubleComplex& val)
-{
-    double real;
-    double imag;
-
-    is >> row >> col >> real >> imag;
-
-    val = make_DataType<hipDoubleComplex>(real, imag);
-}
-
-template <typename I>
-static void sort(std::vector<I>& perm, std::vector<I>& unsorted_row, std::vector<I>& unsorted_col)
-{
-    std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
-}
-
-template <typename I>
-inline void scan(const char* line, I* nrow, I* ncol, int64_t* nnz)
-{
-    sscanf(line, "%d %d %ld", nrow, ncol, nnz);
-}
-
-template <>
-inline void scan<int64_t>(const char* line, int64_t* nrow, int64_t* ncol, int64_t* nnz)
-{
-    sscanf(line, "%ld %ld %ld", nrow, ncol, nnz);
-}
-
 template <typename I, typename T>
-int read_mtx_matrix(const char*          filename,
-                    I&                   nrow,
-                    I&                   ncol,
-                    int64_t&             nnz,
-                    std::vector<I>&      row,
-                    std::vector<I>&      col,
+void gen_matrix_coo(I                    m,
+                    I                    n,
+                    I                    nnz,
+                    std::vector<I>&      row_ind,
+                    std::vector<I>&      col_ind,
                     std::vector<T>&      val,
                     hipsparseIndexBase_t idx_base)
 {
-    const char* env = getenv("GTEST_LISTENER");
-    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
-    {
-        printf("Reading matrix %s...", filename);
-        fflush(stdout);
-    }
+    gen_matrix_coo(m, n, nnz, row_ind, col_ind, val, idx_base, host_random_seed());
+}
 
-    FILE* f = fopen(filename, "r");
-    if(!f)
+/* ============================================================================================ */
+/*! \brief  Builds an m x n CSR matrix row by row. count(i) returns the number of entries of row
+ *  i and fill(i, col, val) writes them in increasing column order with zero based columns. Both
+ *  are called for all rows in parallel. Returns false if the matrix does not fit I and J. */
+template <typename I, typename J, typename T, typename C, typename F>
+bool host_gen_csr(int64_t              m,
+                  int64_t              n,
+                  J&                   nrow,
+                  J&                   ncol,
+                  I&                   nnz,
+                  std::vector<I>&      ptr,
+                  std::vector<J>&      col,
+                  std::vector<T>&      val,
+                  hipsparseIndexBase_t base,
+                  C&&                  count,
+                  F&&                  fill)
+{
+    if(m > static_cast<int64_t>(std::numeric_limits<J>::max())
+       || n > static_cast<int64_t>(std::numeric_limits<J>::max()))
     {
-        fprintf(stderr,
-                "Failed to open matrix file %s because it does not exist. Please download the "
-                "matrix file using the install script with -c flag.",
-                filename);
-        return -1;
+        return false;
     }
 
-    char line[1024];
+    std::vector<int64_t> row_nnz(m + 1, 0);
 
-    // Check for banner
-    if(!fgets(line, 1024, f))
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t i = 0; i < m; ++i)
     {
-        return -1;
+        row_nnz[i + 1] = count(i);
     }
 
-    char banner[16];
-    char array[16];
-    char coord[16];
-    char data[16];
-    char type[16];
+    host_prefix_sum(m, row_nnz.data(), static_cast<int64_t>(0));
 
-    // Extract banner
-    if(sscanf(line, "%15s %15s %15s %15s %15s", banner, array, coord, data, type) != 5)
+    if(row_nnz[m] > static_cast<int64_t>(std::numeric_limits<I>::max()))
     {
-        return -1;
+        return false;
     }
 
-    // Convert to lower case
-    for(char* p = array; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = coord; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = data; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = type; *p != '\0'; *p = tolower(*p), p++)
-        ;
+    nrow = static_cast<J>(m);
+    ncol = static_cast<J>(n);
+    nnz  = static_cast<I>(row_nnz[m]);
 
-    // Check banner
-    if(strncmp(line, "%%MatrixMarket", 14) != 0)
-    {
-        return -1;
-    }
+    ptr.resize(m + 1);
+    col.resize(nnz);
+    val.resize(nnz);
 
-    // Check array type
-    if(strcmp(array, "matrix") != 0)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for(int64_t i = 0; i < m; ++i)
     {
-        return -1;
-    }
+        int64_t begin = row_nnz[i];
 
-    // Check coord
-    if(strcmp(coord, "coordinate") != 0)
-    {
-        return -1;
+        ptr[i] = static_cast<I>(begin + base);
+        fill(i, &col[begin], &val[begin]);
+
+        for(int64_t j = begin; j < row_nnz[i + 1]; ++j)
+        {
+            col[j] += base;
+        }
     }
 
-    // Check data
-    if(strcmp(data, "real") != 0 && strcmp(data, "integer") != 0 && strcmp(data, "pattern") != 0)
+    ptr[m] = nnz + base;
+
+    return true;
+}
+
+/*! \brief  Replaces the diagonal entry of a row by the sum of the magnitudes of its other
+ *  entries plus one. */
+template <typename J, typename T>
+inline void host_gen_dominant_diagonal(int64_t row, int64_t count, const J* col, T* val)
+{
+    double  sum  = 1.0;
+    int64_t diag = -1;
+    for(int64_t j = 0; j < count; ++j)
     {
-        return -1;
+        if(col[j] == row)
+        {
+            diag = j;
+        }
+        else
+        {
+            sum += testing_abs(val[j]);
+        }
     }
 
-    // Check type
-    if(strcmp(type, "general") != 0 && strcmp(type, "symmetric") != 0)
+    if(diag != -1)
     {
-        return -1;
+        val[diag] = make_DataType<T>(sum);
     }
+}
 
-    // Symmetric flag
-    int symm = !strcmp(type, "symmetric");
-
-    // Skip comments
-    while(fgets(line, 1024, f))
+/*! \brief  Laplacian of an nx x ny x nz grid. The 5 point (2D) and 7 point (3D) stencils couple
+ *  every point to its neighbours along the axes, the 9 point (2D) and 27 point (3D) stencils to
+ *  all neighbours of the surrounding box. */
+template <typename I, typename J, typename T>
+bool host_gen_laplacian(int64_t              nx,
+                        int64_t              ny,
+                        int64_t              nz,
+                        bool                 box,
+                        J&                   nrow,
+                        J&                   ncol,
+                        I&                   nnz,
+                        std::vector<I>&      ptr,
+                        std::vector<J>&      col,
+                        std::vector<T>&      val,
+                        hipsparseIndexBase_t base)
+{
+    // Stencil offsets in (z, y, x) lexicographic order, which is the column order
+    std::vector<int> offsets;
+    for(int dz = (nz > 1 ? -1 : 0); dz <= (nz > 1 ? 1 : 0); ++dz)
     {
-        if(line[0] != '%')
+        for(int dy = -1; dy <= 1; ++dy)
         {
-            break;
+            for(int dx = -1; dx <= 1; ++dx)
+            {
+                if(box || std::abs(dz) + std::abs(dy) + std::abs(dx) <= 1)
+                {
+                    offsets.push_back(dz);
+                    offsets.push_back(dy);
+                    offsets.push_back(dx);
+                }
+            }
         }
     }
 
-    // Read dimensions
-    int64_t snnz;
+    int    points = static_cast<int>(offsets.size() / 3);
+    double center = points - 1;
 
-    scan<I>(line, &nrow, &ncol, &snnz);
-    nnz = symm ? (snnz - nrow) * 2 + nrow : snnz;
+    auto visit = [&](int64_t i, auto&& f) {
+        int64_t x = i % nx;
+        int64_t y = (i / nx) % ny;
+        int64_t z = i / (nx * ny);
 
-    std::vector<I> unsorted_row(nnz);
-    std::vector<I> unsorted_col(nnz);
-    std::vector<T> unsorted_val(nnz);
-
-    // Read entries
-    int64_t idx = 0;
-    while(fgets(line, 1024, f))
-    {
-        if(idx >= nnz)
+        for(int p = 0; p < points; ++p)
         {
-            return 1;
+            int64_t xx = x + offsets[3 * p + 2];
+            int64_t yy = y + offsets[3 * p + 1];
+            int64_t zz = z + offsets[3 * p];
+
+            if(xx >= 0 && xx < nx && yy >= 0 && yy < ny && zz >= 0 && zz < nz)
+            {
+                f((zz * ny + yy) * nx + xx);
+            }
         }
+    };
 
-        I irow;
-        I icol;
-        T ival;
+    int64_t n = nx * ny * nz;
 
-        std::istringstream ss(line);
+    return host_gen_csr(
+        n,
+        n,
+        nrow,
+        ncol,
+        nnz,
+        ptr,
+        col,
+        val,
+        base,
+        [&](int64_t i) {
+            int64_t count = 0;
+            visit(i, [&](int64_t) { ++count; });
+            return count;
+        },
+        [&](int64_t i, J* c, T* v) {
+            int64_t j = 0;
+            visit(i, [&](int64_t k) {
+                c[j] = static_cast<J>(k);
+                v[j] = make_DataType<T>(k == i ? center : -1.0);
+                ++j;
+            });
+        });
+}
 
-        if(!strcmp(data, "pattern"))
-        {
-            ss >> irow >> icol;
-            ival = make_DataType<T>(1.0);
-        }
-        else
-        {
-            read_mtx_value(ss, irow, icol, ival);
-        }
+/*! \brief  Diagonally dominant m x m matrix with bandwidth bw and random entries. */
+template <typename I, typename J, typename T>
+bool host_gen_banded(int64_t              m,
+                     int64_t              bw,
+                     uint64_t             seed,
+                     J&                   nrow,
+                     J&                   ncol,
+                     I&                   nnz,
+                     std::vector<I>&      ptr,
+                     std::vector<J>&      col,
+                     std::vector<T>&      val,
+                     hipsparseIndexBase_t base)
+{
+    host_counter_rng rng(seed, 0);
+
+    return host_gen_csr(
+        m,
+        m,
+        nrow,
+        ncol,
+        nnz,
+        ptr,
+        col,
+        val,
+        base,
+        [&](int64_t i) { return std::min(m - 1, i + bw) - std::max(int64_t(0), i - bw) + 1; },
+        [&](int64_t i, J* c, T* v) {
+            int64_t begin = std::max(int64_t(0), i - bw);
+            int64_t end   = std::min(m - 1, i + bw) + 1;
+            for(int64_t k = begin; k < end; ++k)
+            {
+                c[k - begin] = static_cast<J>(k);
+                v[k - begin] = host_random_value<T>(rng, i * m + k, -1.0);
+            }
+
+            host_gen_dominant_diagonal(i, end - begin, c, v);
+        });
+}
 
-        if(idx_base == HIPSPARSE_INDEX_BASE_ZERO)
-        {
-            --irow;
-            --icol;
-        }
+/*! \brief  Diagonally dominant matrix of mb x mb dense blocks of dimension bd, with the
+ *  diagonal block and bpr - 1 randomly placed blocks in every block row. */
+template <typename I, typename J, typename T>
+bool host_gen_block(int64_t              mb,
+                    int64_t              bd,
+                    int64_t              bpr,
+                    uint64_t             seed,
+                    J&                   nrow,
+                    J&                   ncol,
+                    I&                   nnz,
+                    std::vector<I>&      ptr,
+                    std::vector<J>&      col,
+                    std::vector<T>&      val,
+                    hipsparseIndexBase_t base)
+{
+    bpr = std::min(bpr, mb);
 
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        unsorted_val[idx] = ival;
+    int64_t m = mb * bd;
 
-        ++idx;
+    // Block columns of block row bi, the off diagonal ones are drawn with Floyd's algorithm
+    auto block_cols = [&](int64_t bi) {
+        host_counter_rng rng(seed, 1 + static_cast<uint64_t>(bi));
 
-        if(symm && irow != icol)
+        std::vector<int64_t> cols(1, bi);
+        for(int64_t j = mb - bpr; j < mb - 1; ++j)
         {
-            if(idx >= nnz)
+            int64_t t = static_cast<int64_t>(rng(j) % (j + 1));
+            t += (t >= bi);
+            if(std::find(cols.begin(), cols.end(), t) != cols.end())
             {
-                return 1;
+                t = j + (j >= bi);
             }
-
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            unsorted_val[idx] = ival;
-            ++idx;
+            cols.push_back(t);
         }
+
+        std::sort(cols.begin(), cols.end());
+        return cols;
+    };
+
+    host_counter_rng rng(seed, 0);
+
+    return host_gen_csr(
+        m,
+        m,
+        nrow,
+        ncol,
+        nnz,
+        ptr,
+        col,
+        val,
+        base,
+        [&](int64_t) { return bpr * bd; },
+        [&](int64_t i, J* c, T* v) {
+            std::vector<int64_t> cols = block_cols(i / bd);
+
+            int64_t j = 0;
+            for(int64_t bj : cols)
+            {
+                for(int64_t k = bj * bd; k < (bj + 1) * bd; ++k)
+                {
+                    c[j] = static_cast<J>(k);
+                    v[j] = host_random_value<T>(rng, i * m + k, -1.0);
+                    ++j;
+                }
+            }
+
+            host_gen_dominant_diagonal(i, j, c, v);
+        });
+}
+
+/*! \brief  Recursive matrix (R-MAT) graph with 2^scale vertices and edge_factor * 2^scale edges
+ *  before duplicates are merged. Every edge descends scale levels of the adjacency matrix and
+ *  picks the quadrants with probabilities a, b, c and 1 - a - b - c, so a grows the skew of the
+ *  degree distribution. */
+template <typename I, typename J, typename T>
+bool host_gen_rmat(int64_t              scale,
+                   int64_t              edge_factor,
+                   double               a,
+                   double               b,
+                   double               c,
+                   uint64_t             seed,
+                   J&                   nrow,
+                   J&                   ncol,
+                   I&                   nnz,
+                   std::vector<I>&      ptr,
+                   std::vector<J>&      col,
+                   std::vector<T>&      val,
+                   hipsparseIndexBase_t base)
+{
+    if(scale >= 31 || a < 0 || b < 0 || c < 0 || a + b + c > 1)
+    {
+        return false;
     }
-    fclose(f);
 
-    row.resize(nnz);
-    col.resize(nnz);
-    val.resize(nnz);
+    int64_t n     = int64_t(1) << scale;
+    int64_t edges = edge_factor * n;
+
+    host_counter_rng edge_rng(seed, 0);
+    host_counter_rng val_rng(seed, 1);
+
+    std::vector<int64_t> src(edges);
+    std::vector<int64_t> dst(edges);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t e = 0; e < edges; ++e)
+    {
+        int64_t r = 0;
+        int64_t s = 0;
+        for(int64_t l = 0; l < scale; ++l)
+        {
+            double u = edge_rng.uniform(e * scale + l);
+
+            r = 2 * r + (u > a + b);
+            s = 2 * s + ((u > a && u <= a + b) || u > a + b + c);
+        }
+
+        src[e] = r;
+        dst[e] = s;
+    }
 
-    // Sort by row and column index
-    std::vector<I> perm(nnz);
-    for(int64_t i = 0; i < nnz; ++i)
+    // Bucket the edges by row, then sort and merge the duplicates of every row
+    std::vector<int64_t> row_ptr(n + 1, 0);
+    for(int64_t e = 0; e < edges; ++e)
     {
-        perm[i] = i;
+        ++row_ptr[src[e] + 1];
     }
 
-    sort(perm, unsorted_row, unsorted_col);
+    host_prefix_sum(n, row_ptr.data(), static_cast<int64_t>(0));
 
-    for(int64_t i = 0; i < nnz; ++i)
+    std::vector<int64_t> adj(edges);
     {
-        row[i] = unsorted_row[perm[i]];
-        col[i] = unsorted_col[perm[i]];
-        val[i] = unsorted_val[perm[i]];
+        std::vector<int64_t> pos(row_ptr.begin(), row_ptr.end() - 1);
+        for(int64_t e = 0; e < edges; ++e)
+        {
+            adj[pos[src[e]]++] = dst[e];
+        }
     }
 
-    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    std::vector<int64_t> row_nnz(n);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for(int64_t i = 0; i < n; ++i)
     {
-        printf("done.\n");
-        fflush(stdout);
+        int64_t* begin = adj.data() + row_ptr[i];
+        int64_t* end   = adj.data() + row_ptr[i + 1];
+
+        std::sort(begin, end);
+        row_nnz[i] = std::unique(begin, end) - begin;
     }
 
-    return 0;
+    return host_gen_csr(
+        n,
+        n,
+        nrow,
+        ncol,
+        nnz,
+        ptr,
+        col,
+        val,
+        base,
+        [&](int64_t i) { return row_nnz[i]; },
+        [&](int64_t i, J* cols, T* v) {
+            for(int64_t j = 0; j < row_nnz[i]; ++j)
+            {
+                int64_t k = adj[row_ptr[i] + j];
+
+                cols[j] = static_cast<J>(k);
+                v[j]    = host_random_value<T>(val_rng, i * n + k);
+            }
+        });
 }
 
-/* ============================================================================================ */
-/*! \brief  Read matrix from binary file in CSR format */
-template <typename I, typename J, typename T>
-int read_bin_matrix(const char*          filename,
-                    J&                   nrow,
-                    J&                   ncol,
-                    I&                   nnz,
-                    std::vector<I>&      ptr,
-                    std::vector<J>&      col,
-                    std::vector<T>&      val,
-                    hipsparseIndexBase_t idx_base)
+/*! \brief  Splits a matrix generator spec name:arg:...[:seed=s] into the generator name, its
+ *  positional arguments and its seed. Returns false if name is not a known generator. */
+inline bool parse_matrix_generator_spec(const std::string&        spec,
+                                        std::string&              name,
+                                        std::vector<std::string>& args,
+                                        uint64_t&                 seed)
 {
-    const char* env = getenv("GTEST_LISTENER");
-    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    static const char* generators[]
+        = {"laplace2d", "laplace3d", "banded", "block", "rmat", "random"};
+
+    size_t colon = spec.find(':');
+    if(colon == std::string::npos)
     {
-        printf("Reading matrix %s...", filename);
-        fflush(stdout);
+        return false;
     }
 
-    FILE* f = fopen(filename, "rb");
-    if(!f)
+    name = spec.substr(0, colon);
+    if(std::find_if(std::begin(generators),
+                    std::end(generators),
+                    [&](const char* g) { return name == g; })
+       == std::end(generators))
     {
-        return -1;
+        return false;
     }
 
-    int err;
+    seed = 12345ULL;
+    args.clear();
 
-    int nrowf, ncolf, nnzf;
-
-    err = fread(&nrowf, sizeof(int), 1, f);
-    err |= fread(&ncolf, sizeof(int), 1, f);
-    err |= fread(&nnzf, sizeof(int), 1, f);
-    if(!err)
+    while(colon != std::string::npos)
     {
-        fclose(f);
-        return -1;
+        size_t      next  = spec.find(':', colon + 1);
+        std::string token = spec.substr(colon + 1, next - colon - 1);
+
+        if(token.compare(0, 5, "seed=") == 0)
+        {
+            seed = strtoull(token.c_str() + 5, nullptr, 10);
+        }
+        else
+        {
+            args.push_back(token);
+        }
+
+        colon = next;
     }
-    nrow = (J)nrowf;
-    ncol = (J)ncolf;
-    nnz  = (I)nnzf;
 
-    // Allocate memory
-    std::vector<int>    ptrf(nrow + 1);
-    std::vector<int>    colf(nnz);
-    std::vector<double> valf(nnz);
-    ptr.resize(nrow + 1);
-    col.resize(nnz);
-    val.resize(nnz);
+    return true;
+}
+
+/*! \brief  Returns true if filename is a matrix generator spec rather than a file. */
+inline bool is_matrix_generator_spec(const std::string& filename)
+{
+    std::string              name;
+    std::vector<std::string> args;
+    uint64_t                 seed;
+
+    return parse_matrix_generator_spec(filename, name, args, seed);
+}
+
+/*! \brief  Generate a CSR matrix from a spec name:arg:...[:seed=s]. The generators are
+ *
+ *      laplace2d:n[:5|9]              2D Laplacian on an n x n grid, 5 point by default
+ *      laplace3d:n[:7|27]             3D Laplacian on an n x n x n grid, 7 point by default
+ *      banded:m:bw                    diagonally dominant with bandwidth bw
+ *      block:mb:bd:bpr                diagonally dominant with bpr dense bd x bd blocks per
+ *                                     block row
+ *      rmat:scale:edge_factor[:a:b:c] R-MAT graph, a = 0.57, b = c = 0.19 by default
+ *      random:m:n:nnz                 random as gen_matrix_coo
+ *
+ *  Generated matrices only depend on the spec, the seed defaults to 12345. Returns -1 if the
+ *  spec is invalid or the matrix does not fit I and J. */
+template <typename I, typename J, typename T>
+int generate_matrix_from_spec(const std::string&   spec,
+                              J&                   nrow,
+                              J&                   ncol,
+                              I&                   nnz,
+                              std::vector<I>&      ptr,
+                              std::vector<J>&      col,
+                              std::vector<T>&      val,
+                              hipsparseIndexBase_t idx_base)
+{
+    std::string              name;
+    std::vector<std::string> args;
+    uint64_t                 seed;
 
-    err |= fread(ptrf.data(), sizeof(int), nrow + 1, f);
-    err |= fread(colf.data(), sizeof(int), nnz, f);
-    err |= fread(valf.data(), sizeof(double), nnz, f);
-    if(!err)
+    if(!parse_matrix_generator_spec(spec, name, args, seed))
     {
-        fclose(f);
         return -1;
     }
 
-    fclose(f);
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("Generating matrix %s...", spec.c_str());
+        fflush(stdout);
+    }
+
+    // Positional arguments, missing ones take the default
+    bool valid = true;
+    auto arg   = [&](size_t i, double def) {
+        if(i >= args.size())
+        {
+            return def;
+        }
 
-    for(J i = 0; i < nrow + 1; ++i)
+        char*  end;
+        double v = strtod(args[i].c_str(), &end);
+        if(end == args[i].c_str() || *end != '\0' || v < 0)
+        {
+            valid = false;
+        }
+        return v;
+    };
+
+    bool status = false;
+    if(name == "laplace2d")
     {
-        ptr[i] = (I)ptrf[i];
+        int64_t n      = arg(0, -1);
+        int64_t points = arg(1, 5);
+
+        valid = valid && n > 0 && (points == 5 || points == 9) && args.size() <= 2;
+        status = valid
+                 && host_gen_laplacian(
+                     n, n, 1, points == 9, nrow, ncol, nnz, ptr, col, val, idx_base);
     }
+    else if(name == "laplace3d")
+    {
+        int64_t n      = arg(0, -1);
+        int64_t points = arg(1, 7);
 
-    for(I i = 0; i < nnz; ++i)
+        valid = valid && n > 0 && (points == 7 || points == 27) && args.size() <= 2;
+        status = valid
+                 && host_gen_laplacian(
+                     n, n, n, points == 27, nrow, ncol, nnz, ptr, col, val, idx_base);
+    }
+    else if(name == "banded")
+    {
+        int64_t m  = arg(0, -1);
+        int64_t bw = arg(1, -1);
+
+        valid  = valid && m > 0 && bw >= 0 && args.size() == 2;
+        status = valid && host_gen_banded(m, bw, seed, nrow, ncol, nnz, ptr, col, val, idx_base);
+    }
+    else if(name == "block")
     {
-        col[i] = (J)colf[i];
-        val[i] = make_DataType<T>(valf[i]);
+        int64_t mb  = arg(0, -1);
+        int64_t bd  = arg(1, -1);
+        int64_t bpr = arg(2, -1);
+
+        valid  = valid && mb > 0 && bd > 0 && bpr > 0 && args.size() == 3;
+        status = valid
+                 && host_gen_block(mb, bd, bpr, seed, nrow, ncol, nnz, ptr, col, val, idx_base);
     }
+    else if(name == "rmat")
+    {
+        int64_t scale       = arg(0, -1);
+        int64_t edge_factor = arg(1, -1);
+        double  a           = arg(2, 0.57);
+        double  b           = arg(3, 0.19);
+        double  c           = arg(4, 0.19);
 
-    if(idx_base == HIPSPARSE_INDEX_BASE_ONE)
+        valid  = valid && scale >= 0 && edge_factor >= 0 && (args.size() == 2 || args.size() == 5);
+        status = valid
+                 && host_gen_rmat(
+                     scale, edge_factor, a, b, c, seed, nrow, ncol, nnz, ptr, col, val, idx_base);
+    }
+    else if(name == "random")
     {
-        for(J i = 0; i < nrow + 1; ++i)
-        {
-            ++ptr[i];
-        }
+        int64_t m = arg(0, -1);
+        int64_t n = arg(1, -1);
+        int64_t k = arg(2, -1);
 
-        for(I i = 0; i < nnz; ++i)
+        valid = valid && m >= 0 && n >= 0 && k >= 0 && k <= m * n && args.size() == 3
+                && std::max(std::max(m, n), k)
+                       <= static_cast<int64_t>(std::numeric_limits<J>::max())
+                && k <= static_cast<int64_t>(std::numeric_limits<I>::max());
+        if(valid)
         {
-            ++col[i];
+            // Rows are drawn in J, their offsets counted in I
+            std::vector<J> row_ind;
+            std::vector<J> col_ind;
+            gen_matrix_coo(static_cast<J>(m),
+                           static_cast<J>(n),
+                           static_cast<J>(k),
+                           row_ind,
+                           col_ind,
+                           val,
+                           idx_base,
+                           seed);
+
+            nrow = static_cast<J>(m);
+            ncol = static_cast<J>(n);
+            nnz  = static_cast<I>(k);
+
+            ptr.assign(m + 1, 0);
+            for(int64_t i = 0; i < k; ++i)
+            {
+                ++ptr[row_ind[i] - idx_base + 1];
+            }
+
+            host_prefix_sum(nrow, ptr.data(), static_cast<I>(idx_base));
+            col.swap(col_ind);
+            status = true;
         }
     }
 
+    if(!status)
+    {
+        return -1;
+    }
+
     if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
     {
         printf("done.\n");
@@ -1048,152 +1513,1364 @@ int read_bin_matrix(const char*          filename,
 }
 
 /* ============================================================================================ */
-/*! \brief  Generate CSR matrix from file. File can be either mtx or bin. If filename is empty, a random matrix is generated*/
-template <typename I, typename J, typename T>
-bool generate_csr_matrix(const std::string    filename,
-                         J&                   nrow,
-                         J&                   ncol,
-                         I&                   nnz,
-                         std::vector<I>&      csr_row_ptr,
-                         std::vector<J>&      csr_col_ind,
-                         std::vector<T>&      csr_val,
-                         hipsparseIndexBase_t idx_base)
+/*! \brief  Read only view of a whole file. Where possible the file is memory mapped, so that
+ *  large matrices are parsed straight from the page cache instead of being copied first. */
+class mapped_file
 {
-    // If no filename passed, generate matrix
-    if(filename == "")
+public:
+    explicit mapped_file(const char* filename)
     {
-        double scale = 0.02;
-        if(nrow > 1000 || ncol > 1000)
+#ifndef _WIN32
+        int fd = open(filename, O_RDONLY);
+        if(fd < 0)
         {
-            scale = 2.0 / std::max(nrow, ncol);
+            return;
         }
-        nnz = nrow * scale * ncol;
-
-        std::vector<J> coo_row_ind;
-        gen_matrix_coo(nrow, ncol, (J)nnz, coo_row_ind, csr_col_ind, csr_val, idx_base);
 
-        csr_row_ptr.resize(nrow + 1, 0);
-        for(int i = 0; i < nnz; ++i)
+        struct stat st;
+        if(fstat(fd, &st) == 0 && st.st_size > 0)
         {
-            ++csr_row_ptr[coo_row_ind[i] + 1 - idx_base];
+            void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(map != MAP_FAILED)
+            {
+                madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+                this->map  = map;
+                this->ptr  = static_cast<const char*>(map);
+                this->size = st.st_size;
+            }
         }
 
-        csr_row_ptr[0] = idx_base;
-        for(int i = 0; i < nrow; ++i)
+        close(fd);
+#else
+        FILE* f = fopen(filename, "rb");
+        if(!f)
         {
-            csr_row_ptr[i + 1] += csr_row_ptr[i];
+            return;
         }
 
-        return true;
-    }
-    else
-    {
-        std::string extension = filename.substr(filename.find_last_of(".") + 1);
-        if(extension == "bin")
+        fseek(f, 0, SEEK_END);
+        long length = ftell(f);
+        fseek(f, 0, SEEK_SET);
+
+        if(length > 0)
         {
-            if(read_bin_matrix(
-                   filename.c_str(), nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base)
-               == 0)
+            this->buffer.resize(length);
+            if(fread(this->buffer.data(), 1, length, f) == static_cast<size_t>(length))
             {
-                return true;
+                this->ptr  = this->buffer.data();
+                this->size = length;
             }
         }
-        else if(extension == "mtx")
+
+        fclose(f);
+#endif
+    }
+
+    ~mapped_file()
+    {
+#ifndef _WIN32
+        if(this->map != nullptr)
         {
-            int64_t        nnz_count;
-            std::vector<J> coo_row_ind;
-            if(read_mtx_matrix(filename.c_str(),
-                               nrow,
-                               ncol,
-                               nnz_count,
-                               coo_row_ind,
-                               csr_col_ind,
-                               csr_val,
-                               idx_base)
-               == 0)
-            {
-                if(nnz_count < std::numeric_limits<I>::max())
-                {
-                    nnz = (I)nnz_count;
+            munmap(this->map, this->size);
+        }
+#endif
+    }
 
-                    csr_row_ptr.resize(nrow + 1, 0);
-                    for(int i = 0; i < nnz; ++i)
-                    {
-                        ++csr_row_ptr[coo_row_ind[i] + 1 - idx_base];
-                    }
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
 
-                    csr_row_ptr[0] = idx_base;
-                    for(int i = 0; i < nrow; ++i)
-                    {
-                        csr_row_ptr[i + 1] += csr_row_ptr[i];
-                    }
+    const char* begin() const
+    {
+        return this->ptr;
+    }
 
-                    return true;
-                }
-            }
-        }
+    const char* end() const
+    {
+        return this->ptr + this->size;
     }
 
-    return false;
-}
+    bool valid() const
+    {
+        return this->ptr != nullptr;
+    }
+
+private:
+    void*             map{};
+    const char*       ptr{};
+    size_t            size{};
+    std::vector<char> buffer;
+};
 
 /* ============================================================================================ */
-/*! \brief  Generate COO matrix from file. File can be either mtx or bin. If filename is empty, a random matrix is generated*/
-template <typename I, typename T>
-bool generate_coo_matrix(const std::string    filename,
-                         I&                   nrow,
-                         I&                   ncol,
-                         I&                   nnz,
-                         std::vector<I>&      coo_row_ind,
-                         std::vector<I>&      coo_col_ind,
-                         std::vector<T>&      coo_val,
-                         hipsparseIndexBase_t idx_base)
+/*! \brief  Number scanners for MatrixMarket entries. They parse [p, end) and return the position
+ *  after the number, or nullptr if there is none. */
+static inline const char* mtx_skip_blanks(const char* p, const char* end)
 {
-    // If no filename passed, generate matrix
-    if(filename == "")
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
     {
-        double scale = 0.02;
-        if(nrow > 1000 || ncol > 1000)
-        {
-            scale = 2.0 / std::max(nrow, ncol);
-        }
-        nnz = nrow * scale * ncol;
+        ++p;
+    }
 
-        gen_matrix_coo(nrow, ncol, nnz, coo_row_ind, coo_col_ind, coo_val, idx_base);
+    return p;
+}
 
-        return true;
+static inline bool mtx_is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+template <typename I>
+static inline const char* mtx_scan_int(const char* p, const char* end, I& value)
+{
+    p = mtx_skip_blanks(p, end);
+
+    bool negative = false;
+    if(p < end && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
     }
-    else
+
+    if(p == end || !mtx_is_digit(*p))
     {
-        std::string extension = filename.substr(filename.find_last_of(".") + 1);
-        if(extension == "bin")
-        {
-            std::vector<I> csr_row_ptr;
-            if(read_bin_matrix(
-                   filename.c_str(), nrow, ncol, nnz, csr_row_ptr, coo_col_ind, coo_val, idx_base)
-               == 0)
-            {
-                coo_row_ind.resize(nnz);
-                for(I i = 0; i < nrow; ++i)
-                {
-                    I row_begin = csr_row_ptr[i] - idx_base;
-                    I row_end   = csr_row_ptr[i + 1] - idx_base;
+        return nullptr;
+    }
 
-                    for(I j = row_begin; j < row_end; ++j)
-                    {
-                        coo_row_ind[j] = i + idx_base;
-                    }
-                }
+    int64_t v = 0;
+    while(p < end && mtx_is_digit(*p))
+    {
+        v = v * 10 + (*p - '0');
+        ++p;
+    }
 
-                return true;
-            }
-        }
-        else if(extension == "mtx")
-        {
-            int64_t nnz_count;
-            if(read_mtx_matrix(filename.c_str(),
-                               nrow,
-                               ncol,
+    value = static_cast<I>(negative ? -v : v);
+
+    return p;
+}
+
+// Values with at most 15 significant digits and a small exponent are converted exactly with a
+// single multiplication or division, everything else goes through strtod
+static inline const char* mtx_scan_real(const char* p, const char* end, double& value)
+{
+    static const double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    p = mtx_skip_blanks(p, end);
+
+    const char* start    = p;
+    bool        negative = false;
+    if(p < end && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int      digits   = 0;
+    int      exponent = 0;
+    bool     found    = false;
+
+    // Only the first 19 significant digits fit into the mantissa, the fast path below needs
+    // the value to be exact anyway
+    while(p < end && mtx_is_digit(*p))
+    {
+        found = true;
+        digits += (mantissa != 0 || *p != '0') ? 1 : 0;
+        if(digits <= 19)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+        }
+        else
+        {
+            ++exponent;
+        }
+        ++p;
+    }
+
+    if(p < end && *p == '.')
+    {
+        ++p;
+        while(p < end && mtx_is_digit(*p))
+        {
+            found = true;
+            digits += (mantissa != 0 || *p != '0') ? 1 : 0;
+            if(digits <= 19)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                --exponent;
+            }
+            ++p;
+        }
+    }
+
+    if(found && p + 1 < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D')
+       && (mtx_is_digit(p[1]) || p[1] == '-' || p[1] == '+'))
+    {
+        int         e;
+        const char* q = mtx_scan_int(p + 1, end, e);
+        if(q == nullptr)
+        {
+            found = false;
+        }
+        else
+        {
+            exponent += e;
+            p = q;
+        }
+    }
+
+    bool terminated = (p == end || *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n');
+
+    if(found && terminated && digits <= 15 && exponent >= -22 && exponent <= 22)
+    {
+        double v = static_cast<double>(mantissa);
+        v        = (exponent < 0) ? v / powers[-exponent] : v * powers[exponent];
+        value    = negative ? -v : v;
+
+        return p;
+    }
+
+    // Slow path for long mantissas, large exponents, inf and nan
+    const char* token_end = start;
+    while(token_end < end && *token_end != ' ' && *token_end != '\t' && *token_end != '\r'
+          && *token_end != '\n')
+    {
+        ++token_end;
+    }
+
+    char token[128];
+    if(token_end == start || token_end - start >= static_cast<ptrdiff_t>(sizeof(token)))
+    {
+        return nullptr;
+    }
+
+    for(const char* c = start; c < token_end; ++c)
+    {
+        token[c - start] = (*c == 'd' || *c == 'D') ? 'e' : *c;
+    }
+    token[token_end - start] = '\0';
+
+    char* parsed;
+    value = strtod(token, &parsed);
+
+    return (parsed == token + (token_end - start)) ? token_end : nullptr;
+}
+
+static inline const char* mtx_next_line(const char* p, const char* end)
+{
+    const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+    return (eol != nullptr) ? eol + 1 : end;
+}
+
+// Entry lines are the non empty lines that do not start with '%'
+static inline bool mtx_is_entry_line(const char* p, const char* end)
+{
+    p = mtx_skip_blanks(p, end);
+    return p < end && *p != '\n' && *p != '%';
+}
+
+enum mtx_symmetry
+{
+    mtx_general,
+    mtx_symmetric,
+    mtx_skew_symmetric,
+    mtx_hermitian
+};
+
+/* ============================================================================================ */
+/*! \brief  Read the entries of a MatrixMarket file, with the symmetric part expanded and explicit
+ *  zeros of array files dropped. Indices are zero based and entries are in file order. The file
+ *  is split into chunks on line boundaries that are parsed in parallel. */
+template <typename J, typename T>
+int read_mtx_entries(const char*     filename,
+                     J&              nrow,
+                     J&              ncol,
+                     std::vector<J>& row,
+                     std::vector<J>& col,
+                     std::vector<T>& val)
+{
+    mapped_file file(filename);
+    if(!file.valid())
+    {
+        fprintf(stderr,
+                "Failed to open matrix file %s because it does not exist. Please download the "
+                "matrix file using the install script with -c flag.",
+                filename);
+        return -1;
+    }
+
+    const char* p   = file.begin();
+    const char* end = file.end();
+
+    // Banner
+    char banner[16];
+    char object[16];
+    char format[16];
+    char field[16];
+    char symmetry[16];
+
+    std::string first_line(p, mtx_next_line(p, end));
+    if(sscanf(first_line.c_str(),
+              "%15s %15s %15s %15s %15s",
+              banner,
+              object,
+              format,
+              field,
+              symmetry)
+       != 5)
+    {
+        return -1;
+    }
+
+    for(char* s : {object, format, field, symmetry})
+    {
+        for(; *s != '\0'; ++s)
+        {
+            *s = tolower(*s);
+        }
+    }
+
+    if(strcmp(banner, "%%MatrixMarket") != 0 || strcmp(object, "matrix") != 0)
+    {
+        return -1;
+    }
+
+    bool coordinate = (strcmp(format, "coordinate") == 0);
+    if(!coordinate && strcmp(format, "array") != 0)
+    {
+        return -1;
+    }
+
+    bool pattern = (strcmp(field, "pattern") == 0);
+    bool complex = (strcmp(field, "complex") == 0);
+    if(!pattern && !complex && strcmp(field, "real") != 0 && strcmp(field, "integer") != 0)
+    {
+        return -1;
+    }
+
+    // Complex files can only be read into complex matrices, and array files need values
+    bool complex_type = std::is_same<T, hipComplex>() || std::is_same<T, hipDoubleComplex>();
+    if((complex && !complex_type) || (pattern && !coordinate))
+    {
+        return -1;
+    }
+
+    mtx_symmetry symm;
+    if(strcmp(symmetry, "general") == 0)
+    {
+        symm = mtx_general;
+    }
+    else if(strcmp(symmetry, "symmetric") == 0)
+    {
+        symm = mtx_symmetric;
+    }
+    else if(strcmp(symmetry, "skew-symmetric") == 0)
+    {
+        symm = mtx_skew_symmetric;
+    }
+    else if(strcmp(symmetry, "hermitian") == 0 && complex)
+    {
+        symm = mtx_hermitian;
+    }
+    else
+    {
+        return -1;
+    }
+
+    // Skip comments, then read the size line
+    p = mtx_next_line(p, end);
+    while(p < end && !mtx_is_entry_line(p, end))
+    {
+        p = mtx_next_line(p, end);
+    }
+
+    int64_t nfile;
+    {
+        int64_t     m, n;
+        const char* q = mtx_scan_int(p, end, m);
+        q             = (q != nullptr) ? mtx_scan_int(q, end, n) : nullptr;
+        q             = (q != nullptr && coordinate) ? mtx_scan_int(q, end, nfile) : q;
+        if(q == nullptr || m < 0 || n < 0 || (symm != mtx_general && m != n))
+        {
+            return -1;
+        }
+
+        nrow = static_cast<J>(m);
+        ncol = static_cast<J>(n);
+
+        if(!coordinate)
+        {
+            // Array files list columns, of symmetric matrices only the lower triangle
+            nfile = (symm == mtx_general)          ? m * n
+                    : (symm == mtx_skew_symmetric) ? m * (m - 1) / 2
+                                                   : m * (m + 1) / 2;
+        }
+
+        p = mtx_next_line(q, end);
+    }
+
+    // Split the entries into chunks that start on a line boundary
+#ifdef _OPENMP
+    int nthreads = omp_get_max_threads();
+#else
+    int nthreads = 1;
+#endif
+    int64_t nchunks = std::max<int64_t>(1, std::min<int64_t>(4 * nthreads, (end - p) >> 16));
+
+    std::vector<const char*> chunk_begin(nchunks + 1);
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        const char* q  = p + (end - p) * c / nchunks;
+        chunk_begin[c] = (c == 0 || q[-1] == '\n') ? q : mtx_next_line(q, end);
+    }
+    chunk_begin[nchunks] = end;
+
+    // Count the entry lines of each chunk to find where its entries go
+    std::vector<int64_t> chunk_offset(nchunks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        int64_t count = 0;
+        for(const char* q = chunk_begin[c]; q < chunk_begin[c + 1]; q = mtx_next_line(q, end))
+        {
+            count += mtx_is_entry_line(q, end) ? 1 : 0;
+        }
+
+        chunk_offset[c + 1] = count;
+    }
+
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        chunk_offset[c + 1] += chunk_offset[c];
+    }
+
+    if(chunk_offset[nchunks] != nfile)
+    {
+        return 1;
+    }
+
+    // Parse the entries of the file
+    std::vector<J> file_row(nfile);
+    std::vector<J> file_col(nfile);
+    std::vector<T> file_val(nfile);
+
+    int status = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        int64_t idx = chunk_offset[c];
+
+        // Position of the first entry of the chunk in an array file
+        int64_t i = 0;
+        int64_t j = 0;
+        if(!coordinate && symm == mtx_general)
+        {
+            i = idx % std::max<int64_t>(nrow, 1);
+            j = idx / std::max<int64_t>(nrow, 1);
+        }
+        else if(!coordinate && idx < chunk_offset[c + 1])
+        {
+            int64_t skip = idx;
+            while(true)
+            {
+                int64_t first  = (symm == mtx_general)          ? 0
+                                 : (symm == mtx_skew_symmetric) ? j + 1
+                                                                : j;
+                int64_t length = nrow - first;
+                if(skip < length)
+                {
+                    i = first + skip;
+                    break;
+                }
+                skip -= length;
+                ++j;
+            }
+        }
+
+        for(const char* q = chunk_begin[c]; q < chunk_begin[c + 1]; q = mtx_next_line(q, end))
+        {
+            if(!mtx_is_entry_line(q, end))
+            {
+                continue;
+            }
+
+            int64_t     irow = i + 1;
+            int64_t     icol = j + 1;
+            double      re   = 1.0;
+            double      im   = 0.0;
+            const char* r    = q;
+
+            if(coordinate)
+            {
+                r = mtx_scan_int(r, end, irow);
+                r = (r != nullptr) ? mtx_scan_int(r, end, icol) : nullptr;
+            }
+            if(!pattern)
+            {
+                r = (r != nullptr) ? mtx_scan_real(r, end, re) : nullptr;
+            }
+            if(complex)
+            {
+                r = (r != nullptr) ? mtx_scan_real(r, end, im) : nullptr;
+            }
+
+            if(r == nullptr || irow < 1 || irow > nrow || icol < 1 || icol > ncol)
+            {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                status = -1;
+                break;
+            }
+
+            file_row[idx] = static_cast<J>(irow - 1);
+            file_col[idx] = static_cast<J>(icol - 1);
+            file_val[idx] = make_DataType<T>(re, im);
+            ++idx;
+
+            if(!coordinate)
+            {
+                ++i;
+                if(i == nrow)
+                {
+                    ++j;
+                    i = (symm == mtx_general)          ? 0
+                        : (symm == mtx_skew_symmetric) ? j + 1
+                                                       : j;
+                }
+            }
+        }
+    }
+
+    if(status != 0)
+    {
+        return status;
+    }
+
+    // General coordinate files need no expansion
+    if(coordinate && symm == mtx_general)
+    {
+        row.swap(file_row);
+        col.swap(file_col);
+        val.swap(file_val);
+
+        return 0;
+    }
+
+    // Count the entries every chunk expands to: zeros of array files are dropped and the
+    // off diagonal entries of symmetric matrices are mirrored
+    T zero = make_DataType<T>(0.0);
+
+    auto expanded = [&](int64_t k) -> int64_t {
+        if(!coordinate && file_val[k] == zero)
+        {
+            return 0;
+        }
+
+        return (symm != mtx_general && file_row[k] != file_col[k]) ? 2 : 1;
+    };
+
+    std::vector<int64_t> chunk_nnz(nchunks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        int64_t count = 0;
+        for(int64_t k = chunk_offset[c]; k < chunk_offset[c + 1]; ++k)
+        {
+            count += expanded(k);
+        }
+
+        chunk_nnz[c + 1] = count;
+    }
+
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        chunk_nnz[c + 1] += chunk_nnz[c];
+    }
+
+    int64_t nnz = chunk_nnz[nchunks];
+
+    row.resize(nnz);
+    col.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        int64_t idx = chunk_nnz[c];
+        for(int64_t k = chunk_offset[c]; k < chunk_offset[c + 1]; ++k)
+        {
+            int64_t count = expanded(k);
+            if(count == 0)
+            {
+                continue;
+            }
+
+            row[idx] = file_row[k];
+            col[idx] = file_col[k];
+            val[idx] = file_val[k];
+            ++idx;
+
+            if(count == 2)
+            {
+                row[idx] = file_col[k];
+                col[idx] = file_row[k];
+                val[idx] = (symm == mtx_symmetric)        ? file_val[k]
+                           : (symm == mtx_hermitian)      ? testing_conj(file_val[k])
+                                                          : testing_mult(make_DataType<T>(-1.0),
+                                                                         file_val[k]);
+                ++idx;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Build a CSR matrix, sorted by row and column, from zero based COO entries. Rows are
+ *  bucketed in parallel and every row is then sorted on its own; entries with equal indices
+ *  keep their input order. */
+template <typename I, typename J, typename T>
+void coo_to_sorted_csr(J                     nrow,
+                       const std::vector<J>& coo_row,
+                       const std::vector<J>& coo_col,
+                       const std::vector<T>& coo_val,
+                       std::vector<I>&       csr_row_ptr,
+                       std::vector<J>&       csr_col_ind,
+                       std::vector<T>&       csr_val,
+                       hipsparseIndexBase_t  idx_base)
+{
+    int64_t nnz = coo_row.size();
+
+    std::vector<int64_t> ptr(nrow + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int64_t k = 0; k < nnz; ++k)
+    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        ++ptr[coo_row[k] + 1];
+    }
+
+    for(J i = 0; i < nrow; ++i)
+    {
+        ptr[i + 1] += ptr[i];
+    }
+
+    std::vector<int64_t> next(ptr.begin(), ptr.end() - 1);
+    std::vector<int64_t> perm(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int64_t k = 0; k < nnz; ++k)
+    {
+        int64_t pos;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+        pos = next[coo_row[k]]++;
+
+        perm[pos] = k;
+    }
+
+    csr_row_ptr.resize(nrow + 1);
+    csr_col_ind.resize(nnz);
+    csr_val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < nrow; ++i)
+    {
+        std::sort(perm.begin() + ptr[i], perm.begin() + ptr[i + 1], [&](int64_t a, int64_t b) {
+            return (coo_col[a] < coo_col[b]) || (coo_col[a] == coo_col[b] && a < b);
+        });
+
+        for(int64_t k = ptr[i]; k < ptr[i + 1]; ++k)
+        {
+            csr_col_ind[k] = coo_col[perm[k]] + idx_base;
+            csr_val[k]     = coo_val[perm[k]];
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J i = 0; i < nrow + 1; ++i)
+    {
+        csr_row_ptr[i] = static_cast<I>(ptr[i] + idx_base);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in COO format, sorted by row and column. Supports
+ *  coordinate and array files of general, symmetric, skew-symmetric and hermitian matrices. */
+template <typename I, typename T>
+int read_mtx_matrix(const char*          filename,
+                    I&                   nrow,
+                    I&                   ncol,
+                    int64_t&             nnz,
+                    std::vector<I>&      row,
+                    std::vector<I>&      col,
+                    std::vector<T>&      val,
+                    hipsparseIndexBase_t idx_base)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("Reading matrix %s...", filename);
+        fflush(stdout);
+    }
+
+    std::vector<I> unsorted_row;
+    std::vector<I> unsorted_col;
+    std::vector<T> unsorted_val;
+
+    int status
+        = read_mtx_entries(filename, nrow, ncol, unsorted_row, unsorted_col, unsorted_val);
+    if(status != 0)
+    {
+        return status;
+    }
+
+    std::vector<int64_t> ptr;
+    coo_to_sorted_csr(
+        nrow, unsorted_row, unsorted_col, unsorted_val, ptr, col, val, idx_base);
+
+    nnz = val.size();
+    row.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < nrow; ++i)
+    {
+        for(int64_t k = ptr[i] - idx_base; k < ptr[i + 1] - idx_base; ++k)
+        {
+            row[k] = i + idx_base;
+        }
+    }
+
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("done.\n");
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in CSR format, see read_mtx_matrix. Fails if the number of
+ *  entries does not fit into I. */
+template <typename I, typename J, typename T>
+int read_mtx_matrix_csr(const char*          filename,
+                        J&                   nrow,
+                        J&                   ncol,
+                        I&                   nnz,
+                        std::vector<I>&      csr_row_ptr,
+                        std::vector<J>&      csr_col_ind,
+                        std::vector<T>&      csr_val,
+                        hipsparseIndexBase_t idx_base)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("Reading matrix %s...", filename);
+        fflush(stdout);
+    }
+
+    std::vector<J> unsorted_row;
+    std::vector<J> unsorted_col;
+    std::vector<T> unsorted_val;
+
+    int status
+        = read_mtx_entries(filename, nrow, ncol, unsorted_row, unsorted_col, unsorted_val);
+    if(status != 0)
+    {
+        return status;
+    }
+
+    if(unsorted_val.size() >= static_cast<size_t>(std::numeric_limits<I>::max()))
+    {
+        return -1;
+    }
+
+    coo_to_sorted_csr(nrow,
+                      unsorted_row,
+                      unsorted_col,
+                      unsorted_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      csr_val,
+                      idx_base);
+
+    nnz = static_cast<I>(csr_val.size());
+
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("done.\n");
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Versioned binary CSR container written by hipsparse_mtx2csr.
+ *
+ *  The file starts with a 128 byte little endian header followed by the row offsets, column
+ *  indices and values at the recorded byte offsets. Each section is aligned to
+ *  bin_matrix_alignment bytes so that it can be used in place from a memory mapping. Files
+ *  without the magic are read as the legacy layout of three 32-bit sizes, 32-bit indices and
+ *  double values. */
+static constexpr char     bin_matrix_magic[8]  = {'H', 'I', 'P', 'S', 'P', 'B', 'I', 'N'};
+static constexpr uint32_t bin_matrix_version   = 1;
+static constexpr uint64_t bin_matrix_alignment = 64;
+
+enum bin_index_type : uint32_t
+{
+    bin_index_i32 = 0,
+    bin_index_i64 = 1
+};
+
+enum bin_value_type : uint32_t
+{
+    bin_value_f32 = 0,
+    bin_value_f64 = 1,
+    bin_value_c32 = 2,
+    bin_value_c64 = 3
+};
+
+enum bin_matrix_flags : uint32_t
+{
+    bin_flag_row_stats = 1
+};
+
+struct bin_matrix_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    int64_t  nrow;
+    int64_t  ncol;
+    int64_t  nnz;
+    uint32_t ptr_type;
+    uint32_t col_type;
+    uint32_t val_type;
+    uint32_t idx_base;
+    uint32_t flags;
+    uint32_t alignment;
+    uint64_t ptr_offset;
+    uint64_t col_offset;
+    uint64_t val_offset;
+
+    // Row statistics, valid if bin_flag_row_stats is set
+    int64_t min_row_nnz;
+    int64_t max_row_nnz;
+    int64_t empty_rows;
+    double  mean_row_nnz;
+    double  stddev_row_nnz;
+};
+
+static_assert(sizeof(bin_matrix_header) == 128, "binary matrix header must be 128 bytes");
+
+static inline size_t bin_index_size(uint32_t type)
+{
+    return (type == bin_index_i32)   ? sizeof(int32_t)
+           : (type == bin_index_i64) ? sizeof(int64_t)
+                                     : 0;
+}
+
+static inline size_t bin_value_size(uint32_t type)
+{
+    switch(type)
+    {
+    case bin_value_f32:
+        return sizeof(float);
+    case bin_value_f64:
+        return sizeof(double);
+    case bin_value_c32:
+        return 2 * sizeof(float);
+    case bin_value_c64:
+        return 2 * sizeof(double);
+    }
+
+    return 0;
+}
+
+/*! \brief  Typed view of a binary matrix inside a mapping. The pointers stay valid as long as the
+ *  mapped_file they were obtained from. */
+struct bin_matrix_view
+{
+    bin_matrix_header header;
+    const void*       ptr;
+    const void*       col;
+    const void*       val;
+};
+
+/*! \brief  Validate the header of a versioned binary matrix and locate its sections. Returns 1 if
+ *  the file is not in the versioned format, -1 if it is malformed and 0 on success. */
+static inline int map_bin_matrix(const mapped_file& file, bin_matrix_view& view)
+{
+    size_t size = file.end() - file.begin();
+    if(size < sizeof(bin_matrix_magic) || memcmp(file.begin(), bin_matrix_magic, 8) != 0)
+    {
+        return 1;
+    }
+
+    if(size < sizeof(bin_matrix_header))
+    {
+        return -1;
+    }
+
+    bin_matrix_header& h = view.header;
+    memcpy(&h, file.begin(), sizeof(bin_matrix_header));
+
+    if(h.version > bin_matrix_version || h.header_size < sizeof(bin_matrix_header) || h.nrow < 0
+       || h.ncol < 0 || h.nnz < 0 || h.idx_base > 1)
+    {
+        return -1;
+    }
+
+    size_t ptr_size = bin_index_size(h.ptr_type);
+    size_t col_size = bin_index_size(h.col_type);
+    size_t val_size = bin_value_size(h.val_type);
+    if(ptr_size == 0 || col_size == 0 || val_size == 0)
+    {
+        return -1;
+    }
+
+    // Every section has to lie inside the file
+    auto section_fits = [size](uint64_t offset, uint64_t count, size_t elem) {
+        return offset <= size && count <= (size - offset) / elem;
+    };
+
+    if(!section_fits(h.ptr_offset, h.nrow + 1, ptr_size)
+       || !section_fits(h.col_offset, h.nnz, col_size)
+       || !section_fits(h.val_offset, h.nnz, val_size))
+    {
+        return -1;
+    }
+
+    view.ptr = file.begin() + h.ptr_offset;
+    view.col = file.begin() + h.col_offset;
+    view.val = file.begin() + h.val_offset;
+
+    return 0;
+}
+
+/*! \brief  Copy n stored indices into dst, adding shift. Sections that already have the requested
+ *  type and base are copied in bulk. */
+template <typename To>
+inline void bin_copy_indices(const void* src, uint32_t type, int64_t n, To* dst, To shift)
+{
+    if(bin_index_size(type) == sizeof(To) && shift == 0)
+    {
+        memcpy(dst, src, sizeof(To) * n);
+        return;
+    }
+
+    if(type == bin_index_i32)
+    {
+        const int32_t* s = static_cast<const int32_t*>(src);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int64_t i = 0; i < n; ++i)
+        {
+            dst[i] = static_cast<To>(s[i]) + shift;
+        }
+    }
+    else
+    {
+        const int64_t* s = static_cast<const int64_t*>(src);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int64_t i = 0; i < n; ++i)
+        {
+            dst[i] = static_cast<To>(s[i]) + shift;
+        }
+    }
+}
+
+template <typename From, typename To>
+inline void bin_convert_values(const From* src, int64_t n, int64_t stride, To* dst)
+{
+    // stride is 2 for complex data, whose imaginary part follows the real part
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t i = 0; i < n; ++i)
+    {
+        dst[i] = make_DataType<To>(src[stride * i], (stride == 2) ? src[stride * i + 1] : 0.0);
+    }
+}
+
+/*! \brief  Copy n stored values into dst. Complex values cannot be read into a real type. */
+template <typename T>
+inline int bin_copy_values(const void* src, uint32_t type, int64_t n, T* dst)
+{
+    bool complex_type = std::is_same<T, hipComplex>() || std::is_same<T, hipDoubleComplex>();
+    if(!complex_type && (type == bin_value_c32 || type == bin_value_c64))
+    {
+        return -1;
+    }
+
+    if(bin_value_size(type) == sizeof(T) && (complex_type == (type >= bin_value_c32)))
+    {
+        memcpy(dst, src, sizeof(T) * n);
+        return 0;
+    }
+
+    switch(type)
+    {
+    case bin_value_f32:
+        bin_convert_values(static_cast<const float*>(src), n, 1, dst);
+        break;
+    case bin_value_f64:
+        bin_convert_values(static_cast<const double*>(src), n, 1, dst);
+        break;
+    case bin_value_c32:
+        bin_convert_values(static_cast<const float*>(src), n, 2, dst);
+        break;
+    case bin_value_c64:
+        bin_convert_values(static_cast<const double*>(src), n, 2, dst);
+        break;
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix from binary file in CSR format. The file is memory mapped, and sections
+ *  whose stored type and base match the request are copied without conversion. */
+template <typename I, typename J, typename T>
+int read_bin_matrix(const char*          filename,
+                    J&                   nrow,
+                    J&                   ncol,
+                    I&                   nnz,
+                    std::vector<I>&      ptr,
+                    std::vector<J>&      col,
+                    std::vector<T>&      val,
+                    hipsparseIndexBase_t idx_base)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("Reading matrix %s...", filename);
+        fflush(stdout);
+    }
+
+    mapped_file file(filename);
+    if(!file.valid())
+    {
+        return -1;
+    }
+
+    bin_matrix_view view;
+
+    int status = map_bin_matrix(file, view);
+    if(status == 1)
+    {
+        // Legacy layout: int32 sizes and indices, double values, zero based
+        size_t size = file.end() - file.begin();
+        if(size < 3 * sizeof(int32_t))
+        {
+            return -1;
+        }
+
+        int32_t dims[3];
+        memcpy(dims, file.begin(), sizeof(dims));
+
+        bin_matrix_header& h = view.header;
+
+        h.nrow       = dims[0];
+        h.ncol       = dims[1];
+        h.nnz        = dims[2];
+        h.ptr_type   = bin_index_i32;
+        h.col_type   = bin_index_i32;
+        h.val_type   = bin_value_f64;
+        h.idx_base   = 0;
+        h.ptr_offset = sizeof(dims);
+        h.col_offset = h.ptr_offset + sizeof(int32_t) * (h.nrow + 1);
+        h.val_offset = h.col_offset + sizeof(int32_t) * h.nnz;
+
+        if(h.nrow < 0 || h.ncol < 0 || h.nnz < 0
+           || h.val_offset + sizeof(double) * h.nnz > static_cast<uint64_t>(size))
+        {
+            return -1;
+        }
+
+        view.ptr = file.begin() + h.ptr_offset;
+        view.col = file.begin() + h.col_offset;
+        view.val = file.begin() + h.val_offset;
+    }
+    else if(status != 0)
+    {
+        return -1;
+    }
+
+    const bin_matrix_header& h = view.header;
+
+    // Sizes that do not fit the requested index types cannot be read
+    if(h.nrow > static_cast<int64_t>(std::numeric_limits<J>::max())
+       || h.ncol > static_cast<int64_t>(std::numeric_limits<J>::max())
+       || h.nnz > static_cast<int64_t>(std::numeric_limits<I>::max()))
+    {
+        return -1;
+    }
+
+    nrow = static_cast<J>(h.nrow);
+    ncol = static_cast<J>(h.ncol);
+    nnz  = static_cast<I>(h.nnz);
+
+    ptr.resize(h.nrow + 1);
+    col.resize(h.nnz);
+    val.resize(h.nnz);
+
+    int shift = static_cast<int>(idx_base) - static_cast<int>(h.idx_base);
+
+    bin_copy_indices(view.ptr, h.ptr_type, h.nrow + 1, ptr.data(), static_cast<I>(shift));
+    bin_copy_indices(view.col, h.col_type, h.nnz, col.data(), static_cast<J>(shift));
+    if(bin_copy_values(view.val, h.val_type, h.nnz, val.data()) != 0)
+    {
+        return -1;
+    }
+
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("done.\n");
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate CSR matrix from file. File can be either mtx or bin, or a matrix generator
+ *  spec, see generate_matrix_from_spec. If filename is empty, a random matrix is generated*/
+template <typename I, typename J, typename T>
+bool generate_csr_matrix(const std::string    filename,
+                         J&                   nrow,
+                         J&                   ncol,
+                         I&                   nnz,
+                         std::vector<I>&      csr_row_ptr,
+                         std::vector<J>&      csr_col_ind,
+                         std::vector<T>&      csr_val,
+                         hipsparseIndexBase_t idx_base)
+{
+    // If no filename passed, generate matrix
+    if(filename == "")
+    {
+        double scale = 0.02;
+        if(nrow > 1000 || ncol > 1000)
+        {
+            scale = 2.0 / std::max(nrow, ncol);
+        }
+        nnz = nrow * scale * ncol;
+
+        std::vector<J> coo_row_ind;
+        gen_matrix_coo(nrow, ncol, (J)nnz, coo_row_ind, csr_col_ind, csr_val, idx_base);
+
+        csr_row_ptr.resize(nrow + 1, 0);
+        for(int i = 0; i < nnz; ++i)
+        {
+            ++csr_row_ptr[coo_row_ind[i] + 1 - idx_base];
+        }
+
+        csr_row_ptr[0] = idx_base;
+        for(int i = 0; i < nrow; ++i)
+        {
+            csr_row_ptr[i + 1] += csr_row_ptr[i];
+        }
+
+        return true;
+    }
+    else if(is_matrix_generator_spec(filename))
+    {
+        return generate_matrix_from_spec(
+                   filename, nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base)
+               == 0;
+    }
+    else
+    {
+        std::string extension = filename.substr(filename.find_last_of(".") + 1);
+        if(extension == "bin")
+        {
+            if(read_bin_matrix(
+                   filename.c_str(), nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base)
+               == 0)
+            {
+                return true;
+            }
+        }
+        else if(extension == "mtx")
+        {
+            if(read_mtx_matrix_csr(
+                   filename.c_str(), nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base)
+               == 0)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate a variable size batch of random CSR matrices, stored as one block diagonal
+ *  CSR matrix. Batch b spans the rows [batch_row_offsets[b], batch_row_offsets[b + 1]) and the
+ *  columns [batch_col_offsets[b], batch_col_offsets[b + 1]), its sizes are drawn in [1, max_m]
+ *  and [1, max_n], or n = m with square. With diagonal, every row stores a dominant diagonal
+ *  entry so that the batches can be used in triangular solves. */
+template <typename I, typename J, typename T>
+void gen_csr_variable_batch(int                   batch_count,
+                            J                     max_m,
+                            J                     max_n,
+                            bool                  square,
+                            bool                  diagonal,
+                            std::vector<int64_t>& batch_row_offsets,
+                            std::vector<int64_t>& batch_col_offsets,
+                            std::vector<I>&       csr_row_ptr,
+                            std::vector<J>&       csr_col_ind,
+                            std::vector<T>&       csr_val,
+                            hipsparseIndexBase_t  idx_base)
+{
+    batch_row_offsets.assign(1, 0);
+    batch_col_offsets.assign(1, 0);
+    csr_row_ptr.assign(1, idx_base);
+    csr_col_ind.clear();
+    csr_val.clear();
+
+    for(int b = 0; b < batch_count; ++b)
+    {
+        J m = 1 + rand() % max_m;
+        J n = square ? m : 1 + rand() % max_n;
+
+        int64_t row_begin = batch_row_offsets.back();
+        int64_t col_begin = batch_col_offsets.back();
+
+        for(J i = 0; i < m; ++i)
+        {
+            std::vector<J> cols;
+            for(J k = rand() % std::min(n, static_cast<J>(8)); k > 0; --k)
+            {
+                cols.push_back(rand() % n);
+            }
+
+            if(diagonal && i < n)
+            {
+                cols.push_back(i);
+            }
+
+            std::sort(cols.begin(), cols.end());
+            cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+
+            for(J j : cols)
+            {
+                csr_col_ind.push_back(static_cast<J>(col_begin + j + idx_base));
+                csr_val.push_back((diagonal && i == j) ? make_DataType<T>(20.0 * cols.size())
+                                                       : random_generator<T>());
+            }
+
+            csr_row_ptr.push_back(static_cast<I>(csr_col_ind.size() + idx_base));
+        }
+
+        batch_row_offsets.push_back(row_begin + m);
+        batch_col_offsets.push_back(col_begin + n);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate COO matrix from file. File can be either mtx or bin, or a matrix generator
+ *  spec, see generate_matrix_from_spec. If filename is empty, a random matrix is generated*/
+template <typename I, typename T>
+bool generate_coo_matrix(const std::string    filename,
+                         I&                   nrow,
+                         I&                   ncol,
+                         I&                   nnz,
+                         std::vector<I>&      coo_row_ind,
+                         std::vector<I>&      coo_col_ind,
+                         std::vector<T>&      coo_val,
+                         hipsparseIndexBase_t idx_base)
+{
+    // If no filename passed, generate matrix
+    if(filename == "")
+    {
+        double scale = 0.02;
+        if(nrow > 1000 || ncol > 1000)
+        {
+            scale = 2.0 / std::max(nrow, ncol);
+        }
+        nnz = nrow * scale * ncol;
+
+        gen_matrix_coo(nrow, ncol, nnz, coo_row_ind, coo_col_ind, coo_val, idx_base);
+
+        return true;
+    }
+    else
+    {
+        bool        spec      = is_matrix_generator_spec(filename);
+        std::string extension = filename.substr(filename.find_last_of(".") + 1);
+        if(spec || extension == "bin")
+        {
+            std::vector<I> csr_row_ptr;
+            if((spec ? generate_matrix_from_spec(
+                    filename, nrow, ncol, nnz, csr_row_ptr, coo_col_ind, coo_val, idx_base)
+                     : read_bin_matrix(filename.c_str(),
+                                       nrow,
+                                       ncol,
+                                       nnz,
+                                       csr_row_ptr,
+                                       coo_col_ind,
+                                       coo_val,
+                                       idx_base))
+               == 0)
+            {
+                coo_row_ind.resize(nnz);
+                for(I i = 0; i < nrow; ++i)
+                {
+                    I row_begin = csr_row_ptr[i] - idx_base;
+                    I row_end   = csr_row_ptr[i + 1] - idx_base;
+
+                    for(I j = row_begin; j < row_end; ++j)
+                    {
+                        coo_row_ind[j] = i + idx_base;
+                    }
+                }
+
+                return true;
+            }
+        }
+        else if(extension == "mtx")
+        {
+            int64_t nnz_count;
+            if(read_mtx_matrix(filename.c_str(),
+                               nrow,
+                               ncol,
                                nnz_count,
                                coo_row_ind,
                                coo_col_ind,
@@ -1291,6 +2968,103 @@ void host_nnz(hipsparseDirection_t      dirA,
     nnzTotalDevHostPtr[0] = sum;
 }
 
+/* ============================================================================================ */
+/*! \brief  Transposes the pattern of the M x N compressed matrix (ptr, ind) with a counting sort.
+ *  The rows are split into ranges of similar size and every range counts its entries per column
+ *  in its own histogram, which turns into the position of the range in every column. The
+ *  offsets of the transposed matrix are written to t_ptr, and move(src, dst, row) is called once
+ *  for every entry to move entry src of row `row` to position dst of the transposed matrix.
+ *  Entries of a column keep the order of their rows, as in a sequential transpose. */
+template <typename I, typename J, typename F>
+inline void host_csx_transpose(J                    M,
+                               J                    N,
+                               const I*             ptr,
+                               const J*             ind,
+                               hipsparseIndexBase_t base,
+                               I*                   t_ptr,
+                               hipsparseIndexBase_t t_base,
+                               F&&                  move)
+{
+    I nnz = ptr[M] - ptr[0];
+
+#ifdef _OPENMP
+    int nparts = omp_get_max_threads();
+#else
+    int nparts = 1;
+#endif
+
+    // Limit the memory spent on histograms
+    nparts = static_cast<int>(std::max<int64_t>(
+        1, std::min<int64_t>(nparts, (int64_t(1) << 26) / std::max<int64_t>(N, 1))));
+
+    std::vector<J> bounds(nparts + 1, M);
+    for(int p = 0; p < nparts; ++p)
+    {
+        I target  = ptr[0] + static_cast<I>(static_cast<int64_t>(nnz) * p / nparts);
+        bounds[p] = static_cast<J>(std::lower_bound(ptr, ptr + M, target) - ptr);
+    }
+
+    std::vector<I> hist(static_cast<size_t>(nparts) * N, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int p = 0; p < nparts; ++p)
+    {
+        I* h = hist.data() + static_cast<size_t>(p) * N;
+        for(I j = ptr[bounds[p]] - base; j < ptr[bounds[p + 1]] - base; ++j)
+        {
+            ++h[ind[j] - base];
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(J c = 0; c < N; ++c)
+    {
+        I count = 0;
+        for(int p = 0; p < nparts; ++p)
+        {
+            count += hist[static_cast<size_t>(p) * N + c];
+        }
+
+        t_ptr[c + 1] = count;
+    }
+
+    host_prefix_sum(N, t_ptr, static_cast<I>(t_base));
+
+    // Turn the histograms into the first position of every range in every column
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(J c = 0; c < N; ++c)
+    {
+        I pos = t_ptr[c] - t_base;
+        for(int p = 0; p < nparts; ++p)
+        {
+            I count                              = hist[static_cast<size_t>(p) * N + c];
+            hist[static_cast<size_t>(p) * N + c] = pos;
+            pos += count;
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int p = 0; p < nparts; ++p)
+    {
+        I* h = hist.data() + static_cast<size_t>(p) * N;
+        for(J i = bounds[p]; i < bounds[p + 1]; ++i)
+        {
+            for(I j = ptr[i] - base; j < ptr[i + 1] - base; ++j)
+            {
+                move(j, h[ind[j] - base]++, i);
+            }
+        }
+    }
+}
+
 template <hipsparseDirection_t DIRA, typename T>
 void host_dense2csx(int                  m,
                     int                  n,
@@ -1304,50 +3078,42 @@ void host_dense2csx(int                  m,
 {
     static constexpr T s_zero = {};
     int                len    = (HIPSPARSE_DIRECTION_ROW == DIRA) ? m : n;
-    *csx_row_col_ptr          = base;
-    for(int i = 0; i < len; ++i)
-    {
-        csx_row_col_ptr[i + 1] = nnz_per_row_columns[i] + csx_row_col_ptr[i];
-    }
 
-    switch(DIRA)
-    {
-    case HIPSPARSE_DIRECTION_COLUMN:
+    std::copy(nnz_per_row_columns, nnz_per_row_columns + len, csx_row_col_ptr + 1);
+    host_prefix_sum(len, csx_row_col_ptr, static_cast<int>(base));
+
+    // Every row or column is compressed on its own, starting at its offset
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for(int k = 0; k < len; ++k)
     {
-        for(int j = 0; j < n; ++j)
+        int at = csx_row_col_ptr[k] - base;
+
+        if(DIRA == HIPSPARSE_DIRECTION_COLUMN)
         {
             for(int i = 0; i < m; ++i)
             {
-                if(A[j * ld + i] != s_zero)
+                if(A[k * ld + i] != s_zero)
                 {
-                    *csx_val++         = A[j * ld + i];
-                    *csx_col_row_ind++ = i + base;
+                    csx_val[at]         = A[k * ld + i];
+                    csx_col_row_ind[at] = i + base;
+                    ++at;
                 }
             }
         }
-        break;
-    }
-
-    case HIPSPARSE_DIRECTION_ROW:
-    {
-        //
-        // Does not matter having an orthogonal traversal ... testing only.
-        // Otherwise, we would use csxRowPtrA to store the shifts.
-        // and once the job is done a simple memory move would reinitialize the csxRowPtrA to its initial state)
-        //
-        for(int i = 0; i < m; ++i)
+        else
         {
             for(int j = 0; j < n; ++j)
             {
-                if(A[j * ld + i] != s_zero)
+                if(A[j * ld + k] != s_zero)
                 {
-                    *csx_val++         = A[j * ld + i];
-                    *csx_col_row_ind++ = j + base;
+                    csx_val[at]         = A[j * ld + k];
+                    csx_col_row_ind[at] = j + base;
+                    ++at;
                 }
             }
         }
-        break;
-    }
     }
 }
 
@@ -1449,42 +3215,35 @@ void host_csx2dense(int                  m,
                     int                  ld)
 {
     static constexpr T s_zero = {};
-    switch(DIRA)
-    {
-    case HIPSPARSE_DIRECTION_COLUMN:
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int col = 0; col < n; ++col)
     {
-        for(int col = 0; col < n; ++col)
-        {
-            for(int row = 0; row < m; ++row)
-            {
-                A[row + ld * col] = s_zero;
-            }
-            const int bound = csx_row_col_ptr[col + 1] - base;
-            for(int at = csx_row_col_ptr[col] - base; at < bound; ++at)
-            {
-                A[(csx_col_row_ind[at] - base) + ld * col] = csx_val[at];
-            }
-        }
-        break;
+        std::fill(A + static_cast<size_t>(ld) * col, A + static_cast<size_t>(ld) * col + m, s_zero);
     }
 
-    case HIPSPARSE_DIRECTION_ROW:
+    // Rows and columns scatter into disjoint entries of A
+    int len = (HIPSPARSE_DIRECTION_ROW == DIRA) ? m : n;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for(int k = 0; k < len; ++k)
     {
-        for(int row = 0; row < m; ++row)
+        const int bound = csx_row_col_ptr[k + 1] - base;
+        for(int at = csx_row_col_ptr[k] - base; at < bound; ++at)
         {
-            for(int col = 0; col < n; ++col)
+            if(DIRA == HIPSPARSE_DIRECTION_COLUMN)
             {
-                A[col * ld + row] = s_zero;
+                A[(csx_col_row_ind[at] - base) + static_cast<size_t>(ld) * k] = csx_val[at];
             }
-
-            const int bound = csx_row_col_ptr[row + 1] - base;
-            for(int at = csx_row_col_ptr[row] - base; at < bound; ++at)
+            else
             {
-                A[(csx_col_row_ind[at] - base) * ld + row] = csx_val[at];
+                A[static_cast<size_t>(csx_col_row_ind[at] - base) * ld + k] = csx_val[at];
             }
         }
-        break;
-    }
     }
 }
 
@@ -1644,377 +3403,175 @@ void host_prune_csr_to_csr_by_percentage(int                     M,
                                          std::vector<int>&       csr_col_ind_C,
                                          std::vector<T>&         csr_val_C,
                                          hipsparseIndexBase_t    csr_base_A,
-                                         hipsparseIndexBase_t    csr_base_C,
-                                         T                       percentage)
-{
-    int pos = std::ceil(nnz_A * (percentage / 100)) - 1;
-    pos     = std::min(pos, nnz_A - 1);
-    pos     = std::max(pos, 0);
-
-    std::vector<T> sorted_A(nnz_A);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int i = 0; i < nnz_A; i++)
-    {
-        sorted_A[i] = testing_abs(csr_val_A[i]);
-    }
-
-    std::sort(sorted_A.begin(), sorted_A.end());
-
-    T threshold = sorted_A[pos];
-
-    host_prune_csr_to_csr<T>(M,
-                             N,
-                             nnz_A,
-                             csr_row_ptr_A,
-                             csr_col_ind_A,
-                             csr_val_A,
-                             nnz_C,
-                             csr_row_ptr_C,
-                             csr_col_ind_C,
-                             csr_val_C,
-                             csr_base_A,
-                             csr_base_C,
-                             threshold);
-}
-
-template <typename I, typename J, typename T>
-inline void host_csr_to_csc(J        M,
-                            J        N,
-                            I        nnz,
-                            const I* csr_row_ptr,
-                            const J* csr_col_ind,
-                            const T* csr_val,
-                            //const std::vector<I>& csr_row_ptr,
-                            //const std::vector<J>& csr_col_ind,
-                            //const std::vector<T>&   csr_val,
-                            std::vector<J>&      csc_row_ind,
-                            std::vector<I>&      csc_col_ptr,
-                            std::vector<T>&      csc_val,
-                            hipsparseAction_t    action,
-                            hipsparseIndexBase_t base)
-{
-    csc_row_ind.resize(nnz);
-    csc_col_ptr.resize(N + 1, 0);
-    csc_val.resize(nnz);
-
-    // Determine nnz per column
-    for(I i = 0; i < nnz; ++i)
-    {
-        ++csc_col_ptr[csr_col_ind[i] + 1 - base];
-    }
-
-    // Scan
-    for(J i = 0; i < N; ++i)
-    {
-        csc_col_ptr[i + 1] += csc_col_ptr[i];
-    }
-
-    // Fill row indices and values
-    for(J i = 0; i < M; ++i)
-    {
-        I row_begin = csr_row_ptr[i] - base;
-        I row_end   = csr_row_ptr[i + 1] - base;
-
-        for(I j = row_begin; j < row_end; ++j)
-        {
-            J col = csr_col_ind[j] - base;
-            I idx = csc_col_ptr[col];
-
-            csc_row_ind[idx] = i + base;
-            csc_val[idx]     = csr_val[j];
-
-            ++csc_col_ptr[col];
-        }
-    }
-
-    // Shift column pointer array
-    for(J i = N; i > 0; --i)
-    {
-        csc_col_ptr[i] = csc_col_ptr[i - 1] + base;
-    }
-
-    csc_col_ptr[0] = base;
-}
-
-template <typename T>
-inline void host_csr_to_bsr(hipsparseDirection_t    direction,
-                            int                     M,
-                            int                     N,
-                            int                     block_dim,
-                            int&                    nnzb,
-                            hipsparseIndexBase_t    csr_base,
-                            const std::vector<int>& csr_row_ptr,
-                            const std::vector<int>& csr_col_ind,
-                            const std::vector<T>&   csr_val,
-                            hipsparseIndexBase_t    bsr_base,
-                            std::vector<int>&       bsr_row_ptr,
-                            std::vector<int>&       bsr_col_ind,
-                            std::vector<T>&         bsr_val)
-{
-    int mb = (M + block_dim - 1) / block_dim;
-    int nb = (N + block_dim - 1) / block_dim;
-
-    // quick return if block_dim == 1
-    if(block_dim == 1)
-    {
-        bsr_row_ptr.resize(mb + 1, 0);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(size_t i = 0; i < csr_row_ptr.size(); i++)
-        {
-            bsr_row_ptr[i] = (csr_row_ptr[i] - csr_base) + bsr_base;
-        }
-
-        nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
-
-        bsr_col_ind.resize(nnzb, 0);
-        bsr_val.resize(nnzb * block_dim * block_dim, make_DataType<T>(0));
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(size_t i = 0; i < csr_col_ind.size(); i++)
-        {
-            bsr_col_ind[i] = (csr_col_ind[i] - csr_base) + bsr_base;
-        }
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(size_t i = 0; i < csr_val.size(); i++)
-        {
-            bsr_val[i] = csr_val[i];
-        }
-
-        return;
-    }
-
-    // determine number of non-zero block columns for each block row of the bsr matrix
-    bsr_row_ptr.resize(mb + 1, 0);
+                                         hipsparseIndexBase_t    csr_base_C,
+                                         T                       percentage)
+{
+    int pos = std::ceil(nnz_A * (percentage / 100)) - 1;
+    pos     = std::min(pos, nnz_A - 1);
+    pos     = std::max(pos, 0);
 
-    bsr_row_ptr[0] = bsr_base;
+    std::vector<T> sorted_A(nnz_A);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(int i = 0; i < mb; i++)
-    {
-        int start = csr_row_ptr[i * block_dim] - csr_base;
-        int end   = csr_row_ptr[std::min(M, block_dim * i + block_dim)] - csr_base;
-
-        std::vector<int> temp(nb, 0);
-        for(int j = start; j < end; j++)
-        {
-            int blockCol   = (csr_col_ind[j] - csr_base) / block_dim;
-            temp[blockCol] = 1;
-        }
-
-        int sum = 0;
-        for(size_t j = 0; j < temp.size(); j++)
-        {
-            sum += temp[j];
-        }
-
-        bsr_row_ptr[i + 1] = sum;
-    }
-
-    for(int i = 0; i < mb; i++)
+    for(int i = 0; i < nnz_A; i++)
     {
-        bsr_row_ptr[i + 1] += bsr_row_ptr[i];
+        sorted_A[i] = testing_abs(csr_val_A[i]);
     }
 
-    nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
-
-    // find bsr col indices array
-    bsr_col_ind.resize(nnzb, 0);
-    bsr_val.resize(nnzb * block_dim * block_dim, make_DataType<T>(0));
+    std::sort(sorted_A.begin(), sorted_A.end());
 
-    int colIndex = 0;
+    T threshold = sorted_A[pos];
 
-    for(int i = 0; i < mb; i++)
-    {
-        int start = csr_row_ptr[i * block_dim] - csr_base;
-        int end   = csr_row_ptr[std::min(M, block_dim * i + block_dim)] - csr_base;
+    host_prune_csr_to_csr<T>(M,
+                             N,
+                             nnz_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             csr_val_A,
+                             nnz_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             csr_val_C,
+                             csr_base_A,
+                             csr_base_C,
+                             threshold);
+}
 
-        std::vector<int> temp(nb, 0);
+template <typename I, typename J, typename T>
+inline void host_csr_to_csc(J                    M,
+                            J                    N,
+                            I                    nnz,
+                            const I*             csr_row_ptr,
+                            const J*             csr_col_ind,
+                            const T*             csr_val,
+                            std::vector<J>&      csc_row_ind,
+                            std::vector<I>&      csc_col_ptr,
+                            std::vector<T>&      csc_val,
+                            hipsparseAction_t    action,
+                            hipsparseIndexBase_t base)
+{
+    csc_row_ind.resize(nnz);
+    csc_col_ptr.resize(N + 1);
+    csc_val.resize(nnz);
 
-        for(int j = start; j < end; j++)
-        {
-            int blockCol   = (csr_col_ind[j] - csr_base) / block_dim;
-            temp[blockCol] = 1;
-        }
+    host_csx_transpose(M,
+                       N,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       base,
+                       csc_col_ptr.data(),
+                       base,
+                       [&](I src, I dst, J row) {
+                           csc_row_ind[dst] = row + base;
+                           csc_val[dst]     = csr_val[src];
+                       });
+}
 
-        for(int j = 0; j < nb; j++)
-        {
-            if(temp[j] == 1)
-            {
-                bsr_col_ind[colIndex] = j + bsr_base;
-                colIndex++;
-            }
-        }
-    }
+/*! \brief  Builds a GEBSR matrix with mb x nb blocks of size row_block_dim x col_block_dim from
+ *  the entries of every block row. entries(i, visit) calls visit(row, col, val) for each entry
+ *  of block row i, with zero based row and column of the entry. Block rows are compressed in
+ *  parallel, once to count their blocks and once to sort the block columns and place the
+ *  entries. */
+template <typename T, typename F>
+inline void host_gebsr_compress(hipsparseDirection_t direction,
+                                int                  mb,
+                                int                  nb,
+                                int                  row_block_dim,
+                                int                  col_block_dim,
+                                F&&                  entries,
+                                int&                 nnzb,
+                                hipsparseIndexBase_t bsr_base,
+                                std::vector<int>&    bsr_row_ptr,
+                                std::vector<int>&    bsr_col_ind,
+                                std::vector<T>&      bsr_val)
+{
+    bsr_row_ptr.assign(mb + 1, 0);
 
-    // find bsr values array
-    for(int i = 0; i < M; i++)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        int blockRow = i / block_dim;
-
-        int start = csr_row_ptr[i] - csr_base;
-        int end   = csr_row_ptr[i + 1] - csr_base;
+        // Last block row that has seen each block column
+        std::vector<int> mark(nb, -1);
 
-        for(int j = start; j < end; j++)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for(int i = 0; i < mb; ++i)
         {
-            int blockCol = (csr_col_ind[j] - csr_base) / block_dim;
-
-            colIndex = -1;
-            for(int k = bsr_row_ptr[blockRow] - bsr_base; k < bsr_row_ptr[blockRow + 1] - bsr_base;
-                k++)
-            {
-                if(bsr_col_ind[k] - bsr_base == blockCol)
+            int count = 0;
+            entries(i, [&](int, int col, const T&) {
+                int block_col = col / col_block_dim;
+                if(mark[block_col] != i)
                 {
-                    colIndex = k - (bsr_row_ptr[blockRow] - bsr_base);
-                    break;
+                    mark[block_col] = i;
+                    ++count;
                 }
-            }
-
-            assert(colIndex != -1);
-
-            int blockIndex = 0;
-            if(direction == HIPSPARSE_DIRECTION_ROW)
-            {
-                blockIndex = (csr_col_ind[j] - csr_base) % block_dim + (i % block_dim) * block_dim;
-            }
-            else
-            {
-                blockIndex
-                    = ((csr_col_ind[j] - csr_base) % block_dim) * block_dim + (i % block_dim);
-            }
+            });
 
-            int index = (bsr_row_ptr[blockRow] - bsr_base) * block_dim * block_dim
-                        + colIndex * block_dim * block_dim + blockIndex;
-
-            bsr_val[index] = csr_val[j];
+            bsr_row_ptr[i + 1] = count;
         }
     }
-}
-
-template <typename T>
-void host_bsr_to_bsc(int                  mb,
-                     int                  nb,
-                     int                  nnzb,
-                     int                  bsr_dim,
-                     const int*           bsr_row_ptr,
-                     const int*           bsr_col_ind,
-                     const T*             bsr_val,
-                     std::vector<int>&    bsc_row_ind,
-                     std::vector<int>&    bsc_col_ptr,
-                     std::vector<T>&      bsc_val,
-                     hipsparseIndexBase_t bsr_base,
-                     hipsparseIndexBase_t bsc_base)
-{
-    bsc_row_ind.resize(nnzb);
-    bsc_col_ptr.resize(nb + 1, 0);
-    bsc_val.resize(nnzb * bsr_dim * bsr_dim);
 
-    // Determine nnz per column
-    for(int i = 0; i < nnzb; ++i)
-    {
-        ++bsc_col_ptr[bsr_col_ind[i] + 1 - bsr_base];
-    }
+    host_prefix_sum(mb, bsr_row_ptr.data(), static_cast<int>(bsr_base));
 
-    // Scan
-    for(int i = 0; i < nb; ++i)
-    {
-        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
-    }
+    nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
+    bsr_col_ind.resize(nnzb);
+    bsr_val.assign(static_cast<size_t>(nnzb) * row_block_dim * col_block_dim,
+                   make_DataType<T>(0));
 
-    // Fill row indices and values
-    for(int i = 0; i < mb; ++i)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        int row_begin = bsr_row_ptr[i] - bsr_base;
-        int row_end   = bsr_row_ptr[i + 1] - bsr_base;
+        std::vector<int> mark(nb, -1);
+        std::vector<int> pos(nb);
 
-        for(int j = row_begin; j < row_end; ++j)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for(int i = 0; i < mb; ++i)
         {
-            int col = bsr_col_ind[j] - bsr_base;
-            int idx = bsc_col_ptr[col];
+            int  begin = bsr_row_ptr[i] - bsr_base;
+            int  end   = bsr_row_ptr[i + 1] - bsr_base;
+            int* cols  = bsr_col_ind.data() + begin;
 
-            bsc_row_ind[idx] = i + bsc_base;
-
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                for(int bj = 0; bj < bsr_dim; ++bj)
+            int count = 0;
+            entries(i, [&](int, int col, const T&) {
+                int block_col = col / col_block_dim;
+                if(mark[block_col] != i)
                 {
-                    bsc_val[bsr_dim * bsr_dim * idx + bi + bj * bsr_dim]
-                        = bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj];
+                    mark[block_col] = i;
+                    cols[count++]   = block_col;
                 }
-            }
+            });
 
-            ++bsc_col_ptr[col];
-        }
-    }
+            std::sort(cols, cols + (end - begin));
 
-    // Shift column pointer array
-    for(int i = nb; i > 0; --i)
-    {
-        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + bsc_base;
-    }
+            for(int k = begin; k < end; ++k)
+            {
+                pos[bsr_col_ind[k]] = k;
+                bsr_col_ind[k] += bsr_base;
+            }
 
-    bsc_col_ptr[0] = bsc_base;
-}
+            entries(i, [&](int row, int col, const T& val) {
+                int local_row = row % row_block_dim;
+                int local_col = col % col_block_dim;
 
-template <typename T>
-inline void host_gebsr_to_csr(hipsparseDirection_t    direction,
-                              int                     mb,
-                              int                     nb,
-                              int                     nnzb,
-                              const std::vector<T>&   bsr_val,
-                              const std::vector<int>& bsr_row_ptr,
-                              const std::vector<int>& bsr_col_ind,
-                              int                     row_block_dim,
-                              int                     col_block_dim,
-                              hipsparseIndexBase_t    bsr_base,
-                              std::vector<T>&         csr_val,
-                              std::vector<int>&       csr_row_ptr,
-                              std::vector<int>&       csr_col_ind,
-                              hipsparseIndexBase_t    csr_base)
-{
+                size_t index = static_cast<size_t>(row_block_dim) * col_block_dim
+                               * pos[col / col_block_dim];
 
-    csr_col_ind.resize(nnzb * row_block_dim * col_block_dim);
-    csr_row_ptr.resize(mb * row_block_dim + 1);
-    csr_val.resize(nnzb * row_block_dim * col_block_dim);
-    int at         = 0;
-    csr_row_ptr[0] = csr_base;
-    for(int i = 0; i < mb; ++i)
-    {
-        for(int r = 0; r < row_block_dim; ++r)
-        {
-            int row = i * row_block_dim + r;
-            for(int k = bsr_row_ptr[i] - bsr_base; k < bsr_row_ptr[i + 1] - bsr_base; ++k)
-            {
-                int j = bsr_col_ind[k] - bsr_base;
-                for(int c = 0; c < col_block_dim; ++c)
+                if(direction == HIPSPARSE_DIRECTION_ROW)
                 {
-                    int col         = col_block_dim * j + c;
-                    csr_col_ind[at] = col + csr_base;
-                    if(direction == HIPSPARSE_DIRECTION_ROW)
-                    {
-                        csr_val[at]
-                            = bsr_val[k * row_block_dim * col_block_dim + col_block_dim * r + c];
-                    }
-                    else
-                    {
-                        csr_val[at]
-                            = bsr_val[k * row_block_dim * col_block_dim + row_block_dim * c + r];
-                    }
-                    ++at;
+                    bsr_val[index + col_block_dim * local_row + local_col] = val;
                 }
-            }
-
-            csr_row_ptr[row + 1]
-                = csr_row_ptr[row] + (bsr_row_ptr[i + 1] - bsr_row_ptr[i]) * col_block_dim;
+                else
+                {
+                    bsr_val[index + row_block_dim * local_col + local_row] = val;
+                }
+            });
         }
     }
 }
@@ -2035,145 +3592,196 @@ inline void host_csr_to_gebsr(hipsparseDirection_t    direction,
                               std::vector<int>&       bsr_col_ind,
                               std::vector<T>&         bsr_val)
 {
-    int mb  = (m + row_block_dim - 1) / row_block_dim;
-    int nnz = csr_col_ind.size();
-
-    bsr_row_ptr.resize(mb + 1, 0);
+    int mb = (m + row_block_dim - 1) / row_block_dim;
+    int nb = (n + col_block_dim - 1) / col_block_dim;
+
+    host_gebsr_compress(
+        direction,
+        mb,
+        nb,
+        row_block_dim,
+        col_block_dim,
+        [&](int i, auto&& visit) {
+            for(int row = row_block_dim * i; row < std::min(m, row_block_dim * (i + 1)); ++row)
+            {
+                for(int j = csr_row_ptr[row] - csr_base; j < csr_row_ptr[row + 1] - csr_base; ++j)
+                {
+                    visit(row, csr_col_ind[j] - csr_base, csr_val[j]);
+                }
+            }
+        },
+        nnzb,
+        bsr_base,
+        bsr_row_ptr,
+        bsr_col_ind,
+        bsr_val);
+}
 
-    std::vector<int> temp(nnz);
+template <typename T>
+inline void host_csr_to_bsr(hipsparseDirection_t    direction,
+                            int                     M,
+                            int                     N,
+                            int                     block_dim,
+                            int&                    nnzb,
+                            hipsparseIndexBase_t    csr_base,
+                            const std::vector<int>& csr_row_ptr,
+                            const std::vector<int>& csr_col_ind,
+                            const std::vector<T>&   csr_val,
+                            hipsparseIndexBase_t    bsr_base,
+                            std::vector<int>&       bsr_row_ptr,
+                            std::vector<int>&       bsr_col_ind,
+                            std::vector<T>&         bsr_val)
+{
+    int mb = (M + block_dim - 1) / block_dim;
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int i = 0; i < nnz; i++)
+    // quick return if block_dim == 1
+    if(block_dim == 1)
     {
-        temp[i] = (csr_col_ind[i] - csr_base) / col_block_dim;
-    }
-
+        bsr_row_ptr.resize(mb + 1, 0);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(int i = 0; i < mb; i++)
-    {
-        int frow = row_block_dim * i;
-        int lrow = row_block_dim * (i + 1);
-
-        if(lrow > m)
+        for(size_t i = 0; i < csr_row_ptr.size(); i++)
         {
-            lrow = m;
+            bsr_row_ptr[i] = (csr_row_ptr[i] - csr_base) + bsr_base;
         }
 
-        int start = csr_row_ptr[frow] - csr_base;
-        int end   = csr_row_ptr[lrow] - csr_base;
-
-        std::sort(temp.begin() + start, temp.begin() + end);
-    }
+        nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
 
+        bsr_col_ind.resize(nnzb, 0);
+        bsr_val.resize(nnzb * block_dim * block_dim, make_DataType<T>(0));
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(int i = 0; i < mb; i++)
-    {
-        int frow = row_block_dim * i;
-        int lrow = row_block_dim * (i + 1);
-
-        if(lrow > m)
+        for(size_t i = 0; i < csr_col_ind.size(); i++)
         {
-            lrow = m;
+            bsr_col_ind[i] = (csr_col_ind[i] - csr_base) + bsr_base;
         }
-
-        int start = csr_row_ptr[frow] - csr_base;
-        int end   = csr_row_ptr[lrow] - csr_base;
-
-        int col   = -1;
-        int count = 0;
-        for(int j = start; j < end; j++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < csr_val.size(); i++)
         {
-            if(temp[j] > col)
-            {
-                col                 = temp[j];
-                temp[j]             = -1;
-                temp[start + count] = col;
-                count++;
-            }
-            else
-            {
-                temp[j] = -1;
-            }
+            bsr_val[i] = csr_val[i];
         }
 
-        bsr_row_ptr[i + 1] = count;
+        return;
     }
 
-    // fill GEBSR row pointer array
-    bsr_row_ptr[0] = bsr_base;
-    for(int i = 0; i < mb; i++)
-    {
-        bsr_row_ptr[i + 1] += bsr_row_ptr[i];
-    }
+    // BSR is GEBSR with square blocks, which share the layout of the block entries
+    host_csr_to_gebsr(direction,
+                      M,
+                      N,
+                      block_dim,
+                      block_dim,
+                      nnzb,
+                      csr_base,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      csr_val,
+                      bsr_base,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      bsr_val);
+}
+
+template <typename T>
+void host_bsr_to_bsc(int                  mb,
+                     int                  nb,
+                     int                  nnzb,
+                     int                  bsr_dim,
+                     const int*           bsr_row_ptr,
+                     const int*           bsr_col_ind,
+                     const T*             bsr_val,
+                     std::vector<int>&    bsc_row_ind,
+                     std::vector<int>&    bsc_col_ptr,
+                     std::vector<T>&      bsc_val,
+                     hipsparseIndexBase_t bsr_base,
+                     hipsparseIndexBase_t bsc_base)
+{
+    bsc_row_ind.resize(nnzb);
+    bsc_col_ptr.resize(nb + 1);
+    bsc_val.resize(nnzb * bsr_dim * bsr_dim);
 
-    nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
-    bsr_col_ind.resize(nnzb);
-    bsr_val.resize(nnzb * row_block_dim * col_block_dim, make_DataType<T>(0));
+    // Blocks move as a whole and are transposed on the way
+    host_csx_transpose(mb,
+                       nb,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_base,
+                       bsc_col_ptr.data(),
+                       bsc_base,
+                       [&](int src, int dst, int row) {
+                           bsc_row_ind[dst] = row + bsc_base;
+
+                           for(int bi = 0; bi < bsr_dim; ++bi)
+                           {
+                               for(int bj = 0; bj < bsr_dim; ++bj)
+                               {
+                                   bsc_val[bsr_dim * bsr_dim * dst + bi + bj * bsr_dim]
+                                       = bsr_val[bsr_dim * bsr_dim * src + bi * bsr_dim + bj];
+                               }
+                           }
+                       });
+}
 
-    // fill GEBSR col indices array
-    {
-        int index = 0;
-        for(int i = 0; i < nnz; i++)
-        {
-            if(temp[i] != -1)
-            {
-                bsr_col_ind[index] = temp[i] + bsr_base;
-                index++;
-            }
-        }
-    }
+template <typename T>
+inline void host_gebsr_to_csr(hipsparseDirection_t    direction,
+                              int                     mb,
+                              int                     nb,
+                              int                     nnzb,
+                              const std::vector<T>&   bsr_val,
+                              const std::vector<int>& bsr_row_ptr,
+                              const std::vector<int>& bsr_col_ind,
+                              int                     row_block_dim,
+                              int                     col_block_dim,
+                              hipsparseIndexBase_t    bsr_base,
+                              std::vector<T>&         csr_val,
+                              std::vector<int>&       csr_row_ptr,
+                              std::vector<int>&       csr_col_ind,
+                              hipsparseIndexBase_t    csr_base)
+{
+    csr_col_ind.resize(nnzb * row_block_dim * col_block_dim);
+    csr_row_ptr.resize(mb * row_block_dim + 1);
+    csr_val.resize(nnzb * row_block_dim * col_block_dim);
+    csr_row_ptr[0] = csr_base;
 
-    // fill GEBSR values array
+    // Every row of a block row holds all columns of its blocks, which fixes its offset
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 64)
 #endif
-    for(int i = 0; i < m; i++)
+    for(int i = 0; i < mb; ++i)
     {
-        int start = csr_row_ptr[i] - csr_base;
-        int end   = csr_row_ptr[i + 1] - csr_base;
-
-        int bstart = bsr_row_ptr[i / row_block_dim] - bsr_base;
-        int bend   = bsr_row_ptr[i / row_block_dim + 1] - bsr_base;
+        int nblocks = bsr_row_ptr[i + 1] - bsr_row_ptr[i];
 
-        int local_row = i % row_block_dim;
-
-        for(int j = start; j < end; j++)
+        for(int r = 0; r < row_block_dim; ++r)
         {
-            int col = csr_col_ind[j] - csr_base;
-
-            int local_col = col % col_block_dim;
+            int row = i * row_block_dim + r;
+            int at  = (bsr_row_ptr[i] - bsr_base) * row_block_dim * col_block_dim
+                     + r * nblocks * col_block_dim;
 
+            for(int k = bsr_row_ptr[i] - bsr_base; k < bsr_row_ptr[i + 1] - bsr_base; ++k)
             {
-                int index = 0;
-                for(int k = bstart; k < bend; k++)
+                int j = bsr_col_ind[k] - bsr_base;
+                for(int c = 0; c < col_block_dim; ++c)
                 {
-                    if(bsr_col_ind[k] - bsr_base == col / col_block_dim)
+                    int col         = col_block_dim * j + c;
+                    csr_col_ind[at] = col + csr_base;
+                    if(direction == HIPSPARSE_DIRECTION_ROW)
                     {
-                        index  = k;
-                        bstart = k;
-                        break;
+                        csr_val[at]
+                            = bsr_val[k * row_block_dim * col_block_dim + col_block_dim * r + c];
                     }
-                }
-
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    bsr_val[row_block_dim * col_block_dim * index + col_block_dim * local_row
-                            + local_col]
-                        = csr_val[j];
-                }
-                else
-                {
-                    bsr_val[row_block_dim * col_block_dim * index + row_block_dim * local_col
-                            + local_row]
-                        = csr_val[j];
+                    else
+                    {
+                        csr_val[at]
+                            = bsr_val[k * row_block_dim * col_block_dim + row_block_dim * c + r];
+                    }
+                    ++at;
                 }
             }
+
+            csr_row_ptr[row + 1] = at + csr_base;
         }
     }
 }
@@ -2199,42 +3807,48 @@ inline void host_gebsr_to_gebsr(hipsparseDirection_t    direction,
     int m = mb * row_block_dim_A;
     int n = nb * col_block_dim_A;
 
-    // convert GEBSR to CSR format
-    std::vector<int> csr_row_ptr;
-    std::vector<int> csr_col_ind;
-    std::vector<T>   csr_val;
+    int mb_C = (m + row_block_dim_C - 1) / row_block_dim_C;
+    int nb_C = (n + col_block_dim_C - 1) / col_block_dim_C;
 
-    host_gebsr_to_csr(direction,
-                      mb,
-                      nb,
-                      nnzb,
-                      bsr_val_A,
-                      bsr_row_ptr_A,
-                      bsr_col_ind_A,
-                      row_block_dim_A,
-                      col_block_dim_A,
-                      base_A,
-                      csr_val,
-                      csr_row_ptr,
-                      csr_col_ind,
-                      HIPSPARSE_INDEX_BASE_ZERO);
-
-    // convert CSR to GEBSR format
+    // Every entry of the blocks of A, including explicit zeros, becomes an entry of C, which is
+    // read directly from A instead of going through CSR
     int nnzb_C;
-    host_csr_to_gebsr(direction,
-                      m,
-                      n,
-                      row_block_dim_C,
-                      col_block_dim_C,
-                      nnzb_C,
-                      HIPSPARSE_INDEX_BASE_ZERO,
-                      csr_row_ptr,
-                      csr_col_ind,
-                      csr_val,
-                      base_C,
-                      bsr_row_ptr_C,
-                      bsr_col_ind_C,
-                      bsr_val_C);
+    host_gebsr_compress(
+        direction,
+        mb_C,
+        nb_C,
+        row_block_dim_C,
+        col_block_dim_C,
+        [&](int i, auto&& visit) {
+            for(int row = row_block_dim_C * i; row < std::min(m, row_block_dim_C * (i + 1));
+                ++row)
+            {
+                int block_row = row / row_block_dim_A;
+                int local_row = row % row_block_dim_A;
+
+                for(int k = bsr_row_ptr_A[block_row] - base_A;
+                    k < bsr_row_ptr_A[block_row + 1] - base_A;
+                    ++k)
+                {
+                    int    col   = (bsr_col_ind_A[k] - base_A) * col_block_dim_A;
+                    size_t index = static_cast<size_t>(row_block_dim_A) * col_block_dim_A * k;
+
+                    for(int c = 0; c < col_block_dim_A; ++c)
+                    {
+                        visit(row,
+                              col + c,
+                              (direction == HIPSPARSE_DIRECTION_ROW)
+                                  ? bsr_val_A[index + col_block_dim_A * local_row + c]
+                                  : bsr_val_A[index + row_block_dim_A * c + local_row]);
+                    }
+                }
+            }
+        },
+        nnzb_C,
+        base_C,
+        bsr_row_ptr_C,
+        bsr_col_ind_C,
+        bsr_val_C);
 }
 
 template <typename T>
@@ -2605,108 +4219,656 @@ inline void host_bsrmv(hipsparseDirection_t dir,
     }
 }
 
-template <typename I, typename J, typename T>
-inline void host_csrmv(hipsparseOperation_t trans,
-                       J                    M,
-                       J                    N,
+// Largest number of products summed into an entry of op(A) * B, for the tolerance of results
+template <typename I, typename J>
+inline int64_t host_csr_max_sum_length(hipsparseOperation_t trans,
+                                       J                    m,
+                                       J                    n,
+                                       const I*             ptr,
+                                       const J*             col,
+                                       hipsparseIndexBase_t base)
+{
+    int64_t max_length = 0;
+
+    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for reduction(max : max_length)
+#endif
+        for(J i = 0; i < m; ++i)
+        {
+            max_length = std::max(max_length, static_cast<int64_t>(ptr[i + 1] - ptr[i]));
+        }
+    }
+    else
+    {
+        std::vector<int64_t> length(n, 0);
+        for(I j = 0; j < ptr[m] - ptr[0]; ++j)
+        {
+            ++length[col[j] - base];
+        }
+
+        for(J i = 0; i < n; ++i)
+        {
+            max_length = std::max(max_length, length[i]);
+        }
+    }
+
+    return max_length;
+}
+
+// Summation order of the host SpMV references. host_reduction_wavefront reproduces the order in
+// which the device csrmv kernels reduce the entries of a row across a wavefront, so that results
+// can be compared bitwise. host_reduction_natural sums each row from left to right.
+enum host_reduction_order
+{
+    host_reduction_natural,
+    host_reduction_wavefront
+};
+
+// Warp size of the current device
+inline int host_warp_size()
+{
+    int dev;
+    int warp_size;
+
+    if(hipGetDevice(&dev) != hipSuccess
+       || hipDeviceGetAttribute(&warp_size, hipDeviceAttributeWarpSize, dev) != hipSuccess)
+    {
+        return 64;
+    }
+
+    return warp_size;
+}
+
+// Number of lanes the device csrmv kernels use per row for nnz_per_row entries on average
+inline int host_csrmv_wavefront_size(int64_t nnz_per_row)
+{
+    int warp_size = host_warp_size();
+
+    if(nnz_per_row < 4)
+        return 2;
+    else if(nnz_per_row < 8)
+        return 4;
+    else if(nnz_per_row < 16)
+        return 8;
+    else if(nnz_per_row < 32)
+        return 16;
+    else if(nnz_per_row < 64 || warp_size == 32)
+        return 32;
+    else
+        return 64;
+}
+
+template <typename I, typename J, typename T>
+inline void host_csrmv(hipsparseOperation_t trans,
+                       J                    M,
+                       J                    N,
+                       I                    nnz,
+                       T                    alpha,
+                       const I*             csr_row_ptr,
+                       const J*             csr_col_ind,
+                       const T*             csr_val,
+                       const T*             x,
+                       T                    beta,
+                       T*                   y,
+                       hipsparseIndexBase_t base,
+                       host_reduction_order order = host_reduction_wavefront)
+{
+    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE && order == host_reduction_wavefront)
+    {
+        int WF_SIZE = host_csrmv_wavefront_size((M == 0) ? 0 : (nnz / M));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            I row_begin = csr_row_ptr[i] - base;
+            I row_end   = csr_row_ptr[i + 1] - base;
+
+            T sum[64];
+            for(int k = 0; k < WF_SIZE; ++k)
+            {
+                sum[k] = make_DataType<T>(0.0);
+            }
+
+            for(I j = row_begin; j < row_end; j += WF_SIZE)
+            {
+                for(int k = 0; k < WF_SIZE; ++k)
+                {
+                    if(j + k < row_end)
+                    {
+                        sum[k] = testing_fma(testing_mult(alpha, csr_val[j + k]),
+                                             x[csr_col_ind[j + k] - base],
+                                             sum[k]);
+                    }
+                }
+            }
+
+            for(int j = 1; j < WF_SIZE; j <<= 1)
+            {
+                for(int k = 0; k < WF_SIZE - j; ++k)
+                {
+                    sum[k] = sum[k] + sum[k + j];
+                }
+            }
+
+            if(beta == make_DataType<T>(0.0))
+            {
+                y[i] = sum[0];
+            }
+            else
+            {
+                y[i] = testing_fma(beta, y[i], sum[0]);
+            }
+        }
+    }
+    else if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            T sum = make_DataType<T>(0.0);
+
+            for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                sum = testing_fma(csr_val[j], x[csr_col_ind[j] - base], sum);
+            }
+
+            sum = testing_mult(alpha, sum);
+
+            y[i] = (beta == make_DataType<T>(0.0)) ? sum : testing_fma(beta, y[i], sum);
+        }
+    }
+    else
+    {
+        bool conj = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+
+#ifdef _OPENMP
+        int nthreads = omp_get_max_threads();
+#else
+        int nthreads = 1;
+#endif
+
+        // The natural order scatters into one partial result per thread, as long as those fit
+        if(order == host_reduction_natural && nthreads > 1
+           && static_cast<int64_t>(N) * nthreads <= (int64_t(1) << 26))
+        {
+            std::vector<T> partial(static_cast<size_t>(N) * nthreads, make_DataType<T>(0.0));
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+#ifdef _OPENMP
+                T* py = partial.data() + static_cast<size_t>(N) * omp_get_thread_num();
+#pragma omp for schedule(dynamic, 256)
+#else
+                T* py = partial.data();
+#endif
+                for(J i = 0; i < M; ++i)
+                {
+                    T row_val = testing_mult(alpha, x[i]);
+
+                    for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+                    {
+                        J col   = csr_col_ind[j] - base;
+                        py[col] = testing_fma(testing_conj(csr_val[j], conj), row_val, py[col]);
+                    }
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for(J i = 0; i < N; ++i)
+            {
+                T sum = testing_mult(y[i], beta);
+                for(int t = 0; t < nthreads; ++t)
+                {
+                    sum = sum + partial[static_cast<size_t>(N) * t + i];
+                }
+
+                y[i] = sum;
+            }
+
+            return;
+        }
+
+        // Scale y with beta
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(J i = 0; i < N; ++i)
+        {
+            y[i] = testing_mult(y[i], beta);
+        }
+
+        // Transposed SpMV
+        for(J i = 0; i < M; ++i)
+        {
+            I row_begin = csr_row_ptr[i] - base;
+            I row_end   = csr_row_ptr[i + 1] - base;
+            T row_val   = testing_mult(alpha, x[i]);
+
+            for(I j = row_begin; j < row_end; ++j)
+            {
+                J col = csr_col_ind[j] - base;
+                T val = testing_conj(csr_val[j], conj);
+
+                y[col] = testing_fma(val, row_val, y[col]);
+            }
+        }
+    }
+}
+
+// Splits the entries of a row sorted COO matrix into at most nparts ranges that start at a row
+// boundary, so that the ranges can be processed in parallel without sharing output rows. Returns
+// false if the rows are not sorted.
+template <typename I>
+inline bool host_coo_row_partition(I nnz, const I* coo_row_ind, int nparts, std::vector<I>& bounds)
+{
+    for(I i = 1; i < nnz; ++i)
+    {
+        if(coo_row_ind[i] < coo_row_ind[i - 1])
+        {
+            return false;
+        }
+    }
+
+    bounds.assign(1, 0);
+    for(int p = 1; p < nparts; ++p)
+    {
+        I k = static_cast<I>(static_cast<int64_t>(nnz) * p / nparts);
+        k   = std::max(k, bounds.back());
+
+        while(k > 0 && k < nnz && coo_row_ind[k] == coo_row_ind[k - 1])
+        {
+            ++k;
+        }
+
+        bounds.push_back(k);
+    }
+    bounds.push_back(nnz);
+
+    return true;
+}
+
+// y = alpha * op(A) * x + beta * y for A in COO format. Every entry of y accumulates its products
+// in storage order. Row sorted matrices are processed in parallel for the non transposed case.
+template <typename I, typename T>
+inline void host_coomv(hipsparseOperation_t trans,
+                       I                    M,
+                       I                    N,
                        I                    nnz,
                        T                    alpha,
-                       const I*             csr_row_ptr,
-                       const J*             csr_col_ind,
-                       const T*             csr_val,
+                       const I*             coo_row_ind,
+                       const I*             coo_col_ind,
+                       const T*             coo_val,
                        const T*             x,
                        T                    beta,
                        T*                   y,
                        hipsparseIndexBase_t base)
 {
-    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    bool conj  = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+    I    ysize = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? M : N;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(I i = 0; i < ysize; ++i)
+    {
+        y[i] = testing_mult(beta, y[i]);
+    }
+
+#ifdef _OPENMP
+    int nparts = 4 * omp_get_max_threads();
+#else
+    int nparts = 1;
+#endif
+
+    std::vector<I> bounds;
+    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE
+       && host_coo_row_partition(nnz, coo_row_ind, nparts, bounds))
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            for(I i = bounds[p]; i < bounds[p + 1]; ++i)
+            {
+                I row  = coo_row_ind[i] - base;
+                y[row] = testing_fma(
+                    testing_mult(alpha, coo_val[i]), x[coo_col_ind[i] - base], y[row]);
+            }
+        }
+
+        return;
+    }
+
+    for(I i = 0; i < nnz; ++i)
     {
-        // Get device properties
-        int             dev;
-        hipDeviceProp_t prop;
-
-        hipGetDevice(&dev);
-        hipGetDeviceProperties(&prop, dev);
-
-        int WF_SIZE;
-        J   nnz_per_row = (M == 0) ? 0 : (nnz / M);
-
-        if(nnz_per_row < 4)
-            WF_SIZE = 2;
-        else if(nnz_per_row < 8)
-            WF_SIZE = 4;
-        else if(nnz_per_row < 16)
-            WF_SIZE = 8;
-        else if(nnz_per_row < 32)
-            WF_SIZE = 16;
-        else if(nnz_per_row < 64 || prop.warpSize == 32)
-            WF_SIZE = 32;
+        I row = coo_row_ind[i] - base;
+        I col = coo_col_ind[i] - base;
+
+        if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+        {
+            y[row] = testing_fma(testing_mult(alpha, coo_val[i]), x[col], y[row]);
+        }
         else
-            WF_SIZE = 64;
+        {
+            y[col] = testing_fma(
+                testing_mult(alpha, testing_conj(coo_val[i], conj)), x[row], y[col]);
+        }
+    }
+}
 
-        for(J i = 0; i < M; ++i)
+// Converts a CSR matrix to the sliced ELL (SELL-C-sigma) layout of hipsparseCreateSlicedEll().
+// Rows are stably sorted by decreasing length inside windows of sigma rows, sliced ELL row r
+// holds CSR row perm[r]. Slice offsets are zero based, padding has column -1 and value zero.
+template <typename I, typename T>
+inline void host_csr_to_sell(I                     M,
+                             const std::vector<I>& csr_row_ptr,
+                             const std::vector<I>& csr_col_ind,
+                             const std::vector<T>& csr_val,
+                             I                     slice_size,
+                             I                     sigma,
+                             std::vector<I>&       sell_slice_offsets,
+                             std::vector<I>&       perm,
+                             std::vector<I>&       sell_col_ind,
+                             std::vector<T>&       sell_val,
+                             hipsparseIndexBase_t  base)
+{
+    I nslices = (M + slice_size - 1) / slice_size;
+
+    perm.resize(M);
+    for(I i = 0; i < M; ++i)
+    {
+        perm[i] = i;
+    }
+
+    for(I w = 0; w < M; w += sigma)
+    {
+        std::stable_sort(perm.begin() + w, perm.begin() + std::min(w + sigma, M), [&](I a, I b) {
+            return csr_row_ptr[a + 1] - csr_row_ptr[a] > csr_row_ptr[b + 1] - csr_row_ptr[b];
+        });
+    }
+
+    sell_slice_offsets.resize(nslices + 1);
+    sell_slice_offsets[0] = 0;
+
+    for(I s = 0; s < nslices; ++s)
+    {
+        I width = 0;
+        for(I r = s * slice_size; r < std::min((s + 1) * slice_size, M); ++r)
         {
-            I row_begin = csr_row_ptr[i] - base;
-            I row_end   = csr_row_ptr[i + 1] - base;
+            width = std::max(width, csr_row_ptr[perm[r] + 1] - csr_row_ptr[perm[r]]);
+        }
+
+        sell_slice_offsets[s + 1] = sell_slice_offsets[s] + width * slice_size;
+    }
 
-            std::vector<T> sum(WF_SIZE, static_cast<T>(0));
+    sell_col_ind.assign(sell_slice_offsets[nslices], static_cast<I>(-1));
+    sell_val.assign(sell_slice_offsets[nslices], make_DataType<T>(0));
 
-            for(I j = row_begin; j < row_end; j += WF_SIZE)
+    for(I r = 0; r < M; ++r)
+    {
+        I s     = r / slice_size;
+        I begin = csr_row_ptr[perm[r]] - base;
+        I end   = csr_row_ptr[perm[r] + 1] - base;
+
+        for(I j = begin; j < end; ++j)
+        {
+            I k = sell_slice_offsets[s] + (j - begin) * slice_size + r % slice_size;
+
+            sell_col_ind[k] = csr_col_ind[j];
+            sell_val[k]     = csr_val[j];
+        }
+    }
+}
+
+// y = alpha * op(A) * x + beta * y for A in sliced ELL format. Each row accumulates its stored
+// entries in slot order, padded entries are skipped.
+template <typename I, typename T>
+inline void host_sellmv(hipsparseOperation_t trans,
+                        I                    M,
+                        I                    N,
+                        T                    alpha,
+                        const I*             sell_slice_offsets,
+                        const I*             sell_col_ind,
+                        const T*             sell_val,
+                        I                    slice_size,
+                        const T*             x,
+                        T                    beta,
+                        T*                   y,
+                        hipsparseIndexBase_t base)
+{
+    bool conj = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+
+    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for(I i = 0; i < M; ++i)
+        {
+            I s     = i / slice_size;
+            I width = (sell_slice_offsets[s + 1] - sell_slice_offsets[s]) / slice_size;
+
+            T sum = make_DataType<T>(0);
+            for(I p = 0; p < width; ++p)
             {
-                for(int k = 0; k < WF_SIZE; ++k)
+                I k = sell_slice_offsets[s] + p * slice_size + i % slice_size;
+                if(sell_col_ind[k] >= 0)
                 {
-                    if(j + k < row_end)
-                    {
-                        sum[k] = testing_fma(testing_mult(alpha, csr_val[j + k]),
-                                             x[csr_col_ind[j + k] - base],
-                                             sum[k]);
-                    }
+                    sum = testing_fma(sell_val[k], x[sell_col_ind[k] - base], sum);
                 }
             }
 
-            for(int j = 1; j < WF_SIZE; j <<= 1)
+            y[i] = testing_fma(alpha, sum, testing_mult(beta, y[i]));
+        }
+
+        return;
+    }
+
+    for(I j = 0; j < N; ++j)
+    {
+        y[j] = testing_mult(beta, y[j]);
+    }
+
+    for(I i = 0; i < M; ++i)
+    {
+        I s     = i / slice_size;
+        I width = (sell_slice_offsets[s + 1] - sell_slice_offsets[s]) / slice_size;
+
+        for(I p = 0; p < width; ++p)
+        {
+            I k = sell_slice_offsets[s] + p * slice_size + i % slice_size;
+            if(sell_col_ind[k] >= 0)
             {
-                for(int k = 0; k < WF_SIZE - j; ++k)
+                I col  = sell_col_ind[k] - base;
+                y[col] = testing_fma(
+                    testing_mult(alpha, testing_conj(sell_val[k], conj)), x[i], y[col]);
+            }
+        }
+    }
+}
+
+// C = alpha * A * op(B) + beta * C for A in sliced ELL format, see host_csrmm() for the layouts
+// of B and C
+template <typename I, typename T>
+inline void host_sellmm(I                    M,
+                        I                    N,
+                        hipsparseOperation_t transB,
+                        T                    alpha,
+                        const I*             sell_slice_offsets,
+                        const I*             sell_col_ind,
+                        const T*             sell_val,
+                        I                    slice_size,
+                        const T*             B,
+                        I                    ldb,
+                        hipsparseOrder_t     orderB,
+                        T                    beta,
+                        T*                   C,
+                        I                    ldc,
+                        hipsparseOrder_t     orderC,
+                        hipsparseIndexBase_t base)
+{
+    bool conj_B = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+
+    bool B_k_fast
+        = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) == (orderB == HIPSPARSE_ORDER_COL);
+
+    int64_t B_stride_k = B_k_fast ? 1 : ldb;
+    int64_t B_stride_j = B_k_fast ? ldb : 1;
+    int64_t C_stride_i = (orderC == HIPSPARSE_ORDER_COL) ? 1 : ldc;
+    int64_t C_stride_j = (orderC == HIPSPARSE_ORDER_COL) ? ldc : 1;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        I s     = i / slice_size;
+        I width = (sell_slice_offsets[s + 1] - sell_slice_offsets[s]) / slice_size;
+
+        for(I j = 0; j < N; ++j)
+        {
+            T sum = make_DataType<T>(0);
+            for(I p = 0; p < width; ++p)
+            {
+                I k = sell_slice_offsets[s] + p * slice_size + i % slice_size;
+                if(sell_col_ind[k] >= 0)
                 {
-                    sum[k] = sum[k] + sum[k + j];
+                    T b = B[(sell_col_ind[k] - base) * B_stride_k + j * B_stride_j];
+                    sum = testing_fma(sell_val[k], testing_conj(b, conj_B), sum);
                 }
             }
 
-            if(beta == make_DataType<T>(0.0))
+            int64_t idx_C = i * C_stride_i + j * C_stride_j;
+
+            if(beta == make_DataType<T>(0))
             {
-                y[i] = sum[0];
+                C[idx_C] = testing_mult(alpha, sum);
             }
             else
             {
-                y[i] = testing_fma(beta, y[i], sum[0]);
+                C[idx_C] = testing_fma(beta, C[idx_C], testing_mult(alpha, sum));
             }
         }
     }
-    else
+}
+
+// Mixed precision y = alpha * op(A) * x + beta * y, where A and x are stored in type A, y in
+// type Y and all products are accumulated in the compute type C, as done by the generic SpMV
+// for 16 bit and int8 values. Rows are summed in order, results may differ from the device
+// by the rounding of C.
+template <typename I, typename J, typename A, typename Y, typename C>
+inline void host_csrmv_mixed(hipsparseOperation_t trans,
+                             J                    M,
+                             J                    N,
+                             C                    alpha,
+                             const I*             csr_row_ptr,
+                             const J*             csr_col_ind,
+                             const A*             csr_val,
+                             const A*             x,
+                             C                    beta,
+                             Y*                   y,
+                             hipsparseIndexBase_t base)
+{
+    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
-        // Scale y with beta
-        for(J i = 0; i < N; ++i)
+        for(J i = 0; i < M; ++i)
         {
-            y[i] = testing_mult(y[i], beta);
+            C sum = static_cast<C>(0);
+
+            for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                sum += convert_DataType<C>(csr_val[j])
+                       * convert_DataType<C>(x[csr_col_ind[j] - base]);
+            }
+
+            C result = alpha * sum;
+            if(beta != static_cast<C>(0))
+            {
+                result += beta * convert_DataType<C>(y[i]);
+            }
+
+            y[i] = convert_DataType<Y>(result);
         }
+    }
+    else
+    {
+        std::vector<C> sum(N, static_cast<C>(0));
 
-        // Transposed SpMV
         for(J i = 0; i < M; ++i)
         {
-            I row_begin = csr_row_ptr[i] - base;
-            I row_end   = csr_row_ptr[i + 1] - base;
-            T row_val   = testing_mult(alpha, x[i]);
+            C xi = convert_DataType<C>(x[i]);
 
-            for(I j = row_begin; j < row_end; ++j)
+            for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
             {
-                J col = csr_col_ind[j] - base;
-                T val = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                            ? testing_conj(csr_val[j])
-                            : csr_val[j];
+                sum[csr_col_ind[j] - base] += convert_DataType<C>(csr_val[j]) * xi;
+            }
+        }
 
-                y[col] = testing_fma(val, row_val, y[col]);
+        for(J i = 0; i < N; ++i)
+        {
+            C result = alpha * sum[i];
+            if(beta != static_cast<C>(0))
+            {
+                result += beta * convert_DataType<C>(y[i]);
             }
+
+            y[i] = convert_DataType<Y>(result);
+        }
+    }
+}
+
+template <typename I, typename A, typename Y, typename C>
+inline void host_coomv_mixed(hipsparseOperation_t trans,
+                             I                    M,
+                             I                    N,
+                             I                    nnz,
+                             C                    alpha,
+                             const I*             coo_row_ind,
+                             const I*             coo_col_ind,
+                             const A*             coo_val,
+                             const A*             x,
+                             C                    beta,
+                             Y*                   y,
+                             hipsparseIndexBase_t base)
+{
+    I              ysize = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? M : N;
+    std::vector<C> sum(ysize, static_cast<C>(0));
+
+    for(I i = 0; i < nnz; ++i)
+    {
+        I row = coo_row_ind[i] - base;
+        I col = coo_col_ind[i] - base;
+
+        if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+        {
+            sum[row] += convert_DataType<C>(coo_val[i]) * convert_DataType<C>(x[col]);
+        }
+        else
+        {
+            sum[col] += convert_DataType<C>(coo_val[i]) * convert_DataType<C>(x[row]);
+        }
+    }
+
+    for(I i = 0; i < ysize; ++i)
+    {
+        C result = alpha * sum[i];
+        if(beta != static_cast<C>(0))
+        {
+            result += beta * convert_DataType<C>(y[i]);
         }
+
+        y[i] = convert_DataType<Y>(result);
     }
 }
 
@@ -2807,96 +4969,95 @@ void host_csrmm(J                    M,
     bool conj_A = (transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE || force_conj_A);
     bool conj_B = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
 
+    // B is accessed as B[k + j * ldb] if true, B[j + k * ldb] otherwise
+    bool B_k_fast
+        = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) == (orderB == HIPSPARSE_ORDER_COL);
+
+    int64_t B_stride_k = B_k_fast ? 1 : ldb;
+    int64_t B_stride_j = B_k_fast ? ldb : 1;
+    int64_t C_stride_i = (orderC == HIPSPARSE_ORDER_COL) ? 1 : ldc;
+    int64_t C_stride_j = (orderC == HIPSPARSE_ORDER_COL) ? ldc : 1;
+
     if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
+        // Each row of A is applied to a block of columns of B at once. Every entry of C still
+        // accumulates its products in row order.
+        constexpr J block_size = 16;
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 64)
 #endif
         for(J i = 0; i < M; i++)
         {
-            for(J j = 0; j < N; ++j)
+            I row_begin = csr_row_ptr_A[i] - base;
+            I row_end   = csr_row_ptr_A[i + 1] - base;
+
+            for(J jb = 0; jb < N; jb += block_size)
             {
-                I row_begin = csr_row_ptr_A[i] - base;
-                I row_end   = csr_row_ptr_A[i + 1] - base;
-                J idx_C     = orderC == HIPSPARSE_ORDER_COL ? i + j * ldc : i * ldc + j;
+                J nb = std::min(block_size, N - jb);
 
-                T sum = make_DataType<T>(0);
+                T sum[block_size];
+                for(J j = 0; j < nb; ++j)
+                {
+                    sum[j] = make_DataType<T>(0);
+                }
 
                 for(I k = row_begin; k < row_end; ++k)
                 {
-                    J idx_B = 0;
-                    if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                        && orderB == HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
-                           && orderB != HIPSPARSE_ORDER_COL))
-                    {
-                        idx_B = (csr_col_ind_A[k] - base + j * ldb);
-                    }
-                    else
+                    T        a = testing_conj(csr_val_A[k], conj_A);
+                    const T* b = B + (csr_col_ind_A[k] - base) * B_stride_k + jb * B_stride_j;
+
+                    for(J j = 0; j < nb; ++j)
                     {
-                        idx_B = (j + (csr_col_ind_A[k] - base) * ldb);
+                        sum[j] = testing_fma(a, testing_conj(b[j * B_stride_j], conj_B), sum[j]);
                     }
-
-                    sum = testing_fma(
-                        testing_conj(csr_val_A[k], conj_A), testing_conj(B[idx_B], conj_B), sum);
                 }
 
-                if(beta == make_DataType<T>(0))
-                {
-                    C[idx_C] = testing_mult(alpha, sum);
-                }
-                else
+                for(J j = 0; j < nb; ++j)
                 {
-                    C[idx_C] = testing_fma(beta, C[idx_C], testing_mult(alpha, sum));
+                    int64_t idx_C = i * C_stride_i + (jb + j) * C_stride_j;
+
+                    if(beta == make_DataType<T>(0))
+                    {
+                        C[idx_C] = testing_mult(alpha, sum[j]);
+                    }
+                    else
+                    {
+                        C[idx_C] = testing_fma(beta, C[idx_C], testing_mult(alpha, sum[j]));
+                    }
                 }
             }
         }
     }
     else
     {
-        // scale C by beta
-        for(J i = 0; i < K; i++)
+        // Columns of C are independent, each one scatters the rows of A in order
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(J j = 0; j < N; ++j)
         {
-            for(J j = 0; j < N; ++j)
+            // scale C by beta
+            for(J i = 0; i < K; i++)
             {
-                J idx_C  = (orderC == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
-                C[idx_C] = testing_mult(beta, C[idx_C]);
+                int64_t idx_C = i * C_stride_i + j * C_stride_j;
+                C[idx_C]      = testing_mult(beta, C[idx_C]);
             }
-        }
 
-        for(J i = 0; i < M; i++)
-        {
-            I row_begin = csr_row_ptr_A[i] - base;
-            I row_end   = csr_row_ptr_A[i + 1] - base;
-
-            for(J j = 0; j < N; ++j)
+            for(J i = 0; i < M; i++)
             {
+                I row_begin = csr_row_ptr_A[i] - base;
+                I row_end   = csr_row_ptr_A[i + 1] - base;
+                T b         = testing_conj(B[i * B_stride_k + j * B_stride_j], conj_B);
+
                 for(I k = row_begin; k < row_end; ++k)
                 {
                     J col = csr_col_ind_A[k] - base;
                     T val = testing_conj(csr_val_A[k], conj_A);
 
-                    J idx_B = 0;
+                    int64_t idx_C = col * C_stride_i + j * C_stride_j;
 
-                    if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                        && orderB == HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
-                           && orderB != HIPSPARSE_ORDER_COL))
-                    {
-                        idx_B = (i + j * ldb);
-                    }
-                    else
-                    {
-                        idx_B = (j + i * ldb);
-                    }
-
-                    J idx_C = (orderC == HIPSPARSE_ORDER_COL) ? col + j * ldc : col * ldc + j;
-
-                    C[idx_C]
-                        = C[idx_C]
-                          + testing_mult(alpha, testing_mult(val, testing_conj(B[idx_B], conj_B)));
+                    C[idx_C] = C[idx_C] + testing_mult(alpha, testing_mult(val, b));
                 }
             }
         }
@@ -2908,7 +5069,7 @@ void host_csrmm_batched(J                    M,
                         J                    N,
                         J                    K,
                         J                    batch_count_A,
-                        J                    offsets_batch_stride_A,
+                        I                    offsets_batch_stride_A,
                         I                    columns_values_batch_stride_A,
                         hipsparseOperation_t transA,
                         hipsparseOperation_t transB,
@@ -3243,42 +5404,75 @@ void host_coomm(I                    M,
         for(I j = 0; j < N; j++)
         {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            for(I i = 0; i < M; ++i)
+            {
+                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
+
+                C[idx_C] = testing_mult(beta, C[idx_C]);
+            }
+        }
+
+#ifdef _OPENMP
+        int nparts = 4 * omp_get_max_threads();
+#else
+        int nparts = 1;
+#endif
+
+        // Row sorted matrices are split into ranges of rows, so that few columns of C still
+        // keep all threads busy
+        std::vector<I> bounds;
+        if(!host_coo_row_partition(nnz, coo_row_ind_A, nparts, bounds))
+        {
+            nparts = 0;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
 #endif
-            for(I i = 0; i < M; ++i)
+        for(int p = 0; p < nparts; ++p)
+        {
+            for(I j = 0; j < N; j++)
             {
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
+                for(I i = bounds[p]; i < bounds[p + 1]; ++i)
+                {
+                    I row = coo_row_ind_A[i] - base;
+                    I col = coo_col_ind_A[i] - base;
+                    T val = testing_mult(alpha, coo_val_A[i]);
 
-                C[idx_C] = testing_mult(beta, C[idx_C]);
+                    I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? row + j * ldc : row * ldc + j;
+                    I idx_B = ((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                               == (order_B == HIPSPARSE_ORDER_COL))
+                                  ? (col + j * ldb)
+                                  : (j + col * ldb);
+
+                    C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
+                }
             }
         }
 
+        if(nparts == 0)
+        {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-        for(I j = 0; j < N; j++)
-        {
-            for(I i = 0; i < nnz; ++i)
+            for(I j = 0; j < N; j++)
             {
-                I row = coo_row_ind_A[i] - base;
-                I col = coo_col_ind_A[i] - base;
-                T val = testing_mult(alpha, coo_val_A[i]);
+                for(I i = 0; i < nnz; ++i)
+                {
+                    I row = coo_row_ind_A[i] - base;
+                    I col = coo_col_ind_A[i] - base;
+                    T val = testing_mult(alpha, coo_val_A[i]);
 
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? row + j * ldc : row * ldc + j;
+                    I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? row + j * ldc : row * ldc + j;
+                    I idx_B = ((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                               == (order_B == HIPSPARSE_ORDER_COL))
+                                  ? (col + j * ldb)
+                                  : (j + col * ldb);
 
-                I idx_B = 0;
-                if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                   || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE
-                       && order_B != HIPSPARSE_ORDER_COL))
-                {
-                    idx_B = (col + j * ldb);
-                }
-                else
-                {
-                    idx_B = (j + col * ldb);
+                    C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
                 }
-
-                C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
             }
         }
     }
@@ -3437,6 +5631,136 @@ void host_coomm_batched(I                    M,
     }
 }
 
+/* ============================================================================================ */
+/*! \brief  Level schedule of a sparse triangular solve with op(A). The rows of a level only depend
+ *  on rows of earlier levels and can be solved in parallel. The schedule only depends on the
+ *  sparsity pattern and is reused for all right hand sides. For transposed solves it also holds
+ *  the zero based pattern of A^T, in the entry order of host_csr_to_csc, where trans_perm maps
+ *  every entry of A^T to its value in A. */
+template <typename J>
+struct host_trsm_schedule
+{
+    std::vector<J> level_ptr;
+    std::vector<J> level_rows;
+
+    std::vector<int64_t> trans_ptr;
+    std::vector<J>       trans_ind;
+    std::vector<int64_t> trans_perm;
+};
+
+template <typename I, typename J>
+inline void host_trsm_analysis(J                      M,
+                               const I*               csr_row_ptr,
+                               const J*               csr_col_ind,
+                               hipsparseOperation_t   trans,
+                               hipsparseFillMode_t    fill_mode,
+                               hipsparseIndexBase_t   base,
+                               host_trsm_schedule<J>& schedule)
+{
+    bool lower  = (fill_mode == HIPSPARSE_FILL_MODE_LOWER);
+    bool gather = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+    // Visit the rows in the order of a sequential solve. A row of A gathers from the rows it
+    // depends on, or scatters to the rows that depend on it if A is transposed.
+    bool ascending = (lower == gather);
+
+    std::vector<J> level(M, 0);
+    J              nlevels = 0;
+
+    for(J r = 0; r < M; ++r)
+    {
+        J row = ascending ? r : M - 1 - r;
+
+        for(I j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+        {
+            J col = csr_col_ind[j] - base;
+
+            // Entries of the other triangle do not take part in the solve
+            if(col == row || (col < row) != lower)
+            {
+                continue;
+            }
+
+            if(gather)
+            {
+                level[row] = std::max(level[row], level[col] + 1);
+            }
+            else
+            {
+                level[col] = std::max(level[col], level[row] + 1);
+            }
+        }
+
+        nlevels = std::max(nlevels, level[row] + 1);
+    }
+
+    schedule.level_ptr.assign(nlevels + 1, 0);
+    schedule.level_rows.resize(M);
+
+    for(J row = 0; row < M; ++row)
+    {
+        ++schedule.level_ptr[level[row] + 1];
+    }
+
+    for(J l = 0; l < nlevels; ++l)
+    {
+        schedule.level_ptr[l + 1] += schedule.level_ptr[l];
+    }
+
+    std::vector<J> next(schedule.level_ptr.begin(), schedule.level_ptr.end() - 1);
+    for(J row = 0; row < M; ++row)
+    {
+        schedule.level_rows[next[level[row]]++] = row;
+    }
+
+    if(gather)
+    {
+        return;
+    }
+
+    I nnz = csr_row_ptr[M] - csr_row_ptr[0];
+
+    schedule.trans_ptr.assign(M + 1, 0);
+    schedule.trans_ind.resize(nnz);
+    schedule.trans_perm.resize(nnz);
+
+    for(I j = 0; j < nnz; ++j)
+    {
+        ++schedule.trans_ptr[csr_col_ind[j] - base + 1];
+    }
+
+    for(J row = 0; row < M; ++row)
+    {
+        schedule.trans_ptr[row + 1] += schedule.trans_ptr[row];
+    }
+
+    std::vector<int64_t> fill(schedule.trans_ptr.begin(), schedule.trans_ptr.end() - 1);
+    for(J row = 0; row < M; ++row)
+    {
+        for(I j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+        {
+            int64_t k = fill[csr_col_ind[j] - base]++;
+
+            schedule.trans_ind[k]  = row;
+            schedule.trans_perm[k] = j;
+        }
+    }
+}
+
+template <typename J>
+inline void host_trsm_pivot(J* pivot, J row)
+{
+#ifdef _OPENMP
+#pragma omp critical(host_trsm_pivot)
+#endif
+    *pivot = std::min(*pivot, row);
+}
+
+/*! \brief  Computes the incomplete LU factorization with zero fill in of a CSR matrix with sorted
+ *  columns, and returns the first zero pivot, or -1. Rows are factored in the levels of the lower
+ *  triangular solve, as a row only reads the rows of its lower part once they are factored. The
+ *  first pivot is at the same position as when factoring the rows one after the other, and the
+ *  factors are the same when there is no pivot. */
 template <typename T>
 int csrilu0(int                  m,
             const int*           ptr,
@@ -3447,96 +5771,163 @@ int csrilu0(int                  m,
             double               boost_tol,
             T                    boost_val)
 {
-    // pointer of upper part of each row
-    std::vector<int> diag_offset(m);
-    std::vector<int> nnz_entries(m, 0);
+    host_trsm_schedule<int> schedule;
+    host_trsm_analysis(m,
+                       ptr,
+                       col,
+                       HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                       HIPSPARSE_FILL_MODE_LOWER,
+                       idx_base,
+                       schedule);
 
-    // ai = 0 to N loop over all rows
-    for(int ai = 0; ai < m; ++ai)
-    {
-        // ai-th row entries
-        int row_start = ptr[ai] - idx_base;
-        int row_end   = ptr[ai + 1] - idx_base;
-        int j;
+    int nlevels = static_cast<int>(schedule.level_ptr.size()) - 1;
+
+    // pointer of upper part of each row, -1 if the row could not be factored
+    std::vector<int> diag_offset(m, -1);
 
-        // nnz position of ai-th row in val array
-        for(j = row_start; j < row_end; ++j)
+    // Zero pivot found while factoring each row. A row that depends on a row that could not be
+    // factored is skipped, as the pivot of an earlier row is reported instead.
+    std::vector<int> row_pivot(m, -1);
+
+    // A diagonal entry is boosted once a later row divides by it
+    std::vector<char> referenced(boost ? m : 0, 0);
+    if(boost)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int ai = 0; ai < m; ++ai)
         {
-            nnz_entries[col[j] - idx_base] = j;
+            for(int j = ptr[ai] - idx_base; j < ptr[ai + 1] - idx_base; ++j)
+            {
+                if(col[j] - idx_base < ai)
+                {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                    referenced[col[j] - idx_base] = 1;
+                }
+            }
         }
+    }
 
-        bool has_diag = false;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> nnz_entries(m, -1);
 
-        // loop over ai-th row nnz entries
-        for(j = row_start; j < row_end; ++j)
+        for(int level = 0; level < nlevels; ++level)
         {
-            // if nnz entry is in lower matrix
-            if(col[j] - idx_base < ai)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+            for(int r = schedule.level_ptr[level]; r < schedule.level_ptr[level + 1]; ++r)
             {
-                int col_j  = col[j] - idx_base;
-                int diag_j = diag_offset[col_j];
+                int ai = schedule.level_rows[r];
 
-                T diag_val = val[diag_j];
+                // ai-th row entries
+                int row_start = ptr[ai] - idx_base;
+                int row_end   = ptr[ai + 1] - idx_base;
+                int j;
 
-                if(boost)
+                // nnz position of ai-th row in val array
+                for(j = row_start; j < row_end; ++j)
                 {
-                    diag_val    = (boost_tol >= testing_abs(diag_val)) ? boost_val : diag_val;
-                    val[diag_j] = diag_val;
+                    nnz_entries[col[j] - idx_base] = j;
                 }
-                else
+
+                bool has_diag = false;
+                bool failed   = false;
+
+                // loop over ai-th row nnz entries
+                for(j = row_start; j < row_end; ++j)
                 {
-                    // Check for numeric pivot
-                    if(diag_val == make_DataType<T>(0.0))
+                    // if nnz entry is in lower matrix
+                    if(col[j] - idx_base < ai)
                     {
-                        // Numerical zero diagonal
-                        return col_j + idx_base;
+                        int col_j  = col[j] - idx_base;
+                        int diag_j = diag_offset[col_j];
+
+                        if(diag_j == -1)
+                        {
+                            failed = true;
+                            break;
+                        }
+
+                        T diag_val = val[diag_j];
+
+                        // Check for numeric pivot
+                        if(!boost && diag_val == make_DataType<T>(0.0))
+                        {
+                            // Numerical zero diagonal
+                            row_pivot[ai] = col_j + idx_base;
+                            failed        = true;
+                            break;
+                        }
+
+                        // multiplication factor
+                        val[j] = testing_div(val[j], diag_val);
+
+                        // loop over upper offset pointer and do linear combination for nnz entry
+                        for(int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
+                        {
+                            // if nnz at this position do linear combination
+                            if(nnz_entries[col[k] - idx_base] != -1)
+                            {
+                                int idx  = nnz_entries[col[k] - idx_base];
+                                val[idx] = testing_fma(testing_neg(val[j]), val[k], val[idx]);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        has_diag = (col[j] - idx_base == ai);
+                        break;
                     }
                 }
 
-                // multiplication factor
-                val[j] = testing_div(val[j], diag_val);
+                if(!failed && !has_diag)
+                {
+                    // Structural zero digonal
+                    row_pivot[ai] = ai + idx_base;
+                    failed        = true;
+                }
 
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
+                if(!failed)
                 {
-                    // if nnz at this position do linear combination
-                    if(nnz_entries[col[k] - idx_base] != 0)
+                    // set diagonal pointer to diagonal element
+                    diag_offset[ai] = j;
+
+                    if(boost && referenced[ai])
                     {
-                        int idx  = nnz_entries[col[k] - idx_base];
-                        val[idx] = testing_fma(testing_neg(val[j]), val[k], val[idx]);
+                        val[j] = (boost_tol >= testing_abs(val[j])) ? boost_val : val[j];
                     }
                 }
-            }
-            else if(col[j] - idx_base == ai)
-            {
-                has_diag = true;
-                break;
-            }
-            else
-            {
-                break;
-            }
-        }
 
-        if(!has_diag)
-        {
-            // Structural zero digonal
-            return ai + idx_base;
+                // clear nnz entries
+                for(j = row_start; j < row_end; ++j)
+                {
+                    nnz_entries[col[j] - idx_base] = -1;
+                }
+            }
         }
+    }
 
-        // set diagonal pointer to diagonal element
-        diag_offset[ai] = j;
-
-        // clear nnz entries
-        for(j = row_start; j < row_end; ++j)
+    for(int ai = 0; ai < m; ++ai)
+    {
+        if(row_pivot[ai] != -1)
         {
-            nnz_entries[col[j] - idx_base] = 0;
+            return row_pivot[ai];
         }
     }
 
     return -1;
 }
 
+/*! \brief  Computes the incomplete LU factorization with zero fill in of a BSR matrix, with the
+ *  block rows factored level by level as csrilu0. Numeric pivots are reported for the block rows
+ *  before the first structural pivot, as when factoring the block rows one after the other. */
 template <typename T>
 inline void host_bsrilu02(hipsparseDirection_t    dir,
                           int                     mb,
@@ -3552,208 +5943,255 @@ inline void host_bsrilu02(hipsparseDirection_t    dir,
                           T                       boost_val)
 {
     // Initialize pivots
-    *struct_pivot  = mb + 1;
-    *numeric_pivot = mb + 1;
-
-    // Temporary vector to hold diagonal offset to access diagonal BSR block
-    std::vector<int> diag_offset(mb);
-    std::vector<int> nnz_entries(mb, -1);
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
 
-    // First diagonal block is index 0
-    if(mb > 0)
-    {
-        diag_offset[0] = 0;
-    }
+    host_trsm_schedule<int> schedule;
+    host_trsm_analysis(mb,
+                       bsr_row_ptr.data(),
+                       bsr_col_ind.data(),
+                       HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                       HIPSPARSE_FILL_MODE_LOWER,
+                       base,
+                       schedule);
 
-    // Loop over all BSR rows
-    for(int i = 0; i < mb; ++i)
-    {
-        // Flag whether we have a diagonal block or not
-        bool has_diag = false;
+    int nlevels = static_cast<int>(schedule.level_ptr.size()) - 1;
 
-        // BSR column entry and exit point
-        int row_begin = bsr_row_ptr[i] - base;
-        int row_end   = bsr_row_ptr[i + 1] - base;
+    // Temporary vector to hold diagonal offset to access diagonal BSR block, -1 if the BSR row
+    // could not be factored
+    std::vector<int> diag_offset(mb, -1);
 
-        int j;
+    // Whether each BSR row misses its diagonal block or has a zero pivot
+    std::vector<char> row_struct_pivot(mb, 0);
+    std::vector<char> row_numeric_pivot(mb, 0);
 
-        // Set up entry points for linear combination
-        for(j = row_begin; j < row_end; ++j)
-        {
-            int col_j          = bsr_col_ind[j] - base;
-            nnz_entries[col_j] = j;
-        }
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> nnz_entries(mb, -1);
 
-        // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
-        for(j = row_begin; j < row_end; ++j)
+        for(int level = 0; level < nlevels; ++level)
         {
-            // Column index of current BSR block
-            int bsr_col = bsr_col_ind[j] - base;
-
-            // If this is a diagonal block, set diagonal flag to true and skip
-            // all upcoming blocks as we exceed the lower matrix part
-            if(bsr_col == i)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 4)
+#endif
+            for(int r = schedule.level_ptr[level]; r < schedule.level_ptr[level + 1]; ++r)
             {
-                has_diag = true;
-                break;
-            }
+                int i = schedule.level_rows[r];
 
-            // Skip all upper matrix blocks
-            if(bsr_col > i)
-            {
-                break;
-            }
+                // Flag whether we have a diagonal block or not
+                bool has_diag = false;
+                bool failed   = false;
 
-            // Process all lower matrix BSR blocks
+                // BSR column entry and exit point
+                int row_begin = bsr_row_ptr[i] - base;
+                int row_end   = bsr_row_ptr[i + 1] - base;
 
-            // Obtain corresponding row entry and exit point that corresponds with the
-            // current BSR column. Actually, we skip all lower matrix column indices,
-            // therefore starting with the diagonal entry.
-            int diag_j    = diag_offset[bsr_col];
-            int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
+                int j;
 
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+                // Set up entry points for linear combination
+                for(j = row_begin; j < row_end; ++j)
+                {
+                    int col_j          = bsr_col_ind[j] - base;
+                    nnz_entries[col_j] = j;
+                }
 
-                // Process all rows within the BSR block
-                for(int bk = 0; bk < bsr_dim; ++bk)
+                // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
+                for(j = row_begin; j < row_end; ++j)
                 {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+                    // Column index of current BSR block
+                    int bsr_col = bsr_col_ind[j] - base;
 
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
+                    // If this is a diagonal block, set diagonal flag to true and skip
+                    // all upcoming blocks as we exceed the lower matrix part
+                    if(bsr_col == i)
+                    {
+                        has_diag = true;
+                        break;
+                    }
 
-                    // Loop through columns of bk-th row and do linear combination
-                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
+                    // Skip all upper matrix blocks
+                    if(bsr_col > i)
                     {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-val,
-                                          bsr_val[BSR_IND(diag_j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        break;
                     }
-                }
-            }
 
-            // Loop over upper offset pointer and do linear combination for nnz entry
-            for(int k = diag_j + 1; k < row_end_j; ++k)
-            {
-                int bsr_col_k = bsr_col_ind[k] - base;
+                    // Process all lower matrix BSR blocks
 
-                if(nnz_entries[bsr_col_k] != -1)
-                {
-                    int m = nnz_entries[bsr_col_k];
+                    // Obtain corresponding row entry and exit point that corresponds with the
+                    // current BSR column. Actually, we skip all lower matrix column indices,
+                    // therefore starting with the diagonal entry.
+                    int diag_j    = diag_offset[bsr_col];
+                    int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
+
+                    // An earlier BSR row misses its diagonal block
+                    if(diag_j == -1)
+                    {
+                        failed = true;
+                        break;
+                    }
 
                     // Loop through all rows within the BSR block
                     for(int bi = 0; bi < bsr_dim; ++bi)
                     {
-                        // Loop through columns of bi-th row and do linear combination
-                        for(int bj = 0; bj < bsr_dim; ++bj)
+                        T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+
+                        // Process all rows within the BSR block
+                        for(int bk = 0; bk < bsr_dim; ++bk)
                         {
-                            T sum = make_DataType<T>(0);
+                            T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+
+                            // Multiplication factor
+                            bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
 
-                            for(int bk = 0; bk < bsr_dim; ++bk)
+                            // Loop through columns of bk-th row and do linear combination
+                            for(int bj = bi + 1; bj < bsr_dim; ++bj)
                             {
-                                sum = testing_fma(bsr_val[BSR_IND(j, bi, bk, dir)],
-                                                  bsr_val[BSR_IND(k, bk, bj, dir)],
-                                                  sum);
+                                bsr_val[BSR_IND(j, bk, bj, dir)]
+                                    = testing_fma(-val,
+                                                  bsr_val[BSR_IND(diag_j, bi, bj, dir)],
+                                                  bsr_val[BSR_IND(j, bk, bj, dir)]);
                             }
-
-                            bsr_val[BSR_IND(m, bi, bj, dir)]
-                                = bsr_val[BSR_IND(m, bi, bj, dir)] - sum;
                         }
                     }
-                }
-            }
-        }
 
-        // Check for structural pivot
-        if(!has_diag)
-        {
-            *struct_pivot = std::min(*struct_pivot, i + base);
-            break;
-        }
+                    // Loop over upper offset pointer and do linear combination for nnz entry
+                    for(int k = diag_j + 1; k < row_end_j; ++k)
+                    {
+                        int bsr_col_k = bsr_col_ind[k] - base;
 
-        // Process diagonal
-        if(bsr_col_ind[j] - base == i)
-        {
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
+                        if(nnz_entries[bsr_col_k] != -1)
+                        {
+                            int m = nnz_entries[bsr_col_k];
+
+                            // Loop through all rows within the BSR block
+                            for(int bi = 0; bi < bsr_dim; ++bi)
+                            {
+                                // Loop through columns of bi-th row and do linear combination
+                                for(int bj = 0; bj < bsr_dim; ++bj)
+                                {
+                                    T sum = make_DataType<T>(0);
+
+                                    for(int bk = 0; bk < bsr_dim; ++bk)
+                                    {
+                                        sum = testing_fma(bsr_val[BSR_IND(j, bi, bk, dir)],
+                                                          bsr_val[BSR_IND(k, bk, bj, dir)],
+                                                          sum);
+                                    }
+
+                                    bsr_val[BSR_IND(m, bi, bj, dir)]
+                                        = bsr_val[BSR_IND(m, bi, bj, dir)] - sum;
+                                }
+                            }
+                        }
+                    }
+                }
 
-                if(boost)
+                // Check for structural pivot
+                if(!failed && !has_diag)
                 {
-                    diag = (boost_tol >= testing_abs(diag)) ? boost_val : diag;
-                    bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
+                    row_struct_pivot[i] = 1;
+                    failed              = true;
                 }
-                else
+
+                if(!failed)
                 {
-                    // Check for numeric pivot
-                    if(diag == make_DataType<T>(0))
+                    // Process diagonal
+                    // Loop through all rows within the BSR block
+                    for(int bi = 0; bi < bsr_dim; ++bi)
+                    {
+                        T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
+
+                        if(boost)
+                        {
+                            diag = (boost_tol >= testing_abs(diag)) ? boost_val : diag;
+                            bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
+                        }
+                        else
+                        {
+                            // Check for numeric pivot
+                            if(diag == make_DataType<T>(0))
+                            {
+                                row_numeric_pivot[i] = 1;
+                                continue;
+                            }
+                        }
+
+                        // Process all rows within the BSR block after bi-th row
+                        for(int bk = bi + 1; bk < bsr_dim; ++bk)
+                        {
+                            T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+
+                            // Multiplication factor
+                            bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
+
+                            // Loop through remaining columns of bk-th row and do linear
+                            // combination
+                            for(int bj = bi + 1; bj < bsr_dim; ++bj)
+                            {
+                                bsr_val[BSR_IND(j, bk, bj, dir)]
+                                    = testing_fma(-val,
+                                                  bsr_val[BSR_IND(j, bi, bj, dir)],
+                                                  bsr_val[BSR_IND(j, bk, bj, dir)]);
+                            }
+                        }
+                    }
+
+                    // Store diagonal BSR block entry point
+                    int row_diag = diag_offset[i] = j;
+
+                    // Process upper diagonal BSR blocks
+                    for(j = row_diag + 1; j < row_end; ++j)
                     {
-                        *numeric_pivot = std::min(*numeric_pivot, bsr_col_ind[j]);
-                        continue;
+                        // Loop through all rows within the BSR block
+                        for(int bi = 0; bi < bsr_dim; ++bi)
+                        {
+                            // Process all rows within the BSR block after bi-th row
+                            for(int bk = bi + 1; bk < bsr_dim; ++bk)
+                            {
+                                // Loop through columns of bk-th row and do linear combination
+                                for(int bj = 0; bj < bsr_dim; ++bj)
+                                {
+                                    bsr_val[BSR_IND(j, bk, bj, dir)] = testing_fma(
+                                        -bsr_val[BSR_IND(row_diag, bk, bi, dir)],
+                                        bsr_val[BSR_IND(j, bi, bj, dir)],
+                                        bsr_val[BSR_IND(j, bk, bj, dir)]);
+                                }
+                            }
+                        }
                     }
                 }
 
-                // Process all rows within the BSR block after bi-th row
-                for(int bk = bi + 1; bk < bsr_dim; ++bk)
+                // Reset entry points
+                for(j = row_begin; j < row_end; ++j)
                 {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
-
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
-
-                    // Loop through remaining columns of bk-th row and do linear combination
-                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-val,
-                                          bsr_val[BSR_IND(j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
-                    }
+                    int col_j          = bsr_col_ind[j] - base;
+                    nnz_entries[col_j] = -1;
                 }
             }
         }
+    }
 
-        // Store diagonal BSR block entry point
-        int row_diag = diag_offset[i] = j;
-
-        // Process upper diagonal BSR blocks
-        for(j = row_diag + 1; j < row_end; ++j)
+    // A sequential factorization stops at the first structural pivot
+    for(int i = 0; i < mb; ++i)
+    {
+        if(row_numeric_pivot[i] && *numeric_pivot == -1)
         {
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                // Process all rows within the BSR block after bi-th row
-                for(int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    // Loop through columns of bk-th row and do linear combination
-                    for(int bj = 0; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
-                                          bsr_val[BSR_IND(j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
-                    }
-                }
-            }
+            *numeric_pivot = i + base;
         }
 
-        // Reset entry points
-        for(j = row_begin; j < row_end; ++j)
+        if(row_struct_pivot[i])
         {
-            int col_j          = bsr_col_ind[j] - base;
-            nnz_entries[col_j] = -1;
+            *struct_pivot = i + base;
+            break;
         }
     }
-
-    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
 }
 
+/*! \brief  Computes the incomplete Cholesky factorization with zero fill in of a BSR matrix. Block
+ *  rows are factored level by level as in host_bsrilu02, and the rows within a block row one after
+ *  the other. Every row is factored, and the pivots are the smallest ones found. */
 template <typename T>
 inline void host_bsric02(hipsparseDirection_t    direction,
                          int                     Mb,
@@ -3779,215 +6217,293 @@ inline void host_bsric02(hipsparseDirection_t    direction,
     // pointer of upper part of each row
     std::vector<int> diag_block_offset(Mb);
     std::vector<int> diag_offset(M, -1);
-    std::vector<int> nnz_entries(M, -1);
+
+    // Smallest structural and numeric pivot found in each block row
+    std::vector<int> block_struct_pivot(Mb, -1);
+    std::vector<int> block_numeric_pivot(Mb, -1);
+
+    bool missing_diag = false;
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 1024) reduction(|| : missing_diag)
 #endif
     for(int i = 0; i < Mb; i++)
     {
         int row_begin = bsr_row_ptr[i] - base;
         int row_end   = bsr_row_ptr[i + 1] - base;
 
+        bool has_diag = false;
         for(int j = row_begin; j < row_end; j++)
         {
             if(bsr_col_ind[j] - base == i)
             {
                 diag_block_offset[i] = j;
+                has_diag             = true;
                 break;
             }
         }
+
+        missing_diag = missing_diag || !has_diag;
     }
 
-    for(int i = 0; i < M; i++)
+    // A row that refers to a block row without diagonal block reads entries of other block rows,
+    // such matrices are factored one block row after the other
+    host_trsm_schedule<int> schedule;
+    if(missing_diag)
     {
-        int local_row = i % block_dim;
-
-        int row_begin = bsr_row_ptr[i / block_dim] - base;
-        int row_end   = bsr_row_ptr[i / block_dim + 1] - base;
+        schedule.level_ptr.resize(Mb + 1);
+        schedule.level_rows.resize(Mb);
 
-        for(int j = row_begin; j < row_end; j++)
+        for(int i = 0; i < Mb; i++)
         {
-            int block_col_j = bsr_col_ind[j] - base;
-
-            for(int k = 0; k < block_dim; k++)
-            {
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * local_row + k;
-                }
-                else
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * k + local_row;
-                }
-            }
+            schedule.level_ptr[i]  = i;
+            schedule.level_rows[i] = i;
         }
 
-        T   sum            = make_DataType<T>(0);
-        int diag_val_index = -1;
+        schedule.level_ptr[Mb] = Mb;
+    }
+    else
+    {
+        host_trsm_analysis(Mb,
+                           bsr_row_ptr.data(),
+                           bsr_col_ind.data(),
+                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                           HIPSPARSE_FILL_MODE_LOWER,
+                           base,
+                           schedule);
+    }
 
-        bool has_diag         = false;
-        bool break_outer_loop = false;
+    int nlevels = static_cast<int>(schedule.level_ptr.size()) - 1;
 
-        for(int j = row_begin; j < row_end; j++)
-        {
-            int block_col_j = bsr_col_ind[j] - base;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> nnz_entries(M, -1);
 
-            for(int k = 0; k < block_dim; k++)
+        for(int level = 0; level < nlevels; ++level)
+        {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 4)
+#endif
+            for(int r = schedule.level_ptr[level]; r < schedule.level_ptr[level + 1]; ++r)
             {
-                int col_j = block_dim * block_col_j + k;
+                int  block_row = schedule.level_rows[r];
+                int& s_pivot   = block_struct_pivot[block_row];
+                int& n_pivot   = block_numeric_pivot[block_row];
 
-                // Mark diagonal and skip row
-                if(col_j == i)
+                for(int i = block_row * block_dim; i < (block_row + 1) * block_dim; i++)
                 {
-                    diag_val_index = block_dim * block_dim * j + block_dim * k + k;
-
-                    has_diag         = true;
-                    break_outer_loop = true;
-                    break;
-                }
+                    int local_row = i % block_dim;
 
-                // Skip upper triangular
-                if(col_j > i)
-                {
-                    break_outer_loop = true;
-                    break;
-                }
+                    int row_begin = bsr_row_ptr[i / block_dim] - base;
+                    int row_end   = bsr_row_ptr[i / block_dim + 1] - base;
 
-                T val_j;
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row + k];
-                }
-                else
-                {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * k + local_row];
-                }
+                    for(int j = row_begin; j < row_end; j++)
+                    {
+                        int block_col_j = bsr_col_ind[j] - base;
 
-                int local_row_j = col_j % block_dim;
+                        for(int k = 0; k < block_dim; k++)
+                        {
+                            if(direction == HIPSPARSE_DIRECTION_ROW)
+                            {
+                                nnz_entries[block_dim * block_col_j + k]
+                                    = block_dim * block_dim * j + block_dim * local_row + k;
+                            }
+                            else
+                            {
+                                nnz_entries[block_dim * block_col_j + k]
+                                    = block_dim * block_dim * j + block_dim * k + local_row;
+                            }
+                        }
+                    }
 
-                int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
-                int row_end_j   = diag_block_offset[col_j / block_dim];
-                int row_diag_j  = diag_offset[col_j];
+                    T   sum            = make_DataType<T>(0);
+                    int diag_val_index = -1;
 
-                T local_sum = make_DataType<T>(0);
-                T inv_diag  = row_diag_j != -1 ? bsr_val[row_diag_j] : make_DataType<T>(0);
+                    bool has_diag         = false;
+                    bool break_outer_loop = false;
 
-                // Check for numeric zero
-                if(inv_diag == make_DataType<T>(0))
-                {
-                    // Numerical non-invertible block diagonal
-                    if(*numeric_pivot == -1)
+                    for(int j = row_begin; j < row_end; j++)
                     {
-                        *numeric_pivot = block_col_j + base;
-                    }
+                        int block_col_j = bsr_col_ind[j] - base;
 
-                    *numeric_pivot = std::min(*numeric_pivot, block_col_j + base);
+                        for(int k = 0; k < block_dim; k++)
+                        {
+                            int col_j = block_dim * block_col_j + k;
 
-                    inv_diag = make_DataType<T>(1);
-                }
+                            // Mark diagonal and skip row
+                            if(col_j == i)
+                            {
+                                diag_val_index = block_dim * block_dim * j + block_dim * k + k;
 
-                inv_diag = testing_div(make_DataType<T>(1), inv_diag);
+                                has_diag         = true;
+                                break_outer_loop = true;
+                                break;
+                            }
 
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(int l = row_begin_j; l < row_end_j + 1; l++)
-                {
-                    int block_col_l = bsr_col_ind[l] - base;
+                            // Skip upper triangular
+                            if(col_j > i)
+                            {
+                                break_outer_loop = true;
+                                break;
+                            }
 
-                    for(int m = 0; m < block_dim; m++)
-                    {
-                        int idx = nnz_entries[block_dim * block_col_l + m];
+                            T val_j;
+                            if(direction == HIPSPARSE_DIRECTION_ROW)
+                            {
+                                val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row
+                                                + k];
+                            }
+                            else
+                            {
+                                val_j = bsr_val[block_dim * block_dim * j + block_dim * k
+                                                + local_row];
+                            }
+
+                            int local_row_j = col_j % block_dim;
+
+                            int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
+                            int row_end_j   = diag_block_offset[col_j / block_dim];
+                            int row_diag_j  = diag_offset[col_j];
+
+                            T local_sum = make_DataType<T>(0);
+                            T inv_diag
+                                = row_diag_j != -1 ? bsr_val[row_diag_j] : make_DataType<T>(0);
+
+                            // Check for numeric zero
+                            if(inv_diag == make_DataType<T>(0))
+                            {
+                                // Numerical non-invertible block diagonal
+                                if(n_pivot == -1)
+                                {
+                                    n_pivot = block_col_j + base;
+                                }
+
+                                n_pivot = std::min(n_pivot, block_col_j + base);
+
+                                inv_diag = make_DataType<T>(1);
+                            }
+
+                            inv_diag = testing_div(make_DataType<T>(1), inv_diag);
+
+                            // loop over upper offset pointer and do linear combination for nnz
+                            // entry
+                            for(int l = row_begin_j; l < row_end_j + 1; l++)
+                            {
+                                int block_col_l = bsr_col_ind[l] - base;
+
+                                for(int m = 0; m < block_dim; m++)
+                                {
+                                    int idx = nnz_entries[block_dim * block_col_l + m];
+
+                                    if(idx != -1 && block_dim * block_col_l + m < col_j)
+                                    {
+                                        if(direction == HIPSPARSE_DIRECTION_ROW)
+                                        {
+                                            local_sum = testing_fma(
+                                                bsr_val[block_dim * block_dim * l
+                                                        + block_dim * local_row_j + m],
+                                                testing_conj(bsr_val[idx]),
+                                                local_sum);
+                                        }
+                                        else
+                                        {
+                                            local_sum = testing_fma(
+                                                bsr_val[block_dim * block_dim * l + block_dim * m
+                                                        + local_row_j],
+                                                testing_conj(bsr_val[idx]),
+                                                local_sum);
+                                        }
+                                    }
+                                }
+                            }
+
+                            val_j = testing_mult((val_j - local_sum), inv_diag);
+                            sum   = testing_fma(val_j, testing_conj(val_j), sum);
 
-                        if(idx != -1 && block_dim * block_col_l + m < col_j)
-                        {
                             if(direction == HIPSPARSE_DIRECTION_ROW)
                             {
-                                local_sum = testing_fma(bsr_val[block_dim * block_dim * l
-                                                                + block_dim * local_row_j + m],
-                                                        testing_conj(bsr_val[idx]),
-                                                        local_sum);
+                                bsr_val[block_dim * block_dim * j + block_dim * local_row + k]
+                                    = val_j;
                             }
                             else
                             {
-                                local_sum = testing_fma(bsr_val[block_dim * block_dim * l
-                                                                + block_dim * m + local_row_j],
-                                                        testing_conj(bsr_val[idx]),
-                                                        local_sum);
+                                bsr_val[block_dim * block_dim * j + block_dim * k + local_row]
+                                    = val_j;
                             }
                         }
+
+                        if(break_outer_loop)
+                        {
+                            break;
+                        }
                     }
-                }
 
-                val_j = testing_mult((val_j - local_sum), inv_diag);
-                sum   = testing_fma(val_j, testing_conj(val_j), sum);
+                    if(!has_diag)
+                    {
+                        // Structural missing block diagonal
+                        if(s_pivot == -1)
+                        {
+                            s_pivot = i / block_dim + base;
+                        }
+                    }
 
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    bsr_val[block_dim * block_dim * j + block_dim * local_row + k] = val_j;
-                }
-                else
-                {
-                    bsr_val[block_dim * block_dim * j + block_dim * k + local_row] = val_j;
-                }
-            }
+                    // Process diagonal entry
+                    if(has_diag)
+                    {
+                        T diag_entry = make_DataType<T>(
+                            std::sqrt(testing_abs(bsr_val[diag_val_index] - sum)));
+                        bsr_val[diag_val_index] = diag_entry;
 
-            if(break_outer_loop)
-            {
-                break;
-            }
-        }
+                        if(diag_entry == make_DataType<T>(0))
+                        {
+                            // Numerical non-invertible block diagonal
+                            if(n_pivot == -1)
+                            {
+                                n_pivot = i / block_dim + base;
+                            }
 
-        if(!has_diag)
-        {
-            // Structural missing block diagonal
-            if(*struct_pivot == -1)
-            {
-                *struct_pivot = i / block_dim + base;
-            }
-        }
+                            n_pivot = std::min(n_pivot, i / block_dim + base);
+                        }
 
-        // Process diagonal entry
-        if(has_diag)
-        {
-            T diag_entry = make_DataType<T>(std::sqrt(testing_abs(bsr_val[diag_val_index] - sum)));
-            bsr_val[diag_val_index] = diag_entry;
+                        // Store diagonal offset
+                        diag_offset[i] = diag_val_index;
+                    }
 
-            if(diag_entry == make_DataType<T>(0))
-            {
-                // Numerical non-invertible block diagonal
-                if(*numeric_pivot == -1)
-                {
-                    *numeric_pivot = i / block_dim + base;
-                }
+                    for(int j = row_begin; j < row_end; j++)
+                    {
+                        int block_col_j = bsr_col_ind[j] - base;
 
-                *numeric_pivot = std::min(*numeric_pivot, i / block_dim + base);
+                        for(int k = 0; k < block_dim; k++)
+                        {
+                            nnz_entries[block_dim * block_col_j + k] = -1;
+                        }
+                    }
+                }
             }
-
-            // Store diagonal offset
-            diag_offset[i] = diag_val_index;
         }
+    }
 
-        for(int j = row_begin; j < row_end; j++)
+    for(int i = 0; i < Mb; i++)
+    {
+        if(*struct_pivot == -1)
         {
-            int block_col_j = bsr_col_ind[j] - base;
+            *struct_pivot = block_struct_pivot[i];
+        }
 
-            for(int k = 0; k < block_dim; k++)
-            {
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
-                }
-                else
-                {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
-                }
-            }
+        if(block_numeric_pivot[i] != -1)
+        {
+            *numeric_pivot = (*numeric_pivot == -1)
+                                 ? block_numeric_pivot[i]
+                                 : std::min(*numeric_pivot, block_numeric_pivot[i]);
         }
     }
 }
 
+/*! \brief  Computes the incomplete Cholesky factorization with zero fill in of a CSR matrix with
+ *  sorted columns, level by level as csrilu0. The pivots are those of the first row that cannot
+ *  be factored. */
 template <typename T>
 void csric0(int                  M,
             const int*           csr_row_ptr,
@@ -4001,383 +6517,316 @@ void csric0(int                  M,
     struct_pivot  = -1;
     numeric_pivot = -1;
 
-    // pointer of upper part of each row
-    std::vector<int> diag_offset(M);
-    std::vector<int> nnz_entries(M, 0);
-
-    // ai = 0 to N loop over all rows
-    for(int ai = 0; ai < M; ++ai)
-    {
-        // ai-th row entries
-        int row_begin = csr_row_ptr[ai] - idx_base;
-        int row_end   = csr_row_ptr[ai + 1] - idx_base;
-        int j;
-
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
-        {
-            nnz_entries[csr_col_ind[j] - idx_base] = j;
-        }
-
-        T sum = make_DataType<T>(0.0);
-
-        bool has_diag = false;
-
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            int col_j = csr_col_ind[j] - idx_base;
-            T   val_j = csr_val[j];
-
-            // Mark diagonal and skip row
-            if(col_j == ai)
-            {
-                has_diag = true;
-                break;
-            }
-
-            // Skip upper triangular
-            if(col_j > ai)
-            {
-                break;
-            }
-
-            int row_begin_j = csr_row_ptr[col_j] - idx_base;
-            int row_diag_j  = diag_offset[col_j];
-
-            T local_sum = make_DataType<T>(0.0);
-            T inv_diag  = csr_val[row_diag_j];
-
-            // Check for numeric zero
-            if(inv_diag == make_DataType<T>(0.0))
-            {
-                // Numerical zero diagonal
-                numeric_pivot = col_j + idx_base;
-                return;
-            }
-
-            inv_diag = testing_div(make_DataType<T>(1.0), inv_diag);
-
-            // loop over upper offset pointer and do linear combination for nnz entry
-            for(int k = row_begin_j; k < row_diag_j; ++k)
-            {
-                int col_k = csr_col_ind[k] - idx_base;
-
-                // if nnz at this position do linear combination
-                if(nnz_entries[col_k] != 0)
-                {
-                    int idx   = nnz_entries[col_k];
-                    local_sum = testing_fma(csr_val[k], testing_conj(csr_val[idx]), local_sum);
-                }
-            }
-
-            val_j = testing_mult((val_j - local_sum), inv_diag);
-            sum   = testing_fma(val_j, testing_conj(val_j), sum);
-
-            csr_val[j] = val_j;
-        }
-
-        if(!has_diag)
-        {
-            // Structural (and numerical) zero diagonal
-            struct_pivot  = ai + idx_base;
-            numeric_pivot = ai + idx_base;
-            return;
-        }
-
-        // Process diagonal entry
-        T diag_entry = make_DataType<T>(std::sqrt(testing_abs(csr_val[j] - sum)));
-        csr_val[j]   = diag_entry;
+    host_trsm_schedule<int> schedule;
+    host_trsm_analysis(M,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                       HIPSPARSE_FILL_MODE_LOWER,
+                       idx_base,
+                       schedule);
 
-        // Store diagonal offset
-        diag_offset[ai] = j;
+    int nlevels = static_cast<int>(schedule.level_ptr.size()) - 1;
 
-        // clear nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            nnz_entries[csr_col_ind[j] - idx_base] = 0;
-        }
-    }
-}
+    // pointer of upper part of each row, -1 if the row could not be factored
+    std::vector<int> diag_offset(M, -1);
 
-/* ============================================================================================ */
-/*! \brief  Sparse triangular system solve using CSR storage format. */
-template <typename I, typename J, typename T>
-static inline void host_lssolve(J                     M,
-                                J                     nrhs,
-                                hipsparseOperation_t  transB,
-                                T                     alpha,
-                                const std::vector<I>& csr_row_ptr,
-                                const std::vector<J>& csr_col_ind,
-                                const std::vector<T>& csr_val,
-                                std::vector<T>&       B,
-                                J                     ldb,
-                                hipsparseOrder_t      order_B,
-                                hipsparseDiagType_t   diag_type,
-                                hipsparseIndexBase_t  base,
-                                J*                    struct_pivot,
-                                J*                    numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
+    // Structural and numeric pivot found while factoring each row
+    std::vector<int> row_struct_pivot(M, -1);
+    std::vector<int> row_numeric_pivot(M, -1);
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel
 #endif
-    for(J i = 0; i < nrhs; ++i)
     {
-        std::vector<T> temp(prop.warpSize);
+        std::vector<int> nnz_entries(M, -1);
 
-        // Process lower triangular part
-        for(J row = 0; row < M; ++row)
+        for(int level = 0; level < nlevels; ++level)
         {
-            temp.assign(prop.warpSize, make_DataType<T>(0.0));
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+            for(int r = schedule.level_ptr[level]; r < schedule.level_ptr[level + 1]; ++r)
+            {
+                int ai = schedule.level_rows[r];
 
-            J idx_B
-                = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                      ? i * ldb + row
-                      : row * ldb + i;
+                // ai-th row entries
+                int row_begin = csr_row_ptr[ai] - idx_base;
+                int row_end   = csr_row_ptr[ai + 1] - idx_base;
+                int j;
 
-            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-            {
-                temp[0] = testing_mult(alpha, testing_conj(B[idx_B]));
-            }
-            else
-            {
-                temp[0] = testing_mult(alpha, B[idx_B]);
-            }
+                // nnz position of ai-th row in val array
+                for(j = row_begin; j < row_end; ++j)
+                {
+                    nnz_entries[csr_col_ind[j] - idx_base] = j;
+                }
 
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
+                T sum = make_DataType<T>(0.0);
 
-            T diag_val = make_DataType<T>(0.0);
+                bool has_diag = false;
+                bool failed   = false;
 
-            for(I l = row_begin; l < row_end; l += prop.warpSize)
-            {
-                for(int k = 0; k < prop.warpSize; ++k)
+                // loop over ai-th row nnz entries
+                for(j = row_begin; j < row_end; ++j)
                 {
-                    I j = l + k;
+                    int col_j = csr_col_ind[j] - idx_base;
+                    T   val_j = csr_val[j];
 
-                    // Do not run out of bounds
-                    if(j >= row_end)
+                    // Mark diagonal and skip row
+                    if(col_j == ai)
                     {
+                        has_diag = true;
                         break;
                     }
 
-                    J local_col = csr_col_ind[j] - base;
-                    T local_val = csr_val[j];
-
-                    if(local_val == make_DataType<T>(0.0) && local_col == row
-                       && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                    // Skip upper triangular
+                    if(col_j > ai)
                     {
-                        // Numerical zero pivot found, avoid division by 0 and store
-                        // index for later use
-                        *numeric_pivot = std::min(*numeric_pivot, row + base);
-                        local_val      = make_DataType<T>(1.0);
+                        break;
                     }
 
-                    // Ignore all entries that are above the diagonal
-                    if(local_col > row)
+                    int row_begin_j = csr_row_ptr[col_j] - idx_base;
+                    int row_diag_j  = diag_offset[col_j];
+
+                    // An earlier row could not be factored
+                    if(row_diag_j == -1)
                     {
+                        failed = true;
                         break;
                     }
 
-                    // Diagonal entry
-                    if(local_col == row)
-                    {
-                        // If diagonal type is non unit, do division by diagonal entry
-                        // This is not required for unit diagonal for obvious reasons
-                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                        {
-                            diag     = j;
-                            diag_val = testing_div(make_DataType<T>(1.0), local_val);
-                        }
+                    T local_sum = make_DataType<T>(0.0);
+                    T inv_diag  = csr_val[row_diag_j];
 
+                    // Check for numeric zero
+                    if(inv_diag == make_DataType<T>(0.0))
+                    {
+                        // Numerical zero diagonal
+                        row_numeric_pivot[ai] = col_j + idx_base;
+                        failed                = true;
                         break;
                     }
 
-                    // Lower triangular part
-                    J idx     = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                             && order_B == HIPSPARSE_ORDER_COL)
-                                    ? i * ldb + local_col
-                                    : local_col * ldb + i;
-                    T neg_val = testing_mult(make_DataType<T>(-1.0), local_val);
+                    inv_diag = testing_div(make_DataType<T>(1.0), inv_diag);
 
-                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                    {
-                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
-                    }
-                    else
+                    // loop over upper offset pointer and do linear combination for nnz entry
+                    for(int k = row_begin_j; k < row_diag_j; ++k)
                     {
-                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
+                        int col_k = csr_col_ind[k] - idx_base;
+
+                        // if nnz at this position do linear combination
+                        if(nnz_entries[col_k] != -1)
+                        {
+                            int idx   = nnz_entries[col_k];
+                            local_sum = testing_fma(
+                                csr_val[k], testing_conj(csr_val[idx]), local_sum);
+                        }
                     }
+
+                    val_j = testing_mult((val_j - local_sum), inv_diag);
+                    sum   = testing_fma(val_j, testing_conj(val_j), sum);
+
+                    csr_val[j] = val_j;
                 }
-            }
 
-            for(int j = 1; j < prop.warpSize; j <<= 1)
-            {
-                for(int k = 0; k < prop.warpSize - j; ++k)
+                if(!failed && !has_diag)
                 {
-                    temp[k] = temp[k] + temp[k + j];
+                    // Structural (and numerical) zero diagonal
+                    row_struct_pivot[ai]  = ai + idx_base;
+                    row_numeric_pivot[ai] = ai + idx_base;
+                    failed                = true;
                 }
-            }
 
-            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-            {
-                if(diag == -1)
+                if(!failed)
                 {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
+                    // Process diagonal entry
+                    T diag_entry = make_DataType<T>(std::sqrt(testing_abs(csr_val[j] - sum)));
+                    csr_val[j]   = diag_entry;
+
+                    // Store diagonal offset
+                    diag_offset[ai] = j;
                 }
 
-                B[idx_B] = testing_mult(temp[0], diag_val);
-            }
-            else
-            {
-                B[idx_B] = temp[0];
+                // clear nnz entries
+                for(j = row_begin; j < row_end; ++j)
+                {
+                    nnz_entries[csr_col_ind[j] - idx_base] = -1;
+                }
             }
         }
     }
+
+    for(int ai = 0; ai < M; ++ai)
+    {
+        if(row_numeric_pivot[ai] != -1)
+        {
+            struct_pivot  = row_struct_pivot[ai];
+            numeric_pivot = row_numeric_pivot[ai];
+            return;
+        }
+    }
 }
 
+/*! \brief  Solves op(A) * X = alpha * B in place for nrhs right hand sides, where the entry of row
+ *  `row` of right hand side i is B[row * row_stride + i * rhs_stride]. If conj_B is set, B and
+ *  the solved entries are conjugated when read. Every row gathers the solved rows it depends on
+ *  with the wavefront reduction of the device kernels. Transposed solves gather the rows of A^T
+ *  through the pattern of the schedule, which sums in the same order as solving with a CSC copy
+ *  of A, like the device does. */
 template <typename I, typename J, typename T>
-static inline void host_ussolve(J                     M,
-                                J                     nrhs,
-                                hipsparseOperation_t  transB,
-                                T                     alpha,
-                                const std::vector<I>& csr_row_ptr,
-                                const std::vector<J>& csr_col_ind,
-                                const std::vector<T>& csr_val,
-                                std::vector<T>&       B,
-                                J                     ldb,
-                                hipsparseOrder_t      order_B,
-                                hipsparseDiagType_t   diag_type,
-                                hipsparseIndexBase_t  base,
-                                J*                    struct_pivot,
-                                J*                    numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
+inline void host_trsm_solve(const host_trsm_schedule<J>& schedule,
+                            J                            M,
+                            J                            nrhs,
+                            hipsparseOperation_t         trans,
+                            T                            alpha,
+                            const I*                     csr_row_ptr,
+                            const J*                     csr_col_ind,
+                            const T*                     csr_val,
+                            T*                           B,
+                            int64_t                      row_stride,
+                            int64_t                      rhs_stride,
+                            bool                         conj_B,
+                            hipsparseDiagType_t          diag_type,
+                            hipsparseFillMode_t          fill_mode,
+                            hipsparseIndexBase_t         base,
+                            J*                           struct_pivot,
+                            J*                           numeric_pivot)
+{
+    bool non_trans = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE);
+    bool conj_A    = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+    bool non_unit  = (diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
-    {
-        std::vector<T> temp(prop.warpSize);
+    // The lower triangle of A is the upper triangle of A^T
+    bool lower = ((fill_mode == HIPSPARSE_FILL_MODE_LOWER) == non_trans);
 
-        // Process upper triangular part
-        for(J row = M - 1; row >= 0; --row)
-        {
-            temp.assign(prop.warpSize, make_DataType<T>(0.0));
+    auto entry = [&](J row, J i) -> T& { return B[row * row_stride + i * rhs_stride]; };
+    auto read  = [&](J row, J i) { return testing_conj(entry(row, i), conj_B); };
 
-            J idx_B
-                = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                      ? i * ldb + row
-                      : row * ldb + i;
+    // Zero based entries of row `row` of op(A)
+    auto row_begin = [&](J row) -> int64_t {
+        return non_trans ? csr_row_ptr[row] - base : schedule.trans_ptr[row];
+    };
+    auto row_end = [&](J row) -> int64_t {
+        return non_trans ? csr_row_ptr[row + 1] - base : schedule.trans_ptr[row + 1];
+    };
+    auto col_of = [&](int64_t j) -> J {
+        return non_trans ? csr_col_ind[j] - base : schedule.trans_ind[j];
+    };
+    auto val_of = [&](int64_t j) {
+        return non_trans ? csr_val[j] : testing_conj(csr_val[schedule.trans_perm[j]], conj_A);
+    };
 
-            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-            {
-                temp[0] = testing_mult(alpha, testing_conj(B[idx_B]));
-            }
-            else
-            {
-                temp[0] = testing_mult(alpha, B[idx_B]);
-            }
+    int WF_SIZE = std::min(host_warp_size(), 64);
 
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
+    J nlevels = static_cast<J>(schedule.level_ptr.size()) - 1;
+
+    for(J l = 0; l < nlevels; ++l)
+    {
+        J level_begin = schedule.level_ptr[l];
+        J level_end   = schedule.level_ptr[l + 1];
 
-            T diag_val = make_DataType<T>(0.0);
+        bool parallel_level = (level_end - level_begin) * nrhs >= 64;
 
-            for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
+#ifdef _OPENMP
+#pragma omp parallel for collapse(2) schedule(dynamic, 16) if(parallel_level)
+#endif
+        for(J r = level_begin; r < level_end; ++r)
+        {
+            for(J i = 0; i < nrhs; ++i)
             {
-                for(int k = 0; k < prop.warpSize; ++k)
+                J       row   = schedule.level_rows[r];
+                int64_t begin = row_begin(row);
+                int64_t end   = row_end(row);
+
+                T temp[64];
+                for(int k = 0; k < WF_SIZE; ++k)
                 {
-                    I j = l - k;
+                    temp[k] = make_DataType<T>(0.0);
+                }
 
-                    // Do not run out of bounds
-                    if(j < row_begin)
-                    {
-                        break;
-                    }
+                temp[0] = testing_mult(alpha, read(row, i));
 
-                    J local_col = csr_col_ind[j] - base;
-                    T local_val = csr_val[j];
+                I    diag     = -1;
+                T    diag_val = make_DataType<T>(0.0);
+                bool done     = false;
 
-                    // Ignore all entries that are below the diagonal
-                    if(local_col < row)
+                // Lower rows are processed from the left and end at the diagonal, upper rows
+                // from the right and skip everything below the diagonal
+                for(int64_t l = 0; l < end - begin && !done; l += WF_SIZE)
+                {
+                    for(int k = 0; k < WF_SIZE; ++k)
                     {
-                        continue;
-                    }
+                        if(l + k >= end - begin)
+                        {
+                            break;
+                        }
 
-                    // Diagonal entry
-                    if(local_col == row)
-                    {
-                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                        int64_t j   = lower ? begin + l + k : end - 1 - l - k;
+                        J       col = col_of(j);
+                        T       val = val_of(j);
+
+                        if(col == row)
                         {
-                            // Check for numerical zero
-                            if(local_val == make_DataType<T>(0.0))
+                            if(non_unit)
                             {
-                                *numeric_pivot = std::min(*numeric_pivot, row + base);
-                                local_val      = make_DataType<T>(1.0);
+                                // Numerical zero pivot found, avoid division by 0 and
+                                // store index for later use
+                                if(val == make_DataType<T>(0.0))
+                                {
+                                    host_trsm_pivot(numeric_pivot, row + base);
+                                    val = make_DataType<T>(1.0);
+                                }
+
+                                diag     = j;
+                                diag_val = testing_div(make_DataType<T>(1.0), val);
                             }
 
-                            diag     = j;
-                            diag_val = testing_div(make_DataType<T>(1.0), local_val);
-                        }
+                            if(lower)
+                            {
+                                done = true;
+                                break;
+                            }
 
-                        continue;
-                    }
+                            continue;
+                        }
 
-                    // Upper triangular part
-                    J idx = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                             && order_B == HIPSPARSE_ORDER_COL)
-                                ? i * ldb + local_col
-                                : local_col * ldb + i;
+                        // Ignore all entries of the other triangle
+                        if(lower && col > row)
+                        {
+                            done = true;
+                            break;
+                        }
 
-                    T neg_val = testing_mult(make_DataType<T>(-1.0), local_val);
+                        if(!lower && col < row)
+                        {
+                            continue;
+                        }
 
-                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                    {
-                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
+                        temp[k] = testing_fma(-val, read(col, i), temp[k]);
                     }
-                    else
+                }
+
+                for(int j = 1; j < WF_SIZE; j <<= 1)
+                {
+                    for(int k = 0; k < WF_SIZE - j; ++k)
                     {
-                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
+                        temp[k] = temp[k] + temp[k + j];
                     }
                 }
-            }
 
-            for(int j = 1; j < prop.warpSize; j <<= 1)
-            {
-                for(int k = 0; k < prop.warpSize - j; ++k)
+                if(non_unit)
                 {
-                    temp[k] = temp[k] + temp[k + j];
-                }
-            }
+                    if(diag == -1)
+                    {
+                        host_trsm_pivot(struct_pivot, row + base);
+                    }
 
-            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-            {
-                if(diag == -1)
+                    entry(row, i) = testing_mult(temp[0], diag_val);
+                }
+                else
                 {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
+                    entry(row, i) = temp[0];
                 }
-
-                B[idx_B] = testing_mult(temp[0], diag_val);
-            }
-            else
-            {
-                B[idx_B] = temp[0];
             }
         }
     }
@@ -4423,311 +6872,101 @@ void host_bsrsm(int                  mb,
                        bsr_val,
                        bsr_dim,
                        B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
-        }
-        else
-        {
-            bsr_usolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
-        }
-    }
-    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE)
-    {
-        // Transpose matrix
-        std::vector<int> bsrt_row_ptr(mb + 1);
-        std::vector<int> bsrt_col_ind(nnzb);
-        std::vector<T>   bsrt_val(nnzb * bsr_dim * bsr_dim);
-
-        host_bsr_to_bsc(mb,
-                        mb,
-                        nnzb,
-                        bsr_dim,
-                        bsr_row_ptr,
-                        bsr_col_ind,
-                        bsr_val,
-                        bsrt_col_ind,
-                        bsrt_row_ptr,
-                        bsrt_val,
-                        base,
-                        base);
-
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            bsr_usolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsrt_row_ptr.data(),
-                       bsrt_col_ind.data(),
-                       bsrt_val.data(),
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
-        }
-        else
-        {
-            bsr_lsolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsrt_row_ptr.data(),
-                       bsrt_col_ind.data(),
-                       bsrt_val.data(),
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
-        }
-    }
-
-    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
-
-    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
-}
-
-template <typename I, typename J, typename T>
-void host_csr_lsolve(J                    M,
-                     T                    alpha,
-                     const I*             csr_row_ptr,
-                     const J*             csr_col_ind,
-                     const T*             csr_val,
-                     const T*             x,
-                     T*                   y,
-                     hipsparseDiagType_t  diag_type,
-                     hipsparseIndexBase_t base,
-                     J*                   struct_pivot,
-                     J*                   numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-    std::vector<T> temp(prop.warpSize);
-
-    // Process lower triangular part
-    for(J row = 0; row < M; ++row)
-    {
-        temp.assign(prop.warpSize, make_DataType<T>(0.0));
-        temp[0] = testing_mult(alpha, x[row]);
-
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
-
-        T diag_val = make_DataType<T>(0.0);
-
-        for(I l = row_begin; l < row_end; l += prop.warpSize)
-        {
-            for(int k = 0; k < prop.warpSize; ++k)
-            {
-                I j = l + k;
-
-                // Do not run out of bounds
-                if(j >= row_end)
-                {
-                    break;
-                }
-
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
-
-                if(local_val == make_DataType<T>(0.0) && local_col == row
-                   && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                {
-                    // Numerical zero pivot found, avoid division by 0
-                    // and store index for later use.
-                    *numeric_pivot = std::min(*numeric_pivot, row + base);
-                    local_val      = make_DataType<T>(1);
-                }
-
-                // Ignore all entries that are above the diagonal
-                if(local_col > row)
-                {
-                    break;
-                }
-
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    // If diagonal type is non unit, do division by diagonal entry
-                    // This is not required for unit diagonal for obvious reasons
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        diag     = j;
-                        diag_val = testing_div(make_DataType<T>(1), local_val);
-                    }
-
-                    break;
-                }
-
-                // Lower triangular part
-                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
-            }
-        }
-
-        for(int j = 1; j < prop.warpSize; j <<= 1)
-        {
-            for(int k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] = temp[k] + temp[k + j];
-            }
-        }
-
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
-
-            y[row] = testing_mult(temp[0], diag_val);
-        }
-        else
-        {
-            y[row] = temp[0];
-        }
-    }
-}
-
-template <typename I, typename J, typename T>
-void host_csr_usolve(J                    M,
-                     T                    alpha,
-                     const I*             csr_row_ptr,
-                     const J*             csr_col_ind,
-                     const T*             csr_val,
-                     const T*             x,
-                     T*                   y,
-                     hipsparseDiagType_t  diag_type,
-                     hipsparseIndexBase_t base,
-                     J*                   struct_pivot,
-                     J*                   numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-    std::vector<T> temp(prop.warpSize);
-
-    // Process upper triangular part
-    for(J row = M - 1; row >= 0; --row)
-    {
-        temp.assign(prop.warpSize, make_DataType<T>(0));
-        temp[0] = testing_mult(alpha, x[row]);
-
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
-
-        T diag_val = make_DataType<T>(0);
-
-        for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
-        {
-            for(int k = 0; k < prop.warpSize; ++k)
-            {
-                I j = l - k;
-
-                // Do not run out of bounds
-                if(j < row_begin)
-                {
-                    break;
-                }
-
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
-
-                // Ignore all entries that are below the diagonal
-                if(local_col < row)
-                {
-                    continue;
-                }
-
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Check for numerical zero
-                        if(local_val == make_DataType<T>(0))
-                        {
-                            *numeric_pivot = std::min(*numeric_pivot, row + base);
-                            local_val      = make_DataType<T>(1);
-                        }
-
-                        diag     = j;
-                        diag_val = testing_div(make_DataType<T>(1), local_val);
-                    }
-
-                    continue;
-                }
-
-                // Upper triangular part
-                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
-            }
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
         }
-
-        for(int j = 1; j < prop.warpSize; j <<= 1)
+        else
         {
-            for(int k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] = temp[k] + temp[k + j];
-            }
+            bsr_usolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
         }
+    }
+    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE)
+    {
+        // Transpose matrix
+        std::vector<int> bsrt_row_ptr(mb + 1);
+        std::vector<int> bsrt_col_ind(nnzb);
+        std::vector<T>   bsrt_val(nnzb * bsr_dim * bsr_dim);
 
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
+        host_bsr_to_bsc(mb,
+                        mb,
+                        nnzb,
+                        bsr_dim,
+                        bsr_row_ptr,
+                        bsr_col_ind,
+                        bsr_val,
+                        bsrt_col_ind,
+                        bsrt_row_ptr,
+                        bsrt_val,
+                        base,
+                        base);
 
-            y[row] = testing_mult(temp[0], diag_val);
+        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
+        {
+            bsr_usolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsrt_row_ptr.data(),
+                       bsrt_col_ind.data(),
+                       bsrt_val.data(),
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
         }
         else
         {
-            y[row] = temp[0];
+            bsr_lsolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsrt_row_ptr.data(),
+                       bsrt_col_ind.data(),
+                       bsrt_val.data(),
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
         }
     }
+
+    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
+
+    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
 }
 
 template <typename I, typename J, typename T>
@@ -4750,94 +6989,28 @@ void host_csrsv(hipsparseOperation_t trans,
     *struct_pivot  = M + 1;
     *numeric_pivot = M + 1;
 
-    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_csr_lsolve(M,
-                            alpha,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            csr_val,
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-        else
-        {
-            host_csr_usolve(M,
-                            alpha,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            csr_val,
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-    }
-    else if(trans == HIPSPARSE_OPERATION_TRANSPOSE
-            || trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-    {
-        // Transpose matrix
-        std::vector<I> csrt_row_ptr(M + 1);
-        std::vector<J> csrt_col_ind(nnz);
-        std::vector<T> csrt_val(nnz);
-
-        host_csr_to_csc(M,
-                        M,
-                        nnz,
-                        csr_row_ptr,
-                        csr_col_ind,
-                        csr_val,
-                        csrt_col_ind,
-                        csrt_row_ptr,
-                        csrt_val,
-                        HIPSPARSE_ACTION_NUMERIC,
-                        base);
-
-        if(trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-        {
-            for(size_t i = 0; i < csrt_val.size(); i++)
-            {
-                csrt_val[i] = testing_conj(csrt_val[i]);
-            }
-        }
-
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_csr_usolve(M,
-                            alpha,
-                            csrt_row_ptr.data(),
-                            csrt_col_ind.data(),
-                            csrt_val.data(),
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-        else
-        {
-            host_csr_lsolve(M,
-                            alpha,
-                            csrt_row_ptr.data(),
-                            csrt_col_ind.data(),
-                            csrt_val.data(),
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-    }
+    // Solve in place, the transposed solve reads A^T through the pattern of the schedule
+    std::copy(x, x + M, y);
+
+    host_trsm_schedule<J> schedule;
+    host_trsm_analysis(M, csr_row_ptr, csr_col_ind, trans, fill_mode, base, schedule);
+    host_trsm_solve(schedule,
+                    M,
+                    static_cast<J>(1),
+                    trans,
+                    alpha,
+                    csr_row_ptr,
+                    csr_col_ind,
+                    csr_val,
+                    y,
+                    1,
+                    0,
+                    false,
+                    diag_type,
+                    fill_mode,
+                    base,
+                    struct_pivot,
+                    numeric_pivot);
 
     *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
 
@@ -4915,106 +7088,30 @@ void host_csrsm2(J                     M,
     *struct_pivot  = M + 1;
     *numeric_pivot = M + 1;
 
-    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_lssolve(M,
-                         nrhs,
-                         transB,
-                         alpha,
-                         csr_row_ptr,
-                         csr_col_ind,
-                         csr_val,
-                         B,
-                         ldb,
-                         order_B,
-                         diag_type,
-                         base,
-                         struct_pivot,
-                         numeric_pivot);
-        }
-        else
-        {
-            host_ussolve(M,
-                         nrhs,
-                         transB,
-                         alpha,
-                         csr_row_ptr,
-                         csr_col_ind,
-                         csr_val,
-                         B,
-                         ldb,
-                         order_B,
-                         diag_type,
-                         base,
-                         struct_pivot,
-                         numeric_pivot);
-        }
-    }
-    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE
-            || transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-    {
-        // Transpose matrix
-        std::vector<I> csrt_row_ptr(M + 1);
-        std::vector<J> csrt_col_ind(nnz);
-        std::vector<T> csrt_val(nnz);
-
-        host_csr_to_csc(M,
-                        M,
-                        nnz,
-                        csr_row_ptr.data(),
-                        csr_col_ind.data(),
-                        csr_val.data(),
-                        csrt_col_ind,
-                        csrt_row_ptr,
-                        csrt_val,
-                        HIPSPARSE_ACTION_NUMERIC,
-                        base);
-
-        if(transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-        {
-            for(size_t i = 0; i < csrt_val.size(); i++)
-            {
-                csrt_val[i] = testing_conj(csrt_val[i]);
-            }
-        }
-
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_ussolve(M,
-                         nrhs,
-                         transB,
-                         alpha,
-                         csrt_row_ptr,
-                         csrt_col_ind,
-                         csrt_val,
-                         B,
-                         ldb,
-                         order_B,
-                         diag_type,
-                         base,
-                         struct_pivot,
-                         numeric_pivot);
-        }
-        else
-        {
-            host_lssolve(M,
-                         nrhs,
-                         transB,
-                         alpha,
-                         csrt_row_ptr,
-                         csrt_col_ind,
-                         csrt_val,
-                         B,
-                         ldb,
-                         order_B,
-                         diag_type,
-                         base,
-                         struct_pivot,
-                         numeric_pivot);
-        }
-    }
+    bool B_col_major
+        = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL);
+
+    // One schedule serves all right hand sides
+    host_trsm_schedule<J> schedule;
+    host_trsm_analysis(
+        M, csr_row_ptr.data(), csr_col_ind.data(), transA, fill_mode, base, schedule);
+    host_trsm_solve(schedule,
+                    M,
+                    nrhs,
+                    transA,
+                    alpha,
+                    csr_row_ptr.data(),
+                    csr_col_ind.data(),
+                    csr_val.data(),
+                    B.data(),
+                    B_col_major ? 1 : ldb,
+                    B_col_major ? ldb : 1,
+                    transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                    diag_type,
+                    fill_mode,
+                    base,
+                    struct_pivot,
+                    numeric_pivot);
 
     *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
 
@@ -5402,93 +7499,114 @@ void bsr_lsolve(hipsparseDirection_t dir,
                 int*                 struct_pivot,
                 int*                 numeric_pivot)
 {
+    // Block rows of the same level are solved in parallel
+    host_trsm_schedule<int> schedule;
+    host_trsm_analysis(mb,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                       HIPSPARSE_FILL_MODE_LOWER,
+                       base,
+                       schedule);
+
+    for(size_t l = 0; l + 1 < schedule.level_ptr.size(); ++l)
+    {
+        int  level_begin    = schedule.level_ptr[l];
+        int  level_end      = schedule.level_ptr[l + 1];
+        bool parallel_level = (level_end - level_begin) * nrhs >= 16;
+
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for collapse(2) schedule(dynamic, 4) if(parallel_level)
 #endif
-    for(int i = 0; i < nrhs; ++i)
-    {
-        // Process lower triangular part
-        for(int bsr_row = 0; bsr_row < mb; ++bsr_row)
+        for(int r = level_begin; r < level_end; ++r)
         {
-            int bsr_row_begin = bsr_row_ptr[bsr_row] - base;
-            int bsr_row_end   = bsr_row_ptr[bsr_row + 1] - base;
-
-            // Loop over blocks rows
-            for(int bi = 0; bi < bsr_dim; ++bi)
+            for(int i = 0; i < nrhs; ++i)
             {
-                int diag      = -1;
-                int local_row = bsr_row * bsr_dim + bi;
-
-                int idx_B = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? i * ldb + local_row
-                                                                           : local_row * ldb + i;
-                int idx_X = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? i * ldx + local_row
-                                                                           : local_row * ldx + i;
+                // Process lower triangular part
+                int bsr_row = schedule.level_rows[r];
 
-                T sum      = testing_mult(alpha, B[idx_B]);
-                T diag_val = make_DataType<T>(0);
+                int bsr_row_begin = bsr_row_ptr[bsr_row] - base;
+                int bsr_row_end   = bsr_row_ptr[bsr_row + 1] - base;
 
-                // Loop over BSR columns
-                for(int j = bsr_row_begin; j < bsr_row_end; ++j)
+                // Loop over blocks rows
+                for(int bi = 0; bi < bsr_dim; ++bi)
                 {
-                    int bsr_col = bsr_col_ind[j] - base;
+                    int diag      = -1;
+                    int local_row = bsr_row * bsr_dim + bi;
+
+                    int idx_B = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                                    ? i * ldb + local_row
+                                    : local_row * ldb + i;
+                    int idx_X = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                                    ? i * ldx + local_row
+                                    : local_row * ldx + i;
 
-                    // Loop over blocks columns
-                    for(int bj = 0; bj < bsr_dim; ++bj)
+                    T sum      = testing_mult(alpha, B[idx_B]);
+                    T diag_val = make_DataType<T>(0);
+
+                    // Loop over BSR columns
+                    for(int j = bsr_row_begin; j < bsr_row_end; ++j)
                     {
-                        int local_col = bsr_col * bsr_dim + bj;
-                        T   local_val = (dir == HIPSPARSE_DIRECTION_ROW)
-                                            ? bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj]
-                                            : bsr_val[bsr_dim * bsr_dim * j + bi + bj * bsr_dim];
+                        int bsr_col = bsr_col_ind[j] - base;
 
-                        if(local_val == make_DataType<T>(0) && local_col == local_row
-                           && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                        // Loop over blocks columns
+                        for(int bj = 0; bj < bsr_dim; ++bj)
                         {
-                            // Numerical zero pivot found, avoid division by 0
-                            // and store index for later use.
-                            *numeric_pivot = std::min(*numeric_pivot, bsr_row + base);
-                            local_val      = make_DataType<T>(1);
-                        }
+                            int local_col = bsr_col * bsr_dim + bj;
+                            int local_idx = (dir == HIPSPARSE_DIRECTION_ROW) ? bi * bsr_dim + bj
+                                                                             : bi + bj * bsr_dim;
+                            T   local_val = bsr_val[bsr_dim * bsr_dim * j + local_idx];
 
-                        // Ignore all entries that are above the diagonal
-                        if(local_col > local_row)
-                        {
-                            break;
-                        }
+                            if(local_val == make_DataType<T>(0) && local_col == local_row
+                               && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                            {
+                                // Numerical zero pivot found, avoid division by 0
+                                // and store index for later use.
+                                host_trsm_pivot(numeric_pivot, bsr_row + base);
+                                local_val = make_DataType<T>(1);
+                            }
 
-                        // Diagonal
-                        if(local_col == local_row)
-                        {
-                            // If diagonal type is non unit, do division by diagonal entry
-                            // This is not required for unit diagonal for obvious reasons
-                            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                            // Ignore all entries that are above the diagonal
+                            if(local_col > local_row)
                             {
-                                diag     = j;
-                                diag_val = testing_div(make_DataType<T>(1), local_val);
+                                break;
                             }
 
-                            break;
-                        }
+                            // Diagonal
+                            if(local_col == local_row)
+                            {
+                                // If diagonal type is non unit, do division by diagonal entry
+                                // This is not required for unit diagonal for obvious reasons
+                                if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                                {
+                                    diag     = j;
+                                    diag_val = testing_div(make_DataType<T>(1), local_val);
+                                }
+
+                                break;
+                            }
 
-                        // Lower triangular part
-                        int idx = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-                                      ? i * ldx + local_col
-                                      : local_col * ldx + i;
-                        sum     = testing_fma(-local_val, X[idx], sum);
+                            // Lower triangular part
+                            int idx = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                                          ? i * ldx + local_col
+                                          : local_col * ldx + i;
+                            sum     = testing_fma(-local_val, X[idx], sum);
+                        }
                     }
-                }
 
-                if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                {
-                    if(diag == -1)
+                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
                     {
-                        *struct_pivot = std::min(*struct_pivot, bsr_row + base);
-                    }
+                        if(diag == -1)
+                        {
+                            host_trsm_pivot(struct_pivot, bsr_row + base);
+                        }
 
-                    X[idx_X] = testing_mult(sum, diag_val);
-                }
-                else
-                {
-                    X[idx_X] = sum;
+                        X[idx_X] = testing_mult(sum, diag_val);
+                    }
+                    else
+                    {
+                        X[idx_X] = sum;
+                    }
                 }
             }
         }
@@ -5516,86 +7634,107 @@ void bsr_usolve(hipsparseDirection_t dir,
                 int*                 struct_pivot,
                 int*                 numeric_pivot)
 {
+    // Block rows of the same level are solved in parallel
+    host_trsm_schedule<int> schedule;
+    host_trsm_analysis(mb,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                       HIPSPARSE_FILL_MODE_UPPER,
+                       base,
+                       schedule);
+
+    for(size_t l = 0; l + 1 < schedule.level_ptr.size(); ++l)
+    {
+        int  level_begin    = schedule.level_ptr[l];
+        int  level_end      = schedule.level_ptr[l + 1];
+        bool parallel_level = (level_end - level_begin) * nrhs >= 16;
+
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for collapse(2) schedule(dynamic, 4) if(parallel_level)
 #endif
-    for(int i = 0; i < nrhs; ++i)
-    {
-        // Process upper triangular part
-        for(int bsr_row = mb - 1; bsr_row >= 0; --bsr_row)
+        for(int r = level_begin; r < level_end; ++r)
         {
-            int bsr_row_begin = bsr_row_ptr[bsr_row] - base;
-            int bsr_row_end   = bsr_row_ptr[bsr_row + 1] - base;
-
-            for(int bi = bsr_dim - 1; bi >= 0; --bi)
+            for(int i = 0; i < nrhs; ++i)
             {
-                int local_row = bsr_row * bsr_dim + bi;
+                // Process upper triangular part
+                int bsr_row = schedule.level_rows[r];
 
-                int idx_B = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? i * ldb + local_row
-                                                                           : local_row * ldb + i;
-                int idx_X = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? i * ldx + local_row
-                                                                           : local_row * ldx + i;
-                T   sum   = testing_mult(alpha, B[idx_B]);
+                int bsr_row_begin = bsr_row_ptr[bsr_row] - base;
+                int bsr_row_end   = bsr_row_ptr[bsr_row + 1] - base;
 
-                int diag     = -1;
-                T   diag_val = make_DataType<T>(0);
-
-                for(int j = bsr_row_end - 1; j >= bsr_row_begin; --j)
+                for(int bi = bsr_dim - 1; bi >= 0; --bi)
                 {
-                    int bsr_col = bsr_col_ind[j] - base;
+                    int local_row = bsr_row * bsr_dim + bi;
 
-                    for(int bj = bsr_dim - 1; bj >= 0; --bj)
+                    int idx_B = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                                    ? i * ldb + local_row
+                                    : local_row * ldb + i;
+                    int idx_X = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                                    ? i * ldx + local_row
+                                    : local_row * ldx + i;
+                    T   sum   = testing_mult(alpha, B[idx_B]);
+
+                    int diag     = -1;
+                    T   diag_val = make_DataType<T>(0);
+
+                    for(int j = bsr_row_end - 1; j >= bsr_row_begin; --j)
                     {
-                        int local_col = bsr_col * bsr_dim + bj;
-                        T   local_val = dir == HIPSPARSE_DIRECTION_ROW
-                                            ? bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj]
-                                            : bsr_val[bsr_dim * bsr_dim * j + bi + bj * bsr_dim];
+                        int bsr_col = bsr_col_ind[j] - base;
 
-                        // Ignore all entries that are below the diagonal
-                        if(local_col < local_row)
+                        for(int bj = bsr_dim - 1; bj >= 0; --bj)
                         {
-                            continue;
-                        }
+                            int local_col = bsr_col * bsr_dim + bj;
+                            int local_idx = (dir == HIPSPARSE_DIRECTION_ROW) ? bi * bsr_dim + bj
+                                                                             : bi + bj * bsr_dim;
+                            T   local_val = bsr_val[bsr_dim * bsr_dim * j + local_idx];
 
-                        // Diagonal
-                        if(local_col == local_row)
-                        {
-                            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                            // Ignore all entries that are below the diagonal
+                            if(local_col < local_row)
+                            {
+                                continue;
+                            }
+
+                            // Diagonal
+                            if(local_col == local_row)
                             {
-                                // Check for numerical zero
-                                if(local_val == make_DataType<T>(0))
+                                if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
                                 {
-                                    *numeric_pivot = std::min(*numeric_pivot, bsr_row + base);
-                                    local_val      = make_DataType<T>(1);
+                                    // Check for numerical zero
+                                    if(local_val == make_DataType<T>(0))
+                                    {
+                                        host_trsm_pivot(numeric_pivot, bsr_row + base);
+                                        local_val = make_DataType<T>(1);
+                                    }
+
+                                    diag     = j;
+                                    diag_val = testing_div(make_DataType<T>(1), local_val);
                                 }
 
-                                diag     = j;
-                                diag_val = testing_div(make_DataType<T>(1), local_val);
+                                continue;
                             }
 
-                            continue;
+                            // Upper triangular part
+                            int idx = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                                          ? i * ldx + local_col
+                                          : local_col * ldx + i;
+                            sum     = testing_fma(-local_val, X[idx], sum);
                         }
-
-                        // Upper triangular part
-                        int idx = (trans_X == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-                                      ? i * ldx + local_col
-                                      : local_col * ldx + i;
-                        sum     = testing_fma(-local_val, X[idx], sum);
                     }
-                }
 
-                if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                {
-                    if(diag == -1)
+                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
                     {
-                        *struct_pivot = std::min(*struct_pivot, bsr_row + base);
-                    }
+                        if(diag == -1)
+                        {
+                            host_trsm_pivot(struct_pivot, bsr_row + base);
+                        }
 
-                    X[idx_X] = testing_mult(sum, diag_val);
-                }
-                else
-                {
-                    X[idx_X] = sum;
+                        X[idx_X] = testing_mult(sum, diag_val);
+                    }
+                    else
+                    {
+                        X[idx_X] = sum;
+                    }
                 }
             }
         }
@@ -6313,288 +8452,442 @@ static void host_csrgeam(int                  M,
         std::vector<int> perm(row_nnz);
         for(int j = 0; j < row_nnz; ++j)
         {
-            perm[j] = j;
-        }
+            perm[j] = j;
+        }
+
+        int* col_entry = &col[row_begin];
+        T*   val_entry = &val[row_begin];
+
+        std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
+            return col_entry[a] <= col_entry[b];
+        });
+
+        for(int j = 0; j < row_nnz; ++j)
+        {
+            csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
+            csr_val_C[row_begin + j]     = val_entry[perm[j]];
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Open addressing hash table of column indices, used as the accumulator of long rows in
+ *  the host SpGEMM. Every key can carry a position. Only the slots used by a row are cleared, so
+ *  a table sized for a long row is cheap to reuse for shorter ones. */
+template <typename J>
+class host_spgemm_hash_table
+{
+public:
+    // Prepares the table for up to capacity distinct keys
+    void reset(int64_t capacity)
+    {
+        size_t size = 16;
+        while(size < 2 * static_cast<size_t>(capacity))
+        {
+            size <<= 1;
+        }
+
+        if(size > this->keys.size())
+        {
+            this->keys.assign(size, static_cast<J>(-1));
+            this->values.resize(size);
+        }
+
+        this->mask = size - 1;
+    }
+
+    // Returns the slot of key, inserting it if it is not in the table yet
+    size_t insert(J key)
+    {
+        size_t slot = (static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull >> 17) & this->mask;
+
+        while(this->keys[slot] != key)
+        {
+            if(this->keys[slot] == static_cast<J>(-1))
+            {
+                this->keys[slot] = key;
+                this->used.push_back(slot);
+                break;
+            }
 
-        int* col_entry = &col[row_begin];
-        T*   val_entry = &val[row_begin];
+            slot = (slot + 1) & this->mask;
+        }
 
-        std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-            return col_entry[a] <= col_entry[b];
-        });
+        return slot;
+    }
 
-        for(int j = 0; j < row_nnz; ++j)
+    void clear()
+    {
+        for(size_t slot : this->used)
         {
-            csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
-            csr_val_C[row_begin + j]     = val_entry[perm[j]];
+            this->keys[slot] = static_cast<J>(-1);
         }
+
+        this->used.clear();
     }
-}
 
-/* ============================================================================================ */
-/*! \brief  Compute sparse matrix sparse matrix multiplication. */
-template <typename I, typename J, typename T>
-static I host_csrgemm2_nnz(J                    m,
-                           J                    n,
-                           J                    k,
-                           const T*             alpha,
-                           const I*             csr_row_ptr_A,
-                           const J*             csr_col_ind_A,
-                           const I*             csr_row_ptr_B,
-                           const J*             csr_col_ind_B,
-                           const T*             beta,
-                           const I*             csr_row_ptr_D,
-                           const J*             csr_col_ind_D,
-                           I*                   csr_row_ptr_C,
-                           hipsparseIndexBase_t idx_base_A,
-                           hipsparseIndexBase_t idx_base_B,
-                           hipsparseIndexBase_t idx_base_C,
-                           hipsparseIndexBase_t idx_base_D)
+    std::vector<J>       keys;
+    std::vector<int64_t> values;
+    std::vector<size_t>  used;
+
+private:
+    size_t mask{};
+};
+
+/*! \brief  Sparsity pattern of C = alpha * A * B + beta * D computed by host_csrgemm2_symbolic. It
+ *  only depends on the patterns of A, B and D, and host_csrgemm2_numeric reuses it to compute the
+ *  values of C for any values of A, B and D. */
+template <typename I, typename J>
+struct host_csrgemm2_pattern
+{
+    hipsparseIndexBase_t base;
+    std::vector<I>       row_ptr;
+    std::vector<J>       col_ind;
+    std::vector<int64_t> row_flops;
+
+    I nnz() const
+    {
+        return this->row_ptr.back() - this->base;
+    }
+};
+
+// Rows with at most this many products accumulate in a sorted list, longer ones in a hash table
+static constexpr int64_t host_spgemm_list_flops = 128;
+
+template <typename I, typename J>
+inline void host_csrgemm2_symbolic(J                             m,
+                                   J                             n,
+                                   bool                          mul_AB,
+                                   const I*                      csr_row_ptr_A,
+                                   const J*                      csr_col_ind_A,
+                                   const I*                      csr_row_ptr_B,
+                                   const J*                      csr_col_ind_B,
+                                   bool                          add_D,
+                                   const I*                      csr_row_ptr_D,
+                                   const J*                      csr_col_ind_D,
+                                   hipsparseIndexBase_t          idx_base_A,
+                                   hipsparseIndexBase_t          idx_base_B,
+                                   hipsparseIndexBase_t          idx_base_C,
+                                   hipsparseIndexBase_t          idx_base_D,
+                                   host_csrgemm2_pattern<I, J>& C)
 {
+    C.base = idx_base_C;
+    C.row_ptr.assign(m + 1, 0);
+    C.row_flops.assign(m, 0);
+
+    // Rows are processed in blocks that are scheduled dynamically, as the number of products
+    // per row can vary by orders of magnitude
+    constexpr J                 block_size = 64;
+    J                           nblocks    = (m + block_size - 1) / block_size;
+    std::vector<std::vector<J>> block_cols(nblocks);
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
-        std::vector<J> nnz(n, -1);
+        host_spgemm_hash_table<J> table;
+        std::vector<J>            list;
 
 #ifdef _OPENMP
-        int nthreads = omp_get_num_threads();
-        int tid      = omp_get_thread_num();
-#else
-        int nthreads = 1;
-        int tid      = 0;
+#pragma omp for schedule(dynamic, 1)
 #endif
-
-        J rows_per_thread = (m + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, m);
-
-        // Index base
-        csr_row_ptr_C[0] = idx_base_C;
-
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
+        for(J b = 0; b < nblocks; ++b)
         {
-            // Initialize csr row pointer with previous row offset
-            csr_row_ptr_C[i + 1] = 0;
-
-            if(alpha)
+            for(J i = b * block_size; i < std::min(m, (b + 1) * block_size); ++i)
             {
-                I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
+                I row_begin_A = mul_AB ? csr_row_ptr_A[i] - idx_base_A : 0;
+                I row_end_A   = mul_AB ? csr_row_ptr_A[i + 1] - idx_base_A : 0;
+                I row_begin_D = add_D ? csr_row_ptr_D[i] - idx_base_D : 0;
+                I row_end_D   = add_D ? csr_row_ptr_D[i + 1] - idx_base_D : 0;
 
-                // Loop over columns of A
+                // Every product of row i contributes one entry, duplicates are merged below
+                int64_t flops = row_end_D - row_begin_D;
                 for(I j = row_begin_A; j < row_end_A; ++j)
                 {
-                    // Current column of A
                     J col_A = csr_col_ind_A[j] - idx_base_A;
+                    flops += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
+                }
+
+                C.row_flops[i] = flops;
 
-                    I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+                bool use_list = (flops <= host_spgemm_list_flops);
+                if(use_list)
+                {
+                    list.clear();
+                }
+                else
+                {
+                    table.reset(std::min<int64_t>(flops, n));
+                }
 
-                    // Loop over columns of B in row col_A
-                    for(I irow = row_begin_B; irow < row_end_B; ++irow)
+                auto add = [&](J col) {
+                    if(use_list)
+                    {
+                        list.push_back(col);
+                    }
+                    else
                     {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[irow] - idx_base_B;
+                        table.insert(col);
+                    }
+                };
 
-                        // Check if a new nnz is generated
-                        if(nnz[col_B] != i)
-                        {
-                            nnz[col_B] = i;
-                            ++csr_row_ptr_C[i + 1];
-                        }
+                for(I j = row_begin_A; j < row_end_A; ++j)
+                {
+                    J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                    for(I l = csr_row_ptr_B[col_A] - idx_base_B;
+                        l < csr_row_ptr_B[col_A + 1] - idx_base_B;
+                        ++l)
+                    {
+                        add(csr_col_ind_B[l] - idx_base_B);
                     }
                 }
-            }
-
-            // Add nnz of D if beta != 0
-            if(beta)
-            {
-                I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
 
-                // Loop over columns of D
                 for(I j = row_begin_D; j < row_end_D; ++j)
                 {
-                    J col_D = csr_col_ind_D[j] - idx_base_D;
+                    add(csr_col_ind_D[j] - idx_base_D);
+                }
 
-                    // Check if a new nnz is generated
-                    if(nnz[col_D] != i)
+                if(!use_list)
+                {
+                    for(size_t slot : table.used)
                     {
-                        nnz[col_D] = i;
-                        ++csr_row_ptr_C[i + 1];
+                        list.push_back(table.keys[slot]);
                     }
+
+                    table.clear();
                 }
+
+                std::sort(list.begin(), list.end());
+                list.erase(std::unique(list.begin(), list.end()), list.end());
+
+                C.row_ptr[i + 1] = static_cast<I>(list.size());
+                block_cols[b].insert(block_cols[b].end(), list.begin(), list.end());
+                list.clear();
             }
         }
     }
 
     // Scan to obtain row offsets
+    C.row_ptr[0] = idx_base_C;
     for(J i = 0; i < m; ++i)
     {
-        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
+        C.row_ptr[i + 1] += C.row_ptr[i];
     }
 
-    return csr_row_ptr_C[m] - idx_base_C;
+    C.col_ind.resize(C.nnz());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(J b = 0; b < nblocks; ++b)
+    {
+        I offset = C.row_ptr[b * block_size] - idx_base_C;
+        for(size_t j = 0; j < block_cols[b].size(); ++j)
+        {
+            C.col_ind[offset + j] = block_cols[b][j] + idx_base_C;
+        }
+    }
 }
 
+/*! \brief  Computes the values of C = alpha * A * B + beta * D on the pattern of C. The product
+ *  is skipped if alpha is nullptr and D if beta is nullptr. Every entry of C sums its products
+ *  in the order of the entries of A and B, followed by D. */
 template <typename I, typename J, typename T>
-static void host_csrgemm2(J                    m,
-                          J                    n,
-                          J                    k,
-                          const T*             alpha,
-                          const I*             csr_row_ptr_A,
-                          const J*             csr_col_ind_A,
-                          const T*             csr_val_A,
-                          const I*             csr_row_ptr_B,
-                          const J*             csr_col_ind_B,
-                          const T*             csr_val_B,
-                          const T*             beta,
-                          const I*             csr_row_ptr_D,
-                          const J*             csr_col_ind_D,
-                          const T*             csr_val_D,
-                          const I*             csr_row_ptr_C,
-                          J*                   csr_col_ind_C,
-                          T*                   csr_val_C,
-                          hipsparseIndexBase_t idx_base_A,
-                          hipsparseIndexBase_t idx_base_B,
-                          hipsparseIndexBase_t idx_base_C,
-                          hipsparseIndexBase_t idx_base_D)
+inline void host_csrgemm2_numeric(const host_csrgemm2_pattern<I, J>& C,
+                                  const T*                           alpha,
+                                  const I*                           csr_row_ptr_A,
+                                  const J*                           csr_col_ind_A,
+                                  const T*                           csr_val_A,
+                                  const I*                           csr_row_ptr_B,
+                                  const J*                           csr_col_ind_B,
+                                  const T*                           csr_val_B,
+                                  const T*                           beta,
+                                  const I*                           csr_row_ptr_D,
+                                  const J*                           csr_col_ind_D,
+                                  const T*                           csr_val_D,
+                                  T*                                 csr_val_C,
+                                  hipsparseIndexBase_t               idx_base_A,
+                                  hipsparseIndexBase_t               idx_base_B,
+                                  hipsparseIndexBase_t               idx_base_D)
 {
+    J m = static_cast<J>(C.row_ptr.size()) - 1;
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
-        std::vector<I> nnz(n, -1);
+        host_spgemm_hash_table<J> table;
 
 #ifdef _OPENMP
-        int nthreads = omp_get_num_threads();
-        int tid      = omp_get_thread_num();
-#else
-        int nthreads = 1;
-        int tid      = 0;
+#pragma omp for schedule(dynamic, 16)
 #endif
+        for(J i = 0; i < m; ++i)
+        {
+            I        row_begin_C = C.row_ptr[i] - C.base;
+            I        row_end_C   = C.row_ptr[i + 1] - C.base;
+            const J* cols_C      = C.col_ind.data() + row_begin_C;
 
-        J rows_per_thread = (m + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, m);
+            bool use_list = (C.row_flops[i] <= host_spgemm_list_flops);
 
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
-        {
-            I row_begin_C = csr_row_ptr_C[i] - idx_base_C;
-            I row_end_C   = row_begin_C;
+            // Position of column col in row i of C
+            if(!use_list)
+            {
+                table.reset(row_end_C - row_begin_C);
+                for(I j = row_begin_C; j < row_end_C; ++j)
+                {
+                    table.values[table.insert(C.col_ind[j] - C.base)] = j;
+                }
+            }
 
-            if(alpha)
+            auto position = [&](J col) -> I {
+                return use_list ? row_begin_C
+                                      + (std::lower_bound(cols_C,
+                                                          cols_C + (row_end_C - row_begin_C),
+                                                          col + C.base)
+                                         - cols_C)
+                                : static_cast<I>(table.values[table.insert(col)]);
+            };
+
+            for(I j = row_begin_C; j < row_end_C; ++j)
             {
-                I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
+                csr_val_C[j] = make_DataType<T>(0.0);
+            }
 
-                // Loop over columns of A
-                for(I j = row_begin_A; j < row_end_A; ++j)
+            if(alpha)
+            {
+                for(I j = csr_row_ptr_A[i] - idx_base_A; j < csr_row_ptr_A[i + 1] - idx_base_A; ++j)
                 {
-                    // Current column of A
                     J col_A = csr_col_ind_A[j] - idx_base_A;
-                    // Current value of A
                     T val_A = testing_mult(*alpha, csr_val_A[j]);
 
-                    I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
-
-                    // Loop over columns of B in row col_A
-                    for(I l = row_begin_B; l < row_end_B; ++l)
+                    for(I l = csr_row_ptr_B[col_A] - idx_base_B;
+                        l < csr_row_ptr_B[col_A + 1] - idx_base_B;
+                        ++l)
                     {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[l] - idx_base_B;
-                        // Current value of B
-                        T val_B = csr_val_B[l];
-
-                        // Check if a new nnz is generated or if the product is appended
-                        if(nnz[col_B] < row_begin_C)
-                        {
-                            nnz[col_B]               = row_end_C;
-                            csr_col_ind_C[row_end_C] = col_B + idx_base_C;
-                            csr_val_C[row_end_C]     = testing_mult(val_A, val_B);
-                            ++row_end_C;
-                        }
-                        else
-                        {
-                            csr_val_C[nnz[col_B]]
-                                = csr_val_C[nnz[col_B]] + testing_mult(val_A, val_B);
-                        }
+                        I pos          = position(csr_col_ind_B[l] - idx_base_B);
+                        csr_val_C[pos] = csr_val_C[pos] + testing_mult(val_A, csr_val_B[l]);
                     }
                 }
             }
 
-            // Add nnz of D if beta != 0
             if(beta)
             {
-                I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
-
-                // Loop over columns of D
-                for(I j = row_begin_D; j < row_end_D; ++j)
+                for(I j = csr_row_ptr_D[i] - idx_base_D; j < csr_row_ptr_D[i + 1] - idx_base_D; ++j)
                 {
-                    // Current column of D
-                    J col_D = csr_col_ind_D[j] - idx_base_D;
-                    // Current value of D
-                    T val_D = testing_mult(*beta, csr_val_D[j]);
-
-                    // Check if a new nnz is generated or if the value is added
-                    if(nnz[col_D] < row_begin_C)
-                    {
-                        nnz[col_D] = row_end_C;
-
-                        csr_col_ind_C[row_end_C] = col_D + idx_base_C;
-                        csr_val_C[row_end_C]     = val_D;
-                        ++row_end_C;
-                    }
-                    else
-                    {
-                        csr_val_C[nnz[col_D]] = csr_val_C[nnz[col_D]] + val_D;
-                    }
+                    I pos          = position(csr_col_ind_D[j] - idx_base_D);
+                    csr_val_C[pos] = csr_val_C[pos] + testing_mult(*beta, csr_val_D[j]);
                 }
             }
-        }
-    }
-
-    I nnz_C = csr_row_ptr_C[m] - idx_base_C;
-
-    std::vector<J> col(nnz_C);
-    std::vector<T> val(nnz_C);
-
-    memcpy(col.data(), csr_col_ind_C, sizeof(J) * nnz_C);
-    memcpy(val.data(), csr_val_C, sizeof(T) * nnz_C);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < m; ++i)
-    {
-        I row_begin = csr_row_ptr_C[i] - idx_base_C;
-        I row_end   = csr_row_ptr_C[i + 1] - idx_base_C;
-        J row_nnz   = row_end - row_begin;
 
-        std::vector<J> perm(row_nnz);
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            perm[j] = j;
+            if(!use_list)
+            {
+                table.clear();
+            }
         }
+    }
+}
 
-        J* col_entry = &col[row_begin];
-        T* val_entry = &val[row_begin];
-
-        std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
-            return col_entry[a] <= col_entry[b];
-        });
+/* ============================================================================================ */
+/*! \brief  Compute sparse matrix sparse matrix multiplication. */
+template <typename I, typename J, typename T>
+static I host_csrgemm2_nnz(J                    m,
+                           J                    n,
+                           J                    k,
+                           const T*             alpha,
+                           const I*             csr_row_ptr_A,
+                           const J*             csr_col_ind_A,
+                           const I*             csr_row_ptr_B,
+                           const J*             csr_col_ind_B,
+                           const T*             beta,
+                           const I*             csr_row_ptr_D,
+                           const J*             csr_col_ind_D,
+                           I*                   csr_row_ptr_C,
+                           hipsparseIndexBase_t idx_base_A,
+                           hipsparseIndexBase_t idx_base_B,
+                           hipsparseIndexBase_t idx_base_C,
+                           hipsparseIndexBase_t idx_base_D)
+{
+    host_csrgemm2_pattern<I, J> C;
+    host_csrgemm2_symbolic(m,
+                           n,
+                           alpha != nullptr,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           beta != nullptr,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           idx_base_A,
+                           idx_base_B,
+                           idx_base_C,
+                           idx_base_D,
+                           C);
+
+    std::copy(C.row_ptr.begin(), C.row_ptr.end(), csr_row_ptr_C);
+
+    return C.nnz();
+}
 
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
-            csr_val_C[row_begin + j]     = val_entry[perm[j]];
-        }
-    }
+template <typename I, typename J, typename T>
+static void host_csrgemm2(J                    m,
+                          J                    n,
+                          J                    k,
+                          const T*             alpha,
+                          const I*             csr_row_ptr_A,
+                          const J*             csr_col_ind_A,
+                          const T*             csr_val_A,
+                          const I*             csr_row_ptr_B,
+                          const J*             csr_col_ind_B,
+                          const T*             csr_val_B,
+                          const T*             beta,
+                          const I*             csr_row_ptr_D,
+                          const J*             csr_col_ind_D,
+                          const T*             csr_val_D,
+                          const I*             csr_row_ptr_C,
+                          J*                   csr_col_ind_C,
+                          T*                   csr_val_C,
+                          hipsparseIndexBase_t idx_base_A,
+                          hipsparseIndexBase_t idx_base_B,
+                          hipsparseIndexBase_t idx_base_C,
+                          hipsparseIndexBase_t idx_base_D)
+{
+    host_csrgemm2_pattern<I, J> C;
+    host_csrgemm2_symbolic(m,
+                           n,
+                           alpha != nullptr,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           beta != nullptr,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           idx_base_A,
+                           idx_base_B,
+                           idx_base_C,
+                           idx_base_D,
+                           C);
+
+    std::copy(C.col_ind.begin(), C.col_ind.end(), csr_col_ind_C);
+
+    host_csrgemm2_numeric(C,
+                          alpha,
+                          csr_row_ptr_A,
+                          csr_col_ind_A,
+                          csr_val_A,
+                          csr_row_ptr_B,
+                          csr_col_ind_B,
+                          csr_val_B,
+                          beta,
+                          csr_row_ptr_D,
+                          csr_col_ind_D,
+                          csr_val_D,
+                          csr_val_C,
+                          idx_base_A,
+                          idx_base_B,
+                          idx_base_D);
 }
 
 #ifdef __cplusplus
@@ -6626,6 +8919,53 @@ double get_time_us_sync(hipStream_t stream);
 }
 #endif
 
+/* ============================================================================================ */
+/*  timing statistics of the performance run */
+struct hipsparse_timing_stats
+{
+    int    warmup{};
+    int    iters{};
+    double min_us{};
+    double median_us{};
+    double mean_us{};
+    double p90_us{};
+    double p99_us{};
+    double stddev_us{};
+    bool   unstable{};
+};
+
+/*! \brief  Statistics of per iteration samples in microseconds. A run is flagged unstable when
+ *          the samples spread by more than 10% of the mean, or when the 90th percentile is more
+ *          than 25% above the median. */
+hipsparse_timing_stats hipsparse_compute_timing_stats(std::vector<double> samples_us, int warmup);
+
+/*! \brief  Statistics of the last timed run, picked up by display_timing_info */
+hipsparse_timing_stats& hipsparse_last_timing_stats();
+
+/*! \brief  Per iteration GPU timer: records a pair of hipEvents around every iteration on the
+ *          stream of the handle, so that neither the host nor other streams are timed. */
+class hipsparse_event_timer
+{
+public:
+    hipsparse_event_timer(hipsparseHandle_t handle, int iters, int warmup);
+    ~hipsparse_event_timer();
+
+    hipsparse_event_timer(const hipsparse_event_timer&) = delete;
+    hipsparse_event_timer& operator=(const hipsparse_event_timer&) = delete;
+
+    void start(int iter);
+    void stop(int iter);
+
+    // Waits for the timed iterations and returns the median time per iteration in microseconds
+    double finish();
+
+private:
+    hipStream_t             m_stream{};
+    int                     m_warmup{};
+    std::vector<hipEvent_t> m_start{};
+    std::vector<hipEvent_t> m_stop{};
+};
+
 inline void missing_file_error_message(const char* filename)
 {
     std::cerr << "#" << std::endl;
@@ -6663,6 +9003,12 @@ inline const char* get_hipsparse_clients_matrices_dir()
 
 inline std::string get_filename(const std::string& bin_file)
 {
+    // Matrix generator specs are passed on as they are
+    if(is_matrix_generator_spec(bin_file))
+    {
+        return bin_file;
+    }
+
     const char* matrices_dir = get_hipsparse_clients_matrices_dir();
     if(matrices_dir == nullptr)
     {
@@ -6724,4 +9070,30 @@ hipDataType getDataType()
                       : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
 }
 
+template <>
+inline hipDataType getDataType<int8_t>()
+{
+    return HIP_R_8I;
+}
+
+template <>
+inline hipDataType getDataType<int32_t>()
+{
+    return HIP_R_32I;
+}
+
+template <>
+inline hipDataType getDataType<__half>()
+{
+    return HIP_R_16F;
+}
+
+#if(!defined(CUDART_VERSION))
+template <>
+inline hipDataType getDataType<hip_bfloat16>()
+{
+    return HIP_R_16BF;
+}
+#endif
+
 #endif // TESTING_UTILITY_HPP
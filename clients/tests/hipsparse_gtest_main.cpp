@@ -156,6 +156,11 @@ hipsparseStatus_t hipsparse_record_output(const std::string& s)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+hipsparseStatus_t hipsparse_record_output_field(const char* name, const std::string& value)
+{
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparse_record_timing(double msec, double gflops, double gbs)
 {
     return HIPSPARSE_STATUS_SUCCESS;
@@ -43,8 +43,15 @@ std::vector<double> bsr_beta_range  = {1.0};
 base bsr_idxbase_range[] = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
 dir  bsr_dir_range[]     = {HIPSPARSE_DIRECTION_ROW, HIPSPARSE_DIRECTION_COLUMN};
 
-std::string bsr_bin[]
-    = {"nos1.bin", "nos2.bin", "nos3.bin", "nos4.bin", "nos5.bin", "nos6.bin", "nos7.bin"};
+std::string bsr_bin[] = {"nos1.bin",
+                         "nos2.bin",
+                         "nos3.bin",
+                         "nos4.bin",
+                         "nos5.bin",
+                         "nos6.bin",
+                         "nos7.bin",
+                         "block:2000:4:8",
+                         "block:1000:3:5:seed=7"};
 
 class parameterized_bsrmv : public testing::TestWithParam<bsrmv_tuple>
 {
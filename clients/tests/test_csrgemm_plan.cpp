@@ -0,0 +1,112 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csrgemm_plan.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+
+typedef hipsparseIndexBase_t base;
+typedef hipsparseOperation_t trans;
+
+typedef std::tuple<int, int, base, base, base> csrgemm_plan_tuple;
+
+int csrgemm_plan_M_range[] = {0, 647, 1799};
+int csrgemm_plan_K_range[] = {0, 254, 1942};
+
+base csrgemm_plan_idxbaseA_range[] = {HIPSPARSE_INDEX_BASE_ZERO};
+base csrgemm_plan_idxbaseB_range[] = {HIPSPARSE_INDEX_BASE_ONE};
+base csrgemm_plan_idxbaseC_range[] = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csrgemm_plan : public testing::TestWithParam<csrgemm_plan_tuple>
+{
+protected:
+    parameterized_csrgemm_plan() {}
+    virtual ~parameterized_csrgemm_plan() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrgemm_plan_arguments(csrgemm_plan_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.K        = std::get<1>(tup);
+    arg.baseA    = std::get<2>(tup);
+    arg.baseB    = std::get<3>(tup);
+    arg.baseC    = std::get<4>(tup);
+    arg.transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.transB   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.timing   = 0;
+    arg.filename = "";
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION))
+TEST(csrgemm_plan_bad_arg, csrgemm_plan_float)
+{
+    testing_csrgemm_plan_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrgemm_plan, csrgemm_plan_float)
+{
+    Arguments arg = setup_csrgemm_plan_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrgemm_plan<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrgemm_plan, csrgemm_plan_double)
+{
+    Arguments arg = setup_csrgemm_plan_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrgemm_plan<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrgemm_plan, csrgemm_plan_float_complex)
+{
+    Arguments arg = setup_csrgemm_plan_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrgemm_plan<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrgemm_plan, csrgemm_plan_double_complex)
+{
+    Arguments arg = setup_csrgemm_plan_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrgemm_plan<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(csrgemm_plan,
+                         parameterized_csrgemm_plan,
+                         testing::Combine(testing::ValuesIn(csrgemm_plan_M_range),
+                                          testing::ValuesIn(csrgemm_plan_K_range),
+                                          testing::ValuesIn(csrgemm_plan_idxbaseA_range),
+                                          testing::ValuesIn(csrgemm_plan_idxbaseB_range),
+                                          testing::ValuesIn(csrgemm_plan_idxbaseC_range)));
+#endif
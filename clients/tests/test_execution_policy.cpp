@@ -0,0 +1,93 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_execution_policy.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <vector>
+
+typedef std::tuple<int, int, hipsparseExecutionPolicy_t, hipsparseIndexBase_t>
+    execution_policy_tuple;
+
+int execution_policy_N_range[]   = {12000, 22031};
+int execution_policy_nnz_range[] = {0, 5, 1000, 10000};
+
+hipsparseExecutionPolicy_t execution_policy_range[] = {HIPSPARSE_EXECUTION_POLICY_BLOCKING,
+                                                       HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE,
+                                                       HIPSPARSE_EXECUTION_POLICY_ASYNC};
+
+hipsparseIndexBase_t execution_policy_idx_base_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_execution_policy : public testing::TestWithParam<execution_policy_tuple>
+{
+protected:
+    parameterized_execution_policy() {}
+    virtual ~parameterized_execution_policy() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_execution_policy_arguments(execution_policy_tuple tup)
+{
+    Arguments arg;
+    arg.N                = std::get<0>(tup);
+    arg.nnz              = std::get<1>(tup);
+    arg.execution_policy = std::get<2>(tup);
+    arg.baseA            = std::get<3>(tup);
+    arg.timing           = 0;
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION))
+TEST(execution_policy_bad_arg, execution_policy)
+{
+    testing_execution_policy_bad_arg();
+}
+
+TEST_P(parameterized_execution_policy, execution_policy_float)
+{
+    Arguments arg = setup_execution_policy_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_execution_policy<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_execution_policy, execution_policy_double_complex)
+{
+    Arguments arg = setup_execution_policy_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_execution_policy<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(execution_policy,
+                         parameterized_execution_policy,
+                         testing::Combine(testing::ValuesIn(execution_policy_N_range),
+                                          testing::ValuesIn(execution_policy_nnz_range),
+                                          testing::ValuesIn(execution_policy_range),
+                                          testing::ValuesIn(execution_policy_idx_base_range)));
+#endif
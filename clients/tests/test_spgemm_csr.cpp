@@ -31,7 +31,8 @@ typedef std::tuple<int,
                    hipsparseIndexBase_t,
                    hipsparseIndexBase_t,
                    hipsparseIndexBase_t,
-                   hipsparseSpGEMMAlg_t>
+                   hipsparseSpGEMMAlg_t,
+                   hipsparseSpGEMMMode_t>
     spgemm_csr_tuple;
 typedef std::tuple<double,
                    hipsparseIndexBase_t,
@@ -61,6 +62,9 @@ hipsparseIndexBase_t spgemm_csr_idxbaseC_range[] = {HIPSPARSE_INDEX_BASE_ZERO};
 
 hipsparseSpGEMMAlg_t spgemm_csr_alg_range[] = {HIPSPARSE_SPGEMM_DEFAULT};
 
+hipsparseSpGEMMMode_t spgemm_csr_mode_range[]
+    = {HIPSPARSE_SPGEMM_MODE_DEFAULT, HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA};
+
 std::string spgemm_csr_bin[]
     = {"nos1.bin", "nos2.bin", "nos3.bin", "nos4.bin", "nos5.bin", "nos6.bin", "nos7.bin"};
 
@@ -85,14 +89,15 @@ protected:
 Arguments setup_spgemm_csr_arguments(spgemm_csr_tuple tup)
 {
     Arguments arg;
-    arg.M          = std::get<0>(tup);
-    arg.K          = std::get<1>(tup);
-    arg.alpha      = std::get<2>(tup);
-    arg.baseA      = std::get<3>(tup);
-    arg.baseB      = std::get<4>(tup);
-    arg.baseC      = std::get<5>(tup);
-    arg.spgemm_alg = std::get<6>(tup);
-    arg.timing     = 0;
+    arg.M           = std::get<0>(tup);
+    arg.K           = std::get<1>(tup);
+    arg.alpha       = std::get<2>(tup);
+    arg.baseA       = std::get<3>(tup);
+    arg.baseB       = std::get<4>(tup);
+    arg.baseC       = std::get<5>(tup);
+    arg.spgemm_alg  = std::get<6>(tup);
+    arg.spgemm_mode = std::get<7>(tup);
+    arg.timing      = 0;
     return arg;
 }
 
@@ -182,7 +187,8 @@ INSTANTIATE_TEST_SUITE_P(spgemm_csr,
                                           testing::ValuesIn(spgemm_csr_idxbaseA_range),
                                           testing::ValuesIn(spgemm_csr_idxbaseB_range),
                                           testing::ValuesIn(spgemm_csr_idxbaseC_range),
-                                          testing::ValuesIn(spgemm_csr_alg_range)));
+                                          testing::ValuesIn(spgemm_csr_alg_range),
+                                          testing::ValuesIn(spgemm_csr_mode_range)));
 
 INSTANTIATE_TEST_SUITE_P(spgemm_csr_bin,
                          parameterized_spgemm_csr_bin,
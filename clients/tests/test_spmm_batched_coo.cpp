@@ -96,6 +96,11 @@ Arguments setup_spmm_batched_coo_arguments(spmm_batched_coo_tuple tup)
     arg.orderC = std::get<8>(tup);
     arg.baseA  = std::get<9>(tup);
     arg.timing = 0;
+
+    // Algorithm and batch count of B and C
+    arg.spmm_alg    = HIPSPARSE_SPMM_COO_ALG1;
+    arg.batch_count = 10;
+
     return arg;
 }
 
@@ -114,6 +119,10 @@ Arguments setup_spmm_batched_coo_arguments(spmm_batched_coo_bin_tuple tup)
     arg.baseA  = std::get<7>(tup);
     arg.timing = 0;
 
+    // Algorithm and batch count of B and C
+    arg.spmm_alg    = HIPSPARSE_SPMM_COO_ALG1;
+    arg.batch_count = 10;
+
     // Determine absolute path of test matrix
     std::string bin_file = std::get<8>(tup);
 
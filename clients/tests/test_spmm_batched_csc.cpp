@@ -97,6 +97,11 @@ Arguments setup_spmm_batched_csc_arguments(spmm_batched_csc_tuple tup)
     arg.orderC = std::get<8>(tup);
     arg.baseA  = std::get<9>(tup);
     arg.timing = 0;
+
+    // Algorithm and batch count of B and C
+    arg.spmm_alg    = HIPSPARSE_SPMM_ALG_DEFAULT;
+    arg.batch_count = 3;
+
     return arg;
 }
 
@@ -115,6 +120,10 @@ Arguments setup_spmm_batched_csc_arguments(spmm_batched_csc_bin_tuple tup)
     arg.baseA  = std::get<7>(tup);
     arg.timing = 0;
 
+    // Algorithm and batch count of B and C
+    arg.spmm_alg    = HIPSPARSE_SPMM_ALG_DEFAULT;
+    arg.batch_count = 3;
+
     // Determine absolute path of test matrix
     std::string bin_file = std::get<8>(tup);
 
@@ -21,10 +21,114 @@
  *
  * ************************************************************************ */
 
+#include "hipsparse_arguments.hpp"
 #include "testing_spmm_bell.hpp"
 
 #include <hipsparse.h>
 
+struct alpha_beta
+{
+    double alpha;
+    double beta;
+};
+
+typedef std::tuple<int,
+                   int,
+                   int,
+                   int,
+                   alpha_beta,
+                   hipsparseOperation_t,
+                   hipsparseOrder_t,
+                   hipsparseOrder_t,
+                   hipsparseIndexBase_t>
+    spmm_bell_tuple;
+typedef std::tuple<int,
+                   int,
+                   alpha_beta,
+                   hipsparseOperation_t,
+                   hipsparseOrder_t,
+                   hipsparseOrder_t,
+                   hipsparseIndexBase_t,
+                   std::string>
+    spmm_bell_bin_tuple;
+
+int spmm_bell_M_range[]         = {50, 97};
+int spmm_bell_N_range[]         = {5};
+int spmm_bell_K_range[]         = {84};
+int spmm_bell_block_dim_range[] = {1, 2, 4};
+
+alpha_beta spmm_bell_alpha_beta_range[] = {{2.0, 1.0}};
+
+hipsparseOperation_t spmm_bell_transB_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseOrder_t     spmm_bell_orderB_range[] = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+hipsparseOrder_t     spmm_bell_orderC_range[] = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+hipsparseIndexBase_t spmm_bell_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+std::string spmm_bell_bin[] = {"nos2.bin", "nos4.bin", "block:1000:3:5:seed=7"};
+
+class parameterized_spmm_bell : public testing::TestWithParam<spmm_bell_tuple>
+{
+protected:
+    parameterized_spmm_bell() {}
+    virtual ~parameterized_spmm_bell() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmm_bell_bin : public testing::TestWithParam<spmm_bell_bin_tuple>
+{
+protected:
+    parameterized_spmm_bell_bin() {}
+    virtual ~parameterized_spmm_bell_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmm_bell_arguments(spmm_bell_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.K         = std::get<2>(tup);
+    arg.block_dim = std::get<3>(tup);
+    arg.alpha     = std::get<4>(tup).alpha;
+    arg.beta      = std::get<4>(tup).beta;
+    arg.transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.transB    = std::get<5>(tup);
+    arg.orderB    = std::get<6>(tup);
+    arg.orderC    = std::get<7>(tup);
+    arg.baseA     = std::get<8>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_spmm_bell_arguments(spmm_bell_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.N         = std::get<0>(tup);
+    arg.K         = -99;
+    arg.block_dim = std::get<1>(tup);
+    arg.alpha     = std::get<2>(tup).alpha;
+    arg.beta      = std::get<2>(tup).beta;
+    arg.transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.transB    = std::get<3>(tup);
+    arg.orderB    = std::get<4>(tup);
+    arg.orderC    = std::get<5>(tup);
+    arg.baseA     = std::get<6>(tup);
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<7>(tup);
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = get_filename(bin_file);
+
+    return arg;
+}
+
 #if(!defined(CUDART_VERSION))
 TEST(spmm_bell_bad_arg, spmm_bell_float)
 {
@@ -49,3 +153,63 @@ TEST(spmm_bell, spmm_bell_i64_hipComplex)
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+TEST_P(parameterized_spmm_bell, spmm_bell_i32_float)
+{
+    Arguments arg = setup_spmm_bell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_bell<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_bell, spmm_bell_i32_double_complex)
+{
+    Arguments arg = setup_spmm_bell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_bell<int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_bell_bin, spmm_bell_bin_i32_float)
+{
+    Arguments arg = setup_spmm_bell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_bell<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+// 64 bit indices not supported in cusparse for Blocked ELL
+#if(!defined(CUDART_VERSION))
+TEST_P(parameterized_spmm_bell, spmm_bell_i64_double)
+{
+    Arguments arg = setup_spmm_bell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_bell<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(spmm_bell,
+                         parameterized_spmm_bell,
+                         testing::Combine(testing::ValuesIn(spmm_bell_M_range),
+                                          testing::ValuesIn(spmm_bell_N_range),
+                                          testing::ValuesIn(spmm_bell_K_range),
+                                          testing::ValuesIn(spmm_bell_block_dim_range),
+                                          testing::ValuesIn(spmm_bell_alpha_beta_range),
+                                          testing::ValuesIn(spmm_bell_transB_range),
+                                          testing::ValuesIn(spmm_bell_orderB_range),
+                                          testing::ValuesIn(spmm_bell_orderC_range),
+                                          testing::ValuesIn(spmm_bell_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(spmm_bell_bin,
+                         parameterized_spmm_bell_bin,
+                         testing::Combine(testing::ValuesIn(spmm_bell_N_range),
+                                          testing::ValuesIn(spmm_bell_block_dim_range),
+                                          testing::ValuesIn(spmm_bell_alpha_beta_range),
+                                          testing::ValuesIn(spmm_bell_transB_range),
+                                          testing::ValuesIn(spmm_bell_orderB_range),
+                                          testing::ValuesIn(spmm_bell_orderC_range),
+                                          testing::ValuesIn(spmm_bell_idxbase_range),
+                                          testing::ValuesIn(spmm_bell_bin)));
+#endif
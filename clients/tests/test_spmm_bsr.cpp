@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_arguments.hpp"
+#include "testing_spmm_bsr.hpp"
+
+#include <hipsparse.h>
+
+struct alpha_beta
+{
+    double alpha;
+    double beta;
+};
+
+typedef std::tuple<int,
+                   int,
+                   int,
+                   int,
+                   int,
+                   hipsparseOrder_t,
+                   alpha_beta,
+                   hipsparseOperation_t,
+                   hipsparseOrder_t,
+                   hipsparseOrder_t,
+                   hipsparseIndexBase_t>
+    spmm_bsr_tuple;
+typedef std::tuple<int,
+                   int,
+                   int,
+                   hipsparseOrder_t,
+                   alpha_beta,
+                   hipsparseOperation_t,
+                   hipsparseOrder_t,
+                   hipsparseOrder_t,
+                   hipsparseIndexBase_t,
+                   std::string>
+    spmm_bsr_bin_tuple;
+
+int spmm_bsr_M_range[]             = {50, 97};
+int spmm_bsr_N_range[]             = {5};
+int spmm_bsr_K_range[]             = {84};
+int spmm_bsr_row_block_dim_range[] = {1, 3};
+int spmm_bsr_col_block_dim_range[] = {1, 2, 3};
+
+hipsparseOrder_t spmm_bsr_orderA_range[] = {HIPSPARSE_ORDER_ROW, HIPSPARSE_ORDER_COL};
+
+alpha_beta spmm_bsr_alpha_beta_range[] = {{2.0, 1.0}};
+
+hipsparseOperation_t spmm_bsr_transB_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+// The square blocks run on every backend, rectangular blocks check that rocSPARSE rejects them.
+// The BSR SpMM of rocSPARSE takes column major dense matrices.
+#if defined(HIPSPARSE_TEST_HOST_BACKEND)
+hipsparseOrder_t spmm_bsr_orderB_range[] = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+hipsparseOrder_t spmm_bsr_orderC_range[] = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+#else
+hipsparseOrder_t spmm_bsr_orderB_range[] = {HIPSPARSE_ORDER_COL};
+hipsparseOrder_t spmm_bsr_orderC_range[] = {HIPSPARSE_ORDER_COL};
+#endif
+hipsparseIndexBase_t spmm_bsr_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+std::string spmm_bsr_bin[] = {"nos2.bin", "nos4.bin", "block:1000:3:5:seed=7"};
+
+class parameterized_spmm_bsr : public testing::TestWithParam<spmm_bsr_tuple>
+{
+protected:
+    parameterized_spmm_bsr() {}
+    virtual ~parameterized_spmm_bsr() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmm_bsr_bin : public testing::TestWithParam<spmm_bsr_bin_tuple>
+{
+protected:
+    parameterized_spmm_bsr_bin() {}
+    virtual ~parameterized_spmm_bsr_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmm_bsr_arguments(spmm_bsr_tuple tup)
+{
+    Arguments arg;
+    arg.M              = std::get<0>(tup);
+    arg.N              = std::get<1>(tup);
+    arg.K              = std::get<2>(tup);
+    arg.row_block_dimA = std::get<3>(tup);
+    arg.col_block_dimA = std::get<4>(tup);
+    arg.orderA         = std::get<5>(tup);
+    arg.alpha          = std::get<6>(tup).alpha;
+    arg.beta           = std::get<6>(tup).beta;
+    arg.transA         = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.transB         = std::get<7>(tup);
+    arg.orderB         = std::get<8>(tup);
+    arg.orderC         = std::get<9>(tup);
+    arg.baseA          = std::get<10>(tup);
+    arg.timing         = 0;
+    return arg;
+}
+
+Arguments setup_spmm_bsr_arguments(spmm_bsr_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M              = -99;
+    arg.N              = std::get<0>(tup);
+    arg.K              = -99;
+    arg.row_block_dimA = std::get<1>(tup);
+    arg.col_block_dimA = std::get<2>(tup);
+    arg.orderA         = std::get<3>(tup);
+    arg.alpha          = std::get<4>(tup).alpha;
+    arg.beta           = std::get<4>(tup).beta;
+    arg.transA         = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.transB         = std::get<5>(tup);
+    arg.orderB         = std::get<6>(tup);
+    arg.orderC         = std::get<7>(tup);
+    arg.baseA          = std::get<8>(tup);
+    arg.timing         = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<9>(tup);
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = get_filename(bin_file);
+
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION))
+TEST(spmm_bsr_bad_arg, spmm_bsr_float)
+{
+    testing_spmm_bsr_bad_arg();
+}
+
+TEST_P(parameterized_spmm_bsr, spmm_bsr_float)
+{
+    Arguments arg = setup_spmm_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_bsr<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_bsr, spmm_bsr_double)
+{
+    Arguments arg = setup_spmm_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_bsr<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_bsr, spmm_bsr_double_complex)
+{
+    Arguments arg = setup_spmm_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_bsr<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_bsr_bin, spmm_bsr_bin_float)
+{
+    Arguments arg = setup_spmm_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_bsr<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(spmm_bsr,
+                         parameterized_spmm_bsr,
+                         testing::Combine(testing::ValuesIn(spmm_bsr_M_range),
+                                          testing::ValuesIn(spmm_bsr_N_range),
+                                          testing::ValuesIn(spmm_bsr_K_range),
+                                          testing::ValuesIn(spmm_bsr_row_block_dim_range),
+                                          testing::ValuesIn(spmm_bsr_col_block_dim_range),
+                                          testing::ValuesIn(spmm_bsr_orderA_range),
+                                          testing::ValuesIn(spmm_bsr_alpha_beta_range),
+                                          testing::ValuesIn(spmm_bsr_transB_range),
+                                          testing::ValuesIn(spmm_bsr_orderB_range),
+                                          testing::ValuesIn(spmm_bsr_orderC_range),
+                                          testing::ValuesIn(spmm_bsr_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(spmm_bsr_bin,
+                         parameterized_spmm_bsr_bin,
+                         testing::Combine(testing::ValuesIn(spmm_bsr_N_range),
+                                          testing::ValuesIn(spmm_bsr_row_block_dim_range),
+                                          testing::ValuesIn(spmm_bsr_col_block_dim_range),
+                                          testing::ValuesIn(spmm_bsr_orderA_range),
+                                          testing::ValuesIn(spmm_bsr_alpha_beta_range),
+                                          testing::ValuesIn(spmm_bsr_transB_range),
+                                          testing::ValuesIn(spmm_bsr_orderB_range),
+                                          testing::ValuesIn(spmm_bsr_orderC_range),
+                                          testing::ValuesIn(spmm_bsr_idxbase_range),
+                                          testing::ValuesIn(spmm_bsr_bin)));
+#endif
@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_arguments.hpp"
+#include "testing_spmm_sell.hpp"
+
+#include <hipsparse.h>
+
+struct alpha_beta
+{
+    double alpha;
+    double beta;
+};
+
+typedef std::tuple<int,
+                   int,
+                   int,
+                   int,
+                   int,
+                   alpha_beta,
+                   hipsparseOperation_t,
+                   hipsparseOrder_t,
+                   hipsparseOrder_t,
+                   hipsparseIndexBase_t>
+    spmm_sell_tuple;
+typedef std::tuple<int,
+                   int,
+                   int,
+                   alpha_beta,
+                   hipsparseOperation_t,
+                   hipsparseOrder_t,
+                   hipsparseOrder_t,
+                   hipsparseIndexBase_t,
+                   std::string>
+    spmm_sell_bin_tuple;
+
+int spmm_sell_M_range[]          = {50, 97};
+int spmm_sell_N_range[]          = {5};
+int spmm_sell_K_range[]          = {84};
+int spmm_sell_slice_size_range[] = {1, 4, 32};
+int spmm_sell_sigma_range[]      = {1, 16};
+
+alpha_beta spmm_sell_alpha_beta_range[] = {{2.0, 1.0}};
+
+hipsparseOperation_t spmm_sell_transB_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseOrder_t     spmm_sell_orderB_range[] = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+hipsparseOrder_t     spmm_sell_orderC_range[] = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+hipsparseIndexBase_t spmm_sell_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+std::string spmm_sell_bin[] = {"nos2.bin", "nos4.bin"};
+
+class parameterized_spmm_sell : public testing::TestWithParam<spmm_sell_tuple>
+{
+protected:
+    parameterized_spmm_sell() {}
+    virtual ~parameterized_spmm_sell() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmm_sell_bin : public testing::TestWithParam<spmm_sell_bin_tuple>
+{
+protected:
+    parameterized_spmm_sell_bin() {}
+    virtual ~parameterized_spmm_sell_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmm_sell_arguments(spmm_sell_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.K         = std::get<2>(tup);
+    arg.block_dim = std::get<3>(tup);
+    arg.sigma     = std::get<4>(tup);
+    arg.alpha     = std::get<5>(tup).alpha;
+    arg.beta      = std::get<5>(tup).beta;
+    arg.transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.transB    = std::get<6>(tup);
+    arg.orderB    = std::get<7>(tup);
+    arg.orderC    = std::get<8>(tup);
+    arg.baseA     = std::get<9>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_spmm_sell_arguments(spmm_sell_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.N         = std::get<0>(tup);
+    arg.K         = -99;
+    arg.block_dim = std::get<1>(tup);
+    arg.sigma     = std::get<2>(tup);
+    arg.alpha     = std::get<3>(tup).alpha;
+    arg.beta      = std::get<3>(tup).beta;
+    arg.transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.transB    = std::get<4>(tup);
+    arg.orderB    = std::get<5>(tup);
+    arg.orderC    = std::get<6>(tup);
+    arg.baseA     = std::get<7>(tup);
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<8>(tup);
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = get_filename(bin_file);
+
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION))
+TEST_P(parameterized_spmm_sell, spmm_sell_i32_float)
+{
+    Arguments arg = setup_spmm_sell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_sell<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_sell, spmm_sell_i64_double)
+{
+    Arguments arg = setup_spmm_sell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_sell<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_sell, spmm_sell_i32_double_complex)
+{
+    Arguments arg = setup_spmm_sell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_sell<int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_sell_bin, spmm_sell_bin_i32_float)
+{
+    Arguments arg = setup_spmm_sell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_sell<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(spmm_sell,
+                         parameterized_spmm_sell,
+                         testing::Combine(testing::ValuesIn(spmm_sell_M_range),
+                                          testing::ValuesIn(spmm_sell_N_range),
+                                          testing::ValuesIn(spmm_sell_K_range),
+                                          testing::ValuesIn(spmm_sell_slice_size_range),
+                                          testing::ValuesIn(spmm_sell_sigma_range),
+                                          testing::ValuesIn(spmm_sell_alpha_beta_range),
+                                          testing::ValuesIn(spmm_sell_transB_range),
+                                          testing::ValuesIn(spmm_sell_orderB_range),
+                                          testing::ValuesIn(spmm_sell_orderC_range),
+                                          testing::ValuesIn(spmm_sell_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(spmm_sell_bin,
+                         parameterized_spmm_sell_bin,
+                         testing::Combine(testing::ValuesIn(spmm_sell_N_range),
+                                          testing::ValuesIn(spmm_sell_slice_size_range),
+                                          testing::ValuesIn(spmm_sell_sigma_range),
+                                          testing::ValuesIn(spmm_sell_alpha_beta_range),
+                                          testing::ValuesIn(spmm_sell_transB_range),
+                                          testing::ValuesIn(spmm_sell_orderB_range),
+                                          testing::ValuesIn(spmm_sell_orderC_range),
+                                          testing::ValuesIn(spmm_sell_idxbase_range),
+                                          testing::ValuesIn(spmm_sell_bin)));
+#endif
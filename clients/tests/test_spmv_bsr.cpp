@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_arguments.hpp"
+#include "testing_spmv_bsr.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int,
+                   int,
+                   int,
+                   int,
+                   hipsparseOrder_t,
+                   double,
+                   double,
+                   hipsparseOperation_t,
+                   hipsparseIndexBase_t>
+    spmv_bsr_tuple;
+typedef std::tuple<int,
+                   int,
+                   hipsparseOrder_t,
+                   double,
+                   double,
+                   hipsparseOperation_t,
+                   hipsparseIndexBase_t,
+                   std::string>
+    spmv_bsr_bin_tuple;
+
+int spmv_bsr_M_range[]             = {50, 97};
+int spmv_bsr_N_range[]             = {84};
+int spmv_bsr_row_block_dim_range[] = {1, 2, 3};
+int spmv_bsr_col_block_dim_range[] = {1, 2, 3};
+
+hipsparseOrder_t spmv_bsr_order_range[] = {HIPSPARSE_ORDER_ROW, HIPSPARSE_ORDER_COL};
+
+std::vector<double> spmv_bsr_alpha_range = {2.0};
+std::vector<double> spmv_bsr_beta_range  = {1.0};
+
+// The square blocks run on every backend, rectangular blocks check that rocSPARSE rejects them.
+// The BSR SpMV of rocSPARSE is not transposed.
+#if defined(HIPSPARSE_TEST_HOST_BACKEND)
+hipsparseOperation_t spmv_bsr_transA_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+#else
+hipsparseOperation_t spmv_bsr_transA_range[] = {HIPSPARSE_OPERATION_NON_TRANSPOSE};
+#endif
+hipsparseIndexBase_t spmv_bsr_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+std::string spmv_bsr_bin[] = {"nos1.bin", "nos3.bin", "nos6.bin", "block:1000:3:5:seed=7"};
+
+class parameterized_spmv_bsr : public testing::TestWithParam<spmv_bsr_tuple>
+{
+protected:
+    parameterized_spmv_bsr() {}
+    virtual ~parameterized_spmv_bsr() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmv_bsr_bin : public testing::TestWithParam<spmv_bsr_bin_tuple>
+{
+protected:
+    parameterized_spmv_bsr_bin() {}
+    virtual ~parameterized_spmv_bsr_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmv_bsr_arguments(spmv_bsr_tuple tup)
+{
+    Arguments arg;
+    arg.M              = std::get<0>(tup);
+    arg.N              = std::get<1>(tup);
+    arg.row_block_dimA = std::get<2>(tup);
+    arg.col_block_dimA = std::get<3>(tup);
+    arg.orderA         = std::get<4>(tup);
+    arg.alpha          = std::get<5>(tup);
+    arg.beta           = std::get<6>(tup);
+    arg.transA         = std::get<7>(tup);
+    arg.baseA          = std::get<8>(tup);
+    arg.spmv_alg       = HIPSPARSE_SPMV_ALG_DEFAULT;
+    arg.timing         = 0;
+    return arg;
+}
+
+Arguments setup_spmv_bsr_arguments(spmv_bsr_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M              = -99;
+    arg.N              = -99;
+    arg.row_block_dimA = std::get<0>(tup);
+    arg.col_block_dimA = std::get<1>(tup);
+    arg.orderA         = std::get<2>(tup);
+    arg.alpha          = std::get<3>(tup);
+    arg.beta           = std::get<4>(tup);
+    arg.transA         = std::get<5>(tup);
+    arg.baseA          = std::get<6>(tup);
+    arg.spmv_alg       = HIPSPARSE_SPMV_ALG_DEFAULT;
+    arg.timing         = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<7>(tup);
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = get_filename(bin_file);
+
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION))
+TEST(spmv_bsr_bad_arg, spmv_bsr_float)
+{
+    testing_spmv_bsr_bad_arg();
+}
+
+TEST_P(parameterized_spmv_bsr, spmv_bsr_float)
+{
+    Arguments arg = setup_spmv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_bsr<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_bsr, spmv_bsr_double)
+{
+    Arguments arg = setup_spmv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_bsr<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_bsr, spmv_bsr_float_complex)
+{
+    Arguments arg = setup_spmv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_bsr<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_bsr, spmv_bsr_double_complex)
+{
+    Arguments arg = setup_spmv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_bsr<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_bsr_bin, spmv_bsr_bin_float)
+{
+    Arguments arg = setup_spmv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_bsr<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_bsr_bin, spmv_bsr_bin_double)
+{
+    Arguments arg = setup_spmv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_bsr<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(spmv_bsr,
+                         parameterized_spmv_bsr,
+                         testing::Combine(testing::ValuesIn(spmv_bsr_M_range),
+                                          testing::ValuesIn(spmv_bsr_N_range),
+                                          testing::ValuesIn(spmv_bsr_row_block_dim_range),
+                                          testing::ValuesIn(spmv_bsr_col_block_dim_range),
+                                          testing::ValuesIn(spmv_bsr_order_range),
+                                          testing::ValuesIn(spmv_bsr_alpha_range),
+                                          testing::ValuesIn(spmv_bsr_beta_range),
+                                          testing::ValuesIn(spmv_bsr_transA_range),
+                                          testing::ValuesIn(spmv_bsr_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(spmv_bsr_bin,
+                         parameterized_spmv_bsr_bin,
+                         testing::Combine(testing::ValuesIn(spmv_bsr_row_block_dim_range),
+                                          testing::ValuesIn(spmv_bsr_col_block_dim_range),
+                                          testing::ValuesIn(spmv_bsr_order_range),
+                                          testing::ValuesIn(spmv_bsr_alpha_range),
+                                          testing::ValuesIn(spmv_bsr_beta_range),
+                                          testing::ValuesIn(spmv_bsr_transA_range),
+                                          testing::ValuesIn(spmv_bsr_idxbase_range),
+                                          testing::ValuesIn(spmv_bsr_bin)));
+#endif
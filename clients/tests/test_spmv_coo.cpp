@@ -47,8 +47,10 @@ hipsparseOperation_t spmv_coo_transA_range[] = {HIPSPARSE_OPERATION_NON_TRANSPOS
 hipsparseIndexBase_t spmv_coo_idxbase_range[]
     = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
 #if(!defined(CUDART_VERSION))
-hipsparseSpMVAlg_t spmv_coo_alg_range[]
-    = {HIPSPARSE_SPMV_ALG_DEFAULT, HIPSPARSE_SPMV_COO_ALG1, HIPSPARSE_SPMV_COO_ALG2};
+hipsparseSpMVAlg_t spmv_coo_alg_range[] = {HIPSPARSE_SPMV_ALG_DEFAULT,
+                                           HIPSPARSE_SPMV_COO_ALG1,
+                                           HIPSPARSE_SPMV_COO_ALG2,
+                                           HIPSPARSE_SPMV_ALG_AUTO};
 #else
 #if(CUDART_VERSION >= 12000)
 hipsparseSpMVAlg_t spmv_coo_alg_range[]
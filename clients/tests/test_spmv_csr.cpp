@@ -47,8 +47,10 @@ hipsparseOperation_t spmv_csr_transA_range[] = {HIPSPARSE_OPERATION_NON_TRANSPOS
 hipsparseIndexBase_t spmv_csr_idxbase_range[]
     = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
 #if(!defined(CUDART_VERSION))
-hipsparseSpMVAlg_t spmv_csr_alg_range[]
-    = {HIPSPARSE_SPMV_ALG_DEFAULT, HIPSPARSE_SPMV_CSR_ALG1, HIPSPARSE_SPMV_CSR_ALG2};
+hipsparseSpMVAlg_t spmv_csr_alg_range[] = {HIPSPARSE_SPMV_ALG_DEFAULT,
+                                           HIPSPARSE_SPMV_CSR_ALG1,
+                                           HIPSPARSE_SPMV_CSR_ALG2,
+                                           HIPSPARSE_SPMV_ALG_AUTO};
 #else
 #if(CUDART_VERSION >= 12000)
 hipsparseSpMVAlg_t spmv_csr_alg_range[]
@@ -70,7 +72,10 @@ std::string spmv_csr_bin[] = {"nos1.bin",
                               "nos6.bin",
                               "nos7.bin",
                               "Chebyshev4.bin",
-                              "shipsec1.bin"};
+                              "shipsec1.bin",
+                              "laplace3d:24:27",
+                              "banded:5000:16",
+                              "rmat:14:16"};
 
 class parameterized_spmv_csr : public testing::TestWithParam<spmv_csr_tuple>
 {
@@ -131,6 +136,14 @@ TEST(spmv_csr_bad_arg, spmv_csr_float)
     testing_spmv_csr_bad_arg();
 }
 
+#if(!defined(CUDART_VERSION)) && !defined(HIPSPARSE_TEST_HOST_BACKEND)
+TEST(spmv_csr_tuning_cache, spmv_csr_float)
+{
+    hipsparseStatus_t status = testing_spmv_csr_tuning_cache();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
+
 TEST_P(parameterized_spmv_csr, spmv_csr_i32_float)
 {
     Arguments arg = setup_spmv_csr_arguments(GetParam());
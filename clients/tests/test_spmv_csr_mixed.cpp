@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_arguments.hpp"
+#include "testing_spmv_csr_mixed.hpp"
+
+#include <hipsparse.h>
+
+typedef std::
+    tuple<int, int, double, double, hipsparseOperation_t, hipsparseIndexBase_t, hipsparseSpMVAlg_t>
+        spmv_csr_mixed_tuple;
+
+int spmv_csr_mixed_M_range[] = {50, 647};
+int spmv_csr_mixed_N_range[] = {84, 1799};
+
+std::vector<double> spmv_csr_mixed_alpha_range = {2.0};
+std::vector<double> spmv_csr_mixed_beta_range  = {0.0, 1.0};
+
+hipsparseOperation_t spmv_csr_mixed_transA_range[] = {HIPSPARSE_OPERATION_NON_TRANSPOSE};
+hipsparseIndexBase_t spmv_csr_mixed_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+hipsparseSpMVAlg_t spmv_csr_mixed_alg_range[]
+    = {HIPSPARSE_SPMV_ALG_DEFAULT, HIPSPARSE_SPMV_CSR_ALG1, HIPSPARSE_SPMV_CSR_ALG2};
+
+class parameterized_spmv_csr_mixed : public testing::TestWithParam<spmv_csr_mixed_tuple>
+{
+protected:
+    parameterized_spmv_csr_mixed() {}
+    virtual ~parameterized_spmv_csr_mixed() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmv_csr_mixed_arguments(spmv_csr_mixed_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.alpha    = std::get<2>(tup);
+    arg.beta     = std::get<3>(tup);
+    arg.transA   = std::get<4>(tup);
+    arg.baseA    = std::get<5>(tup);
+    arg.spmv_alg = std::get<6>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION))
+TEST_P(parameterized_spmv_csr_mixed, spmv_csr_mixed_i32_i8_i32_i32)
+{
+    Arguments arg = setup_spmv_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_mixed<int32_t, int8_t, int32_t, int32_t>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr_mixed, spmv_csr_mixed_i32_i8_f32_f32)
+{
+    Arguments arg = setup_spmv_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_mixed<int32_t, int8_t, float, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+#if defined(HIPSPARSE_TEST_HALF_TYPES)
+TEST_P(parameterized_spmv_csr_mixed, spmv_csr_mixed_i32_f16_f16_f32)
+{
+    Arguments arg = setup_spmv_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_mixed<int32_t, __half, __half, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr_mixed, spmv_csr_mixed_i32_f16_f32_f32)
+{
+    Arguments arg = setup_spmv_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_mixed<int32_t, __half, float, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr_mixed, spmv_csr_mixed_i32_bf16_bf16_f32)
+{
+    Arguments arg = setup_spmv_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status
+        = testing_spmv_csr_mixed<int32_t, hip_bfloat16, hip_bfloat16, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr_mixed, spmv_csr_mixed_i32_bf16_f32_f32)
+{
+    Arguments arg = setup_spmv_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_mixed<int32_t, hip_bfloat16, float, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(spmv_csr_mixed,
+                         parameterized_spmv_csr_mixed,
+                         testing::Combine(testing::ValuesIn(spmv_csr_mixed_M_range),
+                                          testing::ValuesIn(spmv_csr_mixed_N_range),
+                                          testing::ValuesIn(spmv_csr_mixed_alpha_range),
+                                          testing::ValuesIn(spmv_csr_mixed_beta_range),
+                                          testing::ValuesIn(spmv_csr_mixed_transA_range),
+                                          testing::ValuesIn(spmv_csr_mixed_idxbase_range),
+                                          testing::ValuesIn(spmv_csr_mixed_alg_range)));
+#endif
@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_arguments.hpp"
+#include "testing_spsv_bsr.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int,
+                   int,
+                   hipsparseOrder_t,
+                   double,
+                   hipsparseOperation_t,
+                   hipsparseIndexBase_t,
+                   hipsparseDiagType_t,
+                   hipsparseFillMode_t>
+    spsv_bsr_tuple;
+typedef std::tuple<int,
+                   hipsparseOrder_t,
+                   double,
+                   hipsparseOperation_t,
+                   hipsparseIndexBase_t,
+                   hipsparseDiagType_t,
+                   hipsparseFillMode_t,
+                   std::string>
+    spsv_bsr_bin_tuple;
+
+int spsv_bsr_M_range[]         = {50};
+int spsv_bsr_block_dim_range[] = {1, 2, 5};
+
+hipsparseOrder_t spsv_bsr_order_range[] = {HIPSPARSE_ORDER_ROW, HIPSPARSE_ORDER_COL};
+
+std::vector<double> spsv_bsr_alpha_range = {2.0};
+
+hipsparseOperation_t spsv_bsr_transA_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseIndexBase_t spsv_bsr_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+hipsparseDiagType_t spsv_bsr_diag_type_range[]
+    = {HIPSPARSE_DIAG_TYPE_NON_UNIT, HIPSPARSE_DIAG_TYPE_UNIT};
+hipsparseFillMode_t spsv_bsr_fill_mode_range[]
+    = {HIPSPARSE_FILL_MODE_LOWER, HIPSPARSE_FILL_MODE_UPPER};
+
+std::string spsv_bsr_bin[] = {"nos1.bin", "nos3.bin", "nos6.bin"};
+
+class parameterized_spsv_bsr : public testing::TestWithParam<spsv_bsr_tuple>
+{
+protected:
+    parameterized_spsv_bsr() {}
+    virtual ~parameterized_spsv_bsr() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spsv_bsr_bin : public testing::TestWithParam<spsv_bsr_bin_tuple>
+{
+protected:
+    parameterized_spsv_bsr_bin() {}
+    virtual ~parameterized_spsv_bsr_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spsv_bsr_arguments(spsv_bsr_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<0>(tup);
+    arg.block_dim = std::get<1>(tup);
+    arg.orderA    = std::get<2>(tup);
+    arg.alpha     = std::get<3>(tup);
+    arg.transA    = std::get<4>(tup);
+    arg.baseA     = std::get<5>(tup);
+    arg.diag_type = std::get<6>(tup);
+    arg.fill_mode = std::get<7>(tup);
+    arg.spsv_alg  = HIPSPARSE_SPSV_ALG_DEFAULT;
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_spsv_bsr_arguments(spsv_bsr_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.N         = -99;
+    arg.block_dim = std::get<0>(tup);
+    arg.orderA    = std::get<1>(tup);
+    arg.alpha     = std::get<2>(tup);
+    arg.transA    = std::get<3>(tup);
+    arg.baseA     = std::get<4>(tup);
+    arg.diag_type = std::get<5>(tup);
+    arg.fill_mode = std::get<6>(tup);
+    arg.spsv_alg  = HIPSPARSE_SPSV_ALG_DEFAULT;
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<7>(tup);
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = get_filename(bin_file);
+
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION))
+TEST_P(parameterized_spsv_bsr, spsv_bsr_float)
+{
+    Arguments arg = setup_spsv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spsv_bsr<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spsv_bsr, spsv_bsr_double)
+{
+    Arguments arg = setup_spsv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spsv_bsr<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spsv_bsr, spsv_bsr_float_complex)
+{
+    Arguments arg = setup_spsv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spsv_bsr<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spsv_bsr, spsv_bsr_double_complex)
+{
+    Arguments arg = setup_spsv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spsv_bsr<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spsv_bsr_bin, spsv_bsr_bin_double)
+{
+    Arguments arg = setup_spsv_bsr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spsv_bsr<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(spsv_bsr,
+                         parameterized_spsv_bsr,
+                         testing::Combine(testing::ValuesIn(spsv_bsr_M_range),
+                                          testing::ValuesIn(spsv_bsr_block_dim_range),
+                                          testing::ValuesIn(spsv_bsr_order_range),
+                                          testing::ValuesIn(spsv_bsr_alpha_range),
+                                          testing::ValuesIn(spsv_bsr_transA_range),
+                                          testing::ValuesIn(spsv_bsr_idxbase_range),
+                                          testing::ValuesIn(spsv_bsr_diag_type_range),
+                                          testing::ValuesIn(spsv_bsr_fill_mode_range)));
+
+INSTANTIATE_TEST_SUITE_P(spsv_bsr_bin,
+                         parameterized_spsv_bsr_bin,
+                         testing::Combine(testing::ValuesIn(spsv_bsr_block_dim_range),
+                                          testing::ValuesIn(spsv_bsr_order_range),
+                                          testing::ValuesIn(spsv_bsr_alpha_range),
+                                          testing::ValuesIn(spsv_bsr_transA_range),
+                                          testing::ValuesIn(spsv_bsr_idxbase_range),
+                                          testing::ValuesIn(spsv_bsr_diag_type_range),
+                                          testing::ValuesIn(spsv_bsr_fill_mode_range),
+                                          testing::ValuesIn(spsv_bsr_bin)));
+#endif
@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_workspace_pool.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <vector>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t> workspace_pool_tuple;
+
+int workspace_pool_M_range[] = {0, 872, 21453};
+int workspace_pool_N_range[] = {0, 623, 29285};
+
+hipsparseIndexBase_t workspace_pool_idx_base_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_workspace_pool : public testing::TestWithParam<workspace_pool_tuple>
+{
+protected:
+    parameterized_workspace_pool() {}
+    virtual ~parameterized_workspace_pool() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_workspace_pool_arguments(workspace_pool_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.baseA    = std::get<2>(tup);
+    arg.timing   = 0;
+    arg.filename = "";
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION))
+TEST(workspace_pool_bad_arg, workspace_pool)
+{
+    testing_workspace_pool_bad_arg();
+}
+
+TEST_P(parameterized_workspace_pool, workspace_pool_float)
+{
+    Arguments arg = setup_workspace_pool_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_workspace_pool<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_workspace_pool, workspace_pool_double_complex)
+{
+    Arguments arg = setup_workspace_pool_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_workspace_pool<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(workspace_pool,
+                         parameterized_workspace_pool,
+                         testing::Combine(testing::ValuesIn(workspace_pool_M_range),
+                                          testing::ValuesIn(workspace_pool_N_range),
+                                          testing::ValuesIn(workspace_pool_idx_base_range)));
+#endif
@@ -33,8 +33,15 @@ else( )
     file(TO_CMAKE_PATH "$ENV{HIP_PATH}" HIP_PATH)
 endif( )
 
-# Either rocSPARSE or cuSPARSE is required
-if(NOT USE_CUDA)
+# Either rocSPARSE or cuSPARSE is required, the host backend only needs the HIP-CPU runtime
+if(USE_HOST)
+  find_package(hip_cpu_rt REQUIRED)
+  find_package(OpenMP REQUIRED)
+  if(NOT TARGET hip::host)
+    add_library(hip::host INTERFACE IMPORTED)
+    target_link_libraries(hip::host INTERFACE hip_cpu_rt::hip_cpu_rt)
+  endif()
+elseif(NOT USE_CUDA)
   if(WIN32)
         find_package(hip REQUIRED CONFIG PATHS ${HIP_PATH} ${ROCM_PATH})
         if( CUSTOM_ROCSPARSE )
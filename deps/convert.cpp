@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include <algorithm>
+#include <cstdint>
 #include <math.h>
 #include <sstream>
 #include <stdio.h>
@@ -211,7 +212,62 @@ int read_mtx_matrix(const char*          filename,
     return 0;
 }
 
-int write_bin_matrix(
+// Versioned binary CSR container, must match bin_matrix_header in clients/include/utility.hpp
+struct bin_matrix_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    int64_t  nrow;
+    int64_t  ncol;
+    int64_t  nnz;
+    uint32_t ptr_type;
+    uint32_t col_type;
+    uint32_t val_type;
+    uint32_t idx_base;
+    uint32_t flags;
+    uint32_t alignment;
+    uint64_t ptr_offset;
+    uint64_t col_offset;
+    uint64_t val_offset;
+    int64_t  min_row_nnz;
+    int64_t  max_row_nnz;
+    int64_t  empty_rows;
+    double   mean_row_nnz;
+    double   stddev_row_nnz;
+};
+
+static_assert(sizeof(bin_matrix_header) == 128, "binary matrix header must be 128 bytes");
+
+static const uint64_t bin_matrix_alignment = 64;
+
+// Index and value type codes of the header
+static const uint32_t bin_index_i32 = 0;
+static const uint32_t bin_index_i64 = 1;
+static const uint32_t bin_value_f32 = 0;
+static const uint32_t bin_value_f64 = 1;
+
+static const uint32_t bin_flag_row_stats = 1;
+
+static uint64_t align_offset(uint64_t offset)
+{
+    return (offset + bin_matrix_alignment - 1) / bin_matrix_alignment * bin_matrix_alignment;
+}
+
+static bool write_padded(FILE* f, const void* data, size_t size, uint64_t& offset, uint64_t target)
+{
+    static const char zeros[bin_matrix_alignment] = {};
+
+    if(fwrite(zeros, 1, target - offset, f) != target - offset)
+    {
+        return false;
+    }
+
+    offset = target + size;
+    return size == 0 || fwrite(data, 1, size, f) == size;
+}
+
+int write_bin_matrix_legacy(
     const char* filename, int m, int n, int nnz, const int* ptr, const int* col, const double* val)
 {
     FILE* f = fopen(filename, "wb");
@@ -233,6 +289,81 @@ int write_bin_matrix(
     return 0;
 }
 
+int write_bin_matrix(const char*   filename,
+                     int           m,
+                     int           n,
+                     int           nnz,
+                     const int*    ptr,
+                     const int*    col,
+                     const double* val,
+                     bool          single)
+{
+    bin_matrix_header h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "HIPSPBIN", 8);
+
+    h.version     = 1;
+    h.header_size = sizeof(h);
+    h.nrow        = m;
+    h.ncol        = n;
+    h.nnz         = nnz;
+    h.ptr_type    = bin_index_i32;
+    h.col_type    = bin_index_i32;
+    h.val_type    = single ? bin_value_f32 : bin_value_f64;
+    h.idx_base    = 0;
+    h.alignment   = bin_matrix_alignment;
+
+    size_t val_size = single ? sizeof(float) : sizeof(double);
+
+    h.ptr_offset = align_offset(sizeof(h));
+    h.col_offset = align_offset(h.ptr_offset + sizeof(int) * (m + 1));
+    h.val_offset = align_offset(h.col_offset + sizeof(int) * nnz);
+
+    // Row statistics
+    h.flags       = bin_flag_row_stats;
+    h.min_row_nnz = (m > 0) ? nnz : 0;
+
+    double sum2 = 0.0;
+    for(int i = 0; i < m; ++i)
+    {
+        int64_t row_nnz = ptr[i + 1] - ptr[i];
+
+        h.min_row_nnz = std::min(h.min_row_nnz, row_nnz);
+        h.max_row_nnz = std::max(h.max_row_nnz, row_nnz);
+        h.empty_rows += (row_nnz == 0) ? 1 : 0;
+        sum2 += static_cast<double>(row_nnz) * row_nnz;
+    }
+
+    h.mean_row_nnz   = (m > 0) ? static_cast<double>(nnz) / m : 0.0;
+    h.stddev_row_nnz
+        = (m > 0) ? sqrt(std::max(0.0, sum2 / m - h.mean_row_nnz * h.mean_row_nnz)) : 0.0;
+
+    std::vector<float> valf;
+    if(single)
+    {
+        valf.assign(val, val + nnz);
+    }
+
+    FILE* f = fopen(filename, "wb");
+    if(!f)
+    {
+        return -1;
+    }
+
+    uint64_t offset = 0;
+
+    bool ok = write_padded(f, &h, sizeof(h), offset, 0);
+    ok      = ok && write_padded(f, ptr, sizeof(int) * (m + 1), offset, h.ptr_offset);
+    ok      = ok && write_padded(f, col, sizeof(int) * nnz, offset, h.col_offset);
+    ok      = ok
+         && write_padded(
+             f, single ? (const void*)valf.data() : val, val_size * nnz, offset, h.val_offset);
+
+    fclose(f);
+
+    return ok ? 0 : -1;
+}
+
 int coo_to_csr(int m, int nnz, const int* src_row, std::vector<int>& dst_ptr)
 {
     dst_ptr.resize(m + 1, 0);
@@ -254,6 +385,37 @@ int coo_to_csr(int m, int nnz, const int* src_row, std::vector<int>& dst_ptr)
 
 int main(int argc, char* argv[])
 {
+    // Usage: mtx2csr [--legacy | --single] input.mtx output.bin
+    bool legacy = false;
+    bool single = false;
+
+    int arg = 1;
+    for(; arg < argc && strncmp(argv[arg], "--", 2) == 0; ++arg)
+    {
+        if(strcmp(argv[arg], "--legacy") == 0)
+        {
+            legacy = true;
+        }
+        else if(strcmp(argv[arg], "--single") == 0)
+        {
+            single = true;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option %s.\n", argv[arg]);
+            return -1;
+        }
+    }
+
+    if(argc - arg != 2 || (legacy && single))
+    {
+        fprintf(stderr, "Usage: %s [--legacy | --single] input.mtx output.bin\n", argv[0]);
+        return -1;
+    }
+
+    const char* input  = argv[arg];
+    const char* output = argv[arg + 1];
+
     int m;
     int n;
     int nnz;
@@ -263,21 +425,24 @@ int main(int argc, char* argv[])
     std::vector<int>    col;
     std::vector<double> val;
 
-    if(read_mtx_matrix(argv[1], m, n, nnz, row, col, val) != 0)
+    if(read_mtx_matrix(input, m, n, nnz, row, col, val) != 0)
     {
-        fprintf(stderr, "Cannot open [read] %s.\n", argv[1]);
+        fprintf(stderr, "Cannot open [read] %s.\n", input);
         return -1;
     }
 
     if(coo_to_csr(m, nnz, row.data(), ptr) != 0)
     {
-        fprintf(stderr, "Cannot convert %s from COO to CSR.\n", argv[1]);
+        fprintf(stderr, "Cannot convert %s from COO to CSR.\n", input);
         return -1;
     }
 
-    if(write_bin_matrix(argv[2], m, n, nnz, ptr.data(), col.data(), val.data()) != 0)
+    int status
+        = legacy ? write_bin_matrix_legacy(output, m, n, nnz, ptr.data(), col.data(), val.data())
+                 : write_bin_matrix(output, m, n, nnz, ptr.data(), col.data(), val.data(), single);
+    if(status != 0)
     {
-        fprintf(stderr, "Cannot open [write] %s.\n", argv[2]);
+        fprintf(stderr, "Cannot open [write] %s.\n", output);
         return -1;
     }
 
@@ -96,6 +96,7 @@ struct csrsm2Info;
 struct csrilu02Info;
 struct csric02Info;
 struct csrgemm2Info;
+struct csrgemmPlan;
 struct pruneInfo;
 struct csru2csrInfo;
 /// \endcond
@@ -257,6 +258,18 @@ typedef struct csric02Info* csric02Info_t;
  */
 typedef struct csrgemm2Info* csrgemm2Info_t;
 
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding a csrgemm plan.
+ *
+ *  \details
+ *  The hipSPARSE csrgemm plan caches the analysis and the temporary storage gathered by
+ *  hipsparseXcsrgemmNnzWithPlan(), so that \ref hipsparseScsrgemmWithPlan
+ *  "hipsparseXcsrgemmWithPlan()" can recompute products of matrices with unchanged sparsity
+ *  patterns without repeating them. It must be initialized using hipsparseCreateCsrgemmPlan()
+ *  and should be destroyed at the end using hipsparseDestroyCsrgemmPlan().
+ */
+typedef struct csrgemmPlan* csrgemmPlan_t;
+
 /*! \ingroup types_module
  *  \brief Pointer type to opaque structure holding prune info.
  *
@@ -486,6 +499,23 @@ typedef enum {
     HIPSPARSE_DIRECTION_COLUMN = 1 /**< Parse the matrix by columns */
 } hipsparseDirection_t;
 
+/*! \ingroup types_module
+ *  \brief Specify whether blocking routines synchronize with the host.
+ *
+ *  \details
+ *  Some routines, such as hipsparseXdoti() or hipsparseXcsr2csc(), are blocking in
+ *  cuSPARSE and therefore synchronize the stream of the handle before they return. The
+ *  \ref hipsparseExecutionPolicy_t indicates whether these synchronizations may be skipped.
+ *  The \ref hipsparseExecutionPolicy_t can be changed by hipsparseSetExecutionPolicy() and
+ *  overridden for all handles with the \p HIPSPARSE_EXECUTION_POLICY environment variable.
+ *  The currently used execution policy can be obtained by hipsparseGetExecutionPolicy().
+ */
+typedef enum {
+    HIPSPARSE_EXECUTION_POLICY_BLOCKING     = 0, /**< Synchronize before returning (default) */
+    HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE = 1, /**< Skip synchronization if all results are in device memory */
+    HIPSPARSE_EXECUTION_POLICY_ASYNC        = 2 /**< Never synchronize, the caller synchronizes the stream */
+} hipsparseExecutionPolicy_t;
+
 // clang-format on
 
 #ifdef __cplusplus
@@ -605,6 +635,90 @@ hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePoi
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode);
 
+/*! \ingroup aux_module
+ *  \brief Pre-size the workspace pool of the library context
+ *
+ *  \details
+ *  Legacy routines that require temporary device storage, such as
+ *  \ref hipsparseScsr2csc "hipsparseXcsr2csc()", \ref hipsparseXcsrgemmNnz "hipsparseXcsrgemmNnz()",
+ *  \ref hipsparseScsrgemm "hipsparseXcsrgemm()" and \ref hipsparseShyb2csr "hipsparseXhyb2csr()",
+ *  draw it from a device workspace pool that is owned by the handle. The pool grows on
+ *  demand and is reused by all subsequent calls, so that no device allocations happen in
+ *  steady state. \p hipsparseSetWorkspacePoolSize grows the pool to at least \p size bytes
+ *  up front. It never shrinks the pool, use hipsparseTrimWorkspacePool() for that.
+ *
+ *  \note
+ *  The pool is ordered on the stream of the handle. Changing the stream with
+ *  hipsparseSetStream() is allowed, the next routine using the pool will wait for the
+ *  work that is still pending on the previous stream.
+ *
+ *  \note
+ *  With the cuSPARSE backend, the pool is not used and this function does nothing.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetWorkspacePoolSize(hipsparseHandle_t handle, size_t size);
+
+/*! \ingroup aux_module
+ *  \brief Query the workspace pool of the library context
+ *
+ *  \details
+ *  \p hipsparseGetWorkspacePoolInfo returns the current size of the workspace pool in
+ *  bytes, as well as the largest workspace requested by any routine since the handle
+ *  was created or the pool was last trimmed. Pre-sizing the pool of a new handle with
+ *  the high-water mark of a previous run avoids all device allocations.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t
+    hipsparseGetWorkspacePoolInfo(hipsparseHandle_t handle, size_t* size, size_t* highWaterMark);
+
+/*! \ingroup aux_module
+ *  \brief Release the workspace pool of the library context
+ *
+ *  \details
+ *  \p hipsparseTrimWorkspacePool waits for all work that may still use the workspace
+ *  pool, releases its device memory and resets the high-water mark. The pool is
+ *  allocated again by the next routine that needs it.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseTrimWorkspacePool(hipsparseHandle_t handle);
+
+/*! \ingroup aux_module
+ *  \brief Specify the execution policy of the library context
+ *
+ *  \details
+ *  \p hipsparseSetExecutionPolicy specifies whether routines that are blocking in
+ *  cuSPARSE synchronize the stream of the handle before they return. With
+ *  \ref HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE, the synchronization is skipped whenever
+ *  all results are written to device memory. With \ref HIPSPARSE_EXECUTION_POLICY_ASYNC,
+ *  it is always skipped and the caller must synchronize the stream before reading any
+ *  result, including results that are written to host memory. The default is
+ *  \ref HIPSPARSE_EXECUTION_POLICY_BLOCKING.
+ *
+ *  \note
+ *  If the \p HIPSPARSE_EXECUTION_POLICY environment variable is set to \p blocking,
+ *  \p async_device or \p async, it takes precedence over the policy set by this function.
+ *
+ *  \note
+ *  With the cuSPARSE backend, the blocking behaviour is controlled by cuSPARSE. Only
+ *  \ref HIPSPARSE_EXECUTION_POLICY_BLOCKING is accepted, the other policies return
+ *  \ref HIPSPARSE_STATUS_NOT_SUPPORTED.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetExecutionPolicy(hipsparseHandle_t          handle,
+                                              hipsparseExecutionPolicy_t policy);
+
+/*! \ingroup aux_module
+ *  \brief Get current execution policy from library context
+ *
+ *  \details
+ *  \p hipsparseGetExecutionPolicy gets the hipSPARSE library context execution policy
+ *  which is currently used for all subsequent function calls, taking the
+ *  \p HIPSPARSE_EXECUTION_POLICY environment variable into account.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetExecutionPolicy(hipsparseHandle_t           handle,
+                                              hipsparseExecutionPolicy_t* policy);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix descriptor
  *  \details
@@ -1022,6 +1136,29 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseDestroyCsrgemm2Info(csrgemm2Info_t info);
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
+/*! \ingroup aux_module
+ *  \brief Create a csrgemm plan
+ *
+ *  \details
+ *  \p hipsparseCreateCsrgemmPlan creates a plan that holds the csrgemm analysis data and
+ *  temporary storage gathered by hipsparseXcsrgemmNnzWithPlan(). It should be destroyed
+ *  at the end using hipsparseDestroyCsrgemmPlan().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateCsrgemmPlan(csrgemmPlan_t* plan);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a csrgemm plan
+ *
+ *  \details
+ *  \p hipsparseDestroyCsrgemmPlan destroys a csrgemm plan and releases its temporary
+ *  storage.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyCsrgemmPlan(csrgemmPlan_t plan);
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 13000)
 /* Info structures */
 /*! \ingroup aux_module
@@ -1210,8 +1347,11 @@ hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
 *  \endcode
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  This function follows the execution policy of the handle. With
+*  \ref HIPSPARSE_EXECUTION_POLICY_BLOCKING it blocks until \p result is available. With
+*  \ref HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE it only blocks if the pointer mode is
+*  \ref HIPSPARSE_POINTER_MODE_HOST. With \ref HIPSPARSE_EXECUTION_POLICY_ASYNC it never
+*  blocks. See hipsparseSetExecutionPolicy().
 *
 *  @param[in]
 *  handle      handle to the hipsparse library context queue.
@@ -1344,8 +1484,11 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
 *  \endcode
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  This function follows the execution policy of the handle. With
+*  \ref HIPSPARSE_EXECUTION_POLICY_BLOCKING it blocks until \p result is available. With
+*  \ref HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE it only blocks if the pointer mode is
+*  \ref HIPSPARSE_POINTER_MODE_HOST. With \ref HIPSPARSE_EXECUTION_POLICY_ASYNC it never
+*  blocks. See hipsparseSetExecutionPolicy().
 *
 *  @param[in]
 *  handle      handle to the hipsparse library context queue.
@@ -7830,6 +7973,290 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
 /**@}*/
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format, symbolic
+*  phase with a reusable plan
+*
+*  \details
+*  \p hipsparseXcsrgemmNnzWithPlan computes the CSR row offsets and the total number of
+*  non-zero elements of the resulting multiplied matrix C, like \ref hipsparseXcsrgemmNnz().
+*  In addition, the analysis of the sparsity patterns of A and B and the temporary storage
+*  are kept in \p plan. As long as the sparsity patterns of A and B do not change, the
+*  product can then be recomputed any number of times with \ref hipsparseScsrgemmWithPlan
+*  "hipsparseXcsrgemmWithPlan()", which skips the analysis and the allocation of temporary
+*  storage.
+*
+*  \note
+*  Calling \p hipsparseXcsrgemmNnzWithPlan again on the same plan discards the previous
+*  analysis. A plan must not be used by multiple streams at the same time.
+*
+*  \note
+*  With the cuSPARSE backend, the plan does not cache anything and the routines behave as
+*  \ref hipsparseXcsrgemmNnz() and \ref hipsparseScsrgemm "hipsparseXcsrgemm()".
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  transA          matrix \f$A\f$ operation type.
+*  @param[in]
+*  transB          matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descrA          descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnzA            number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrRowPtrA      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrColIndA      array of \p nnzA elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descrB          descriptor of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  nnzB            number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csrRowPtrB      array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csrColIndB      array of \p nnzB elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descrC          descriptor of the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csrRowPtrC      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnzTotalDevHostPtr pointer to the number of non-zero entries of the sparse CSR
+*                     matrix \f$C\f$. \p nnzTotalDevHostPtr can be a host or device pointer.
+*  @param[inout]
+*  plan            csrgemm plan created with hipsparseCreateCsrgemmPlan().
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p n, \p k, \p nnzA, \p nnzB,
+*          \p descrA, \p csrRowPtrA, \p csrColIndA, \p descrB, \p csrRowPtrB, \p csrColIndB,
+*          \p descrC, \p csrRowPtrC, \p nnzTotalDevHostPtr or \p plan is invalid.
+*  \retval HIPSPARSE_STATUS_ALLOC_FAILED the temporary storage of the plan could not be
+*          allocated.
+*  \retval HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED
+*          \p transA != \ref HIPSPARSE_OPERATION_NON_TRANSPOSE,
+*          \p transB != \ref HIPSPARSE_OPERATION_NON_TRANSPOSE, or
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsrgemmNnzWithPlan(hipsparseHandle_t         handle,
+                                               hipsparseOperation_t      transA,
+                                               hipsparseOperation_t      transB,
+                                               int                       m,
+                                               int                       n,
+                                               int                       k,
+                                               const hipsparseMatDescr_t descrA,
+                                               int                       nnzA,
+                                               const int*                csrRowPtrA,
+                                               const int*                csrColIndA,
+                                               const hipsparseMatDescr_t descrB,
+                                               int                       nnzB,
+                                               const int*                csrRowPtrB,
+                                               const int*                csrColIndB,
+                                               const hipsparseMatDescr_t descrC,
+                                               int*                      csrRowPtrC,
+                                               int*                      nnzTotalDevHostPtr,
+                                               csrgemmPlan_t             plan);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format, numeric
+*  phase with a reusable plan
+*
+*  \details
+*  \p hipsparseXcsrgemmWithPlan computes the sparse CSR matrix \f$C = op(A) \cdot op(B)\f$
+*  like \ref hipsparseScsrgemm "hipsparseXcsrgemm()", using the analysis and temporary
+*  storage kept in \p plan by hipsparseXcsrgemmNnzWithPlan(). The sparsity patterns of
+*  A and B must be the ones \p plan was created for, only their values may change between
+*  calls. The first call computes the column indices of C, subsequent calls into the same
+*  \p csrRowPtrC and \p csrColIndC arrays only recompute its values.
+*
+*  \note
+*  The plan is tied to the sparsity patterns, which are not checked. Reuse of the column
+*  indices of C is detected from the \p csrRowPtrC and \p csrColIndC pointers, so if the
+*  patterns of A or B change, or \p csrColIndC is rewritten in place, the plan must be
+*  set up again with hipsparseXcsrgemmNnzWithPlan().
+*
+*  \note
+*  On rocSPARSE releases before 2.2, which have no numeric only csrgemm, every call
+*  computes the column indices of C as well.
+*
+*  \note
+*  In device pointer mode, the number of non-zeros of C is read back from \p csrRowPtrC
+*  by the first call that only recomputes the values, which synchronizes the stream once.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  transA          matrix \f$A\f$ operation type.
+*  @param[in]
+*  transB          matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descrA          descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnzA            number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrValA         array of \p nnzA elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrRowPtrA      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrColIndA      array of \p nnzA elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descrB          descriptor of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  nnzB            number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csrValB         array of \p nnzB elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csrRowPtrB      array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csrColIndB      array of \p nnzB elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descrC          descriptor of the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csrValC         array of \p nnzC elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csrRowPtrC      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csrColIndC      array of \p nnzC elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[inout]
+*  plan            csrgemm plan prepared by hipsparseXcsrgemmNnzWithPlan().
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p n, \p k, \p nnzA, \p nnzB,
+*          \p descrA, \p csrValA, \p csrRowPtrA, \p csrColIndA, \p descrB, \p csrValB,
+*          \p csrRowPtrB, \p csrColIndB, \p descrC, \p csrValC, \p csrRowPtrC,
+*          \p csrColIndC or \p plan is invalid, or \p plan has not been prepared by
+*          hipsparseXcsrgemmNnzWithPlan() for the same operation and sizes.
+*  \retval HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED
+*          \p transA != \ref HIPSPARSE_OPERATION_NON_TRANSPOSE,
+*          \p transB != \ref HIPSPARSE_OPERATION_NON_TRANSPOSE, or
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const float*              csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const float*              csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            float*                    csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const double*             csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const double*             csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            double*                   csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipComplex*         csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipComplex*         csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            hipComplex*               csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipDoubleComplex*   csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipDoubleComplex*   csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            hipDoubleComplex*         csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan);
+/**@}*/
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 12000)
 /*! \ingroup extra_module
 *  \brief Sparse matrix sparse matrix multiplication using CSR storage format
@@ -13003,8 +13430,11 @@ hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
 *  The resulting matrix can also be seen as the transpose of the input matrix.
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  This function follows the execution policy of the handle. With
+*  \ref HIPSPARSE_EXECUTION_POLICY_BLOCKING it blocks until the conversion has finished.
+*  All results are written to device memory, so it is non blocking with
+*  \ref HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE and \ref HIPSPARSE_EXECUTION_POLICY_ASYNC.
+*  See hipsparseSetExecutionPolicy().
 *
 *  @param[in]
 *  handle          handle to the hipsparse library context queue.
@@ -14776,18 +15206,183 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrColIndC);
 /**@}*/
 
+#if(!defined(CUDART_VERSION))
 /*! \ingroup conv_module
-*  \brief Convert a sparse BSR matrix into a sparse CSR matrix
+*  \brief This function computes the slice offsets of a sliced ELL matrix converted from a
+*  sparse CSR matrix.
 *
 *  \details
-*  \p hipsparseXbsr2csr converts a BSR matrix into a CSR matrix. It is assumed,
-*  that \p csrValC, \p csrColIndC and \p csrRowPtrC are allocated. Allocation size
-*  for \p csrRowPtrC is computed by the number of block rows multiplied by the block
-*  dimension plus one. Allocation for \p csrValC and \p csrColInd is computed by the
-*  the number of blocks in the BSR matrix multiplied by the block dimension squared.
+*  \p hipsparseXcsr2sellNnz is the first step of the conversion of a CSR matrix into a sliced
+*  ELL (SELL-C-sigma) matrix, see \p hipsparseCreateSlicedEll for the layout. The rows are
+*  grouped in \p sliceSize rows slices, each slice is as wide as its longest row. When
+*  \p sigma is larger than one, the rows of each window of \p sigma consecutive rows are
+*  sorted by decreasing length before being sliced, which reduces the padding of irregular
+*  matrices. Row \p r of the sliced ELL matrix is then row \p perm[r] of the CSR matrix, i.e.
+*  the sliced ELL matrix holds \p P*A and a product computed with it has to be scattered
+*  with \p perm. The sort is stable, \p sigma equal to one keeps the original row order.
+*
+*  \p sellSliceOffsets has \p (m+sliceSize-1)/sliceSize+1 elements and is zero based.
+*  \p sellValuesSize is the total number of entries stored, padding included, and is
+*  written to host or device memory depending on the pointer mode.
 *
-*  For example, given the BSR matrix using block dimension 2:
-*  \f[
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle            handle to the hipsparse library context queue.
+*  @param[in]
+*  m                 number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n                 number of columns of the sparse CSR matrix.
+*  @param[in]
+*  descrA            descriptor of the sparse CSR matrix. Currently, only
+*                    \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*  @param[in]
+*  csrRowPtrA        array of \p m+1 elements that point to the start of every row.
+*  @param[in]
+*  sliceSize         number of rows of a slice.
+*  @param[in]
+*  sigma             number of rows of the sorting windows.
+*  @param[out]
+*  sellSliceOffsets  array of \p (m+sliceSize-1)/sliceSize+1 elements that point to the start of
+*                    every slice.
+*  @param[out]
+*  perm              array of \p m elements containing the CSR row of every sliced ELL row. It can
+*                    be \p NULL when \p sigma is one.
+*  @param[out]
+*  sellValuesSize    number of entries of the sliced ELL matrix, padding included.
+*
+*  \retval     HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval     HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p n, \p sliceSize, \p sigma,
+*              \p descrA, \p csrRowPtrA, \p sellSliceOffsets, \p perm or \p sellValuesSize
+*              is invalid.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsr2sellNnz(hipsparseHandle_t         handle,
+                                        int                       m,
+                                        int                       n,
+                                        const hipsparseMatDescr_t descrA,
+                                        const int*                csrRowPtrA,
+                                        int                       sliceSize,
+                                        int                       sigma,
+                                        int*                      sellSliceOffsets,
+                                        int*                      perm,
+                                        int*                      sellValuesSize);
+#endif
+
+#if(!defined(CUDART_VERSION))
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse sliced ELL matrix
+*
+*  \details
+*  \p hipsparseXcsr2sell converts a CSR matrix into a sliced ELL matrix. \p sellSliceOffsets
+*  and \p perm are the arrays computed by \p hipsparseXcsr2sellNnz, \p sellColInd and
+*  \p sellVal have \p sellValuesSize elements. The column indices keep the index base of
+*  \p descrA, padded entries have a column index of -1 and a zero value.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle            handle to the hipsparse library context queue.
+*  @param[in]
+*  m                 number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n                 number of columns of the sparse CSR matrix.
+*  @param[in]
+*  descrA            descriptor of the sparse CSR matrix. Currently, only
+*                    \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*  @param[in]
+*  csrValA           array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csrRowPtrA        array of \p m+1 elements that point to the start of every row.
+*  @param[in]
+*  csrColIndA        array of \p nnz elements containing the column indices.
+*  @param[in]
+*  sliceSize         number of rows of a slice.
+*  @param[in]
+*  sellSliceOffsets  slice offsets computed by \p hipsparseXcsr2sellNnz.
+*  @param[in]
+*  perm              row permutation computed by \p hipsparseXcsr2sellNnz, \p NULL for the
+*                    identity.
+*  @param[out]
+*  sellColInd        array of \p sellValuesSize elements containing the column indices.
+*  @param[out]
+*  sellVal           array of \p sellValuesSize elements containing the values.
+*
+*  \retval     HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval     HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p n, \p sliceSize,
+*              \p descrA, \p csrValA, \p csrRowPtrA, \p csrColIndA, \p sellSliceOffsets,
+*              \p sellColInd or \p sellVal is invalid.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const float*              csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     float*                    sellVal);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const double*             csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     double*                   sellVal);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipComplex*         csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     hipComplex*               sellVal);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipDoubleComplex*   csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     hipDoubleComplex*         sellVal);
+/**@}*/
+#endif
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse BSR matrix into a sparse CSR matrix
+*
+*  \details
+*  \p hipsparseXbsr2csr converts a BSR matrix into a CSR matrix. It is assumed,
+*  that \p csrValC, \p csrColIndC and \p csrRowPtrC are allocated. Allocation size
+*  for \p csrRowPtrC is computed by the number of block rows multiplied by the block
+*  dimension plus one. Allocation for \p csrValC and \p csrColInd is computed by the
+*  the number of blocks in the BSR matrix multiplied by the block dimension squared.
+*
+*  For example, given the BSR matrix using block dimension 2:
+*  \f[
 *   \left[ 
 *    \begin{array}{c | c} 
 *      \begin{array}{c c} 
@@ -17974,24 +18569,33 @@ typedef struct hipsparseSpSMDescr* hipsparseSpSMDescr_t;
  *  \details
  *  This is a list of the \ref hipsparseFormat_t types that are used by the hipSPARSE
  *  library.
+ *
+ *  \note
+ *  rocSPARSE has no sliced ELL format. On the rocSPARSE backend, every sliced ELL routine,
+ *  the descriptor routines as well as hipsparseXcsr2sellNnz() and hipsparseXcsr2sell(),
+ *  returns \ref HIPSPARSE_STATUS_NOT_SUPPORTED.
  */
 #if(!defined(CUDART_VERSION))
 typedef enum
 {
-    HIPSPARSE_FORMAT_CSR         = 1, /* Compressed Sparse Row */
-    HIPSPARSE_FORMAT_CSC         = 2, /* Compressed Sparse Column */
-    HIPSPARSE_FORMAT_COO         = 3, /* Coordinate - Structure of Arrays */
-    HIPSPARSE_FORMAT_COO_AOS     = 4, /* Coordinate - Array of Structures */
-    HIPSPARSE_FORMAT_BLOCKED_ELL = 5 /* Blocked ELL */
+    HIPSPARSE_FORMAT_CSR            = 1, /* Compressed Sparse Row */
+    HIPSPARSE_FORMAT_CSC            = 2, /* Compressed Sparse Column */
+    HIPSPARSE_FORMAT_COO            = 3, /* Coordinate - Structure of Arrays */
+    HIPSPARSE_FORMAT_COO_AOS        = 4, /* Coordinate - Array of Structures */
+    HIPSPARSE_FORMAT_BLOCKED_ELL    = 5, /* Blocked ELL */
+    HIPSPARSE_FORMAT_SLICED_ELLPACK = 6, /* Sliced ELL */
+    HIPSPARSE_FORMAT_BSR            = 7 /* Block Compressed Sparse Row */
 } hipsparseFormat_t;
 #else
 #if(CUDART_VERSION >= 12000)
 typedef enum
 {
-    HIPSPARSE_FORMAT_CSR         = 1, /* Compressed Sparse Row */
-    HIPSPARSE_FORMAT_CSC         = 2, /* Compressed Sparse Column */
-    HIPSPARSE_FORMAT_COO         = 3, /* Coordinate - Structure of Arrays */
-    HIPSPARSE_FORMAT_BLOCKED_ELL = 5 /* Blocked ELL */
+    HIPSPARSE_FORMAT_CSR            = 1, /* Compressed Sparse Row */
+    HIPSPARSE_FORMAT_CSC            = 2, /* Compressed Sparse Column */
+    HIPSPARSE_FORMAT_COO            = 3, /* Coordinate - Structure of Arrays */
+    HIPSPARSE_FORMAT_BLOCKED_ELL    = 5, /* Blocked ELL */
+    HIPSPARSE_FORMAT_SLICED_ELLPACK = 6, /* Sliced ELL */
+    HIPSPARSE_FORMAT_BSR            = 7 /* Block Compressed Sparse Row */
 } hipsparseFormat_t;
 #elif(CUDART_VERSION >= 11021 && CUDART_VERSION < 12000)
 typedef enum
@@ -18068,6 +18672,15 @@ typedef enum
  *  \details
  *  This is a list of the \ref hipsparseSpMVAlg_t types that are used by the hipSPARSE
  *  library.
+ *
+ *  With \ref HIPSPARSE_SPMV_ALG_AUTO, \ref hipsparseSpMV_preprocess times the algorithms
+ *  that apply to the format of the sparse matrix and remembers the fastest one for
+ *  subsequent \ref hipsparseSpMV calls with the same descriptor. \ref hipsparseSpMV never
+ *  tunes, without \ref hipsparseSpMV_preprocess it uses \ref HIPSPARSE_SPMV_ALG_DEFAULT. If the
+ *  environment variable \p HIPSPARSE_SPMV_TUNING_CACHE names a file, the choice is also
+ *  stored there, keyed by a fingerprint of the matrix, its sparsity pattern, the device and
+ *  the rocSPARSE version, so that later runs skip the tuning. The cuSPARSE
+ *  backend maps \ref HIPSPARSE_SPMV_ALG_AUTO to \ref HIPSPARSE_SPMV_ALG_DEFAULT.
  */
 #if(!defined(CUDART_VERSION))
 typedef enum
@@ -18080,7 +18693,8 @@ typedef enum
     HIPSPARSE_SPMV_COO_ALG1    = 1,
     HIPSPARSE_SPMV_CSR_ALG1    = 2,
     HIPSPARSE_SPMV_CSR_ALG2    = 3,
-    HIPSPARSE_SPMV_COO_ALG2    = 4
+    HIPSPARSE_SPMV_COO_ALG2    = 4,
+    HIPSPARSE_SPMV_ALG_AUTO    = 5
 } hipsparseSpMVAlg_t;
 #else
 #if(CUDART_VERSION >= 12000)
@@ -18090,7 +18704,8 @@ typedef enum
     HIPSPARSE_SPMV_COO_ALG1    = 1,
     HIPSPARSE_SPMV_CSR_ALG1    = 2,
     HIPSPARSE_SPMV_CSR_ALG2    = 3,
-    HIPSPARSE_SPMV_COO_ALG2    = 4
+    HIPSPARSE_SPMV_COO_ALG2    = 4,
+    HIPSPARSE_SPMV_ALG_AUTO    = 5
 } hipsparseSpMVAlg_t;
 #elif(CUDART_VERSION >= 11021 && CUDART_VERSION < 12000)
 typedef enum
@@ -18103,7 +18718,8 @@ typedef enum
     HIPSPARSE_SPMV_COO_ALG1    = 1,
     HIPSPARSE_SPMV_CSR_ALG1    = 2,
     HIPSPARSE_SPMV_CSR_ALG2    = 3,
-    HIPSPARSE_SPMV_COO_ALG2    = 4
+    HIPSPARSE_SPMV_COO_ALG2    = 4,
+    HIPSPARSE_SPMV_ALG_AUTO    = 5
 } hipsparseSpMVAlg_t;
 #elif(CUDART_VERSION >= 10010 && CUDART_VERSION < 11021)
 typedef enum
@@ -18330,6 +18946,20 @@ typedef enum
 #endif
 #endif
 
+/*! \ingroup types_module
+ *  \brief List of hipsparse SpGEMM descriptor modes.
+ *
+ *  \details
+ *  The \ref hipsparseSpGEMMMode_t indicates how a \ref hipsparseSpGEMMDescr_t lays out the
+ *  temporary storage of hipsparseSpGEMM_workEstimation(), hipsparseSpGEMM_compute() and
+ *  hipsparseSpGEMM_copy(). It can be changed by hipsparseSpGEMM_setMode().
+ */
+typedef enum
+{
+    HIPSPARSE_SPGEMM_MODE_DEFAULT      = 0, /**< C is staged in the user buffers, then copied */
+    HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA = 1 /**< One user buffer, C is written in place */
+} hipsparseSpGEMMMode_t;
+
 /* Sparse vector API */
 
 /*! \ingroup generic_module
@@ -18649,6 +19279,121 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
                                                  hipDataType                 valueType);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Create a sparse sliced ELL matrix descriptor
+*  \details
+*  \p hipsparseCreateSlicedEll creates a sparse sliced ELL (SELL-C) matrix descriptor. The rows
+*  are grouped in slices of \p sliceSize rows, each slice is stored as a column major
+*  \p sliceSize x width block where width is the longest row of the slice. Entry \p j of row
+*  \p r is stored at position \p sellSliceOffsets[s] + \p j * \p sliceSize + \p r %
+*  \p sliceSize of \p sellColInd and \p sellValues, with \p s = \p r / \p sliceSize. The
+*  slice offsets are zero based, padded entries have a column index of -1. \p sellValuesSize is
+*  the total number of stored entries, padding included. The descriptor should be destroyed at
+*  the end using \p hipsparseDestroySpMat.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12010)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateSlicedEll(hipsparseSpMatDescr_t* spMatDescr,
+                                           int64_t                rows,
+                                           int64_t                cols,
+                                           int64_t                nnz,
+                                           int64_t                sellValuesSize,
+                                           int64_t                sliceSize,
+                                           void*                  sellSliceOffsets,
+                                           void*                  sellColInd,
+                                           void*                  sellValues,
+                                           hipsparseIndexType_t   sellSliceOffsetsType,
+                                           hipsparseIndexType_t   sellColIndType,
+                                           hipsparseIndexBase_t   idxBase,
+                                           hipDataType            valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse sliced ELL matrix descriptor
+*  \details
+*  \p hipsparseCreateConstSlicedEll creates a sparse sliced ELL matrix descriptor, see
+*  \p hipsparseCreateSlicedEll. It should be destroyed at the end using
+*  \p hipsparseDestroySpMat.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12010)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateConstSlicedEll(hipsparseConstSpMatDescr_t* spMatDescr,
+                                                int64_t                     rows,
+                                                int64_t                     cols,
+                                                int64_t                     nnz,
+                                                int64_t                     sellValuesSize,
+                                                int64_t                     sliceSize,
+                                                const void*                 sellSliceOffsets,
+                                                const void*                 sellColInd,
+                                                const void*                 sellValues,
+                                                hipsparseIndexType_t        sellSliceOffsetsType,
+                                                hipsparseIndexType_t        sellColIndType,
+                                                hipsparseIndexBase_t        idxBase,
+                                                hipDataType                 valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse BSR matrix descriptor
+*  \details
+*  \p hipsparseCreateBsr creates a sparse block compressed sparse row (BSR) matrix descriptor.
+*  The matrix has \p brows x \p bcols blocks of \p rowBlockSize x \p colBlockSize entries,
+*  that is \p brows * \p rowBlockSize rows and \p bcols * \p colBlockSize columns. The
+*  \p bnnz nonzero blocks are stored contiguously in \p bsrValues, each one in \p order
+*  (\ref HIPSPARSE_ORDER_ROW or \ref HIPSPARSE_ORDER_COL) layout. \p bsrRowOffsets and
+*  \p bsrColInd hold the block row offsets and the block column indices, as with CSR, and
+*  hipsparseSpMatGetSize() reports \p bnnz as the number of nonzeros. The descriptor should be
+*  destroyed at the end using \p hipsparseDestroySpMat.
+*
+*  \note
+*  The rocSPARSE backend only supports square blocks, and only takes BSR matrices in the
+*  non-transposed hipsparseSpMV(), in hipsparseSpMM() with column major dense matrices, and,
+*  with 32 bit indices, in hipsparseSpSV_bufferSize() and hipsparseSparseToDense_bufferSize().
+*  hipsparseDenseToSparse_bufferSize() returns \ref HIPSPARSE_STATUS_NOT_SUPPORTED for BSR
+*  matrices there, since the column indices and values of a rocSPARSE BSR descriptor cannot be
+*  set after it is created.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12010)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateBsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                brows,
+                                     int64_t                bcols,
+                                     int64_t                bnnz,
+                                     int64_t                rowBlockSize,
+                                     int64_t                colBlockSize,
+                                     void*                  bsrRowOffsets,
+                                     void*                  bsrColInd,
+                                     void*                  bsrValues,
+                                     hipsparseIndexType_t   bsrRowOffsetsType,
+                                     hipsparseIndexType_t   bsrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType,
+                                     hipsparseOrder_t       order);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse BSR matrix descriptor
+*  \details
+*  \p hipsparseCreateConstBsr creates a sparse BSR matrix descriptor, see
+*  \p hipsparseCreateBsr. It should be destroyed at the end using \p hipsparseDestroySpMat.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12010)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateConstBsr(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     brows,
+                                          int64_t                     bcols,
+                                          int64_t                     bnnz,
+                                          int64_t                     rowBlockSize,
+                                          int64_t                     colBlockSize,
+                                          const void*                 bsrRowOffsets,
+                                          const void*                 bsrColInd,
+                                          const void*                 bsrValues,
+                                          hipsparseIndexType_t        bsrRowOffsetsType,
+                                          hipsparseIndexType_t        bsrColIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType,
+                                          hipsparseOrder_t            order);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Destroy a sparse matrix descriptor
 *  \details
@@ -18838,6 +19583,96 @@ hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDe
                                               hipDataType*               valueType);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse sliced ELL matrix
+*  \details
+*  \p hipsparseSlicedEllGet gets the fields of the sparse sliced ELL matrix descriptor
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSlicedEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                        int64_t*                    rows,
+                                        int64_t*                    cols,
+                                        int64_t*                    nnz,
+                                        int64_t*                    sellValuesSize,
+                                        int64_t*                    sliceSize,
+                                        void**                      sellSliceOffsets,
+                                        void**                      sellColInd,
+                                        void**                      sellValues,
+                                        hipsparseIndexType_t*       sellSliceOffsetsType,
+                                        hipsparseIndexType_t*       sellColIndType,
+                                        hipsparseIndexBase_t*       idxBase,
+                                        hipDataType*                valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse sliced ELL matrix
+*  \details
+*  \p hipsparseConstSlicedEllGet gets the fields of the sparse sliced ELL matrix descriptor
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseConstSlicedEllGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                             int64_t*                   rows,
+                                             int64_t*                   cols,
+                                             int64_t*                   nnz,
+                                             int64_t*                   sellValuesSize,
+                                             int64_t*                   sliceSize,
+                                             const void**               sellSliceOffsets,
+                                             const void**               sellColInd,
+                                             const void**               sellValues,
+                                             hipsparseIndexType_t*      sellSliceOffsetsType,
+                                             hipsparseIndexType_t*      sellColIndType,
+                                             hipsparseIndexBase_t*      idxBase,
+                                             hipDataType*               valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse BSR matrix
+*  \details
+*  \p hipsparseBsrGet gets the fields of the sparse BSR matrix descriptor
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseBsrGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    brows,
+                                  int64_t*                    bcols,
+                                  int64_t*                    bnnz,
+                                  int64_t*                    rowBlockSize,
+                                  int64_t*                    colBlockSize,
+                                  void**                      bsrRowOffsets,
+                                  void**                      bsrColInd,
+                                  void**                      bsrValues,
+                                  hipsparseIndexType_t*       bsrRowOffsetsType,
+                                  hipsparseIndexType_t*       bsrColIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType,
+                                  hipsparseOrder_t*           order);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse BSR matrix
+*  \details
+*  \p hipsparseConstBsrGet gets the fields of the sparse BSR matrix descriptor
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseConstBsrGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   brows,
+                                       int64_t*                   bcols,
+                                       int64_t*                   bnnz,
+                                       int64_t*                   rowBlockSize,
+                                       int64_t*                   colBlockSize,
+                                       const void**               bsrRowOffsets,
+                                       const void**               bsrColInd,
+                                       const void**               bsrValues,
+                                       hipsparseIndexType_t*      bsrRowOffsetsType,
+                                       hipsparseIndexType_t*      bsrColIndType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType,
+                                       hipsparseOrder_t*          order);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Set pointers of a sparse CSR matrix
 *  \details
@@ -18877,6 +19712,25 @@ hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 cooValues);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Set pointers of a sparse BSR matrix
+*  \details
+*  \p hipsparseBsrSetPointers sets the fields of the sparse BSR matrix descriptor, e.g. after
+*  hipsparseDenseToSparse_analysis() has determined the number of nonzero blocks.
+*
+*  \note
+*  The rocSPARSE backend can only replace \p bsrValues. \p bsrRowOffsets and \p bsrColInd
+*  must be the pointers the descriptor already holds, otherwise the routine returns
+*  \ref HIPSPARSE_STATUS_NOT_SUPPORTED.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseBsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 bsrRowOffsets,
+                                          void*                 bsrColInd,
+                                          void*                 bsrValues);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Get the sizes of a sparse matrix
 */
@@ -18987,6 +19841,42 @@ hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
                                               int64_t               columnsValuesBatchStride);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Set a variable size batch partition of the sparse CSR matrix
+*  \details
+*  \p hipsparseCsrSetVariableBatch describes the CSR matrix as \p batchCount independent
+*  matrices of different sizes and sparsity patterns, stored as one block diagonal matrix.
+*  Batch \p b spans the rows [batchRowOffsets[b], batchRowOffsets[b + 1]) and the columns
+*  [batchColOffsets[b], batchColOffsets[b + 1]) of the matrix, and its entries must lie in this
+*  block. The dense vectors hold the concatenated vectors of the batches.
+*
+*  hipsparseSpMV() and hipsparseSpSV_solve() then compute all the batches in a single call. For
+*  hipsparseSpSV_solve(), the batches must be square.
+*
+*  @param[inout]
+*  spMatDescr      the sparse CSR matrix descriptor.
+*  @param[in]
+*  batchCount      the number of batches.
+*  @param[in]
+*  batchRowOffsets array of \p batchCount + 1 zero based row offsets (host memory), starting at
+*                  0 and ending at the number of rows.
+*  @param[in]
+*  batchColOffsets array of \p batchCount + 1 zero based column offsets (host memory), starting
+*                  at 0 and ending at the number of columns.
+*
+*  \note
+*  The host backend solves the batches in parallel. The rocSPARSE and cuSPARSE backends only
+*  validate the partition and run the block diagonal matrix as a whole, which gives the same
+*  result.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsrSetVariableBatch(hipsparseSpMatDescr_t spMatDescr,
+                                               int                   batchCount,
+                                               const int64_t*        batchRowOffsets,
+                                               const int64_t*        batchColOffsets);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Get attribute from sparse matrix descriptor
 */
@@ -20247,11 +21137,19 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
 *  \par Mixed precisions:
 *  <table>
 *  <caption id="spmv_mixed">Mixed Precisions</caption>
-*  <tr><th>A / X    <th>Y         <th>compute_type
-*  <tr><td>HIP_R_8I <td>HIP_R_32I <td>HIP_R_32I
-*  <tr><td>HIP_R_8I <td>HIP_R_32F <td>HIP_R_32F
+*  <tr><th>A / X      <th>Y          <th>compute_type
+*  <tr><td>HIP_R_8I   <td>HIP_R_32I  <td>HIP_R_32I
+*  <tr><td>HIP_R_8I   <td>HIP_R_32F  <td>HIP_R_32F
+*  <tr><td>HIP_R_16F  <td>HIP_R_16F  <td>HIP_R_32F
+*  <tr><td>HIP_R_16F  <td>HIP_R_32F  <td>HIP_R_32F
+*  <tr><td>HIP_R_16BF <td>HIP_R_16BF <td>HIP_R_32F
+*  <tr><td>HIP_R_16BF <td>HIP_R_32F  <td>HIP_R_32F
 *  </table>
 *
+*  \note
+*  On the rocSPARSE backend, the HIP_R_16F and HIP_R_16BF value types require rocSPARSE 4.0
+*  or later.
+*
 *  \par Mixed-regular real precisions
 *  <table>
 *  <caption id="spmv_mixed_regular_real">Mixed-regular real precisions</caption>
@@ -20432,6 +21330,186 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 void*                       externalBuffer);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Calculate the buffer size required for the sparse matrix vector multiplication
+*  followed by a dot product
+*
+*  \details
+*  \p hipsparseSpMVDot_bufferSize computes the required user allocated buffer size needed
+*  when calling hipsparseSpMVDot().
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVDot_bufferSize(hipsparseHandle_t           handle,
+                                              hipsparseOperation_t        opA,
+                                              const void*                 alpha,
+                                              hipsparseConstSpMatDescr_t  matA,
+                                              hipsparseConstDnVecDescr_t  vecX,
+                                              const void*                 beta,
+                                              const hipsparseDnVecDescr_t vecY,
+                                              hipDataType                 computeType,
+                                              hipsparseSpMVAlg_t          alg,
+                                              size_t*                     pBufferSizeInBytes);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Compute the sparse matrix vector multiplication followed by a dot product
+*
+*  \details
+*  \p hipsparseSpMVDot computes
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y, \quad
+*    result := x^H \cdot y,
+*  \f]
+*  where \f$op(A)\f$ is a square sparse matrix, in a single pass over \p x and \p y. With
+*  \f$\beta = 0\f$, the result is the quadratic form \f$\alpha \cdot x^H \cdot op(A) \cdot x\f$
+*  of a conjugate gradient iteration. For complex types, \f$x\f$ is conjugated.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  opA             matrix operation type.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  matA            matrix descriptor.
+*  @param[in]
+*  vecX            vector descriptor.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[inout]
+*  vecY            vector descriptor.
+*  @param[out]
+*  result          pointer to the dot product of type \p computeType, in host or device
+*                  memory depending on the pointer mode.
+*  @param[in]
+*  computeType     floating point precision for the computation.
+*  @param[in]
+*  alg             SpMV algorithm for the SpMV computation.
+*  @param[out]
+*  externalBuffer  temporary storage buffer allocated by the user.
+*
+*  \retval      HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval      HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p alpha, \p matA, \p vecX, \p beta,
+*               \p vecY, \p result or \p externalBuffer pointer is invalid, or the sizes of
+*               the vectors do not match \f$op(A)\f$.
+*  \retval      HIPSPARSE_STATUS_NOT_SUPPORTED \p computeType is currently not supported.
+*
+*  \note
+*  rocSPARSE has no fused SpMV epilogue, and composing the routine of separate rocSPARSE calls
+*  would make more passes over the vectors than the unfused sequence. The rocSPARSE backend
+*  returns \ref HIPSPARSE_STATUS_NOT_SUPPORTED, use hipsparseSpMV() followed by the dot
+*  product or the residual update instead.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVDot(hipsparseHandle_t           handle,
+                                   hipsparseOperation_t        opA,
+                                   const void*                 alpha,
+                                   hipsparseConstSpMatDescr_t  matA,
+                                   hipsparseConstDnVecDescr_t  vecX,
+                                   const void*                 beta,
+                                   const hipsparseDnVecDescr_t vecY,
+                                   void*                       result,
+                                   hipDataType                 computeType,
+                                   hipsparseSpMVAlg_t          alg,
+                                   void*                       externalBuffer);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Calculate the buffer size required for the sparse matrix vector multiplication
+*  followed by a residual and its norm
+*
+*  \details
+*  \p hipsparseSpMVResidual_bufferSize computes the required user allocated buffer size
+*  needed when calling hipsparseSpMVResidual().
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVResidual_bufferSize(hipsparseHandle_t           handle,
+                                                   hipsparseOperation_t        opA,
+                                                   const void*                 alpha,
+                                                   hipsparseConstSpMatDescr_t  matA,
+                                                   hipsparseConstDnVecDescr_t  vecX,
+                                                   const void*                 beta,
+                                                   const hipsparseDnVecDescr_t vecY,
+                                                   hipsparseConstDnVecDescr_t  vecB,
+                                                   const hipsparseDnVecDescr_t vecR,
+                                                   hipDataType                 computeType,
+                                                   hipsparseSpMVAlg_t          alg,
+                                                   size_t*                     pBufferSizeInBytes);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Compute the sparse matrix vector multiplication followed by a residual and its norm
+*
+*  \details
+*  \p hipsparseSpMVResidual computes
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y, \quad
+*    r := b - y, \quad
+*    result := \|r\|_2,
+*  \f]
+*  in a single pass over \p y, \p b and \p r. \p vecR and \p vecB may point to the same
+*  values, in which case \f$b\f$ is overwritten by the residual.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  opA             matrix operation type.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  matA            matrix descriptor.
+*  @param[in]
+*  vecX            vector descriptor.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[inout]
+*  vecY            vector descriptor.
+*  @param[in]
+*  vecB            vector descriptor of the right-hand side, of the size of \p vecY.
+*  @param[out]
+*  vecR            vector descriptor of the residual, of the size of \p vecY.
+*  @param[out]
+*  result          pointer to the euclidean norm of the residual, of the real type of
+*                  \p computeType, in host or device memory depending on the pointer mode.
+*  @param[in]
+*  computeType     floating point precision for the computation.
+*  @param[in]
+*  alg             SpMV algorithm for the SpMV computation.
+*  @param[out]
+*  externalBuffer  temporary storage buffer allocated by the user.
+*
+*  \retval      HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval      HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p alpha, \p matA, \p vecX, \p beta,
+*               \p vecY, \p vecB, \p vecR, \p result or \p externalBuffer pointer is invalid,
+*               or the sizes of the vectors do not match \f$op(A)\f$.
+*  \retval      HIPSPARSE_STATUS_NOT_SUPPORTED \p computeType is currently not supported.
+*
+*  \note
+*  rocSPARSE has no fused SpMV epilogue, and composing the routine of separate rocSPARSE calls
+*  would make more passes over the vectors than the unfused sequence. The rocSPARSE backend
+*  returns \ref HIPSPARSE_STATUS_NOT_SUPPORTED, use hipsparseSpMV() followed by the dot
+*  product or the residual update instead.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVResidual(hipsparseHandle_t           handle,
+                                        hipsparseOperation_t        opA,
+                                        const void*                 alpha,
+                                        hipsparseConstSpMatDescr_t  matA,
+                                        hipsparseConstDnVecDescr_t  vecX,
+                                        const void*                 beta,
+                                        const hipsparseDnVecDescr_t vecY,
+                                        hipsparseConstDnVecDescr_t  vecB,
+                                        const hipsparseDnVecDescr_t vecR,
+                                        void*                       result,
+                                        hipDataType                 computeType,
+                                        hipsparseSpMVAlg_t          alg,
+                                        void*                       externalBuffer);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Calculate the buffer size required for the sparse matrix multiplication with a dense matrix
 *
@@ -20609,11 +21687,19 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
 *  \par Mixed precisions:
 *  <table>
 *  <caption id="spmm_mixed">Mixed Precisions</caption>
-*  <tr><th>A / B    <th>C         <th>compute_type
-*  <tr><td>HIP_R_8I <td>HIP_R_32I <td>HIP_R_32I
-*  <tr><td>HIP_R_8I <td>HIP_R_32F <td>HIP_R_32F
+*  <tr><th>A / B      <th>C          <th>compute_type
+*  <tr><td>HIP_R_8I   <td>HIP_R_32I  <td>HIP_R_32I
+*  <tr><td>HIP_R_8I   <td>HIP_R_32F  <td>HIP_R_32F
+*  <tr><td>HIP_R_16F  <td>HIP_R_16F  <td>HIP_R_32F
+*  <tr><td>HIP_R_16F  <td>HIP_R_32F  <td>HIP_R_32F
+*  <tr><td>HIP_R_16BF <td>HIP_R_16BF <td>HIP_R_32F
+*  <tr><td>HIP_R_16BF <td>HIP_R_32F  <td>HIP_R_32F
 *  </table>
 *
+*  \note
+*  On the rocSPARSE backend, the HIP_R_16F and HIP_R_16BF value types require rocSPARSE 4.0
+*  or later.
+*
 *  @param[in]
 *  handle          handle to the hipsparse library context queue.
 *  @param[in]
@@ -20811,6 +21897,71 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Specify the mode of a sparse matrix sparse matrix product descriptor
+*  \details
+*  \p hipsparseSpGEMM_setMode sets the \ref hipsparseSpGEMMMode_t of a sparse matrix sparse
+*  matrix product descriptor. It must be called before hipsparseSpGEMM_workEstimation().
+*
+*  In the default mode, hipsparseSpGEMM_compute() computes \f$C\f$ into the two user
+*  allocated buffers and hipsparseSpGEMM_copy() copies it into the arrays of \f$C\f$.
+*
+*  With \ref HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA, the buffer size returned by the first call
+*  to hipsparseSpGEMM_workEstimation() is the only temporary storage needed by all stages.
+*  hipsparseSpGEMM_compute() returns a size of zero for the second buffer and does not
+*  compute anything. The product is then computed by hipsparseSpGEMM_copy() directly into
+*  the column and value arrays of \f$C\f$, once they have been set with
+*  hipsparseCsrSetPointers(). This avoids staging \f$C\f$ in temporary storage and the
+*  copy that follows, which roughly halves the peak memory of large products.
+*
+*  \note
+*  In single arena mode, if \f$C\f$ has a row pointer array when
+*  hipsparseSpGEMM_workEstimation() is called, the row pointers are written directly into
+*  it and the same array must be passed to hipsparseCsrSetPointers() before
+*  hipsparseSpGEMM_copy(). Otherwise, space for the row pointers is reserved in the buffer.
+*
+*  \note
+*  In single arena mode, the values of \f$C\f$ are overwritten and \p beta must be zero.
+*  In host pointer mode, a non-zero \p beta returns \ref HIPSPARSE_STATUS_NOT_SUPPORTED. In
+*  device pointer mode, \p beta is not read back, which would synchronize the stream, and is
+*  taken as zero.
+*
+*  \note
+*  The mode only applies to hipsparseSpGEMM_workEstimation(), hipsparseSpGEMM_compute()
+*  and hipsparseSpGEMM_copy(). With the cuSPARSE backend, the mode is ignored.
+*
+*  @param[in]
+*  descr    SpGEMM descriptor.
+*  @param[in]
+*  mode     \ref HIPSPARSE_SPGEMM_MODE_DEFAULT or \ref HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr is invalid or \p mode is not a valid mode.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGEMM_setMode(hipsparseSpGEMMDescr_t descr, hipsparseSpGEMMMode_t mode);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get the mode of a sparse matrix sparse matrix product descriptor
+*  \details
+*  \p hipsparseSpGEMM_getMode returns the \ref hipsparseSpGEMMMode_t of a sparse matrix
+*  sparse matrix product descriptor.
+*
+*  @param[in]
+*  descr    SpGEMM descriptor.
+*  @param[out]
+*  mode     mode of the descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr or \p mode pointer is invalid.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGEMM_getMode(hipsparseSpGEMMDescr_t descr, hipsparseSpGEMMMode_t* mode);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Work estimation step of the sparse matrix sparse matrix product:
 *  \f[
@@ -28,8 +28,20 @@
 #include <rocsparse/rocsparse.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
@@ -61,6 +73,19 @@
         }                                                                       \
     }
 
+// Half and bfloat16 values are available from rocSPARSE 4.0 on
+#if ROCSPARSE_VERSION_MAJOR >= 4
+#define HIPSPARSE_ROCSPARSE_HALF_TYPES
+#endif
+
+// Numeric only csrgemm is available from rocSPARSE 2.2 on
+#if ROCSPARSE_VERSION_MAJOR > 2 || (ROCSPARSE_VERSION_MAJOR == 2 && ROCSPARSE_VERSION_MINOR >= 2)
+#define HIPSPARSE_ROCSPARSE_CSRGEMM_NUMERIC
+#endif
+
+// Traces and times a public routine depending on HIPSPARSE_LOG_LEVEL, see hipsparse::logScope
+#define HIPSPARSE_LOG_CALL(...) hipsparse::logScope hipsparse_log_scope(__func__, __VA_ARGS__)
+
 // csru2csr struct - to hold permutation array
 struct csru2csrInfo
 {
@@ -68,6 +93,27 @@ struct csru2csrInfo
     int* P    = nullptr;
 };
 
+// csrgemm plan struct - to hold the csrgemm analysis and temporary storage
+struct csrgemmPlan
+{
+    rocsparse_mat_info   info        = nullptr;
+    hipsparseOperation_t transA      = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOperation_t transB      = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    int                  m           = 0;
+    int                  n           = 0;
+    int                  k           = 0;
+    int                  nnzA        = 0;
+    int                  nnzB        = 0;
+    int                  nnzC        = -1;
+    bool                 analysed    = false;
+    size_t               bufferSize  = 0;
+    void*                buffer      = nullptr;
+
+    // Arrays of C the column indices have been computed into by the first numeric call
+    const int* csrRowPtrC = nullptr;
+    const int* csrColIndC = nullptr;
+};
+
 namespace hipsparse
 {
     hipsparseStatus_t hipErrorToHIPSPARSEStatus(hipError_t status)
@@ -462,6 +508,16 @@ namespace hipsparse
             return rocsparse_datatype_f32_c;
         case HIP_C_64F:
             return rocsparse_datatype_f64_c;
+        case HIP_R_8I:
+            return rocsparse_datatype_i8_r;
+        case HIP_R_32I:
+            return rocsparse_datatype_i32_r;
+#ifdef HIPSPARSE_ROCSPARSE_HALF_TYPES
+        case HIP_R_16F:
+            return rocsparse_datatype_f16_r;
+        case HIP_R_16BF:
+            return rocsparse_datatype_bf16_r;
+#endif
         default:
             throw "Non existent hipDataType";
         }
@@ -479,6 +535,16 @@ namespace hipsparse
             return HIP_C_32F;
         case rocsparse_datatype_f64_c:
             return HIP_C_64F;
+        case rocsparse_datatype_i8_r:
+            return HIP_R_8I;
+        case rocsparse_datatype_i32_r:
+            return HIP_R_32I;
+#ifdef HIPSPARSE_ROCSPARSE_HALF_TYPES
+        case rocsparse_datatype_f16_r:
+            return HIP_R_16F;
+        case rocsparse_datatype_bf16_r:
+            return HIP_R_16BF;
+#endif
         default:
             throw "Non existent rocsparse_datatype";
         }
@@ -490,6 +556,8 @@ namespace hipsparse
         {
         // case HIPSPARSE_MV_ALG_DEFAULT:
         case HIPSPARSE_SPMV_ALG_DEFAULT:
+        // Without a tuned choice, auto falls back to the default algorithm
+        case HIPSPARSE_SPMV_ALG_AUTO:
             return rocsparse_spmv_alg_default;
         // case HIPSPARSE_COOMV_ALG:
         case HIPSPARSE_SPMV_COO_ALG1:
@@ -643,6 +711,8 @@ namespace hipsparse
             return rocsparse_format_coo_aos;
         case HIPSPARSE_FORMAT_BLOCKED_ELL:
             return rocsparse_format_bell;
+        case HIPSPARSE_FORMAT_BSR:
+            return rocsparse_format_bsr;
         default:
             throw "Non existent hipsparseFormat_t";
         }
@@ -662,12 +732,651 @@ namespace hipsparse
             return HIPSPARSE_FORMAT_COO_AOS;
         case rocsparse_format_bell:
             return HIPSPARSE_FORMAT_BLOCKED_ELL;
+        case rocsparse_format_bsr:
+            return HIPSPARSE_FORMAT_BSR;
         default:
             throw "Non existent rocsparse_format";
         }
     }
 }
 
+namespace hipsparse
+{
+    // hipsparseHandle_t is a plain rocsparse_handle. State that rocSPARSE does not
+    // manage for us is kept in a side table keyed by the handle, created in
+    // hipsparseCreate() and released in hipsparseDestroy().
+    // Latency histogram bins used by the profile log: < 10us, < 100us, < 1ms, < 10ms,
+    // < 100ms and above
+    static const int logHistogramBins = 6;
+
+    struct logStats
+    {
+        size_t calls{};
+        double totalUs{};
+        double minUs{};
+        double maxUs{};
+        size_t histogram[logHistogramBins]{};
+    };
+
+    struct handleState
+    {
+        // Device workspace pool used by wrappers that need temporary storage
+        void*       workspace{};
+        size_t      workspaceSize{};
+        size_t      workspaceHighWater{};
+        hipStream_t workspaceStream{};
+        hipEvent_t  workspaceEvent{};
+
+        // Whether routines that are blocking in cuSPARSE may skip their synchronization
+        hipsparseExecutionPolicy_t executionPolicy{HIPSPARSE_EXECUTION_POLICY_BLOCKING};
+
+        // Device copy of the constants block, uploaded on first use
+        void* constants{};
+
+        // Per routine statistics gathered with HIPSPARSE_LOG_LEVEL=profile
+        std::map<std::string, logStats> logProfile;
+        hipEvent_t                      logStart{};
+        hipEvent_t                      logStop{};
+    };
+
+    static std::mutex& handleStateMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::unordered_map<hipsparseHandle_t, handleState*>& handleStateMap()
+    {
+        static std::unordered_map<hipsparseHandle_t, handleState*> map;
+        return map;
+    }
+
+    static handleState* getHandleState(hipsparseHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(handleStateMutex());
+
+        auto it = handleStateMap().find(handle);
+        return (it != handleStateMap().end()) ? it->second : nullptr;
+    }
+
+    static size_t alignWorkspaceSize(size_t size)
+    {
+        return ((size - 1) / 256 + 1) * 256;
+    }
+
+    static hipsparseStatus_t releaseWorkspace(handleState* state)
+    {
+        if(state->workspace != nullptr)
+        {
+            // Work that is still queued on the last stream may read from the pool
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(state->workspaceStream));
+            RETURN_IF_HIP_ERROR(hipFree(state->workspace));
+
+            state->workspace     = nullptr;
+            state->workspaceSize = 0;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t
+        reserveWorkspace(handleState* state, hipStream_t stream, size_t size)
+    {
+        if(size <= state->workspaceSize)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        size_t newSize = alignWorkspaceSize(size);
+
+        RETURN_IF_HIPSPARSE_ERROR(releaseWorkspace(state));
+        RETURN_IF_HIP_ERROR(hipMalloc(&state->workspace, newSize));
+
+        state->workspaceSize   = newSize;
+        state->workspaceStream = stream;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Returns a device buffer of at least size bytes that stays valid until the next
+    // workspace request on the same handle. All users of the pool are ordered on the
+    // handle stream, so the buffer can be reused without any synchronization as long
+    // as the stream does not change. When it does, the new stream waits on the old one.
+    static hipsparseStatus_t getWorkspace(hipsparseHandle_t handle, size_t size, void** buffer)
+    {
+        handleState* state = getHandleState(handle);
+        if(state == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        state->workspaceHighWater = std::max(state->workspaceHighWater, size);
+
+        if(state->workspace != nullptr && state->workspaceStream != stream)
+        {
+            if(state->workspaceEvent == nullptr)
+            {
+                RETURN_IF_HIP_ERROR(
+                    hipEventCreateWithFlags(&state->workspaceEvent, hipEventDisableTiming));
+            }
+
+            RETURN_IF_HIP_ERROR(hipEventRecord(state->workspaceEvent, state->workspaceStream));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, state->workspaceEvent, 0));
+        }
+
+        // Grow geometrically so that a slowly increasing request pattern settles
+        // after a few calls instead of reallocating every time
+        if(size > state->workspaceSize)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                reserveWorkspace(state, stream, std::max(size, state->workspaceSize * 3 / 2)));
+        }
+
+        state->workspaceStream = stream;
+
+        *buffer = state->workspace;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // The HIPSPARSE_EXECUTION_POLICY environment variable overrides the policy of all
+    // handles. It is read once, returns false if it is not set or not recognized.
+    static bool getEnvExecutionPolicy(hipsparseExecutionPolicy_t* policy)
+    {
+        static const int envPolicy = []() {
+            const char* env = getenv("HIPSPARSE_EXECUTION_POLICY");
+            if(env == nullptr)
+            {
+                return -1;
+            }
+
+            if(strcmp(env, "blocking") == 0)
+            {
+                return static_cast<int>(HIPSPARSE_EXECUTION_POLICY_BLOCKING);
+            }
+            if(strcmp(env, "async_device") == 0)
+            {
+                return static_cast<int>(HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE);
+            }
+            if(strcmp(env, "async") == 0)
+            {
+                return static_cast<int>(HIPSPARSE_EXECUTION_POLICY_ASYNC);
+            }
+
+            return -1;
+        }();
+
+        if(envPolicy < 0)
+        {
+            return false;
+        }
+
+        *policy = static_cast<hipsparseExecutionPolicy_t>(envPolicy);
+        return true;
+    }
+
+    static hipsparseExecutionPolicy_t getExecutionPolicy(hipsparseHandle_t handle)
+    {
+        hipsparseExecutionPolicy_t policy;
+        if(getEnvExecutionPolicy(&policy))
+        {
+            return policy;
+        }
+
+        handleState* state = getHandleState(handle);
+        return (state != nullptr) ? state->executionPolicy : HIPSPARSE_EXECUTION_POLICY_BLOCKING;
+    }
+
+    // Synchronizes the stream at the end of a routine that is blocking in cuSPARSE,
+    // unless the execution policy of the handle allows to skip it. If
+    // resultFollowsPointerMode is set, the routine writes its result to host memory in
+    // host pointer mode, otherwise all results are written to device memory.
+    static hipsparseStatus_t synchronizeBlocking(hipsparseHandle_t handle,
+                                                 hipStream_t       stream,
+                                                 bool              resultFollowsPointerMode)
+    {
+        switch(getExecutionPolicy(handle))
+        {
+        case HIPSPARSE_EXECUTION_POLICY_ASYNC:
+            return HIPSPARSE_STATUS_SUCCESS;
+
+        case HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE:
+        {
+            if(!resultFollowsPointerMode)
+            {
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+
+            rocsparse_pointer_mode pointer_mode;
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
+
+            if(pointer_mode == rocsparse_pointer_mode_device)
+            {
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+            break;
+        }
+
+        case HIPSPARSE_EXECUTION_POLICY_BLOCKING:
+            break;
+        }
+
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Block of the constants 0, 1 and -1 for the four data types. Every value takes a
+    // slot large enough for a double complex number, ordered by data type, then value.
+    struct constantsBlock
+    {
+        alignas(16) char data[4 * 3 * 16];
+    };
+
+    static const constantsBlock& getHostConstants()
+    {
+        static const constantsBlock block = []() {
+            constantsBlock b{};
+            const int      values[] = {0, 1, -1};
+
+            for(int v = 0; v < 3; ++v)
+            {
+                float            s = static_cast<float>(values[v]);
+                double           d = static_cast<double>(values[v]);
+                hipComplex       c = make_hipComplex(s, 0.0f);
+                hipDoubleComplex z = make_hipDoubleComplex(d, 0.0);
+
+                memcpy(b.data + (0 * 3 + v) * 16, &s, sizeof(s));
+                memcpy(b.data + (1 * 3 + v) * 16, &d, sizeof(d));
+                memcpy(b.data + (2 * 3 + v) * 16, &c, sizeof(c));
+                memcpy(b.data + (3 * 3 + v) * 16, &z, sizeof(z));
+            }
+
+            return b;
+        }();
+
+        return block;
+    }
+
+    static hipsparseStatus_t getConstantOffset(hipDataType dataType, int value, size_t* offset)
+    {
+        size_t type;
+        switch(dataType)
+        {
+        case HIP_R_32F:
+            type = 0;
+            break;
+        case HIP_R_64F:
+            type = 1;
+            break;
+        case HIP_C_32F:
+            type = 2;
+            break;
+        case HIP_C_64F:
+            type = 3;
+            break;
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(value < -1 || value > 1)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // 0, 1, -1
+        size_t slot = (value == -1) ? 2 : value;
+
+        *offset = (type * 3 + slot) * 16;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Returns the constant 0, 1 or -1 of the given data type, as a host or device pointer
+    // depending on the pointer mode of the handle. The device constants are uploaded once
+    // per handle, on first use, so that routines do not have to copy them on every call.
+    static hipsparseStatus_t getConstant(hipsparseHandle_t handle,
+                                         hipDataType       dataType,
+                                         int               value,
+                                         const void**      constant)
+    {
+        size_t offset;
+        RETURN_IF_HIPSPARSE_ERROR(getConstantOffset(dataType, value, &offset));
+
+        rocsparse_pointer_mode pointer_mode;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
+
+        if(pointer_mode == rocsparse_pointer_mode_host)
+        {
+            *constant = getHostConstants().data + offset;
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        handleState* state = getHandleState(handle);
+        if(state == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(state->constants == nullptr)
+        {
+            void* constants;
+            RETURN_IF_HIP_ERROR(hipMalloc(&constants, sizeof(constantsBlock)));
+
+            hipError_t err = hipMemcpy(
+                constants, getHostConstants().data, sizeof(constantsBlock), hipMemcpyHostToDevice);
+            if(err != hipSuccess)
+            {
+                hipFree(constants);
+                return hipErrorToHIPSPARSEStatus(err);
+            }
+
+            state->constants = constants;
+        }
+
+        *constant = static_cast<const char*>(state->constants) + offset;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+namespace hipsparse
+{
+    enum logLevel : int
+    {
+        logLevelTrace   = 1,
+        logLevelBench   = 2,
+        logLevelProfile = 4
+    };
+
+    // HIPSPARSE_LOG_LEVEL holds trace, bench and profile separated by ',' or '|', or the
+    // equivalent bit mask (1, 2, 4). It is read once, when the library is loaded, so that
+    // a disabled log only costs a single test per call.
+    static int readEnvLogLevel()
+    {
+        const char* env = getenv("HIPSPARSE_LOG_LEVEL");
+        if(env == nullptr)
+        {
+            return 0;
+        }
+
+        char* end;
+        long  mask = strtol(env, &end, 0);
+        if(end != env && *end == '\0')
+        {
+            return static_cast<int>(mask) & (logLevelTrace | logLevelBench | logLevelProfile);
+        }
+
+        int               level = 0;
+        std::stringstream list(env);
+        std::string       token;
+        while(std::getline(list, token, ','))
+        {
+            std::stringstream alternatives(token);
+            std::string       name;
+            while(std::getline(alternatives, name, '|'))
+            {
+                if(name == "trace")
+                {
+                    level |= logLevelTrace;
+                }
+                else if(name == "bench")
+                {
+                    level |= logLevelBench;
+                }
+                else if(name == "profile")
+                {
+                    level |= logLevelProfile;
+                }
+            }
+        }
+
+        return level;
+    }
+
+    static const int envLogLevel = readEnvLogLevel();
+
+    // Log lines go to the file named by HIPSPARSE_LOG_PATH, or to stderr
+    static void logWrite(const std::string& line)
+    {
+        static std::mutex    mutex;
+        static std::ofstream file = []() {
+            const char* path = getenv("HIPSPARSE_LOG_PATH");
+            return (path != nullptr) ? std::ofstream(path, std::ios::app) : std::ofstream();
+        }();
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        std::ostream& os = file.is_open() ? static_cast<std::ostream&>(file) : std::cerr;
+        os << line << std::endl;
+    }
+
+    template <typename T, typename std::enable_if<!std::is_pointer<T>::value, int>::type = 0>
+    static void logValue(std::ostream& os, const T& value)
+    {
+        os << value;
+    }
+
+    template <typename T, typename std::enable_if<std::is_pointer<T>::value, int>::type = 0>
+    static void logValue(std::ostream& os, const T& value)
+    {
+        os << static_cast<const void*>(value);
+    }
+
+    static void logValue(std::ostream& os, const hipComplex& value)
+    {
+        os << '(' << hipCrealf(value) << ',' << hipCimagf(value) << ')';
+    }
+
+    static void logValue(std::ostream& os, const hipDoubleComplex& value)
+    {
+        os << '(' << hipCreal(value) << ',' << hipCimag(value) << ')';
+    }
+
+    static void logValues(std::ostream&) {}
+
+    template <typename T, typename... Ts>
+    static void logValues(std::ostream& os, const T& value, const Ts&... values)
+    {
+        os << ',';
+        logValue(os, value);
+        logValues(os, values...);
+    }
+
+    static int& logDepth()
+    {
+        static thread_local int depth = 0;
+        return depth;
+    }
+
+    // Logs a public routine for the lifetime of the object. With trace, the routine and
+    // its arguments are logged on entry. With bench or profile, the routine is enclosed in
+    // events recorded on the handle stream and waits for its completion, its latency is
+    // then logged (bench) or added to the statistics printed by hipsparseDestroy()
+    // (profile). Routines called by other routines are not logged on their own.
+    class logScope
+    {
+    public:
+        template <typename... Ts>
+        logScope(const char* name, hipsparseHandle_t handle, const Ts&... args)
+        {
+            if(envLogLevel != 0)
+            {
+                begin(name, handle, args...);
+            }
+        }
+
+        ~logScope()
+        {
+            if(active)
+            {
+                end();
+            }
+        }
+
+        logScope(const logScope&) = delete;
+        logScope& operator=(const logScope&) = delete;
+
+    private:
+        template <typename... Ts>
+        void begin(const char* name, hipsparseHandle_t handle, const Ts&... args)
+        {
+            active = true;
+
+            if(logDepth()++ != 0)
+            {
+                return;
+            }
+
+            if(envLogLevel & logLevelTrace)
+            {
+                std::ostringstream line;
+                line << name;
+                logValues(line, handle, args...);
+                logWrite(line.str());
+            }
+
+            if(envLogLevel & (logLevelBench | logLevelProfile))
+            {
+                startTimer(name, handle);
+            }
+        }
+
+        void startTimer(const char* name, hipsparseHandle_t handle);
+        void end();
+
+        bool         active{};
+        const char*  routine{};
+        handleState* state{};
+        hipStream_t  stream{};
+    };
+
+    void logScope::startTimer(const char* name, hipsparseHandle_t handle)
+    {
+        handleState* current = getHandleState(handle);
+        if(current == nullptr
+           || rocsparse_get_stream((rocsparse_handle)handle, &stream) != rocsparse_status_success)
+        {
+            return;
+        }
+
+        if(current->logStart == nullptr)
+        {
+            hipEvent_t start;
+            hipEvent_t stop;
+            if(hipEventCreate(&start) != hipSuccess)
+            {
+                return;
+            }
+            if(hipEventCreate(&stop) != hipSuccess)
+            {
+                hipEventDestroy(start);
+                return;
+            }
+
+            current->logStart = start;
+            current->logStop  = stop;
+        }
+
+        if(hipEventRecord(current->logStart, stream) == hipSuccess)
+        {
+            routine = name;
+            state   = current;
+        }
+    }
+
+    void logScope::end()
+    {
+        --logDepth();
+
+        float ms;
+        if(state == nullptr || hipEventRecord(state->logStop, stream) != hipSuccess
+           || hipEventSynchronize(state->logStop) != hipSuccess
+           || hipEventElapsedTime(&ms, state->logStart, state->logStop) != hipSuccess)
+        {
+            return;
+        }
+
+        double us = 1e3 * ms;
+
+        if(envLogLevel & logLevelBench)
+        {
+            std::ostringstream line;
+            line << routine << ",time_us," << us;
+            logWrite(line.str());
+        }
+
+        if(envLogLevel & logLevelProfile)
+        {
+            logStats& stats = state->logProfile[routine];
+
+            stats.minUs = (stats.calls == 0) ? us : std::min(stats.minUs, us);
+            stats.maxUs = std::max(stats.maxUs, us);
+            stats.totalUs += us;
+            ++stats.calls;
+
+            int    bin   = 0;
+            double bound = 10.0;
+            while(bin < logHistogramBins - 1 && us >= bound)
+            {
+                ++bin;
+                bound *= 10.0;
+            }
+            ++stats.histogram[bin];
+        }
+    }
+
+    // Prints the routines recorded with profile, ordered by total time
+    static void logProfileSummary(hipsparseHandle_t handle, const handleState& state)
+    {
+        if(state.logProfile.empty())
+        {
+            return;
+        }
+
+        std::vector<std::pair<std::string, logStats>> routines(state.logProfile.begin(),
+                                                               state.logProfile.end());
+        std::sort(routines.begin(),
+                  routines.end(),
+                  [](const std::pair<std::string, logStats>& a,
+                     const std::pair<std::string, logStats>& b) {
+                      return a.second.totalUs > b.second.totalUs;
+                  });
+
+        std::ostringstream summary;
+        summary << "hipSPARSE profile of handle " << static_cast<const void*>(handle) << '\n';
+        summary << std::left << std::setw(40) << "routine" << std::right << std::setw(8)
+                << "calls" << std::setw(14) << "total us" << std::setw(12) << "mean us"
+                << std::setw(12) << "min us" << std::setw(12) << "max us" << std::setw(8)
+                << "<10us" << std::setw(8) << "<100us" << std::setw(8) << "<1ms" << std::setw(8)
+                << "<10ms" << std::setw(8) << "<100ms" << std::setw(8) << ">=100ms";
+
+        summary << std::fixed << std::setprecision(2);
+        for(const auto& routine : routines)
+        {
+            const logStats& stats = routine.second;
+
+            summary << '\n'
+                    << std::left << std::setw(40) << routine.first << std::right << std::setw(8)
+                    << stats.calls << std::setw(14) << stats.totalUs << std::setw(12)
+                    << stats.totalUs / stats.calls << std::setw(12) << stats.minUs
+                    << std::setw(12) << stats.maxUs;
+
+            for(int bin = 0; bin < logHistogramBins; ++bin)
+            {
+                summary << std::setw(8) << stats.histogram[bin];
+            }
+        }
+
+        logWrite(summary.str());
+    }
+}
+
 hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
 {
     // Check if handle is valid
@@ -686,11 +1395,54 @@ hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
         retval = hipsparse::rocSPARSEStatusToHIPStatus(
             rocsparse_create_handle((rocsparse_handle*)handle));
     }
+
+    if(retval == HIPSPARSE_STATUS_SUCCESS)
+    {
+        std::lock_guard<std::mutex> lock(hipsparse::handleStateMutex());
+        hipsparse::handleStateMap()[*handle] = new hipsparse::handleState;
+    }
+
     return retval;
 }
 
 hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
 {
+    hipsparse::handleState* state = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(hipsparse::handleStateMutex());
+
+        auto it = hipsparse::handleStateMap().find(handle);
+        if(it != hipsparse::handleStateMap().end())
+        {
+            state = it->second;
+            hipsparse::handleStateMap().erase(it);
+        }
+    }
+
+    if(state != nullptr)
+    {
+        hipsparse::logProfileSummary(handle, *state);
+        hipsparse::releaseWorkspace(state);
+
+        if(state->workspaceEvent != nullptr)
+        {
+            hipEventDestroy(state->workspaceEvent);
+        }
+
+        if(state->constants != nullptr)
+        {
+            hipFree(state->constants);
+        }
+
+        if(state->logStart != nullptr)
+        {
+            hipEventDestroy(state->logStart);
+            hipEventDestroy(state->logStop);
+        }
+
+        delete state;
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_destroy_handle((rocsparse_handle)handle));
 }
@@ -707,6 +1459,8 @@ const char* hipsparseGetErrorString(hipsparseStatus_t status)
 
 hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
 {
+    HIPSPARSE_LOG_CALL(handle, version);
+
     if(handle == nullptr)
     {
         return HIPSPARSE_STATUS_NOT_INITIALIZED;
@@ -719,6 +1473,8 @@ hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
 
 hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
 {
+    HIPSPARSE_LOG_CALL(handle, rev);
+
     // Get hipSPARSE revision
     if(handle == nullptr)
     {
@@ -757,34 +1513,140 @@ hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
 
 hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
 {
+    HIPSPARSE_LOG_CALL(handle, streamId);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_set_stream((rocsparse_handle)handle, streamId));
 }
 
 hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
 {
+    HIPSPARSE_LOG_CALL(handle, streamId);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_get_stream((rocsparse_handle)handle, streamId));
 }
 
 hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
 {
+    HIPSPARSE_LOG_CALL(handle, mode);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_pointer_mode(
         (rocsparse_handle)handle, hipsparse::hipPtrModeToHCCPtrMode(mode)));
 }
 
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
 {
+    HIPSPARSE_LOG_CALL(handle, mode);
+
     rocsparse_pointer_mode_ rocsparse_mode;
     rocsparse_status status = rocsparse_get_pointer_mode((rocsparse_handle)handle, &rocsparse_mode);
     *mode                   = hipsparse::HCCPtrModeToHIPPtrMode(rocsparse_mode);
     return hipsparse::rocSPARSEStatusToHIPStatus(status);
 }
 
-hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
+hipsparseStatus_t hipsparseSetWorkspacePoolSize(hipsparseHandle_t handle, size_t size)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_descr((rocsparse_mat_descr*)descrA));
+    HIPSPARSE_LOG_CALL(handle, size);
+
+    hipsparse::handleState* state = hipsparse::getHandleState(handle);
+    if(state == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    return hipsparse::reserveWorkspace(state, stream, size);
+}
+
+hipsparseStatus_t
+    hipsparseGetWorkspacePoolInfo(hipsparseHandle_t handle, size_t* size, size_t* highWaterMark)
+{
+    HIPSPARSE_LOG_CALL(handle, size, highWaterMark);
+
+    hipsparse::handleState* state = hipsparse::getHandleState(handle);
+    if(state == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(size == nullptr || highWaterMark == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *size          = state->workspaceSize;
+    *highWaterMark = state->workspaceHighWater;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseTrimWorkspacePool(hipsparseHandle_t handle)
+{
+    HIPSPARSE_LOG_CALL(handle);
+
+    hipsparse::handleState* state = hipsparse::getHandleState(handle);
+    if(state == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::releaseWorkspace(state));
+
+    state->workspaceHighWater = 0;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetExecutionPolicy(hipsparseHandle_t          handle,
+                                              hipsparseExecutionPolicy_t policy)
+{
+    HIPSPARSE_LOG_CALL(handle, policy);
+
+    hipsparse::handleState* state = hipsparse::getHandleState(handle);
+    if(state == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(policy != HIPSPARSE_EXECUTION_POLICY_BLOCKING
+       && policy != HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE
+       && policy != HIPSPARSE_EXECUTION_POLICY_ASYNC)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    state->executionPolicy = policy;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetExecutionPolicy(hipsparseHandle_t           handle,
+                                              hipsparseExecutionPolicy_t* policy)
+{
+    HIPSPARSE_LOG_CALL(handle, policy);
+
+    if(hipsparse::getHandleState(handle) == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(policy == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *policy = hipsparse::getExecutionPolicy(handle);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
+{
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_descr((rocsparse_mat_descr*)descrA));
 }
 
 hipsparseStatus_t hipsparseDestroyMatDescr(hipsparseMatDescr_t descrA)
@@ -977,6 +1839,45 @@ hipsparseStatus_t hipsparseDestroyCsrgemm2Info(csrgemm2Info_t info)
         rocsparse_destroy_mat_info((rocsparse_mat_info)info));
 }
 
+hipsparseStatus_t hipsparseCreateCsrgemmPlan(csrgemmPlan_t* plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *plan = new csrgemmPlan;
+
+    rocsparse_status status = rocsparse_create_mat_info(&(*plan)->info);
+
+    if(status != rocsparse_status_success)
+    {
+        delete *plan;
+        *plan = nullptr;
+    }
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+}
+
+hipsparseStatus_t hipsparseDestroyCsrgemmPlan(csrgemmPlan_t plan)
+{
+    // Check if plan structure has been created
+    if(plan != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(plan->info));
+
+        // Check if temporary storage is allocated
+        if(plan->buffer != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(plan->buffer));
+        }
+
+        delete plan;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCreatePruneInfo(pruneInfo_t* info)
 {
     return hipsparse::rocSPARSEStatusToHIPStatus(
@@ -1031,6 +1932,8 @@ hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
                                   float*               y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_saxpyi(
         (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1043,6 +1946,8 @@ hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
                                   double*              y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_daxpyi(
         (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1055,6 +1960,8 @@ hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
                                   hipComplex*          y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_caxpyi((rocsparse_handle)handle,
                          nnz,
@@ -1073,6 +1980,8 @@ hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       y,
                                   hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zaxpyi((rocsparse_handle)handle,
                          nnz,
@@ -1091,6 +2000,8 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                  float*               result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1104,8 +2015,8 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                               result,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1118,6 +2029,8 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                  double*              result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1131,8 +2044,8 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                               result,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1145,6 +2058,8 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                  hipComplex*          result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1158,8 +2073,8 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                               (rocsparse_float_complex*)result,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1172,6 +2087,8 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       result,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1185,8 +2102,8 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                               (rocsparse_double_complex*)result,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1199,6 +2116,8 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                   hipComplex*          result,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1212,8 +2131,8 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                                (rocsparse_float_complex*)result,
                                                hipsparse::hipBaseToHCCBase(idxBase)));
 
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1226,6 +2145,8 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       result,
                                   hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1239,8 +2160,8 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                                (rocsparse_double_complex*)result,
                                                hipsparse::hipBaseToHCCBase(idxBase)));
 
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1252,6 +2173,8 @@ hipsparseStatus_t hipsparseSgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthr(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1263,6 +2186,8 @@ hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthr(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1274,6 +2199,8 @@ hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgthr((rocsparse_handle)handle,
                         nnz,
@@ -1290,6 +2217,8 @@ hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
                                  const int*              xInd,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgthr((rocsparse_handle)handle,
                         nnz,
@@ -1306,6 +2235,8 @@ hipsparseStatus_t hipsparseSgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthrz(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1317,6 +2248,8 @@ hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthrz(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1328,6 +2261,8 @@ hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgthrz((rocsparse_handle)handle,
                          nnz,
@@ -1344,6 +2279,8 @@ hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgthrz((rocsparse_handle)handle,
                          nnz,
@@ -1362,6 +2299,8 @@ hipsparseStatus_t hipsparseSroti(hipsparseHandle_t    handle,
                                  const float*         s,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, c, s, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sroti(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1375,6 +2314,8 @@ hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
                                  const double*        s,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, c, s, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_droti(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1386,6 +2327,8 @@ hipsparseStatus_t hipsparseSsctr(hipsparseHandle_t    handle,
                                  float*               y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_ssctr(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1397,6 +2340,8 @@ hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
                                  double*              y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsctr(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1408,6 +2353,8 @@ hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
                                  hipComplex*          y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csctr((rocsparse_handle)handle,
                         nnz,
@@ -1424,6 +2371,8 @@ hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       y,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, nnz, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zsctr((rocsparse_handle)handle,
                         nnz,
@@ -1447,6 +2396,20 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -1478,6 +2441,20 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -1509,6 +2486,20 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -1540,6 +2531,20 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -1560,6 +2565,8 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle, csrsv2Info_t info, int* position)
 {
+    HIPSPARSE_LOG_CALL(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1585,6 +2592,17 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1620,6 +2638,17 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1655,6 +2684,17 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1690,6 +2730,17 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1725,6 +2776,17 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -1749,6 +2811,17 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -1773,6 +2846,17 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -1797,6 +2881,17 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -1822,6 +2917,18 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1859,6 +2966,18 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1896,6 +3015,18 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1933,6 +3064,18 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1973,6 +3116,21 @@ hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       f,
+                       x,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2005,6 +3163,21 @@ hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       f,
+                       x,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2037,6 +3210,21 @@ hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       f,
+                       x,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2069,6 +3257,21 @@ hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       f,
+                       x,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2095,6 +3298,8 @@ hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_LOG_CALL(handle, transA, alpha, descrA, hybA, x, beta, y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_shybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2115,6 +3320,8 @@ hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_LOG_CALL(handle, transA, alpha, descrA, hybA, x, beta, y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dhybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2135,6 +3342,8 @@ hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_LOG_CALL(handle, transA, alpha, descrA, hybA, x, beta, y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_chybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2155,6 +3364,8 @@ hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_LOG_CALL(handle, transA, alpha, descrA, hybA, x, beta, y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zhybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2182,6 +3393,22 @@ hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       mb,
+                       nb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -2217,6 +3444,22 @@ hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       mb,
+                       nb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -2252,6 +3495,22 @@ hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       mb,
+                       nb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -2287,6 +3546,22 @@ hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       mb,
+                       nb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -2325,6 +3600,25 @@ hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
                                    const float*              beta,
                                    float*                    y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       trans,
+                       sizeOfMask,
+                       mb,
+                       nb,
+                       nnzb,
+                       alpha,
+                       descr,
+                       bsrVal,
+                       bsrMaskPtr,
+                       bsrRowPtr,
+                       bsrEndPtr,
+                       bsrColInd,
+                       blockDim,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -2365,6 +3659,25 @@ hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
                                    const double*             beta,
                                    double*                   y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       trans,
+                       sizeOfMask,
+                       mb,
+                       nb,
+                       nnzb,
+                       alpha,
+                       descr,
+                       bsrVal,
+                       bsrMaskPtr,
+                       bsrRowPtr,
+                       bsrEndPtr,
+                       bsrColInd,
+                       blockDim,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -2405,6 +3718,25 @@ hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
                                    const hipComplex*         beta,
                                    hipComplex*               y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       trans,
+                       sizeOfMask,
+                       mb,
+                       nb,
+                       nnzb,
+                       alpha,
+                       descr,
+                       bsrVal,
+                       bsrMaskPtr,
+                       bsrRowPtr,
+                       bsrEndPtr,
+                       bsrColInd,
+                       blockDim,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -2445,6 +3777,25 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
                                    const hipDoubleComplex*   beta,
                                    hipDoubleComplex*         y)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       trans,
+                       sizeOfMask,
+                       mb,
+                       nb,
+                       nnzb,
+                       alpha,
+                       descr,
+                       bsrVal,
+                       bsrMaskPtr,
+                       bsrRowPtr,
+                       bsrEndPtr,
+                       bsrColInd,
+                       blockDim,
+                       x,
+                       beta,
+                       y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -2469,6 +3820,8 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrsv2_zeroPivot(hipsparseHandle_t handle, bsrsv2Info_t info, int* position)
 {
+    HIPSPARSE_LOG_CALL(handle, info, position);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_bsrsv_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 }
@@ -2486,6 +3839,19 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2525,6 +3891,19 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2564,6 +3943,19 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2603,6 +3995,19 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2642,6 +4047,19 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -2670,6 +4088,19 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -2698,6 +4129,19 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -2726,6 +4170,19 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -2755,6 +4212,20 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -2786,6 +4257,20 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -2817,6 +4302,20 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -2848,6 +4347,20 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -2882,6 +4395,23 @@ hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       f,
+                       x,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -2918,6 +4448,23 @@ hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       f,
+                       x,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -2954,6 +4501,23 @@ hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       f,
+                       x,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -2990,6 +4554,23 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       transA,
+                       mb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       f,
+                       x,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -3016,6 +4597,8 @@ hipsparseStatus_t hipsparseSgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3043,6 +4626,8 @@ hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3070,6 +4655,8 @@ hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3097,6 +4684,8 @@ hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3132,6 +4721,21 @@ hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       alpha,
+                       A,
+                       lda,
+                       nnz,
+                       x,
+                       xInd,
+                       beta,
+                       y,
+                       idxBase,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3164,6 +4768,21 @@ hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       alpha,
+                       A,
+                       lda,
+                       nnz,
+                       x,
+                       xInd,
+                       beta,
+                       y,
+                       idxBase,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3196,6 +4815,21 @@ hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       alpha,
+                       A,
+                       lda,
+                       nnz,
+                       x,
+                       xInd,
+                       beta,
+                       y,
+                       idxBase,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3228,6 +4862,21 @@ hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
                                   hipsparseIndexBase_t    idxBase,
                                   void*                   pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       alpha,
+                       A,
+                       lda,
+                       nnz,
+                       x,
+                       xInd,
+                       beta,
+                       y,
+                       idxBase,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3265,6 +4914,26 @@ hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transB,
+                       mb,
+                       n,
+                       kb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3307,6 +4976,26 @@ hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transB,
+                       mb,
+                       n,
+                       kb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3349,6 +5038,26 @@ hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transB,
+                       mb,
+                       n,
+                       kb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3391,6 +5100,26 @@ hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transB,
+                       mb,
+                       n,
+                       kb,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3430,6 +5159,23 @@ hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3467,6 +5213,23 @@ hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3504,6 +5267,23 @@ hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3541,6 +5321,23 @@ hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3579,6 +5376,24 @@ hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
                                    float*                    C,
                                    int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3617,6 +5432,24 @@ hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
                                    double*                   C,
                                    int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3655,6 +5488,24 @@ hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
                                    hipComplex*               C,
                                    int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3693,6 +5544,24 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
                                    hipDoubleComplex*         C,
                                    int                       ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       beta,
+                       C,
+                       ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3716,6 +5585,8 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrsm2_zeroPivot(hipsparseHandle_t handle, bsrsm2Info_t info, int* position)
 {
+    HIPSPARSE_LOG_CALL(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse bsrsm2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -3745,6 +5616,21 @@ hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3788,6 +5674,21 @@ hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3831,6 +5732,21 @@ hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3874,6 +5790,21 @@ hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3918,6 +5849,22 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3953,6 +5900,22 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3988,6 +5951,22 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4023,6 +6002,22 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4063,6 +6058,27 @@ hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4107,6 +6123,27 @@ hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4151,6 +6188,27 @@ hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4195,6 +6253,27 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       transA,
+                       transX,
+                       mb,
+                       nrhs,
+                       nnzb,
+                       alpha,
+                       descrA,
+                       bsrSortedValA,
+                       bsrSortedRowPtrA,
+                       bsrSortedColIndA,
+                       blockDim,
+                       info,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4221,6 +6300,8 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrsm2_zeroPivot(hipsparseHandle_t handle, csrsm2Info_t info, int* position)
 {
+    HIPSPARSE_LOG_CALL(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse csrsm2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -4253,6 +6334,24 @@ hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -4290,6 +6389,24 @@ hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -4327,6 +6444,24 @@ hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -4364,6 +6499,24 @@ hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -4401,6 +6554,24 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4439,6 +6610,24 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4477,6 +6666,24 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4515,6 +6722,24 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4553,6 +6778,24 @@ hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4590,6 +6833,24 @@ hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4627,6 +6888,24 @@ hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4664,6 +6943,24 @@ hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       algo,
+                       transA,
+                       transB,
+                       m,
+                       nrhs,
+                       nnz,
+                       alpha,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       B,
+                       ldb,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4698,6 +6995,21 @@ hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
                                   float*            C,
                                   int               ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       A,
+                       lda,
+                       cscValB,
+                       cscColPtrB,
+                       cscRowIndB,
+                       beta,
+                       C,
+                       ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4746,6 +7058,21 @@ hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
                                   double*           C,
                                   int               ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       A,
+                       lda,
+                       cscValB,
+                       cscColPtrB,
+                       cscRowIndB,
+                       beta,
+                       C,
+                       ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4794,6 +7121,21 @@ hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
                                   hipComplex*       C,
                                   int               ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       A,
+                       lda,
+                       cscValB,
+                       cscColPtrB,
+                       cscRowIndB,
+                       beta,
+                       C,
+                       ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -4842,6 +7184,21 @@ hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       C,
                                   int                     ldc)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       alpha,
+                       A,
+                       lda,
+                       cscValB,
+                       cscColPtrB,
+                       cscRowIndB,
+                       beta,
+                       C,
+                       ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -4890,6 +7247,21 @@ hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       nnzA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrRowPtrC,
+                       nnzTotalDevHostPtr);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                               m,
@@ -4927,6 +7299,26 @@ hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgeam((rocsparse_handle)handle,
                            m,
@@ -4969,6 +7361,26 @@ hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5011,6 +7423,26 @@ hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
@@ -5053,6 +7485,26 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5096,6 +7548,27 @@ hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrSortedValB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedValC,
+                       csrSortedRowPtrC,
+                       csrSortedColIndC,
+                       pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5122,6 +7595,27 @@ hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrSortedValB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedValC,
+                       csrSortedRowPtrC,
+                       csrSortedColIndC,
+                       pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5148,6 +7642,27 @@ hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrSortedValB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedValC,
+                       csrSortedRowPtrC,
+                       csrSortedColIndC,
+                       pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5174,6 +7689,27 @@ hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrSortedValB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedValC,
+                       csrSortedRowPtrC,
+                       csrSortedColIndC,
+                       pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5195,6 +7731,22 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                                         int*                      nnzTotalDevHostPtr,
                                         void*                     workspace)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       nnzA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       descrB,
+                       nnzB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedRowPtrC,
+                       nnzTotalDevHostPtr,
+                       workspace);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                               m,
@@ -5233,6 +7785,27 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrSortedValB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedValC,
+                       csrSortedRowPtrC,
+                       csrSortedColIndC,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgeam((rocsparse_handle)handle,
                            m,
@@ -5276,6 +7849,27 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrSortedValB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedValC,
+                       csrSortedRowPtrC,
+                       csrSortedColIndC,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5319,6 +7913,27 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrSortedValB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedValC,
+                       csrSortedRowPtrC,
+                       csrSortedColIndC,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
@@ -5362,6 +7977,27 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       beta,
+                       descrB,
+                       nnzB,
+                       csrSortedValB,
+                       csrSortedRowPtrB,
+                       csrSortedColIndB,
+                       descrC,
+                       csrSortedValC,
+                       csrSortedRowPtrC,
+                       csrSortedColIndC,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5402,6 +8038,24 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrRowPtrC,
+                       nnzTotalDevHostPtr);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5411,36 +8065,13 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    hipDoubleComplex  one = make_hipDoubleComplex(1.0, 0.0);
-    hipDoubleComplex* alpha;
+    hipDoubleComplex  one   = make_hipDoubleComplex(1.0, 0.0);
+    hipDoubleComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipDoubleComplex*)malloc(sizeof(hipDoubleComplex));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
-    }
-
-    // Obtain temporary buffer size
+    // Obtain temporary buffer size (alpha is not dereferenced here, only checked
+    // against nullptr, so the host value can be used in either pointer mode)
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
                                        hipsparse::hipOperationToHCCOperation(transA),
@@ -5465,24 +8096,19 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                                        info,
                                        &buffer_size));
 
-    if(status != HIPSPARSE_STATUS_SUCCESS)
+    if(status == HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
+        // Obtain temporary buffer from the handle workspace pool
+        status = hipsparse::getWorkspace(handle, buffer_size, &temp_buffer);
+    }
 
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
-
     // Determine nnz
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgemm_nnz((rocsparse_handle)handle,
@@ -5509,17 +8135,6 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                               info,
                               temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -5553,6 +8168,27 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5562,35 +8198,13 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    float  one = 1.0f;
-    float* alpha;
+    float  one   = 1.0f;
+    float* alpha = &one;
 
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (float*)malloc(sizeof(float));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(float)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(float), hipMemcpyHostToDevice));
-    }
-
-    // Obtain temporary buffer size
+    // Obtain temporary buffer size (alpha is not dereferenced here, only checked
+    // against nullptr, so the host value can be used in either pointer mode)
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgemm_buffer_size((rocsparse_handle)handle,
                                        hipsparse::hipOperationToHCCOperation(transA),
@@ -5615,24 +8229,25 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                                        info,
                                        &buffer_size));
 
-    if(status != HIPSPARSE_STATUS_SUCCESS)
+    if(status == HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
+        // Obtain temporary buffer from the handle workspace pool
+        status = hipsparse::getWorkspace(handle, buffer_size, &temp_buffer);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        // Use the cached alpha = 1.0 that matches the pointer mode
+        status = hipsparse::getConstant(handle, HIP_R_32F, 1, (const void**)&alpha);
+    }
 
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
-
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgemm((rocsparse_handle)handle,
@@ -5665,17 +8280,6 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -5709,6 +8313,27 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5718,35 +8343,13 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    double  one = 1.0;
-    double* alpha;
+    double  one   = 1.0;
+    double* alpha = &one;
 
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (double*)malloc(sizeof(double));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(double)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(double), hipMemcpyHostToDevice));
-    }
-
-    // Obtain temporary buffer size
+    // Obtain temporary buffer size (alpha is not dereferenced here, only checked
+    // against nullptr, so the host value can be used in either pointer mode)
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgemm_buffer_size((rocsparse_handle)handle,
                                        hipsparse::hipOperationToHCCOperation(transA),
@@ -5771,24 +8374,25 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                                        info,
                                        &buffer_size));
 
-    if(status != HIPSPARSE_STATUS_SUCCESS)
+    if(status == HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
+        // Obtain temporary buffer from the handle workspace pool
+        status = hipsparse::getWorkspace(handle, buffer_size, &temp_buffer);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        // Use the cached alpha = 1.0 that matches the pointer mode
+        status = hipsparse::getConstant(handle, HIP_R_64F, 1, (const void**)&alpha);
+    }
 
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
-
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgemm((rocsparse_handle)handle,
@@ -5821,17 +8425,6 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -5865,6 +8458,27 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5874,35 +8488,13 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    hipComplex  one = make_hipComplex(1.0f, 0.0f);
-    hipComplex* alpha;
+    hipComplex  one   = make_hipComplex(1.0f, 0.0f);
+    hipComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipComplex*)malloc(sizeof(hipComplex));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipComplex)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(hipComplex), hipMemcpyHostToDevice));
-    }
-
-    // Obtain temporary buffer size
+    // Obtain temporary buffer size (alpha is not dereferenced here, only checked
+    // against nullptr, so the host value can be used in either pointer mode)
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm_buffer_size((rocsparse_handle)handle,
                                        hipsparse::hipOperationToHCCOperation(transA),
@@ -5927,24 +8519,25 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                                        info,
                                        &buffer_size));
 
-    if(status != HIPSPARSE_STATUS_SUCCESS)
+    if(status == HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
+        // Obtain temporary buffer from the handle workspace pool
+        status = hipsparse::getWorkspace(handle, buffer_size, &temp_buffer);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        // Use the cached alpha = 1.0 that matches the pointer mode
+        status = hipsparse::getConstant(handle, HIP_C_32F, 1, (const void**)&alpha);
+    }
 
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
-
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm((rocsparse_handle)handle,
@@ -5977,17 +8570,6 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -6021,6 +8603,27 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -6030,36 +8633,13 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    hipDoubleComplex  one = make_hipDoubleComplex(1.0, 0.0);
-    hipDoubleComplex* alpha;
+    hipDoubleComplex  one   = make_hipDoubleComplex(1.0, 0.0);
+    hipDoubleComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipDoubleComplex*)malloc(sizeof(hipDoubleComplex));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
-    }
-
-    // Obtain temporary buffer size
+    // Obtain temporary buffer size (alpha is not dereferenced here, only checked
+    // against nullptr, so the host value can be used in either pointer mode)
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
                                        hipsparse::hipOperationToHCCOperation(transA),
@@ -6084,24 +8664,25 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                                        info,
                                        &buffer_size));
 
-    if(status != HIPSPARSE_STATUS_SUCCESS)
+    if(status == HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
+        // Obtain temporary buffer from the handle workspace pool
+        status = hipsparse::getWorkspace(handle, buffer_size, &temp_buffer);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        // Use the cached alpha = 1.0 that matches the pointer mode
+        status = hipsparse::getConstant(handle, HIP_C_64F, 1, (const void**)&alpha);
+    }
 
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
-
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm((rocsparse_handle)handle,
@@ -6134,25 +8715,723 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
+    if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        free(alpha);
+        rocsparse_destroy_mat_info(info);
+
+        return status;
     }
-    else
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace hipsparse
+{
+    static hipsparseStatus_t reserveCsrgemmPlan(csrgemmPlan_t plan, size_t bufferSize)
     {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
+        if(plan->buffer != nullptr && plan->bufferSize >= bufferSize)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(plan->buffer != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(plan->buffer));
+
+            plan->buffer     = nullptr;
+            plan->bufferSize = 0;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMalloc(&plan->buffer, bufferSize));
+        plan->bufferSize = bufferSize;
+
+        return HIPSPARSE_STATUS_SUCCESS;
     }
 
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+    static hipsparseStatus_t checkCsrgemmPlan(csrgemmPlan_t        plan,
+                                              hipsparseOperation_t transA,
+                                              hipsparseOperation_t transB,
+                                              int                  m,
+                                              int                  n,
+                                              int                  k,
+                                              int                  nnzA,
+                                              int                  nnzB)
+    {
+        // The plan must have been analysed for the very same product
+        if(plan == nullptr || !plan->analysed || plan->transA != transA || plan->transB != transB
+           || plan->m != m || plan->n != n || plan->k != k || plan->nnzA != nnzA
+           || plan->nnzB != nnzB)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
 
-    if(status != HIPSPARSE_STATUS_SUCCESS)
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+#ifdef HIPSPARSE_ROCSPARSE_CSRGEMM_NUMERIC
+    // Whether the column indices of C have already been computed into these arrays, in which
+    // case only the values of C need to be recomputed
+    static bool
+        hasCsrgemmPlanPattern(csrgemmPlan_t plan, const int* csrRowPtrC, const int* csrColIndC)
     {
-        rocsparse_destroy_mat_info(info);
+        return plan->csrRowPtrC == csrRowPtrC && plan->csrColIndC == csrColIndC
+               && csrColIndC != nullptr;
+    }
 
-        return status;
+    // The number of non-zeros of C, which the numeric only phase takes on the host. In device
+    // pointer mode, it is read back from the row pointers of C once, by the first numeric only
+    // call, rather than synchronizing the nnz phase.
+    static hipsparseStatus_t getCsrgemmPlanNnz(hipsparseHandle_t         handle,
+                                               csrgemmPlan_t             plan,
+                                               const hipsparseMatDescr_t descrC)
+    {
+        if(plan->nnzC >= 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        int end;
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &end, plan->csrRowPtrC + plan->m, sizeof(int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        plan->nnzC = end - hipsparseGetMatIndexBase(descrC);
+
+        return HIPSPARSE_STATUS_SUCCESS;
     }
+#endif
+}
 
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info));
+hipsparseStatus_t hipsparseXcsrgemmNnzWithPlan(hipsparseHandle_t         handle,
+                                               hipsparseOperation_t      transA,
+                                               hipsparseOperation_t      transB,
+                                               int                       m,
+                                               int                       n,
+                                               int                       k,
+                                               const hipsparseMatDescr_t descrA,
+                                               int                       nnzA,
+                                               const int*                csrRowPtrA,
+                                               const int*                csrColIndA,
+                                               const hipsparseMatDescr_t descrB,
+                                               int                       nnzB,
+                                               const int*                csrRowPtrB,
+                                               const int*                csrColIndB,
+                                               const hipsparseMatDescr_t descrC,
+                                               int*                      csrRowPtrC,
+                                               int*                      nnzTotalDevHostPtr,
+                                               csrgemmPlan_t             plan)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrRowPtrC,
+                       nnzTotalDevHostPtr,
+                       plan);
+
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Any previous analysis is discarded
+    plan->analysed   = false;
+    plan->csrRowPtrC = nullptr;
+    plan->csrColIndC = nullptr;
+
+    // Initialize alpha = 1.0
+    hipDoubleComplex one = make_hipDoubleComplex(1.0, 0.0);
+
+    // Obtain temporary buffer size and analyse the sparsity patterns (alpha is not
+    // dereferenced here, only checked against nullptr). The size is queried for the largest
+    // data type, so that the buffer can be used by the numeric phase in any data type.
+    size_t buffer_size;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
+                                       hipsparse::hipOperationToHCCOperation(transA),
+                                       hipsparse::hipOperationToHCCOperation(transB),
+                                       m,
+                                       n,
+                                       k,
+                                       (const rocsparse_double_complex*)&one,
+                                       (rocsparse_mat_descr)descrA,
+                                       nnzA,
+                                       csrRowPtrA,
+                                       csrColIndA,
+                                       (rocsparse_mat_descr)descrB,
+                                       nnzB,
+                                       csrRowPtrB,
+                                       csrColIndB,
+                                       nullptr,
+                                       nullptr,
+                                       0,
+                                       nullptr,
+                                       nullptr,
+                                       plan->info,
+                                       &buffer_size));
+
+    // Temporary storage is owned by the plan, it is kept for the numeric phase
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::reserveCsrgemmPlan(plan, buffer_size));
+
+    // Determine nnz
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz((rocsparse_handle)handle,
+                                                    hipsparse::hipOperationToHCCOperation(transA),
+                                                    hipsparse::hipOperationToHCCOperation(transB),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    (rocsparse_mat_descr)descrA,
+                                                    nnzA,
+                                                    csrRowPtrA,
+                                                    csrColIndA,
+                                                    (rocsparse_mat_descr)descrB,
+                                                    nnzB,
+                                                    csrRowPtrB,
+                                                    csrColIndB,
+                                                    nullptr,
+                                                    0,
+                                                    nullptr,
+                                                    nullptr,
+                                                    (rocsparse_mat_descr)descrC,
+                                                    csrRowPtrC,
+                                                    nnzTotalDevHostPtr,
+                                                    plan->info,
+                                                    plan->buffer));
+
+    // The number of non-zeros of C is needed by the numeric phase. In device pointer mode, it
+    // is only read back when needed, see hipsparse::getCsrgemmPlanNnz()
+    hipsparsePointerMode_t pointer_mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &pointer_mode));
+    plan->nnzC = (pointer_mode == HIPSPARSE_POINTER_MODE_HOST) ? *nnzTotalDevHostPtr : -1;
+
+    plan->transA   = transA;
+    plan->transB   = transB;
+    plan->m        = m;
+    plan->n        = n;
+    plan->k        = k;
+    plan->nnzA     = nnzA;
+    plan->nnzB     = nnzB;
+    plan->analysed = true;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseScsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const float*              csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const float*              csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            float*                    csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       plan);
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::checkCsrgemmPlan(plan, transA, transB, m, n, k, nnzA, nnzB));
+
+    float* alpha;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getConstant(handle, HIP_R_32F, 1, (const void**)&alpha));
+
+#ifdef HIPSPARSE_ROCSPARSE_CSRGEMM_NUMERIC
+    // The first call computes the column indices of C, the following ones only its values
+    if(hipsparse::hasCsrgemmPlanPattern(plan, csrRowPtrC, csrColIndC))
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::getCsrgemmPlanNnz(handle, plan, descrC));
+
+        return hipsparse::rocSPARSEStatusToHIPStatus(
+            rocsparse_scsrgemm_numeric((rocsparse_handle)handle,
+                                       hipsparse::hipOperationToHCCOperation(transA),
+                                       hipsparse::hipOperationToHCCOperation(transB),
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       (rocsparse_mat_descr)descrA,
+                                       nnzA,
+                                       csrValA,
+                                       csrRowPtrA,
+                                       csrColIndA,
+                                       (rocsparse_mat_descr)descrB,
+                                       nnzB,
+                                       csrValB,
+                                       csrRowPtrB,
+                                       csrColIndB,
+                                       nullptr,
+                                       nullptr,
+                                       0,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       (rocsparse_mat_descr)descrC,
+                                       plan->nnzC,
+                                       csrValC,
+                                       csrRowPtrC,
+                                       csrColIndC,
+                                       plan->info,
+                                       plan->buffer));
+    }
+#endif
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsrgemm((rocsparse_handle)handle,
+                                                 hipsparse::hipOperationToHCCOperation(transA),
+                                                 hipsparse::hipOperationToHCCOperation(transB),
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 (rocsparse_mat_descr)descrA,
+                                                 nnzA,
+                                                 csrValA,
+                                                 csrRowPtrA,
+                                                 csrColIndA,
+                                                 (rocsparse_mat_descr)descrB,
+                                                 nnzB,
+                                                 csrValB,
+                                                 csrRowPtrB,
+                                                 csrColIndB,
+                                                 nullptr,
+                                                 nullptr,
+                                                 0,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 (rocsparse_mat_descr)descrC,
+                                                 csrValC,
+                                                 csrRowPtrC,
+                                                 csrColIndC,
+                                                 plan->info,
+                                                 plan->buffer));
+
+    plan->csrRowPtrC = csrRowPtrC;
+    plan->csrColIndC = csrColIndC;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const double*             csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const double*             csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            double*                   csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       plan);
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::checkCsrgemmPlan(plan, transA, transB, m, n, k, nnzA, nnzB));
+
+    double* alpha;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getConstant(handle, HIP_R_64F, 1, (const void**)&alpha));
+
+#ifdef HIPSPARSE_ROCSPARSE_CSRGEMM_NUMERIC
+    // The first call computes the column indices of C, the following ones only its values
+    if(hipsparse::hasCsrgemmPlanPattern(plan, csrRowPtrC, csrColIndC))
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::getCsrgemmPlanNnz(handle, plan, descrC));
+
+        return hipsparse::rocSPARSEStatusToHIPStatus(
+            rocsparse_dcsrgemm_numeric((rocsparse_handle)handle,
+                                       hipsparse::hipOperationToHCCOperation(transA),
+                                       hipsparse::hipOperationToHCCOperation(transB),
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       (rocsparse_mat_descr)descrA,
+                                       nnzA,
+                                       csrValA,
+                                       csrRowPtrA,
+                                       csrColIndA,
+                                       (rocsparse_mat_descr)descrB,
+                                       nnzB,
+                                       csrValB,
+                                       csrRowPtrB,
+                                       csrColIndB,
+                                       nullptr,
+                                       nullptr,
+                                       0,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       (rocsparse_mat_descr)descrC,
+                                       plan->nnzC,
+                                       csrValC,
+                                       csrRowPtrC,
+                                       csrColIndC,
+                                       plan->info,
+                                       plan->buffer));
+    }
+#endif
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsrgemm((rocsparse_handle)handle,
+                                                 hipsparse::hipOperationToHCCOperation(transA),
+                                                 hipsparse::hipOperationToHCCOperation(transB),
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 (rocsparse_mat_descr)descrA,
+                                                 nnzA,
+                                                 csrValA,
+                                                 csrRowPtrA,
+                                                 csrColIndA,
+                                                 (rocsparse_mat_descr)descrB,
+                                                 nnzB,
+                                                 csrValB,
+                                                 csrRowPtrB,
+                                                 csrColIndB,
+                                                 nullptr,
+                                                 nullptr,
+                                                 0,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 (rocsparse_mat_descr)descrC,
+                                                 csrValC,
+                                                 csrRowPtrC,
+                                                 csrColIndC,
+                                                 plan->info,
+                                                 plan->buffer));
+
+    plan->csrRowPtrC = csrRowPtrC;
+    plan->csrColIndC = csrColIndC;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipComplex*         csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipComplex*         csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            hipComplex*               csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       plan);
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::checkCsrgemmPlan(plan, transA, transB, m, n, k, nnzA, nnzB));
+
+    hipComplex* alpha;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getConstant(handle, HIP_C_32F, 1, (const void**)&alpha));
+
+#ifdef HIPSPARSE_ROCSPARSE_CSRGEMM_NUMERIC
+    // The first call computes the column indices of C, the following ones only its values
+    if(hipsparse::hasCsrgemmPlanPattern(plan, csrRowPtrC, csrColIndC))
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::getCsrgemmPlanNnz(handle, plan, descrC));
+
+        return hipsparse::rocSPARSEStatusToHIPStatus(
+            rocsparse_ccsrgemm_numeric((rocsparse_handle)handle,
+                                       hipsparse::hipOperationToHCCOperation(transA),
+                                       hipsparse::hipOperationToHCCOperation(transB),
+                                       m,
+                                       n,
+                                       k,
+                                       (const rocsparse_float_complex*)alpha,
+                                       (rocsparse_mat_descr)descrA,
+                                       nnzA,
+                                       (const rocsparse_float_complex*)csrValA,
+                                       csrRowPtrA,
+                                       csrColIndA,
+                                       (rocsparse_mat_descr)descrB,
+                                       nnzB,
+                                       (const rocsparse_float_complex*)csrValB,
+                                       csrRowPtrB,
+                                       csrColIndB,
+                                       nullptr,
+                                       nullptr,
+                                       0,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       (rocsparse_mat_descr)descrC,
+                                       plan->nnzC,
+                                       (rocsparse_float_complex*)csrValC,
+                                       csrRowPtrC,
+                                       csrColIndC,
+                                       plan->info,
+                                       plan->buffer));
+    }
+#endif
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsrgemm((rocsparse_handle)handle,
+                                                 hipsparse::hipOperationToHCCOperation(transA),
+                                                 hipsparse::hipOperationToHCCOperation(transB),
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 (const rocsparse_float_complex*)alpha,
+                                                 (rocsparse_mat_descr)descrA,
+                                                 nnzA,
+                                                 (const rocsparse_float_complex*)csrValA,
+                                                 csrRowPtrA,
+                                                 csrColIndA,
+                                                 (rocsparse_mat_descr)descrB,
+                                                 nnzB,
+                                                 (const rocsparse_float_complex*)csrValB,
+                                                 csrRowPtrB,
+                                                 csrColIndB,
+                                                 nullptr,
+                                                 nullptr,
+                                                 0,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 (rocsparse_mat_descr)descrC,
+                                                 (rocsparse_float_complex*)csrValC,
+                                                 csrRowPtrC,
+                                                 csrColIndC,
+                                                 plan->info,
+                                                 plan->buffer));
+
+    plan->csrRowPtrC = csrRowPtrC;
+    plan->csrColIndC = csrColIndC;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseZcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipDoubleComplex*   csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipDoubleComplex*   csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            hipDoubleComplex*         csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       plan);
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::checkCsrgemmPlan(plan, transA, transB, m, n, k, nnzA, nnzB));
+
+    hipDoubleComplex* alpha;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getConstant(handle, HIP_C_64F, 1, (const void**)&alpha));
+
+#ifdef HIPSPARSE_ROCSPARSE_CSRGEMM_NUMERIC
+    // The first call computes the column indices of C, the following ones only its values
+    if(hipsparse::hasCsrgemmPlanPattern(plan, csrRowPtrC, csrColIndC))
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::getCsrgemmPlanNnz(handle, plan, descrC));
+
+        return hipsparse::rocSPARSEStatusToHIPStatus(
+            rocsparse_zcsrgemm_numeric((rocsparse_handle)handle,
+                                       hipsparse::hipOperationToHCCOperation(transA),
+                                       hipsparse::hipOperationToHCCOperation(transB),
+                                       m,
+                                       n,
+                                       k,
+                                       (const rocsparse_double_complex*)alpha,
+                                       (rocsparse_mat_descr)descrA,
+                                       nnzA,
+                                       (const rocsparse_double_complex*)csrValA,
+                                       csrRowPtrA,
+                                       csrColIndA,
+                                       (rocsparse_mat_descr)descrB,
+                                       nnzB,
+                                       (const rocsparse_double_complex*)csrValB,
+                                       csrRowPtrB,
+                                       csrColIndB,
+                                       nullptr,
+                                       nullptr,
+                                       0,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       (rocsparse_mat_descr)descrC,
+                                       plan->nnzC,
+                                       (rocsparse_double_complex*)csrValC,
+                                       csrRowPtrC,
+                                       csrColIndC,
+                                       plan->info,
+                                       plan->buffer));
+    }
+#endif
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsrgemm((rocsparse_handle)handle,
+                                                 hipsparse::hipOperationToHCCOperation(transA),
+                                                 hipsparse::hipOperationToHCCOperation(transB),
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 (const rocsparse_double_complex*)alpha,
+                                                 (rocsparse_mat_descr)descrA,
+                                                 nnzA,
+                                                 (const rocsparse_double_complex*)csrValA,
+                                                 csrRowPtrA,
+                                                 csrColIndA,
+                                                 (rocsparse_mat_descr)descrB,
+                                                 nnzB,
+                                                 (const rocsparse_double_complex*)csrValB,
+                                                 csrRowPtrB,
+                                                 csrColIndB,
+                                                 nullptr,
+                                                 nullptr,
+                                                 0,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 (rocsparse_mat_descr)descrC,
+                                                 (rocsparse_double_complex*)csrValC,
+                                                 csrRowPtrC,
+                                                 csrColIndC,
+                                                 plan->info,
+                                                 plan->buffer));
+
+    plan->csrRowPtrC = csrRowPtrC;
+    plan->csrColIndC = csrColIndC;
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6178,6 +9457,27 @@ hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       beta,
+                       descrD,
+                       nnzD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6224,6 +9524,27 @@ hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       beta,
+                       descrD,
+                       nnzD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6270,6 +9591,27 @@ hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       beta,
+                       descrD,
+                       nnzD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6316,6 +9658,27 @@ hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       beta,
+                       descrD,
+                       nnzD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6363,6 +9726,28 @@ hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
                                         const csrgemm2Info_t      info,
                                         void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       descrA,
+                       nnzA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       descrD,
+                       nnzD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       descrC,
+                       csrRowPtrC,
+                       nnzTotalDevHostPtr,
+                       info,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrgemm_nnz((rocsparse_handle)handle,
                                                                        rocsparse_operation_none,
                                                                        rocsparse_operation_none,
@@ -6416,6 +9801,34 @@ hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       beta,
+                       descrD,
+                       nnzD,
+                       csrValD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsrgemm((rocsparse_handle)handle,
                                                                     rocsparse_operation_none,
                                                                     rocsparse_operation_none,
@@ -6475,6 +9888,34 @@ hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       beta,
+                       descrD,
+                       nnzD,
+                       csrValD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrgemm((rocsparse_handle)handle,
                                                                     rocsparse_operation_none,
                                                                     rocsparse_operation_none,
@@ -6534,6 +9975,34 @@ hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       beta,
+                       descrD,
+                       nnzD,
+                       csrValD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm((rocsparse_handle)handle,
                            rocsparse_operation_none,
@@ -6594,6 +10063,34 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       k,
+                       alpha,
+                       descrA,
+                       nnzA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       descrB,
+                       nnzB,
+                       csrValB,
+                       csrRowPtrB,
+                       csrColIndB,
+                       beta,
+                       descrD,
+                       nnzD,
+                       csrValD,
+                       csrRowPtrD,
+                       csrColIndD,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm((rocsparse_handle)handle,
                            rocsparse_operation_none,
@@ -6629,6 +10126,8 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrilu02_zeroPivot(hipsparseHandle_t handle, bsrilu02Info_t info, int* position)
 {
+    HIPSPARSE_LOG_CALL(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6646,6 +10145,8 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
+    HIPSPARSE_LOG_CALL(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsbsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -6653,6 +10154,8 @@ hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
 hipsparseStatus_t hipsparseDbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
+    HIPSPARSE_LOG_CALL(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dbsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -6663,6 +10166,8 @@ hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
+    HIPSPARSE_LOG_CALL(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcbsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
@@ -6677,6 +10182,8 @@ hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
+    HIPSPARSE_LOG_CALL(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
@@ -6697,6 +10204,18 @@ hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6734,6 +10253,18 @@ hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6771,6 +10302,18 @@ hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6808,6 +10351,18 @@ hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6846,6 +10401,19 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6885,6 +10453,19 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6924,6 +10505,19 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6963,6 +10557,19 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7002,6 +10609,19 @@ hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7030,6 +10650,19 @@ hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7058,6 +10691,19 @@ hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7086,6 +10732,19 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7104,6 +10763,8 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrilu02_zeroPivot(hipsparseHandle_t handle, csrilu02Info_t info, int* position)
 {
+    HIPSPARSE_LOG_CALL(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7121,6 +10782,8 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseScsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
+    HIPSPARSE_LOG_CALL(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dscsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -7128,6 +10791,8 @@ hipsparseStatus_t hipsparseScsrilu02_numericBoost(
 hipsparseStatus_t hipsparseDcsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
+    HIPSPARSE_LOG_CALL(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -7138,6 +10803,8 @@ hipsparseStatus_t hipsparseCcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
+    HIPSPARSE_LOG_CALL(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dccsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
@@ -7152,6 +10819,8 @@ hipsparseStatus_t hipsparseZcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
+    HIPSPARSE_LOG_CALL(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
@@ -7170,6 +10839,16 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7203,6 +10882,16 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7236,6 +10925,16 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7269,6 +10968,16 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7302,6 +11011,16 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7324,6 +11043,16 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7346,6 +11075,16 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7368,6 +11107,16 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7391,6 +11140,17 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7425,6 +11185,17 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7459,6 +11230,17 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7494,6 +11276,17 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7531,6 +11324,17 @@ hipsparseStatus_t hipsparseScsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA_valM,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsrilu0((rocsparse_handle)handle,
                                                                     m,
                                                                     nnz,
@@ -7556,6 +11360,17 @@ hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA_valM,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0((rocsparse_handle)handle,
                                                                     m,
                                                                     nnz,
@@ -7581,6 +11396,17 @@ hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA_valM,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrilu0((rocsparse_handle)handle,
                            m,
@@ -7607,6 +11433,17 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA_valM,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0((rocsparse_handle)handle,
                            m,
@@ -7623,6 +11460,8 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsric02_zeroPivot(hipsparseHandle_t handle, bsric02Info_t info, int* position)
 {
+    HIPSPARSE_LOG_CALL(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7649,6 +11488,18 @@ hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7686,6 +11537,18 @@ hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7723,6 +11586,18 @@ hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7760,6 +11635,18 @@ hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7798,6 +11685,19 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7837,6 +11737,19 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7876,6 +11789,19 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7915,6 +11841,19 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7954,6 +11893,19 @@ hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7982,6 +11934,19 @@ hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -8010,6 +11975,19 @@ hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -8038,6 +12016,19 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -8056,6 +12047,8 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsric02_zeroPivot(hipsparseHandle_t handle, csric02Info_t info, int* position)
 {
+    HIPSPARSE_LOG_CALL(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse csric02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8080,6 +12073,16 @@ hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -8113,6 +12116,16 @@ hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -8146,6 +12159,16 @@ hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -8179,6 +12202,16 @@ hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -8212,6 +12245,16 @@ hipsparseStatus_t hipsparseScsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8234,6 +12277,16 @@ hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8256,6 +12309,16 @@ hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8278,6 +12341,16 @@ hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8301,6 +12374,17 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8335,6 +12419,17 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8369,6 +12464,17 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8404,6 +12510,17 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8441,6 +12558,17 @@ hipsparseStatus_t hipsparseScsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA_valM,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsric0((rocsparse_handle)handle,
                                                                    m,
                                                                    nnz,
@@ -8466,6 +12594,17 @@ hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA_valM,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsric0((rocsparse_handle)handle,
                                                                    m,
                                                                    nnz,
@@ -8491,6 +12630,17 @@ hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA_valM,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsric0((rocsparse_handle)handle,
                           m,
@@ -8517,6 +12667,17 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrSortedValA_valM,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       info,
+                       policy,
+                       pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsric0((rocsparse_handle)handle,
                           m,
@@ -8537,6 +12698,8 @@ hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
                                     int*                 cooRowInd,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, csrRowPtr, nnz, m, cooRowInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csr2coo((rocsparse_handle)handle,
                           csrRowPtr,
@@ -8559,6 +12722,19 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnz,
+                       csrSortedVal,
+                       csrSortedRowPtr,
+                       csrSortedColInd,
+                       cscSortedVal,
+                       cscSortedRowInd,
+                       cscSortedColPtr,
+                       copyValues,
+                       idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8571,23 +12747,16 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace pool
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getWorkspace(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
-    hipStream_t       stream;
-    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-        return status;
-    }
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
 
     // Format conversion
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
+    hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2csc((rocsparse_handle)handle,
                            m,
                            n,
@@ -8602,11 +12771,8 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, false));
 
     return status;
 }
@@ -8624,6 +12790,19 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnz,
+                       csrSortedVal,
+                       csrSortedRowPtr,
+                       csrSortedColInd,
+                       cscSortedVal,
+                       cscSortedRowInd,
+                       cscSortedColPtr,
+                       copyValues,
+                       idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8636,23 +12815,16 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace pool
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getWorkspace(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
-    hipStream_t       stream;
-    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-        return status;
-    }
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
 
     // Format conversion
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
+    hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2csc((rocsparse_handle)handle,
                            m,
                            n,
@@ -8667,11 +12839,8 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, false));
 
     return status;
 }
@@ -8689,6 +12858,19 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnz,
+                       csrSortedVal,
+                       csrSortedRowPtr,
+                       csrSortedColInd,
+                       cscSortedVal,
+                       cscSortedRowInd,
+                       cscSortedColPtr,
+                       copyValues,
+                       idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8701,23 +12883,16 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace pool
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getWorkspace(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
-    hipStream_t       stream;
-    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-        return status;
-    }
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
 
     // Format conversion
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
+    hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2csc((rocsparse_handle)handle,
                            m,
                            n,
@@ -8732,11 +12907,8 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, false));
 
     return status;
 }
@@ -8754,6 +12926,19 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                     hipsparseAction_t       copyValues,
                                     hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnz,
+                       csrSortedVal,
+                       csrSortedRowPtr,
+                       csrSortedColInd,
+                       cscSortedVal,
+                       cscSortedRowInd,
+                       cscSortedColPtr,
+                       copyValues,
+                       idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8766,23 +12951,16 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace pool
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getWorkspace(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
-    hipStream_t       stream;
-    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-        return status;
-    }
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
 
     // Format conversion
-    status = hipsparse::rocSPARSEStatusToHIPStatus(
+    hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2csc((rocsparse_handle)handle,
                            m,
                            n,
@@ -8797,11 +12975,8 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-    // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Synchronize stream, unless the execution policy allows to skip it
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronizeBlocking(handle, stream, false));
 
     return status;
 }
@@ -8822,6 +12997,22 @@ hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
                                                  hipsparseCsr2CscAlg_t alg,
                                                  size_t*               pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnz,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       cscVal,
+                       cscColPtr,
+                       cscRowInd,
+                       valType,
+                       copyValues,
+                       idxBase,
+                       alg,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csr2csc_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8849,6 +13040,22 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                       hipsparseCsr2CscAlg_t alg,
                                       void*                 buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnz,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       cscVal,
+                       cscColPtr,
+                       cscRowInd,
+                       valType,
+                       copyValues,
+                       idxBase,
+                       alg,
+                       buffer);
+
     switch(valType)
     {
     case HIP_R_32F:
@@ -8929,6 +13136,17 @@ hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       hybA,
+                       userEllWidth,
+                       partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2hyb((rocsparse_handle)handle,
                            m,
@@ -8953,6 +13171,17 @@ hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       hybA,
+                       userEllWidth,
+                       partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2hyb((rocsparse_handle)handle,
                            m,
@@ -8977,6 +13206,17 @@ hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       hybA,
+                       userEllWidth,
+                       partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2hyb((rocsparse_handle)handle,
                            m,
@@ -9001,6 +13241,17 @@ hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrSortedValA,
+                       csrSortedRowPtrA,
+                       csrSortedColIndA,
+                       hybA,
+                       userEllWidth,
+                       partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2hyb((rocsparse_handle)handle,
                            m,
@@ -9025,6 +13276,17 @@ hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       mb,
+                       nb,
+                       nnzb,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -9049,6 +13311,17 @@ hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       mb,
+                       nb,
+                       nnzb,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -9073,6 +13346,17 @@ hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       mb,
+                       nb,
+                       nnzb,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pBufferSizeInBytes);
+
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -9099,6 +13383,17 @@ hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handl
                                                    int                     colBlockDim,
                                                    size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       mb,
+                       nb,
+                       nnzb,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pBufferSizeInBytes);
+
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -9130,6 +13425,22 @@ hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       mb,
+                       nb,
+                       nnzb,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       bscVal,
+                       bscRowInd,
+                       bscColPtr,
+                       copyValues,
+                       idx_base,
+                       temp_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
                                                      nb,
@@ -9164,6 +13475,22 @@ hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       mb,
+                       nb,
+                       nnzb,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       bscVal,
+                       bscRowInd,
+                       bscColPtr,
+                       copyValues,
+                       idx_base,
+                       temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9199,6 +13526,22 @@ hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       mb,
+                       nb,
+                       nnzb,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       bscVal,
+                       bscRowInd,
+                       bscColPtr,
+                       copyValues,
+                       idx_base,
+                       temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9234,6 +13577,22 @@ hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
                                         hipsparseIndexBase_t    idx_base,
                                         void*                   temp_buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       mb,
+                       nb,
+                       nnzb,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       bscVal,
+                       bscRowInd,
+                       bscColPtr,
+                       copyValues,
+                       idx_base,
+                       temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9265,6 +13624,18 @@ hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_scsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9292,6 +13663,18 @@ hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9319,6 +13702,18 @@ hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_ccsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9346,6 +13741,18 @@ hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9375,6 +13782,20 @@ hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
                                          int*                      bsrNnzDevhost,
                                          void*                     pbuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrRowPtr,
+                       csrColInd,
+                       bsr_descr,
+                       bsrRowPtr,
+                       rowBlockDim,
+                       colBlockDim,
+                       bsrNnzDevhost,
+                       pbuffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2gebsr_nnz((rocsparse_handle)handle,
                                                       hipsparse::hipDirectionToHCCDirection(dir),
@@ -9408,6 +13829,22 @@ hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       bsr_descr,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pbuffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9442,6 +13879,22 @@ hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       bsr_descr,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pbuffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9476,6 +13929,22 @@ hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       bsr_descr,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pbuffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9510,6 +13979,22 @@ hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dir,
+                       m,
+                       n,
+                       csr_descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       bsr_descr,
+                       bsrVal,
+                       bsrRowPtr,
+                       bsrColInd,
+                       rowBlockDim,
+                       colBlockDim,
+                       pbuffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9542,6 +14027,20 @@ hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       blockDim,
+                       descrC,
+                       bsrValC,
+                       bsrRowPtrC,
+                       bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9572,6 +14071,20 @@ hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       blockDim,
+                       descrC,
+                       bsrValC,
+                       bsrRowPtrC,
+                       bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9602,6 +14115,20 @@ hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       blockDim,
+                       descrC,
+                       bsrValC,
+                       bsrRowPtrC,
+                       bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9632,6 +14159,20 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       blockDim,
+                       descrC,
+                       bsrValC,
+                       bsrRowPtrC,
+                       bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9648,6 +14189,148 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+// rocSPARSE has no sliced ELL format
+hipsparseStatus_t hipsparseXcsr2sellNnz(hipsparseHandle_t         handle,
+                                        int                       m,
+                                        int                       n,
+                                        const hipsparseMatDescr_t descrA,
+                                        const int*                csrRowPtrA,
+                                        int                       sliceSize,
+                                        int                       sigma,
+                                        int*                      sellSliceOffsets,
+                                        int*                      perm,
+                                        int*                      sellValuesSize)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrRowPtrA,
+                       sliceSize,
+                       sigma,
+                       sellSliceOffsets,
+                       perm,
+                       sellValuesSize);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const float*              csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     float*                    sellVal)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       sliceSize,
+                       sellSliceOffsets,
+                       perm,
+                       sellColInd,
+                       sellVal);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const double*             csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     double*                   sellVal)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       sliceSize,
+                       sellSliceOffsets,
+                       perm,
+                       sellColInd,
+                       sellVal);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipComplex*         csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     hipComplex*               sellVal)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       sliceSize,
+                       sellSliceOffsets,
+                       perm,
+                       sellColInd,
+                       sellVal);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipDoubleComplex*   csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     hipDoubleComplex*         sellVal)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       sliceSize,
+                       sellSliceOffsets,
+                       perm,
+                       sellColInd,
+                       sellVal);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
 hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                                     hipsparseDirection_t      dirA,
                                     int                       mb,
@@ -9662,6 +14345,20 @@ hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9692,6 +14389,20 @@ hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9722,6 +14433,20 @@ hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9752,6 +14477,20 @@ hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       blockDim,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9783,6 +14522,21 @@ hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDim,
+                       colBlockDim,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9815,6 +14569,21 @@ hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDim,
+                       colBlockDim,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9847,6 +14616,21 @@ hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDim,
+                       colBlockDim,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9879,6 +14663,21 @@ hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDim,
+                       colBlockDim,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9910,6 +14709,20 @@ hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              float                     tol)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrColIndA,
+                       csrRowPtrA,
+                       nnzA,
+                       nnzPerRow,
+                       csrValC,
+                       csrColIndC,
+                       csrRowPtrC,
+                       tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -9940,6 +14753,20 @@ hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              double                    tol)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrColIndA,
+                       csrRowPtrA,
+                       nnzA,
+                       nnzPerRow,
+                       csrValC,
+                       csrColIndC,
+                       csrRowPtrC,
+                       tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -9970,6 +14797,20 @@ hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipComplex                tol)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrColIndA,
+                       csrRowPtrA,
+                       nnzA,
+                       nnzPerRow,
+                       csrValC,
+                       csrColIndC,
+                       csrRowPtrC,
+                       tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -10000,6 +14841,20 @@ hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipDoubleComplex          tol)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       descrA,
+                       csrValA,
+                       csrColIndA,
+                       csrRowPtrA,
+                       nnzA,
+                       nnzPerRow,
+                       csrValC,
+                       csrColIndC,
+                       csrRowPtrC,
+                       tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -10031,6 +14886,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       threshold,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -10063,6 +14933,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       threshold,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -10095,6 +14980,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       threshold,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -10127,6 +15027,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       threshold,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -10158,6 +15073,20 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       threshold,
+                       descrC,
+                       csrRowPtrC,
+                       nnzTotalDevHostPtr,
+                       buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
@@ -10188,6 +15117,20 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       threshold,
+                       descrC,
+                       csrRowPtrC,
+                       nnzTotalDevHostPtr,
+                       buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
@@ -10219,6 +15162,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       threshold,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr((rocsparse_handle)handle,
                                  m,
@@ -10251,6 +15209,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       threshold,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr((rocsparse_handle)handle,
                                  m,
@@ -10284,6 +15257,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       percentage,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10318,6 +15307,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       percentage,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10352,6 +15357,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t  info,
                                                                    size_t*      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       percentage,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10386,6 +15407,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t   info,
                                                                    size_t*       pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       percentage,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10419,6 +15456,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       percentage,
+                       descrC,
+                       csrRowPtrC,
+                       nnzTotalDevHostPtr,
+                       info,
+                       buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
@@ -10451,6 +15503,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       percentage,
+                       descrC,
+                       csrRowPtrC,
+                       nnzTotalDevHostPtr,
+                       info,
+                       buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
@@ -10484,6 +15551,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       percentage,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
@@ -10518,6 +15601,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       nnzA,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       percentage,
+                       descrC,
+                       csrValC,
+                       csrRowPtrC,
+                       csrColIndC,
+                       info,
+                       buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
@@ -10543,6 +15642,8 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_LOG_CALL(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10551,9 +15652,9 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace pool
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getWorkspace(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10565,9 +15666,6 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     return status;
 }
 
@@ -10578,6 +15676,8 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_LOG_CALL(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10586,9 +15686,9 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace pool
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getWorkspace(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10600,9 +15700,6 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     return status;
 }
 
@@ -10613,6 +15710,8 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_LOG_CALL(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10621,9 +15720,9 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace pool
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getWorkspace(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10635,9 +15734,6 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     return status;
 }
 
@@ -10648,6 +15744,8 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_LOG_CALL(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10656,9 +15754,9 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace pool
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getWorkspace(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10670,9 +15768,6 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     return status;
 }
 
@@ -10686,6 +15781,8 @@ hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LOG_CALL(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10708,6 +15805,8 @@ hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LOG_CALL(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10730,6 +15829,8 @@ hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LOG_CALL(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10752,6 +15853,8 @@ hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LOG_CALL(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10775,6 +15878,8 @@ hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10799,6 +15904,8 @@ hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10823,6 +15930,8 @@ hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10847,6 +15956,8 @@ hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10872,6 +15983,18 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       threshold,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10900,6 +16023,18 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       threshold,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10928,6 +16063,18 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       threshold,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10956,6 +16103,18 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       threshold,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10983,6 +16142,17 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       threshold,
+                       descr,
+                       csrRowPtr,
+                       nnzTotalDevHostPtr,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sprune_dense2csr_nnz((rocsparse_handle)handle,
                                                              m,
                                                              n,
@@ -11008,6 +16178,17 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       threshold,
+                       descr,
+                       csrRowPtr,
+                       nnzTotalDevHostPtr,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dprune_dense2csr_nnz((rocsparse_handle)handle,
                                                              m,
                                                              n,
@@ -11034,6 +16215,18 @@ hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       threshold,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sprune_dense2csr((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -11061,6 +16254,18 @@ hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       threshold,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dprune_dense2csr((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -11089,6 +16294,19 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       percentage,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       info,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11119,6 +16337,19 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       percentage,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       info,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11150,6 +16381,19 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       percentage,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       info,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11181,6 +16425,19 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       percentage,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       info,
+                       pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11210,6 +16467,18 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       percentage,
+                       descr,
+                       csrRowPtr,
+                       nnzTotalDevHostPtr,
+                       info,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -11238,6 +16507,18 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       percentage,
+                       descr,
+                       csrRowPtr,
+                       nnzTotalDevHostPtr,
+                       info,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -11267,6 +16548,19 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       percentage,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       info,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -11297,6 +16591,19 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       percentage,
+                       descr,
+                       csrVal,
+                       csrRowPtr,
+                       csrColInd,
+                       info,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -11325,6 +16632,8 @@ hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11349,6 +16658,8 @@ hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11373,6 +16684,8 @@ hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11397,6 +16710,8 @@ hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11420,6 +16735,8 @@ hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11442,6 +16759,8 @@ hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11464,6 +16783,8 @@ hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11486,6 +16807,8 @@ hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11508,6 +16831,8 @@ hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11530,6 +16855,8 @@ hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11552,6 +16879,8 @@ hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11574,6 +16903,8 @@ hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11598,6 +16929,18 @@ hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
                                        int*                      bsrRowPtrC,
                                        int*                      bsrNnzb)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       m,
+                       n,
+                       descrA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       blockDim,
+                       descrC,
+                       bsrRowPtrC,
+                       bsrNnzb);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz((rocsparse_handle)handle,
                                                     hipsparse::hipDirectionToHCCDirection(dirA),
                                                     m,
@@ -11622,6 +16965,8 @@ hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          float                     tol)
 {
+    HIPSPARSE_LOG_CALL(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11642,6 +16987,8 @@ hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          double                    tol)
 {
+    HIPSPARSE_LOG_CALL(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11662,6 +17009,8 @@ hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipComplex                tol)
 {
+    HIPSPARSE_LOG_CALL(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11682,6 +17031,8 @@ hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipDoubleComplex          tol)
 {
+    HIPSPARSE_LOG_CALL(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11700,6 +17051,8 @@ hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
                                     int*                 csrRowPtr,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LOG_CALL(handle, cooRowInd, nnz, m, csrRowPtr, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_coo2csr((rocsparse_handle)handle,
                           cooRowInd,
@@ -11711,6 +17064,8 @@ hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
 
 hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
 {
+    HIPSPARSE_LOG_CALL(handle, n, p);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_identity_permutation((rocsparse_handle)handle, n, p));
 }
@@ -11723,6 +17078,8 @@ hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        csrColInd,
                                                   size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrsort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes));
 }
@@ -11737,6 +17094,8 @@ hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, P, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrsort((rocsparse_handle)handle,
                                                                    m,
                                                                    n,
@@ -11756,6 +17115,8 @@ hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cscRowInd,
                                                   size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes));
 }
@@ -11770,6 +17131,8 @@ hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, cscColPtr, cscRowInd, P, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort((rocsparse_handle)handle,
                                                                    m,
                                                                    n,
@@ -11789,6 +17152,8 @@ hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cooCols,
                                                   size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes));
 }
@@ -11802,6 +17167,8 @@ hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
                                          int*              P,
                                          void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_row(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
 }
@@ -11815,6 +17182,8 @@ hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
                                             int*              P,
                                             void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_column(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
 }
@@ -11834,6 +17203,21 @@ hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       pBufferSizeInBytes);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11873,6 +17257,21 @@ hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       pBufferSizeInBytes);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11911,6 +17310,21 @@ hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       pBufferSizeInBytes);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11949,6 +17363,21 @@ hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       pBufferSizeInBytes);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11989,6 +17418,23 @@ hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
                                            int*                      nnzTotalDevHostPtr,
                                            void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       descrC,
+                       bsrRowPtrC,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       nnzTotalDevHostPtr,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_gebsr2gebsr_nnz((rocsparse_handle)handle,
                                                         hipsparse::hipDirectionToHCCDirection(dirA),
                                                         mb,
@@ -12027,6 +17473,25 @@ hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       descrC,
+                       bsrValC,
+                       bsrRowPtrC,
+                       bsrColIndC,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12067,6 +17532,25 @@ hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       descrC,
+                       bsrValC,
+                       bsrRowPtrC,
+                       bsrColIndC,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12107,6 +17591,25 @@ hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       descrC,
+                       bsrValC,
+                       bsrRowPtrC,
+                       bsrColIndC,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12147,6 +17650,25 @@ hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       dirA,
+                       mb,
+                       nb,
+                       nnzb,
+                       descrA,
+                       bsrValA,
+                       bsrRowPtrA,
+                       bsrColIndA,
+                       rowBlockDimA,
+                       colBlockDimA,
+                       descrC,
+                       bsrValC,
+                       bsrRowPtrC,
+                       bsrColIndC,
+                       rowBlockDimC,
+                       colBlockDimC,
+                       buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12178,6 +17700,8 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12232,6 +17756,8 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12286,6 +17812,8 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12340,6 +17868,8 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12395,6 +17925,8 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12478,6 +18010,8 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12561,6 +18095,8 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12644,6 +18180,8 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12727,6 +18265,8 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12802,6 +18342,8 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12877,6 +18419,85 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    // Test for bad args
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Invalid sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Quick return
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // nnz must be 0
+        if(nnz != 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Invalid pointers
+    if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
+       || info == nullptr || pBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check for valid permutation array
+    if(info->P == nullptr || info->size != nnz)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get stream
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    // Unsort CSR column indices based on the given permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_isctr((rocsparse_handle)handle,
+                                              nnz,
+                                              csrColInd,
+                                              info->P,
+                                              (int*)pBuffer,
+                                              rocsparse_index_base_zero));
+
+    // Copy unsorted column indices back to csrColInd
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(csrColInd, pBuffer, sizeof(int) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Unsort CSR values based on the given permutation
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsctr(
+        handle, nnz, csrVal, info->P, (hipComplex*)pBuffer, HIPSPARSE_INDEX_BASE_ZERO));
+
+    // Copy unsorted values back to csrVal
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(csrVal, pBuffer, sizeof(hipComplex) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipDoubleComplex*         csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    HIPSPARSE_LOG_CALL(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12908,112 +18529,563 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // Check for valid permutation array
-    if(info->P == nullptr || info->size != nnz)
+    // Check for valid permutation array
+    if(info->P == nullptr || info->size != nnz)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get stream
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    // Unsort CSR column indices based on the given permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_isctr((rocsparse_handle)handle,
+                                              nnz,
+                                              csrColInd,
+                                              info->P,
+                                              (int*)pBuffer,
+                                              rocsparse_index_base_zero));
+
+    // Copy unsorted column indices back to csrColInd
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(csrColInd, pBuffer, sizeof(int) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Unsort CSR values based on the given permutation
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseZsctr(
+        handle, nnz, csrVal, info->P, (hipDoubleComplex*)pBuffer, HIPSPARSE_INDEX_BASE_ZERO));
+
+    // Copy unsorted values back to csrVal
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        csrVal, pBuffer, sizeof(hipDoubleComplex) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace hipsparse
+{
+    // Algorithm chosen by HIPSPARSE_SPMV_ALG_AUTO for a SpMat descriptor. rocSPARSE
+    // descriptors cannot carry it, so it is kept in a side table keyed by the descriptor
+    // and dropped when the descriptor is destroyed or its arrays are replaced.
+    struct spmvTuning
+    {
+        hipsparseOperation_t opA;
+        hipDataType          computeType;
+        rocsparse_spmv_alg   alg;
+    };
+
+    // Number of timed iterations per candidate, after one warm up iteration
+    static const int spmvTuningIterations = 5;
+
+    static std::mutex& spmvTuningMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::unordered_map<const void*, spmvTuning>& spmvTuningMap()
+    {
+        static std::unordered_map<const void*, spmvTuning> map;
+        return map;
+    }
+
+    static bool getSpMVTuning(hipsparseConstSpMatDescr_t matA,
+                              hipsparseOperation_t       opA,
+                              hipDataType                computeType,
+                              rocsparse_spmv_alg*        alg)
+    {
+        std::lock_guard<std::mutex> lock(spmvTuningMutex());
+
+        auto it = spmvTuningMap().find(matA);
+        if(it == spmvTuningMap().end() || it->second.opA != opA
+           || it->second.computeType != computeType)
+        {
+            return false;
+        }
+
+        *alg = it->second.alg;
+        return true;
+    }
+
+    static void setSpMVTuning(hipsparseConstSpMatDescr_t matA,
+                              hipsparseOperation_t       opA,
+                              hipDataType                computeType,
+                              rocsparse_spmv_alg         alg)
+    {
+        std::lock_guard<std::mutex> lock(spmvTuningMutex());
+        spmvTuningMap()[matA] = {opA, computeType, alg};
+    }
+
+    static void forgetSpMVTuning(hipsparseConstSpMatDescr_t matA)
+    {
+        std::lock_guard<std::mutex> lock(spmvTuningMutex());
+        spmvTuningMap().erase(matA);
+    }
+
+    // Algorithms timed by the tuning, depending on the format of the matrix. Formats
+    // with a single algorithm are not tuned.
+    static int getSpMVCandidates(hipsparseConstSpMatDescr_t matA, rocsparse_spmv_alg* candidates)
+    {
+        rocsparse_format format;
+        if(rocsparse_spmat_get_format((rocsparse_const_spmat_descr)matA, &format)
+           != rocsparse_status_success)
+        {
+            candidates[0] = rocsparse_spmv_alg_default;
+            return 1;
+        }
+
+        switch(format)
+        {
+        case rocsparse_format_csr:
+        case rocsparse_format_csc:
+            candidates[0] = rocsparse_spmv_alg_csr_adaptive;
+            candidates[1] = rocsparse_spmv_alg_csr_stream;
+            return 2;
+        case rocsparse_format_coo:
+            candidates[0] = rocsparse_spmv_alg_coo;
+            candidates[1] = rocsparse_spmv_alg_coo_atomic;
+            return 2;
+        default:
+            candidates[0] = rocsparse_spmv_alg_default;
+            return 1;
+        }
+    }
+
+    // HIPSPARSE_SPMV_TUNING_CACHE names a text file of "<fingerprint> <algorithm>" lines
+    // that keeps the tuning results across runs. It is read on first use, or when the
+    // variable names another file, and every new result is appended to it.
+    static const char* getSpMVTuningCachePath()
+    {
+        return getenv("HIPSPARSE_SPMV_TUNING_CACHE");
+    }
+
+    // Must be called with spmvTuningMutex() held
+    static std::unordered_map<uint64_t, int>& spmvTuningCache()
+    {
+        static std::unordered_map<uint64_t, int> cache;
+        static std::string                       loadedPath;
+        static bool                              loaded = false;
+
+        // Forget the results of a file that is no longer named
+        const char* path = getSpMVTuningCachePath();
+        if(path == nullptr)
+        {
+            loaded = false;
+            cache.clear();
+        }
+        else if(!loaded || loadedPath != path)
+        {
+            loaded     = true;
+            loadedPath = path;
+            cache.clear();
+
+            std::ifstream file(loadedPath);
+            uint64_t      fingerprint;
+            int           alg;
+            while(file >> std::hex >> fingerprint >> std::dec >> alg)
+            {
+                cache[fingerprint] = alg;
+            }
+        }
+
+        return cache;
+    }
+
+    static bool loadSpMVTuning(uint64_t                  fingerprint,
+                               const rocsparse_spmv_alg* candidates,
+                               int                       count,
+                               rocsparse_spmv_alg*       alg)
+    {
+        std::lock_guard<std::mutex> lock(spmvTuningMutex());
+
+        auto it = spmvTuningCache().find(fingerprint);
+        if(it == spmvTuningCache().end())
+        {
+            return false;
+        }
+
+        // Ignore entries written by a rocSPARSE with a different set of algorithms
+        for(int i = 0; i < count; ++i)
+        {
+            if(static_cast<int>(candidates[i]) == it->second)
+            {
+                *alg = candidates[i];
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static void storeSpMVTuning(uint64_t fingerprint, rocsparse_spmv_alg alg)
+    {
+        std::lock_guard<std::mutex> lock(spmvTuningMutex());
+
+        spmvTuningCache()[fingerprint] = static_cast<int>(alg);
+
+        const char* path = getSpMVTuningCachePath();
+        if(path == nullptr)
+        {
+            return;
+        }
+
+        std::ofstream file(path, std::ios::app);
+        file << std::hex << std::setw(16) << std::setfill('0') << fingerprint << std::dec << ' '
+             << static_cast<int>(alg) << '\n';
+    }
+
+    static void hashBytes(uint64_t& hash, const void* data, size_t size)
+    {
+        // FNV-1a
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for(size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    static hipsparseStatus_t hashDeviceIndices(hipStream_t         stream,
+                                               uint64_t&           hash,
+                                               const void*         data,
+                                               rocsparse_indextype type,
+                                               size_t              count)
+    {
+        size_t width = (type == rocsparse_indextype_i64)   ? sizeof(int64_t)
+                       : (type == rocsparse_indextype_u16) ? sizeof(uint16_t)
+                                                           : sizeof(int32_t);
+
+        std::vector<char> host(width * count);
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(host.data(), data, host.size(), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        hashBytes(hash, host.data(), host.size());
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Fingerprint of a SpMV problem for the tuning cache. It covers the shape and types of
+    // the matrix, the operation, the device architecture and the rocSPARSE version. The row
+    // lengths decide which algorithm wins, so the offsets of CSR and CSC matrices and the
+    // row indices of COO matrices are hashed as well.
+    static hipsparseStatus_t getSpMVFingerprint(hipsparseHandle_t          handle,
+                                                hipsparseOperation_t       opA,
+                                                hipsparseConstSpMatDescr_t matA,
+                                                hipDataType                computeType,
+                                                uint64_t*                  fingerprint)
+    {
+        rocsparse_const_spmat_descr descr = (rocsparse_const_spmat_descr)matA;
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        int version;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_version((rocsparse_handle)handle, &version));
+
+        int64_t          rows, cols, nnz;
+        rocsparse_format format;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_size(descr, &rows, &cols, &nnz));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_format(descr, &format));
+
+        int             device;
+        hipDeviceProp_t prop;
+        RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+        RETURN_IF_HIP_ERROR(hipGetDeviceProperties(&prop, device));
+
+        uint64_t hash = 14695981039346656037ull;
+        hashBytes(hash, &rows, sizeof(rows));
+        hashBytes(hash, &cols, sizeof(cols));
+        hashBytes(hash, &nnz, sizeof(nnz));
+        hashBytes(hash, &format, sizeof(format));
+        hashBytes(hash, &opA, sizeof(opA));
+        hashBytes(hash, &computeType, sizeof(computeType));
+        hashBytes(hash, prop.gcnArchName, strlen(prop.gcnArchName));
+        hashBytes(hash, &version, sizeof(version));
+
+        if(format == rocsparse_format_csr || format == rocsparse_format_csc)
+        {
+            int64_t              m, n, k;
+            const void*          offsets;
+            const void*          ind;
+            const void*          val;
+            rocsparse_indextype  offsetsType;
+            rocsparse_indextype  indType;
+            rocsparse_index_base base;
+            rocsparse_datatype   valType;
+
+            if(format == rocsparse_format_csr)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(descr,
+                                                                  &m,
+                                                                  &n,
+                                                                  &k,
+                                                                  &offsets,
+                                                                  &ind,
+                                                                  &val,
+                                                                  &offsetsType,
+                                                                  &indType,
+                                                                  &base,
+                                                                  &valType));
+            }
+            else
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csc_get(descr,
+                                                                  &m,
+                                                                  &n,
+                                                                  &k,
+                                                                  &offsets,
+                                                                  &ind,
+                                                                  &val,
+                                                                  &offsetsType,
+                                                                  &indType,
+                                                                  &base,
+                                                                  &valType));
+            }
+
+            hashBytes(hash, &offsetsType, sizeof(offsetsType));
+            hashBytes(hash, &indType, sizeof(indType));
+            hashBytes(hash, &valType, sizeof(valType));
+
+            size_t count = ((format == rocsparse_format_csr) ? m : n) + 1;
+            RETURN_IF_HIPSPARSE_ERROR(hashDeviceIndices(stream, hash, offsets, offsetsType, count));
+        }
+        else if(format == rocsparse_format_coo)
+        {
+            int64_t              m, n, k;
+            const void*          rowInd;
+            const void*          colInd;
+            const void*          val;
+            rocsparse_indextype  indType;
+            rocsparse_index_base base;
+            rocsparse_datatype   valType;
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_coo_get(
+                descr, &m, &n, &k, &rowInd, &colInd, &val, &indType, &base, &valType));
+
+            hashBytes(hash, &indType, sizeof(indType));
+            hashBytes(hash, &valType, sizeof(valType));
+
+            RETURN_IF_HIPSPARSE_ERROR(hashDeviceIndices(stream, hash, rowInd, indType, k));
+        }
+
+        *fingerprint = hash;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t getSpMVVectorSize(hipsparseConstDnVecDescr_t vec, size_t* size)
+    {
+        int64_t            n;
+        const void*        values;
+        rocsparse_datatype dataType;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_dnvec_get(
+            (rocsparse_const_dnvec_descr)vec, &n, &values, &dataType));
+
+        switch(dataType)
+        {
+        case rocsparse_datatype_i8_r:
+        case rocsparse_datatype_u8_r:
+            *size = n;
+            return HIPSPARSE_STATUS_SUCCESS;
+#ifdef HIPSPARSE_ROCSPARSE_HALF_TYPES
+        case rocsparse_datatype_f16_r:
+        case rocsparse_datatype_bf16_r:
+            *size = n * 2;
+            return HIPSPARSE_STATUS_SUCCESS;
+#endif
+        case rocsparse_datatype_f32_r:
+        case rocsparse_datatype_i32_r:
+        case rocsparse_datatype_u32_r:
+            *size = n * 4;
+            return HIPSPARSE_STATUS_SUCCESS;
+        case rocsparse_datatype_f64_r:
+        case rocsparse_datatype_f32_c:
+            *size = n * 8;
+            return HIPSPARSE_STATUS_SUCCESS;
+        case rocsparse_datatype_f64_c:
+            *size = n * 16;
+            return HIPSPARSE_STATUS_SUCCESS;
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    // Times every candidate on the actual operands and returns the fastest. y is saved to
+    // the workspace pool first and restored at the end, so the tuning has no visible effect
+    // besides the preprocessing of the chosen algorithm, which the caller still has to do.
+    static hipsparseStatus_t tuneSpMV(hipsparseHandle_t           handle,
+                                      hipsparseOperation_t        opA,
+                                      const void*                 alpha,
+                                      hipsparseConstSpMatDescr_t  matA,
+                                      hipsparseConstDnVecDescr_t  vecX,
+                                      const void*                 beta,
+                                      const hipsparseDnVecDescr_t vecY,
+                                      hipDataType                 computeType,
+                                      const rocsparse_spmv_alg*   candidates,
+                                      int                         count,
+                                      void*                       externalBuffer,
+                                      rocsparse_spmv_alg*         winner)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
-    }
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
 
-    // Get stream
-    hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+        size_t ySize;
+        RETURN_IF_HIPSPARSE_ERROR(getSpMVVectorSize(vecY, &ySize));
 
-    // Unsort CSR column indices based on the given permutation
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_isctr((rocsparse_handle)handle,
-                                              nnz,
-                                              csrColInd,
-                                              info->P,
-                                              (int*)pBuffer,
-                                              rocsparse_index_base_zero));
+        void* y;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnvec_get_values((rocsparse_dnvec_descr)vecY, &y));
 
-    // Copy unsorted column indices back to csrColInd
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(csrColInd, pBuffer, sizeof(int) * nnz, hipMemcpyDeviceToDevice, stream));
+        void* backup;
+        RETURN_IF_HIPSPARSE_ERROR(getWorkspace(handle, ySize, &backup));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(backup, y, ySize, hipMemcpyDeviceToDevice, stream));
 
-    // Unsort CSR values based on the given permutation
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsctr(
-        handle, nnz, csrVal, info->P, (hipComplex*)pBuffer, HIPSPARSE_INDEX_BASE_ZERO));
+        hipEvent_t start;
+        hipEvent_t stop;
+        RETURN_IF_HIP_ERROR(hipEventCreate(&start));
+        hipError_t err = hipEventCreate(&stop);
+        if(err != hipSuccess)
+        {
+            hipEventDestroy(start);
+            return hipErrorToHIPSPARSEStatus(err);
+        }
 
-    // Copy unsorted values back to csrVal
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(csrVal, pBuffer, sizeof(hipComplex) * nnz, hipMemcpyDeviceToDevice, stream));
+        rocsparse_operation hccOpA     = hipOperationToHCCOperation(opA);
+        rocsparse_datatype  hccType    = hipDataTypeToHCCDataType(computeType);
+        float               bestTime   = 0.0f;
+        bool                found      = false;
+        size_t              bufferSize = 0;
+        hipsparseStatus_t   status     = HIPSPARSE_STATUS_SUCCESS;
 
-    return HIPSPARSE_STATUS_SUCCESS;
-}
+        for(int c = 0; c < count; ++c)
+        {
+            auto run = [&](rocsparse_spmv_stage stage) {
+                return rocsparse_spmv((rocsparse_handle)handle,
+                                      hccOpA,
+                                      alpha,
+                                      (rocsparse_const_spmat_descr)matA,
+                                      (rocsparse_const_dnvec_descr)vecX,
+                                      beta,
+                                      (const rocsparse_dnvec_descr)vecY,
+                                      hccType,
+                                      candidates[c],
+                                      stage,
+                                      &bufferSize,
+                                      externalBuffer);
+            };
+
+            // A candidate that does not support this problem is skipped
+            if(run(rocsparse_spmv_stage_preprocess) != rocsparse_status_success
+               || run(rocsparse_spmv_stage_compute) != rocsparse_status_success)
+            {
+                continue;
+            }
+
+            err = hipEventRecord(start, stream);
+            for(int i = 0; i < spmvTuningIterations && err == hipSuccess; ++i)
+            {
+                if(run(rocsparse_spmv_stage_compute) != rocsparse_status_success)
+                {
+                    err = hipErrorUnknown;
+                }
+            }
+            err = (err == hipSuccess) ? hipEventRecord(stop, stream) : err;
+            err = (err == hipSuccess) ? hipEventSynchronize(stop) : err;
+
+            float time;
+            err = (err == hipSuccess) ? hipEventElapsedTime(&time, start, stop) : err;
+            if(err != hipSuccess)
+            {
+                status = hipErrorToHIPSPARSEStatus(err);
+                break;
+            }
+
+            if(!found || time < bestTime)
+            {
+                *winner  = candidates[c];
+                bestTime = time;
+                found    = true;
+            }
+        }
 
-hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     hipDoubleComplex*         csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
-{
-    // Test for bad args
-    if(handle == nullptr)
-    {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
-    }
+        hipEventDestroy(start);
+        hipEventDestroy(stop);
 
-    // Invalid sizes
-    if(m < 0 || n < 0 || nnz < 0)
-    {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
-    }
+        // y is restored even if a candidate failed
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(y, backup, ySize, hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_HIPSPARSE_ERROR(status);
 
-    // Quick return
-    if(m == 0 || n == 0 || nnz == 0)
-    {
-        // nnz must be 0
-        if(nnz != 0)
+        if(!found)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            *winner = rocsparse_spmv_alg_default;
         }
 
         return HIPSPARSE_STATUS_SUCCESS;
     }
 
-    // Invalid pointers
-    if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
-       || info == nullptr || pBuffer == nullptr)
-    {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
-    }
-
-    // Check for valid permutation array
-    if(info->P == nullptr || info->size != nnz)
+    // Algorithm used by HIPSPARSE_SPMV_ALG_AUTO: the one remembered on the descriptor,
+    // else the one found in the tuning cache file, else the winner of a new tuning
+    static hipsparseStatus_t selectSpMVAlg(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           void*                       externalBuffer,
+                                           rocsparse_spmv_alg*         alg)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
-    }
+        if(getSpMVTuning(matA, opA, computeType, alg))
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
 
-    // Get stream
-    hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+        rocsparse_spmv_alg candidates[2];
+        int                count = getSpMVCandidates(matA, candidates);
 
-    // Unsort CSR column indices based on the given permutation
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_isctr((rocsparse_handle)handle,
-                                              nnz,
-                                              csrColInd,
-                                              info->P,
-                                              (int*)pBuffer,
-                                              rocsparse_index_base_zero));
+        if(count == 1)
+        {
+            *alg = candidates[0];
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
 
-    // Copy unsorted column indices back to csrColInd
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(csrColInd, pBuffer, sizeof(int) * nnz, hipMemcpyDeviceToDevice, stream));
+        bool     persistent = (getSpMVTuningCachePath() != nullptr);
+        uint64_t fingerprint;
 
-    // Unsort CSR values based on the given permutation
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseZsctr(
-        handle, nnz, csrVal, info->P, (hipDoubleComplex*)pBuffer, HIPSPARSE_INDEX_BASE_ZERO));
+        if(persistent)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                getSpMVFingerprint(handle, opA, matA, computeType, &fingerprint));
+
+            if(loadSpMVTuning(fingerprint, candidates, count, alg))
+            {
+                setSpMVTuning(matA, opA, computeType, *alg);
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+        }
 
-    // Copy unsorted values back to csrVal
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        csrVal, pBuffer, sizeof(hipDoubleComplex) * nnz, hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_HIPSPARSE_ERROR(tuneSpMV(handle,
+                                           opA,
+                                           alpha,
+                                           matA,
+                                           vecX,
+                                           beta,
+                                           vecY,
+                                           computeType,
+                                           candidates,
+                                           count,
+                                           externalBuffer,
+                                           alg));
+
+        setSpMVTuning(matA, opA, computeType, *alg);
+
+        if(persistent)
+        {
+            storeSpMVTuning(fingerprint, *alg);
+        }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
 }
 
 /* Generic API */
@@ -13252,6 +19324,121 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
                                           hipsparse::hipDataTypeToHCCDataType(valueType)));
 }
 
+// rocSPARSE has no sliced ELL format
+hipsparseStatus_t hipsparseCreateSlicedEll(hipsparseSpMatDescr_t* spMatDescr,
+                                           int64_t                rows,
+                                           int64_t                cols,
+                                           int64_t                nnz,
+                                           int64_t                sellValuesSize,
+                                           int64_t                sliceSize,
+                                           void*                  sellSliceOffsets,
+                                           void*                  sellColInd,
+                                           void*                  sellValues,
+                                           hipsparseIndexType_t   sellSliceOffsetsType,
+                                           hipsparseIndexType_t   sellColIndType,
+                                           hipsparseIndexBase_t   idxBase,
+                                           hipDataType            valueType)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCreateConstSlicedEll(hipsparseConstSpMatDescr_t* spMatDescr,
+                                                int64_t                     rows,
+                                                int64_t                     cols,
+                                                int64_t                     nnz,
+                                                int64_t                     sellValuesSize,
+                                                int64_t                     sliceSize,
+                                                const void*                 sellSliceOffsets,
+                                                const void*                 sellColInd,
+                                                const void*                 sellValues,
+                                                hipsparseIndexType_t        sellSliceOffsetsType,
+                                                hipsparseIndexType_t        sellColIndType,
+                                                hipsparseIndexBase_t        idxBase,
+                                                hipDataType                 valueType)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCreateBsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                brows,
+                                     int64_t                bcols,
+                                     int64_t                bnnz,
+                                     int64_t                rowBlockSize,
+                                     int64_t                colBlockSize,
+                                     void*                  bsrRowOffsets,
+                                     void*                  bsrColInd,
+                                     void*                  bsrValues,
+                                     hipsparseIndexType_t   bsrRowOffsetsType,
+                                     hipsparseIndexType_t   bsrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType,
+                                     hipsparseOrder_t       order)
+{
+    // rocSPARSE blocks are square, their layout is given by the block direction
+    if(rowBlockSize != colBlockSize)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const rocsparse_direction block_dir
+        = (order == HIPSPARSE_ORDER_ROW) ? rocsparse_direction_row : rocsparse_direction_column;
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_bsr_descr((rocsparse_spmat_descr*)spMatDescr,
+                                   brows,
+                                   bcols,
+                                   bnnz,
+                                   block_dir,
+                                   rowBlockSize,
+                                   bsrRowOffsets,
+                                   bsrColInd,
+                                   bsrValues,
+                                   hipsparse::hipIndexTypeToHCCIndexType(bsrRowOffsetsType),
+                                   hipsparse::hipIndexTypeToHCCIndexType(bsrColIndType),
+                                   hipsparse::hipBaseToHCCBase(idxBase),
+                                   hipsparse::hipDataTypeToHCCDataType(valueType)));
+}
+
+hipsparseStatus_t hipsparseCreateConstBsr(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     brows,
+                                          int64_t                     bcols,
+                                          int64_t                     bnnz,
+                                          int64_t                     rowBlockSize,
+                                          int64_t                     colBlockSize,
+                                          const void*                 bsrRowOffsets,
+                                          const void*                 bsrColInd,
+                                          const void*                 bsrValues,
+                                          hipsparseIndexType_t        bsrRowOffsetsType,
+                                          hipsparseIndexType_t        bsrColIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType,
+                                          hipsparseOrder_t            order)
+{
+    // rocSPARSE blocks are square, their layout is given by the block direction
+    if(rowBlockSize != colBlockSize)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const rocsparse_direction block_dir
+        = (order == HIPSPARSE_ORDER_ROW) ? rocsparse_direction_row : rocsparse_direction_column;
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_const_bsr_descr((rocsparse_const_spmat_descr*)spMatDescr,
+                                         brows,
+                                         bcols,
+                                         bnnz,
+                                         block_dir,
+                                         rowBlockSize,
+                                         bsrRowOffsets,
+                                         bsrColInd,
+                                         bsrValues,
+                                         hipsparse::hipIndexTypeToHCCIndexType(bsrRowOffsetsType),
+                                         hipsparse::hipIndexTypeToHCCIndexType(bsrColIndType),
+                                         hipsparse::hipBaseToHCCBase(idxBase),
+                                         hipsparse::hipDataTypeToHCCDataType(valueType)));
+}
+
 hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
                                         int64_t                rows,
                                         int64_t                cols,
@@ -13399,6 +19586,8 @@ hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr
 
 hipsparseStatus_t hipsparseDestroySpMat(hipsparseConstSpMatDescr_t spMatDescr)
 {
+    hipsparse::forgetSpMVTuning(spMatDescr);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_destroy_spmat_descr((rocsparse_const_spmat_descr)spMatDescr));
 }
@@ -13474,6 +19663,174 @@ hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDe
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+hipsparseStatus_t hipsparseSlicedEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                        int64_t*                    rows,
+                                        int64_t*                    cols,
+                                        int64_t*                    nnz,
+                                        int64_t*                    sellValuesSize,
+                                        int64_t*                    sliceSize,
+                                        void**                      sellSliceOffsets,
+                                        void**                      sellColInd,
+                                        void**                      sellValues,
+                                        hipsparseIndexType_t*       sellSliceOffsetsType,
+                                        hipsparseIndexType_t*       sellColIndType,
+                                        hipsparseIndexBase_t*       idxBase,
+                                        hipDataType*                valueType)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseConstSlicedEllGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                             int64_t*                   rows,
+                                             int64_t*                   cols,
+                                             int64_t*                   nnz,
+                                             int64_t*                   sellValuesSize,
+                                             int64_t*                   sliceSize,
+                                             const void**               sellSliceOffsets,
+                                             const void**               sellColInd,
+                                             const void**               sellValues,
+                                             hipsparseIndexType_t*      sellSliceOffsetsType,
+                                             hipsparseIndexType_t*      sellColIndType,
+                                             hipsparseIndexBase_t*      idxBase,
+                                             hipDataType*               valueType)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseBsrGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    brows,
+                                  int64_t*                    bcols,
+                                  int64_t*                    bnnz,
+                                  int64_t*                    rowBlockSize,
+                                  int64_t*                    colBlockSize,
+                                  void**                      bsrRowOffsets,
+                                  void**                      bsrColInd,
+                                  void**                      bsrValues,
+                                  hipsparseIndexType_t*       bsrRowOffsetsType,
+                                  hipsparseIndexType_t*       bsrColIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType,
+                                  hipsparseOrder_t*           order)
+{
+    if(rowBlockSize == nullptr || colBlockSize == nullptr || order == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    rocsparse_indextype  hcc_row_offsets_type;
+    rocsparse_indextype  hcc_col_ind_type;
+    rocsparse_index_base hcc_index_base;
+    rocsparse_datatype   hcc_data_type;
+    rocsparse_direction  hcc_block_direction;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_bsr_get((const rocsparse_spmat_descr)spMatDescr,
+                          brows,
+                          bcols,
+                          bnnz,
+                          &hcc_block_direction,
+                          rowBlockSize,
+                          bsrRowOffsets,
+                          bsrColInd,
+                          bsrValues,
+                          bsrRowOffsetsType != nullptr ? &hcc_row_offsets_type : nullptr,
+                          bsrColIndType != nullptr ? &hcc_col_ind_type : nullptr,
+                          idxBase != nullptr ? &hcc_index_base : nullptr,
+                          valueType != nullptr ? &hcc_data_type : nullptr));
+
+    // rocSPARSE only has square blocks
+    *colBlockSize = *rowBlockSize;
+
+    if(bsrRowOffsetsType != nullptr)
+    {
+        *bsrRowOffsetsType = hipsparse::HCCIndexTypeToHIPIndexType(hcc_row_offsets_type);
+    }
+    if(bsrColIndType != nullptr)
+    {
+        *bsrColIndType = hipsparse::HCCIndexTypeToHIPIndexType(hcc_col_ind_type);
+    }
+    if(idxBase != nullptr)
+    {
+        *idxBase = hipsparse::HCCBaseToHIPBase(hcc_index_base);
+    }
+    if(valueType != nullptr)
+    {
+        *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
+    }
+
+    *order = (hcc_block_direction == rocsparse_direction_row) ? HIPSPARSE_ORDER_ROW
+                                                              : HIPSPARSE_ORDER_COL;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstBsrGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   brows,
+                                       int64_t*                   bcols,
+                                       int64_t*                   bnnz,
+                                       int64_t*                   rowBlockSize,
+                                       int64_t*                   colBlockSize,
+                                       const void**               bsrRowOffsets,
+                                       const void**               bsrColInd,
+                                       const void**               bsrValues,
+                                       hipsparseIndexType_t*      bsrRowOffsetsType,
+                                       hipsparseIndexType_t*      bsrColIndType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType,
+                                       hipsparseOrder_t*          order)
+{
+    if(rowBlockSize == nullptr || colBlockSize == nullptr || order == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    rocsparse_indextype  hcc_row_offsets_type;
+    rocsparse_indextype  hcc_col_ind_type;
+    rocsparse_index_base hcc_index_base;
+    rocsparse_datatype   hcc_data_type;
+    rocsparse_direction  hcc_block_direction;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_const_bsr_get((const rocsparse_const_spmat_descr)spMatDescr,
+                                brows,
+                                bcols,
+                                bnnz,
+                                &hcc_block_direction,
+                                rowBlockSize,
+                                bsrRowOffsets,
+                                bsrColInd,
+                                bsrValues,
+                                bsrRowOffsetsType != nullptr ? &hcc_row_offsets_type : nullptr,
+                                bsrColIndType != nullptr ? &hcc_col_ind_type : nullptr,
+                                idxBase != nullptr ? &hcc_index_base : nullptr,
+                                valueType != nullptr ? &hcc_data_type : nullptr));
+
+    // rocSPARSE only has square blocks
+    *colBlockSize = *rowBlockSize;
+
+    if(bsrRowOffsetsType != nullptr)
+    {
+        *bsrRowOffsetsType = hipsparse::HCCIndexTypeToHIPIndexType(hcc_row_offsets_type);
+    }
+    if(bsrColIndType != nullptr)
+    {
+        *bsrColIndType = hipsparse::HCCIndexTypeToHIPIndexType(hcc_col_ind_type);
+    }
+    if(idxBase != nullptr)
+    {
+        *idxBase = hipsparse::HCCBaseToHIPBase(hcc_index_base);
+    }
+    if(valueType != nullptr)
+    {
+        *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
+    }
+
+    *order = (hcc_block_direction == rocsparse_direction_row) ? HIPSPARSE_ORDER_ROW
+                                                              : HIPSPARSE_ORDER_COL;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
                                   int64_t*                    rows,
                                   int64_t*                    cols,
@@ -13654,6 +20011,8 @@ hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 csrColInd,
                                           void*                 csrValues)
 {
+    hipsparse::forgetSpMVTuning(spMatDescr);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csr_set_pointers(
         (rocsparse_spmat_descr)spMatDescr, csrRowOffsets, csrColInd, csrValues));
 }
@@ -13739,6 +20098,8 @@ hipsparseStatus_t hipsparseCscSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 cscRowInd,
                                           void*                 cscValues)
 {
+    hipsparse::forgetSpMVTuning(spMatDescr);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csc_set_pointers(
         (rocsparse_spmat_descr)spMatDescr, cscColOffsets, cscRowInd, cscValues));
 }
@@ -13748,10 +20109,61 @@ hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 cooColInd,
                                           void*                 cooValues)
 {
+    hipsparse::forgetSpMVTuning(spMatDescr);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coo_set_pointers(
         (rocsparse_spmat_descr)spMatDescr, cooRowInd, cooColInd, cooValues));
 }
 
+hipsparseStatus_t hipsparseBsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 bsrRowOffsets,
+                                          void*                 bsrColInd,
+                                          void*                 bsrValues)
+{
+    if(spMatDescr == nullptr || bsrRowOffsets == nullptr || bsrValues == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t              mb;
+    int64_t              nb;
+    int64_t              nnzb;
+    int64_t              block_dim;
+    void*                row_offsets;
+    void*                col_ind;
+    void*                values;
+    rocsparse_direction  block_direction;
+    rocsparse_indextype  row_offsets_type;
+    rocsparse_indextype  col_ind_type;
+    rocsparse_index_base index_base;
+    rocsparse_datatype   data_type;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_bsr_get((const rocsparse_spmat_descr)spMatDescr,
+                                                &mb,
+                                                &nb,
+                                                &nnzb,
+                                                &block_direction,
+                                                &block_dim,
+                                                &row_offsets,
+                                                &col_ind,
+                                                &values,
+                                                &row_offsets_type,
+                                                &col_ind_type,
+                                                &index_base,
+                                                &data_type));
+
+    // rocSPARSE can only replace the values of a BSR descriptor, the sparsity pattern stays
+    if(bsrRowOffsets != row_offsets || bsrColInd != col_ind)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparse::forgetSpMVTuning(spMatDescr);
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmat_set_values((rocsparse_spmat_descr)spMatDescr, bsrValues));
+}
+
 hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
                                         int64_t*                   rows,
                                         int64_t*                   cols,
@@ -13826,16 +20238,59 @@ hipsparseStatus_t hipsparseCooSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
         (rocsparse_spmat_descr)spMatDescr, batchCount, batchStride));
 }
 
-hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
-                                              int                   batchCount,
-                                              int64_t               offsetsBatchStride,
-                                              int64_t               columnsValuesBatchStride)
-{
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_csr_set_strided_batch((rocsparse_spmat_descr)spMatDescr,
-                                        batchCount,
-                                        offsetsBatchStride,
-                                        columnsValuesBatchStride));
+hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               offsetsBatchStride,
+                                              int64_t               columnsValuesBatchStride)
+{
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_csr_set_strided_batch((rocsparse_spmat_descr)spMatDescr,
+                                        batchCount,
+                                        offsetsBatchStride,
+                                        columnsValuesBatchStride));
+}
+
+hipsparseStatus_t hipsparseCsrSetVariableBatch(hipsparseSpMatDescr_t spMatDescr,
+                                               int                   batchCount,
+                                               const int64_t*        batchRowOffsets,
+                                               const int64_t*        batchColOffsets)
+{
+    if(spMatDescr == nullptr || batchRowOffsets == nullptr || batchColOffsets == nullptr
+       || batchCount <= 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    rocsparse_const_spmat_descr descr = (rocsparse_const_spmat_descr)spMatDescr;
+
+    int64_t          rows, cols, nnz;
+    rocsparse_format format;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_size(descr, &rows, &cols, &nnz));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_format(descr, &format));
+
+    if(format != rocsparse_format_csr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    for(int b = 0; b < batchCount; ++b)
+    {
+        if(batchRowOffsets[b + 1] < batchRowOffsets[b]
+           || batchColOffsets[b + 1] < batchColOffsets[b])
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+    }
+
+    if(batchRowOffsets[0] != 0 || batchColOffsets[0] != 0 || batchRowOffsets[batchCount] != rows
+       || batchColOffsets[batchCount] != cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The batches of a block diagonal matrix do not interact, rocSPARSE computes them in a
+    // single launch without knowing the partition
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseConstSpMatDescr_t spMatDescr,
@@ -14073,6 +20528,8 @@ hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t          handle,
                                  const void*                beta,
                                  hipsparseDnVecDescr_t      vecY)
 {
+    HIPSPARSE_LOG_CALL(handle, alpha, vecX, beta, vecY);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_axpby((rocsparse_handle)handle,
                                                                  alpha,
                                                                  (rocsparse_const_spvec_descr)vecX,
@@ -14084,6 +20541,8 @@ hipsparseStatus_t hipsparseGather(hipsparseHandle_t          handle,
                                   hipsparseConstDnVecDescr_t vecY,
                                   hipsparseSpVecDescr_t      vecX)
 {
+    HIPSPARSE_LOG_CALL(handle, vecY, vecX);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_gather(
         (rocsparse_handle)handle, (rocsparse_const_dnvec_descr)vecY, (rocsparse_spvec_descr)vecX));
 }
@@ -14092,6 +20551,8 @@ hipsparseStatus_t hipsparseScatter(hipsparseHandle_t          handle,
                                    hipsparseConstSpVecDescr_t vecX,
                                    hipsparseDnVecDescr_t      vecY)
 {
+    HIPSPARSE_LOG_CALL(handle, vecX, vecY);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scatter(
         (rocsparse_handle)handle, (rocsparse_const_spvec_descr)vecX, (rocsparse_dnvec_descr)vecY));
 }
@@ -14102,6 +20563,8 @@ hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
                                hipsparseSpVecDescr_t vecX,
                                hipsparseDnVecDescr_t vecY)
 {
+    HIPSPARSE_LOG_CALL(handle, c_coeff, s_coeff, vecX, vecY);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_rot((rocsparse_handle)handle,
                                                                c_coeff,
                                                                s_coeff,
@@ -14109,12 +20572,607 @@ hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
                                                                (rocsparse_dnvec_descr)vecY));
 }
 
+namespace hipsparse
+{
+    static hipsparseStatus_t getDataTypeSize(hipDataType dataType, size_t& size);
+
+    static bool isBsrMatrix(hipsparseConstSpMatDescr_t mat)
+    {
+        rocsparse_format format;
+        return mat != nullptr
+               && rocsparse_spmat_get_format((rocsparse_const_spmat_descr)mat, &format)
+                      == rocsparse_status_success
+               && format == rocsparse_format_bsr;
+    }
+
+    // rocSPARSE has no generic BSR triangular solve or BSR dense conversion, both run on the
+    // legacy BSR routines, which take 32 bit indices
+    struct bsrMatrix
+    {
+        int                  mb;
+        int                  nb;
+        int                  nnzb;
+        int                  blockDim;
+        const int*           rowPtr;
+        const int*           colInd;
+        const void*          values;
+        hipsparseDirection_t dir;
+        hipsparseIndexBase_t base;
+        hipDataType          valueType;
+    };
+
+    static hipsparseStatus_t getBsrMatrix(hipsparseConstSpMatDescr_t mat, bsrMatrix& bsr)
+    {
+        int64_t              mb;
+        int64_t              nb;
+        int64_t              nnzb;
+        int64_t              rowBlockSize;
+        int64_t              colBlockSize;
+        const void*          rowPtr;
+        const void*          colInd;
+        hipsparseIndexType_t rowPtrType;
+        hipsparseIndexType_t colIndType;
+        hipsparseOrder_t     order;
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseConstBsrGet(mat,
+                                                       &mb,
+                                                       &nb,
+                                                       &nnzb,
+                                                       &rowBlockSize,
+                                                       &colBlockSize,
+                                                       &rowPtr,
+                                                       &colInd,
+                                                       &bsr.values,
+                                                       &rowPtrType,
+                                                       &colIndType,
+                                                       &bsr.base,
+                                                       &bsr.valueType,
+                                                       &order));
+
+        if(rowPtrType != HIPSPARSE_INDEX_32I || colIndType != HIPSPARSE_INDEX_32I)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        bsr.mb       = static_cast<int>(mb);
+        bsr.nb       = static_cast<int>(nb);
+        bsr.nnzb     = static_cast<int>(nnzb);
+        bsr.blockDim = static_cast<int>(rowBlockSize);
+        bsr.rowPtr   = static_cast<const int*>(rowPtr);
+        bsr.colInd   = static_cast<const int*>(colInd);
+        bsr.dir
+            = (order == HIPSPARSE_ORDER_ROW) ? HIPSPARSE_DIRECTION_ROW : HIPSPARSE_DIRECTION_COLUMN;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Copies the index base, fill mode and diagonal type of a generic matrix into a legacy
+    // matrix descriptor
+    static hipsparseStatus_t setLegacyMatDescr(hipsparseConstSpMatDescr_t mat,
+                                               hipsparseIndexBase_t       base,
+                                               hipsparseMatDescr_t        descr)
+    {
+        hipsparseFillMode_t fillMode;
+        hipsparseDiagType_t diagType;
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetAttribute(
+            mat, HIPSPARSE_SPMAT_FILL_MODE, &fillMode, sizeof(fillMode)));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetAttribute(
+            mat, HIPSPARSE_SPMAT_DIAG_TYPE, &diagType, sizeof(diagType)));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, base));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatFillMode(descr, fillMode));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatDiagType(descr, diagType));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t bsrsvBufferSize(hipsparseHandle_t    handle,
+                                             hipsparseOperation_t opA,
+                                             const bsrMatrix&     A,
+                                             hipsparseMatDescr_t  descr,
+                                             bsrsv2Info_t         info,
+                                             size_t*              pBufferSizeInBytes)
+    {
+        // The legacy buffer size queries take non-const values they never write to
+        void* values = const_cast<void*>(A.values);
+
+        switch(A.valueType)
+        {
+        case HIP_R_32F:
+            return hipsparseSbsrsv2_bufferSizeExt(handle,
+                                                  A.dir,
+                                                  opA,
+                                                  A.mb,
+                                                  A.nnzb,
+                                                  descr,
+                                                  (float*)values,
+                                                  A.rowPtr,
+                                                  A.colInd,
+                                                  A.blockDim,
+                                                  info,
+                                                  pBufferSizeInBytes);
+        case HIP_R_64F:
+            return hipsparseDbsrsv2_bufferSizeExt(handle,
+                                                  A.dir,
+                                                  opA,
+                                                  A.mb,
+                                                  A.nnzb,
+                                                  descr,
+                                                  (double*)values,
+                                                  A.rowPtr,
+                                                  A.colInd,
+                                                  A.blockDim,
+                                                  info,
+                                                  pBufferSizeInBytes);
+        case HIP_C_32F:
+            return hipsparseCbsrsv2_bufferSizeExt(handle,
+                                                  A.dir,
+                                                  opA,
+                                                  A.mb,
+                                                  A.nnzb,
+                                                  descr,
+                                                  (hipComplex*)values,
+                                                  A.rowPtr,
+                                                  A.colInd,
+                                                  A.blockDim,
+                                                  info,
+                                                  pBufferSizeInBytes);
+        case HIP_C_64F:
+            return hipsparseZbsrsv2_bufferSizeExt(handle,
+                                                  A.dir,
+                                                  opA,
+                                                  A.mb,
+                                                  A.nnzb,
+                                                  descr,
+                                                  (hipDoubleComplex*)values,
+                                                  A.rowPtr,
+                                                  A.colInd,
+                                                  A.blockDim,
+                                                  info,
+                                                  pBufferSizeInBytes);
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    static hipsparseStatus_t bsrsvAnalysis(hipsparseHandle_t    handle,
+                                           hipsparseOperation_t opA,
+                                           const bsrMatrix&     A,
+                                           hipsparseMatDescr_t  descr,
+                                           bsrsv2Info_t         info,
+                                           void*                buffer)
+    {
+        switch(A.valueType)
+        {
+        case HIP_R_32F:
+            return hipsparseSbsrsv2_analysis(handle,
+                                             A.dir,
+                                             opA,
+                                             A.mb,
+                                             A.nnzb,
+                                             descr,
+                                             (const float*)A.values,
+                                             A.rowPtr,
+                                             A.colInd,
+                                             A.blockDim,
+                                             info,
+                                             HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                             buffer);
+        case HIP_R_64F:
+            return hipsparseDbsrsv2_analysis(handle,
+                                             A.dir,
+                                             opA,
+                                             A.mb,
+                                             A.nnzb,
+                                             descr,
+                                             (const double*)A.values,
+                                             A.rowPtr,
+                                             A.colInd,
+                                             A.blockDim,
+                                             info,
+                                             HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                             buffer);
+        case HIP_C_32F:
+            return hipsparseCbsrsv2_analysis(handle,
+                                             A.dir,
+                                             opA,
+                                             A.mb,
+                                             A.nnzb,
+                                             descr,
+                                             (const hipComplex*)A.values,
+                                             A.rowPtr,
+                                             A.colInd,
+                                             A.blockDim,
+                                             info,
+                                             HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                             buffer);
+        case HIP_C_64F:
+            return hipsparseZbsrsv2_analysis(handle,
+                                             A.dir,
+                                             opA,
+                                             A.mb,
+                                             A.nnzb,
+                                             descr,
+                                             (const hipDoubleComplex*)A.values,
+                                             A.rowPtr,
+                                             A.colInd,
+                                             A.blockDim,
+                                             info,
+                                             HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                             buffer);
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    static hipsparseStatus_t bsrsvSolve(hipsparseHandle_t    handle,
+                                        hipsparseOperation_t opA,
+                                        const void*          alpha,
+                                        const bsrMatrix&     A,
+                                        hipsparseMatDescr_t  descr,
+                                        bsrsv2Info_t         info,
+                                        const void*          x,
+                                        void*                y,
+                                        void*                buffer)
+    {
+        switch(A.valueType)
+        {
+        case HIP_R_32F:
+            return hipsparseSbsrsv2_solve(handle,
+                                          A.dir,
+                                          opA,
+                                          A.mb,
+                                          A.nnzb,
+                                          (const float*)alpha,
+                                          descr,
+                                          (const float*)A.values,
+                                          A.rowPtr,
+                                          A.colInd,
+                                          A.blockDim,
+                                          info,
+                                          (const float*)x,
+                                          (float*)y,
+                                          HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                          buffer);
+        case HIP_R_64F:
+            return hipsparseDbsrsv2_solve(handle,
+                                          A.dir,
+                                          opA,
+                                          A.mb,
+                                          A.nnzb,
+                                          (const double*)alpha,
+                                          descr,
+                                          (const double*)A.values,
+                                          A.rowPtr,
+                                          A.colInd,
+                                          A.blockDim,
+                                          info,
+                                          (const double*)x,
+                                          (double*)y,
+                                          HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                          buffer);
+        case HIP_C_32F:
+            return hipsparseCbsrsv2_solve(handle,
+                                          A.dir,
+                                          opA,
+                                          A.mb,
+                                          A.nnzb,
+                                          (const hipComplex*)alpha,
+                                          descr,
+                                          (const hipComplex*)A.values,
+                                          A.rowPtr,
+                                          A.colInd,
+                                          A.blockDim,
+                                          info,
+                                          (const hipComplex*)x,
+                                          (hipComplex*)y,
+                                          HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                          buffer);
+        case HIP_C_64F:
+            return hipsparseZbsrsv2_solve(handle,
+                                          A.dir,
+                                          opA,
+                                          A.mb,
+                                          A.nnzb,
+                                          (const hipDoubleComplex*)alpha,
+                                          descr,
+                                          (const hipDoubleComplex*)A.values,
+                                          A.rowPtr,
+                                          A.colInd,
+                                          A.blockDim,
+                                          info,
+                                          (const hipDoubleComplex*)x,
+                                          (hipDoubleComplex*)y,
+                                          HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                          buffer);
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    // BSR to dense conversion expands the matrix to CSR in the external buffer, row
+    // pointers first, then column indices and values
+    static hipsparseStatus_t bsrToDenseBufferSize(const bsrMatrix& A, size_t& bufferSize)
+    {
+        const int64_t m   = static_cast<int64_t>(A.mb) * A.blockDim;
+        const int64_t n   = static_cast<int64_t>(A.nb) * A.blockDim;
+        const int64_t nnz = static_cast<int64_t>(A.nnzb) * A.blockDim * A.blockDim;
+
+        // The legacy CSR routines take 32 bit sizes
+        if(m > std::numeric_limits<int>::max() || n > std::numeric_limits<int>::max()
+           || nnz > std::numeric_limits<int>::max())
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        size_t valueSize;
+        RETURN_IF_HIPSPARSE_ERROR(getDataTypeSize(A.valueType, valueSize));
+
+        bufferSize = alignWorkspaceSize(sizeof(int) * (m + 1));
+        bufferSize += alignWorkspaceSize(sizeof(int) * std::max<int64_t>(nnz, 1));
+        bufferSize += alignWorkspaceSize(valueSize * std::max<int64_t>(nnz, 1));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // A row major dense matrix is stored like its column major transpose, which is the CSR
+    // matrix read as CSC
+    static hipsparseStatus_t bsrToCsrToDense(hipsparseHandle_t   handle,
+                                             const bsrMatrix&    A,
+                                             hipsparseMatDescr_t descr,
+                                             int*                csrRowPtr,
+                                             int*                csrColInd,
+                                             void*               csrVal,
+                                             int                 m,
+                                             int                 n,
+                                             hipsparseOrder_t    order,
+                                             void*               dense,
+                                             int                 ld)
+    {
+        switch(A.valueType)
+        {
+        case HIP_R_32F:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseSbsr2csr(handle,
+                                                        A.dir,
+                                                        A.mb,
+                                                        A.nb,
+                                                        descr,
+                                                        (const float*)A.values,
+                                                        A.rowPtr,
+                                                        A.colInd,
+                                                        A.blockDim,
+                                                        descr,
+                                                        (float*)csrVal,
+                                                        csrRowPtr,
+                                                        csrColInd));
+
+            if(order == HIPSPARSE_ORDER_COL)
+            {
+                return hipsparseScsr2dense(handle,
+                                           m,
+                                           n,
+                                           descr,
+                                           (const float*)csrVal,
+                                           csrRowPtr,
+                                           csrColInd,
+                                           (float*)dense,
+                                           ld);
+            }
+
+            return hipsparseScsc2dense(handle,
+                                       n,
+                                       m,
+                                       descr,
+                                       (const float*)csrVal,
+                                       csrColInd,
+                                       csrRowPtr,
+                                       (float*)dense,
+                                       ld);
+        }
+        case HIP_R_64F:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseDbsr2csr(handle,
+                                                        A.dir,
+                                                        A.mb,
+                                                        A.nb,
+                                                        descr,
+                                                        (const double*)A.values,
+                                                        A.rowPtr,
+                                                        A.colInd,
+                                                        A.blockDim,
+                                                        descr,
+                                                        (double*)csrVal,
+                                                        csrRowPtr,
+                                                        csrColInd));
+
+            if(order == HIPSPARSE_ORDER_COL)
+            {
+                return hipsparseDcsr2dense(handle,
+                                           m,
+                                           n,
+                                           descr,
+                                           (const double*)csrVal,
+                                           csrRowPtr,
+                                           csrColInd,
+                                           (double*)dense,
+                                           ld);
+            }
+
+            return hipsparseDcsc2dense(handle,
+                                       n,
+                                       m,
+                                       descr,
+                                       (const double*)csrVal,
+                                       csrColInd,
+                                       csrRowPtr,
+                                       (double*)dense,
+                                       ld);
+        }
+        case HIP_C_32F:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseCbsr2csr(handle,
+                                                        A.dir,
+                                                        A.mb,
+                                                        A.nb,
+                                                        descr,
+                                                        (const hipComplex*)A.values,
+                                                        A.rowPtr,
+                                                        A.colInd,
+                                                        A.blockDim,
+                                                        descr,
+                                                        (hipComplex*)csrVal,
+                                                        csrRowPtr,
+                                                        csrColInd));
+
+            if(order == HIPSPARSE_ORDER_COL)
+            {
+                return hipsparseCcsr2dense(handle,
+                                           m,
+                                           n,
+                                           descr,
+                                           (const hipComplex*)csrVal,
+                                           csrRowPtr,
+                                           csrColInd,
+                                           (hipComplex*)dense,
+                                           ld);
+            }
+
+            return hipsparseCcsc2dense(handle,
+                                       n,
+                                       m,
+                                       descr,
+                                       (const hipComplex*)csrVal,
+                                       csrColInd,
+                                       csrRowPtr,
+                                       (hipComplex*)dense,
+                                       ld);
+        }
+        case HIP_C_64F:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseZbsr2csr(handle,
+                                                        A.dir,
+                                                        A.mb,
+                                                        A.nb,
+                                                        descr,
+                                                        (const hipDoubleComplex*)A.values,
+                                                        A.rowPtr,
+                                                        A.colInd,
+                                                        A.blockDim,
+                                                        descr,
+                                                        (hipDoubleComplex*)csrVal,
+                                                        csrRowPtr,
+                                                        csrColInd));
+
+            if(order == HIPSPARSE_ORDER_COL)
+            {
+                return hipsparseZcsr2dense(handle,
+                                           m,
+                                           n,
+                                           descr,
+                                           (const hipDoubleComplex*)csrVal,
+                                           csrRowPtr,
+                                           csrColInd,
+                                           (hipDoubleComplex*)dense,
+                                           ld);
+            }
+
+            return hipsparseZcsc2dense(handle,
+                                       n,
+                                       m,
+                                       descr,
+                                       (const hipDoubleComplex*)csrVal,
+                                       csrColInd,
+                                       csrRowPtr,
+                                       (hipDoubleComplex*)dense,
+                                       ld);
+        }
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    static hipsparseStatus_t bsrToDense(hipsparseHandle_t          handle,
+                                        hipsparseConstSpMatDescr_t matA,
+                                        hipsparseDnMatDescr_t      matB,
+                                        void*                      buffer)
+    {
+        bsrMatrix A;
+        RETURN_IF_HIPSPARSE_ERROR(getBsrMatrix(matA, A));
+
+        size_t bufferSize;
+        RETURN_IF_HIPSPARSE_ERROR(bsrToDenseBufferSize(A, bufferSize));
+
+        int64_t          rows;
+        int64_t          cols;
+        int64_t          ld;
+        void*            dense;
+        hipDataType      denseType;
+        hipsparseOrder_t denseOrder;
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparseDnMatGet(matB, &rows, &cols, &ld, &dense, &denseType, &denseOrder));
+
+        if(denseType != A.valueType || ld > std::numeric_limits<int>::max())
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        const int m   = A.mb * A.blockDim;
+        const int n   = A.nb * A.blockDim;
+        const int nnz = A.nnzb * A.blockDim * A.blockDim;
+
+        char* ptr       = static_cast<char*>(buffer);
+        int*  csrRowPtr = reinterpret_cast<int*>(ptr);
+        ptr += alignWorkspaceSize(sizeof(int) * (m + 1));
+        int* csrColInd = reinterpret_cast<int*>(ptr);
+        ptr += alignWorkspaceSize(sizeof(int) * std::max(nnz, 1));
+        void* csrVal = ptr;
+
+        hipsparseMatDescr_t descr;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateMatDescr(&descr));
+
+        hipsparseStatus_t status = hipsparseSetMatIndexBase(descr, A.base);
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = bsrToCsrToDense(handle,
+                                     A,
+                                     descr,
+                                     csrRowPtr,
+                                     csrColInd,
+                                     csrVal,
+                                     m,
+                                     n,
+                                     denseOrder,
+                                     dense,
+                                     static_cast<int>(ld));
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyMatDescr(descr));
+        return status;
+    }
+}
+
 hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t           handle,
                                                     hipsparseConstSpMatDescr_t  matA,
                                                     hipsparseDnMatDescr_t       matB,
                                                     hipsparseSparseToDenseAlg_t alg,
                                                     size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    if(handle == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(hipsparse::isBsrMatrix(matA))
+    {
+        hipsparse::bsrMatrix A;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::getBsrMatrix(matA, A));
+        return hipsparse::bsrToDenseBufferSize(A, *pBufferSizeInBytes);
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                   (rocsparse_const_spmat_descr)matA,
@@ -14130,6 +21188,18 @@ hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
                                          hipsparseSparseToDenseAlg_t alg,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, matA, matB, alg, externalBuffer);
+
+    if(hipsparse::isBsrMatrix(matA))
+    {
+        if(handle == nullptr || matB == nullptr || externalBuffer == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return hipsparse::bsrToDense(handle, matA, matB, externalBuffer);
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                   (rocsparse_const_spmat_descr)matA,
@@ -14145,6 +21215,20 @@ hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t
                                                     hipsparseDenseToSparseAlg_t alg,
                                                     size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    if(handle == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The rocSPARSE BSR descriptor cannot take the block count, column indices and values
+    // that the analysis determines, so dense to BSR conversion is not available
+    if(hipsparse::isBsrMatrix(matB))
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                   (rocsparse_const_dnmat_descr)matA,
@@ -14160,6 +21244,8 @@ hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           ha
                                                   hipsparseDenseToSparseAlg_t alg,
                                                   void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, matA, matB, alg, externalBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                   (rocsparse_const_dnmat_descr)matA,
@@ -14175,6 +21261,8 @@ hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           han
                                                  hipsparseDenseToSparseAlg_t alg,
                                                  void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, matA, matB, alg, externalBuffer);
+
     size_t bufferSize = 4;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
@@ -14193,6 +21281,8 @@ hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
                                            hipDataType                computeType,
                                            size_t*                    pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, opX, vecX, vecY, result, computeType, pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spvv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opX),
@@ -14212,6 +21302,8 @@ hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
                                 hipDataType                computeType,
                                 void*                      externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, opX, vecX, vecY, result, computeType, externalBuffer);
+
     size_t bufferSize;
 
     // Check for buffer == nullptr as this is not done in rocsparse
@@ -14242,19 +21334,64 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmv((rocsparse_handle)handle,
-                       hipsparse::hipOperationToHCCOperation(opA),
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
                        alpha,
-                       (rocsparse_const_spmat_descr)matA,
-                       (rocsparse_const_dnvec_descr)vecX,
+                       matA,
+                       vecX,
                        beta,
-                       (const rocsparse_dnvec_descr)vecY,
-                       hipsparse::hipDataTypeToHCCDataType(computeType),
-                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
-                       rocsparse_spmv_stage_buffer_size,
-                       pBufferSizeInBytes,
-                       nullptr));
+                       vecY,
+                       computeType,
+                       alg,
+                       pBufferSizeInBytes);
+
+    if(alg != HIPSPARSE_SPMV_ALG_AUTO)
+    {
+        return hipsparse::rocSPARSEStatusToHIPStatus(
+            rocsparse_spmv((rocsparse_handle)handle,
+                           hipsparse::hipOperationToHCCOperation(opA),
+                           alpha,
+                           (rocsparse_const_spmat_descr)matA,
+                           (rocsparse_const_dnvec_descr)vecX,
+                           beta,
+                           (const rocsparse_dnvec_descr)vecY,
+                           hipsparse::hipDataTypeToHCCDataType(computeType),
+                           hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
+                           rocsparse_spmv_stage_buffer_size,
+                           pBufferSizeInBytes,
+                           nullptr));
+    }
+
+    if(pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The buffer has to fit every algorithm the tuning may pick
+    rocsparse_spmv_alg candidates[2];
+    int                count = hipsparse::getSpMVCandidates(matA, candidates);
+
+    *pBufferSizeInBytes = 0;
+    for(int c = 0; c < count; ++c)
+    {
+        size_t bufferSize;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 hipsparse::hipOperationToHCCOperation(opA),
+                                                 alpha,
+                                                 (rocsparse_const_spmat_descr)matA,
+                                                 (rocsparse_const_dnvec_descr)vecX,
+                                                 beta,
+                                                 (const rocsparse_dnvec_descr)vecY,
+                                                 hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                 candidates[c],
+                                                 rocsparse_spmv_stage_buffer_size,
+                                                 &bufferSize,
+                                                 nullptr));
+
+        *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, bufferSize);
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
@@ -14268,6 +21405,24 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       alpha,
+                       matA,
+                       vecX,
+                       beta,
+                       vecY,
+                       computeType,
+                       alg,
+                       externalBuffer);
+
+    rocsparse_spmv_alg hccAlg = hipsparse::hipSpMVAlgToHCCSpMVAlg(alg);
+    if(alg == HIPSPARSE_SPMV_ALG_AUTO)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::selectSpMVAlg(
+            handle, opA, alpha, matA, vecX, beta, vecY, computeType, externalBuffer, &hccAlg));
+    }
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmv((rocsparse_handle)handle,
@@ -14278,7 +21433,7 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
                        beta,
                        (const rocsparse_dnvec_descr)vecY,
                        hipsparse::hipDataTypeToHCCDataType(computeType),
-                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
+                       hccAlg,
                        rocsparse_spmv_stage_preprocess,
                        &bufferSize,
                        externalBuffer));
@@ -14295,6 +21450,25 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 hipsparseSpMVAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       alpha,
+                       matA,
+                       vecX,
+                       beta,
+                       vecY,
+                       computeType,
+                       alg,
+                       externalBuffer);
+
+    // Use the algorithm picked by hipsparseSpMV_preprocess. The tuning only runs there, so
+    // without it the default algorithm is used.
+    rocsparse_spmv_alg hccAlg = hipsparse::hipSpMVAlgToHCCSpMVAlg(alg);
+    if(alg == HIPSPARSE_SPMV_ALG_AUTO)
+    {
+        hipsparse::getSpMVTuning(matA, opA, computeType, &hccAlg);
+    }
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmv((rocsparse_handle)handle,
@@ -14305,12 +21479,125 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                        beta,
                        (const rocsparse_dnvec_descr)vecY,
                        hipsparse::hipDataTypeToHCCDataType(computeType),
-                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
+                       hccAlg,
                        rocsparse_spmv_stage_compute,
                        &bufferSize,
                        externalBuffer));
 }
 
+// rocSPARSE has no fused SpMV epilogues
+hipsparseStatus_t hipsparseSpMVDot_bufferSize(hipsparseHandle_t           handle,
+                                              hipsparseOperation_t        opA,
+                                              const void*                 alpha,
+                                              hipsparseConstSpMatDescr_t  matA,
+                                              hipsparseConstDnVecDescr_t  vecX,
+                                              const void*                 beta,
+                                              const hipsparseDnVecDescr_t vecY,
+                                              hipDataType                 computeType,
+                                              hipsparseSpMVAlg_t          alg,
+                                              size_t*                     pBufferSizeInBytes)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       alpha,
+                       matA,
+                       vecX,
+                       beta,
+                       vecY,
+                       computeType,
+                       alg,
+                       pBufferSizeInBytes);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpMVDot(hipsparseHandle_t           handle,
+                                   hipsparseOperation_t        opA,
+                                   const void*                 alpha,
+                                   hipsparseConstSpMatDescr_t  matA,
+                                   hipsparseConstDnVecDescr_t  vecX,
+                                   const void*                 beta,
+                                   const hipsparseDnVecDescr_t vecY,
+                                   void*                       result,
+                                   hipDataType                 computeType,
+                                   hipsparseSpMVAlg_t          alg,
+                                   void*                       externalBuffer)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       alpha,
+                       matA,
+                       vecX,
+                       beta,
+                       vecY,
+                       result,
+                       computeType,
+                       alg,
+                       externalBuffer);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpMVResidual_bufferSize(hipsparseHandle_t           handle,
+                                                   hipsparseOperation_t        opA,
+                                                   const void*                 alpha,
+                                                   hipsparseConstSpMatDescr_t  matA,
+                                                   hipsparseConstDnVecDescr_t  vecX,
+                                                   const void*                 beta,
+                                                   const hipsparseDnVecDescr_t vecY,
+                                                   hipsparseConstDnVecDescr_t  vecB,
+                                                   const hipsparseDnVecDescr_t vecR,
+                                                   hipDataType                 computeType,
+                                                   hipsparseSpMVAlg_t          alg,
+                                                   size_t*                     pBufferSizeInBytes)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       alpha,
+                       matA,
+                       vecX,
+                       beta,
+                       vecY,
+                       vecB,
+                       vecR,
+                       computeType,
+                       alg,
+                       pBufferSizeInBytes);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpMVResidual(hipsparseHandle_t           handle,
+                                        hipsparseOperation_t        opA,
+                                        const void*                 alpha,
+                                        hipsparseConstSpMatDescr_t  matA,
+                                        hipsparseConstDnVecDescr_t  vecX,
+                                        const void*                 beta,
+                                        const hipsparseDnVecDescr_t vecY,
+                                        hipsparseConstDnVecDescr_t  vecB,
+                                        const hipsparseDnVecDescr_t vecR,
+                                        void*                       result,
+                                        hipDataType                 computeType,
+                                        hipsparseSpMVAlg_t          alg,
+                                        void*                       externalBuffer)
+{
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       alpha,
+                       matA,
+                       vecX,
+                       beta,
+                       vecY,
+                       vecB,
+                       vecR,
+                       result,
+                       computeType,
+                       alg,
+                       externalBuffer);
+
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
 hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseOperation_t        opA,
                                            hipsparseOperation_t        opB,
@@ -14323,6 +21610,18 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
@@ -14351,6 +21650,18 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       externalBuffer);
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
@@ -14380,6 +21691,18 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                                 hipsparseSpMMAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       externalBuffer);
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
@@ -14410,6 +21733,11 @@ struct hipsparseSpGEMMDescr
     void* externalBuffer3{};
     void* externalBuffer4{};
     void* externalBuffer5{};
+
+    // In single arena mode, externalBuffer1 holds the C row pointer array (only if C had
+    // none at work estimation) followed by the rocSPARSE buffer, which starts at arenaOffset
+    hipsparseSpGEMMMode_t mode{HIPSPARSE_SPGEMM_MODE_DEFAULT};
+    size_t                arenaOffset{};
 };
 
 hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
@@ -14434,6 +21762,36 @@ hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+hipsparseStatus_t hipsparseSpGEMM_setMode(hipsparseSpGEMMDescr_t descr, hipsparseSpGEMMMode_t mode)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(mode != HIPSPARSE_SPGEMM_MODE_DEFAULT && mode != HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->mode        = mode;
+    descr->arenaOffset = 0;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_getMode(hipsparseSpGEMMDescr_t descr, hipsparseSpGEMMMode_t* mode)
+{
+    if(descr == nullptr || mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = descr->mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 namespace hipsparse
 {
     static hipsparseStatus_t getIndexTypeSize(hipsparseIndexType_t indexType, size_t& size)
@@ -14485,6 +21843,22 @@ namespace hipsparse
             size = sizeof(hipDoubleComplex);
             return HIPSPARSE_STATUS_SUCCESS;
         }
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        {
+            size = sizeof(uint16_t);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIP_R_8I:
+        {
+            size = sizeof(int8_t);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIP_R_32I:
+        {
+            size = sizeof(int32_t);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
         default:
         {
             size = 0;
@@ -14497,6 +21871,243 @@ namespace hipsparse
     }
 }
 
+namespace hipsparse
+{
+    static bool isZeroScalar(const void* scalar, hipDataType dataType)
+    {
+        switch(dataType)
+        {
+        case HIP_R_32F:
+            return *static_cast<const float*>(scalar) == 0.0f;
+        case HIP_R_64F:
+            return *static_cast<const double*>(scalar) == 0.0;
+        case HIP_C_32F:
+        {
+            const hipComplex* value = static_cast<const hipComplex*>(scalar);
+            return hipCrealf(*value) == 0.0f && hipCimagf(*value) == 0.0f;
+        }
+        case HIP_C_64F:
+        {
+            const hipDoubleComplex* value = static_cast<const hipDoubleComplex*>(scalar);
+            return hipCreal(*value) == 0.0 && hipCimag(*value) == 0.0;
+        }
+        default:
+            return false;
+        }
+    }
+
+    // Single arena work estimation. The query returns the size of the one buffer used by
+    // all SpGEMM stages. The second call computes the C row pointer array, either directly
+    // into the array of C or, if C has none yet, into the front of the arena.
+    static hipsparseStatus_t
+        spgemmSingleArenaWorkEstimation(hipsparseHandle_t          handle,
+                                        hipsparseOperation_t       opA,
+                                        hipsparseOperation_t       opB,
+                                        const void*                alpha,
+                                        hipsparseConstSpMatDescr_t matA,
+                                        hipsparseConstSpMatDescr_t matB,
+                                        hipsparseSpMatDescr_t      matC,
+                                        hipDataType                computeType,
+                                        hipsparseSpGEMMAlg_t       alg,
+                                        hipsparseSpGEMMDescr_t     spgemmDescr,
+                                        size_t*                    bufferSize1,
+                                        void*                      externalBuffer1)
+    {
+        // Get data stored in C matrix
+        int64_t              rowsC, colsC, nnzC;
+        void*                csrRowOffsetsC;
+        void*                csrColIndC;
+        void*                csrValuesC;
+        hipsparseIndexType_t csrRowOffsetsTypeC;
+        hipsparseIndexType_t csrColIndTypeC;
+        hipsparseIndexBase_t idxBaseC;
+        hipDataType          csrValueTypeC;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matC,
+                                                  &rowsC,
+                                                  &colsC,
+                                                  &nnzC,
+                                                  &csrRowOffsetsC,
+                                                  &csrColIndC,
+                                                  &csrValuesC,
+                                                  &csrRowOffsetsTypeC,
+                                                  &csrColIndTypeC,
+                                                  &idxBaseC,
+                                                  &csrValueTypeC));
+
+        if(externalBuffer1 == nullptr)
+        {
+            // Query for required buffer size
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm((rocsparse_handle)handle,
+                                                       hipOperationToHCCOperation(opA),
+                                                       hipOperationToHCCOperation(opB),
+                                                       alpha,
+                                                       (rocsparse_const_spmat_descr)matA,
+                                                       (rocsparse_const_spmat_descr)matB,
+                                                       nullptr,
+                                                       (rocsparse_const_spmat_descr)matC,
+                                                       (rocsparse_spmat_descr)matC,
+                                                       hipDataTypeToHCCDataType(computeType),
+                                                       hipSpGEMMAlgToHCCSpGEMMAlg(alg),
+                                                       rocsparse_spgemm_stage_buffer_size,
+                                                       bufferSize1,
+                                                       nullptr));
+
+            // Only reserve space for the C row pointer array if the user did not provide one
+            spgemmDescr->arenaOffset = 0;
+            if(csrRowOffsetsC == nullptr)
+            {
+                size_t csrRowOffsetsTypeSizeC;
+                RETURN_IF_HIPSPARSE_ERROR(
+                    getIndexTypeSize(csrRowOffsetsTypeC, csrRowOffsetsTypeSizeC));
+
+                spgemmDescr->arenaOffset
+                    = ((csrRowOffsetsTypeSizeC * (rowsC + 1) - 1) / 256 + 1) * 256;
+            }
+
+            *bufferSize1 += spgemmDescr->arenaOffset;
+
+            spgemmDescr->bufferSize1 = *bufferSize1;
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        spgemmDescr->externalBuffer1 = externalBuffer1;
+
+        void* csrRowOffsetsCFromArena = csrRowOffsetsC;
+        if(spgemmDescr->arenaOffset != 0)
+        {
+            csrRowOffsetsCFromArena = spgemmDescr->externalBuffer1;
+        }
+        else if(csrRowOffsetsC == nullptr)
+        {
+            // No space has been reserved for the row pointer array in the query
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparseCsrSetPointers(matC, csrRowOffsetsCFromArena, csrColIndC, csrValuesC));
+
+        // Compute number of non-zeros in C matrix
+        size_t bufferSize = spgemmDescr->bufferSize1 - spgemmDescr->arenaOffset;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm(
+            (rocsparse_handle)handle,
+            hipOperationToHCCOperation(opA),
+            hipOperationToHCCOperation(opB),
+            alpha,
+            (rocsparse_const_spmat_descr)matA,
+            (rocsparse_const_spmat_descr)matB,
+            nullptr,
+            (rocsparse_const_spmat_descr)matC,
+            (rocsparse_spmat_descr)matC,
+            hipDataTypeToHCCDataType(computeType),
+            hipSpGEMMAlgToHCCSpGEMMAlg(alg),
+            rocsparse_spgemm_stage_nnz,
+            &bufferSize,
+            static_cast<char*>(spgemmDescr->externalBuffer1) + spgemmDescr->arenaOffset));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Single arena copy. Once the user has attached the C column and value arrays, the
+    // product is computed straight into them, re-using the arena of the work estimation.
+    static hipsparseStatus_t spgemmSingleArenaCopy(hipsparseHandle_t          handle,
+                                                   hipsparseOperation_t       opA,
+                                                   hipsparseOperation_t       opB,
+                                                   const void*                alpha,
+                                                   hipsparseConstSpMatDescr_t matA,
+                                                   hipsparseConstSpMatDescr_t matB,
+                                                   const void*                beta,
+                                                   hipsparseSpMatDescr_t      matC,
+                                                   hipDataType                computeType,
+                                                   hipsparseSpGEMMAlg_t       alg,
+                                                   hipsparseSpGEMMDescr_t     spgemmDescr)
+    {
+        // The values of C are overwritten, there is no staged product to add beta * C to. In
+        // device pointer mode, beta is not read back, that would synchronize the stream on
+        // every copy, and is taken as zero.
+        hipsparsePointerMode_t pointer_mode;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &pointer_mode));
+
+        if(pointer_mode == HIPSPARSE_POINTER_MODE_HOST && !isZeroScalar(beta, computeType))
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        // Get data stored in C matrix
+        int64_t              rowsC, colsC, nnzC;
+        void*                csrRowOffsetsC;
+        void*                csrColIndC;
+        void*                csrValuesC;
+        hipsparseIndexType_t csrRowOffsetsTypeC;
+        hipsparseIndexType_t csrColIndTypeC;
+        hipsparseIndexBase_t idxBaseC;
+        hipDataType          csrValueTypeC;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matC,
+                                                  &rowsC,
+                                                  &colsC,
+                                                  &nnzC,
+                                                  &csrRowOffsetsC,
+                                                  &csrColIndC,
+                                                  &csrValuesC,
+                                                  &csrRowOffsetsTypeC,
+                                                  &csrColIndTypeC,
+                                                  &idxBaseC,
+                                                  &csrValueTypeC));
+
+        if(csrRowOffsetsC == nullptr
+           || (nnzC > 0 && (csrColIndC == nullptr || csrValuesC == nullptr)))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // Row pointer array computed during the work estimation
+        void* csrRowOffsetsCFromArena
+            = (spgemmDescr->arenaOffset != 0) ? spgemmDescr->externalBuffer1 : csrRowOffsetsC;
+
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparseCsrSetPointers(matC, csrRowOffsetsCFromArena, csrColIndC, csrValuesC));
+
+        size_t bufferSize = spgemmDescr->bufferSize1 - spgemmDescr->arenaOffset;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm(
+            (rocsparse_handle)handle,
+            hipOperationToHCCOperation(opA),
+            hipOperationToHCCOperation(opB),
+            alpha,
+            (rocsparse_const_spmat_descr)matA,
+            (rocsparse_const_spmat_descr)matB,
+            nullptr,
+            (rocsparse_const_spmat_descr)matC,
+            (rocsparse_spmat_descr)matC,
+            hipDataTypeToHCCDataType(computeType),
+            hipSpGEMMAlgToHCCSpGEMMAlg(alg),
+            rocsparse_spgemm_stage_compute,
+            &bufferSize,
+            static_cast<char*>(spgemmDescr->externalBuffer1) + spgemmDescr->arenaOffset));
+
+        if(csrRowOffsetsCFromArena != csrRowOffsetsC)
+        {
+            size_t csrRowOffsetsTypeSizeC;
+            RETURN_IF_HIPSPARSE_ERROR(
+                getIndexTypeSize(csrRowOffsetsTypeC, csrRowOffsetsTypeSizeC));
+
+            hipStream_t stream;
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+            // Copy data from the arena to row pointer array
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrRowOffsetsC,
+                                               csrRowOffsetsCFromArena,
+                                               csrRowOffsetsTypeSizeC * (rowsC + 1),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparseCsrSetPointers(matC, csrRowOffsetsC, csrColIndC, csrValuesC));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
 hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          handle,
                                                  hipsparseOperation_t       opA,
                                                  hipsparseOperation_t       opB,
@@ -14511,6 +22122,20 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
                                                  size_t*                    bufferSize1,
                                                  void*                      externalBuffer1)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       spgemmDescr,
+                       bufferSize1,
+                       externalBuffer1);
+
     // Match cusparse error handling
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || bufferSize1 == nullptr || spgemmDescr == nullptr)
@@ -14518,6 +22143,22 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
+    if(spgemmDescr->mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        return hipsparse::spgemmSingleArenaWorkEstimation(handle,
+                                                          opA,
+                                                          opB,
+                                                          alpha,
+                                                          matA,
+                                                          matB,
+                                                          matC,
+                                                          computeType,
+                                                          alg,
+                                                          spgemmDescr,
+                                                          bufferSize1,
+                                                          externalBuffer1);
+    }
+
     // Get data stored in C matrix
     int64_t              rowsC, colsC, nnzC;
     void*                csrRowOffsetsC;
@@ -14613,12 +22254,39 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
                                           size_t*                    bufferSize2,
                                           void*                      externalBuffer2)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       spgemmDescr,
+                       bufferSize2,
+                       externalBuffer2);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
-       || matB == nullptr || matC == nullptr || bufferSize2 == nullptr)
+       || matB == nullptr || matC == nullptr || bufferSize2 == nullptr || spgemmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
+    // In single arena mode, the product is computed by hipsparseSpGEMM_copy directly
+    // into the arrays of C, using the buffer of the work estimation
+    if(spgemmDescr->mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        if(externalBuffer2 == nullptr)
+        {
+            *bufferSize2             = 0;
+            spgemmDescr->bufferSize2 = 0;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     // Get data stored in C matrix
     int64_t              rowsC, colsC, nnzC;
     void*                csrRowOffsetsC;
@@ -14648,9 +22316,6 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
     RETURN_IF_HIPSPARSE_ERROR(hipsparse::getIndexTypeSize(csrColIndTypeC, csrColIndTypeSizeC));
     RETURN_IF_HIPSPARSE_ERROR(hipsparse::getDataTypeSize(csrValueTypeC, csrValueTypeSizeC));
 
-    size_t computeTypeSize;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getDataTypeSize(computeType, computeTypeSize));
-
     if(externalBuffer2 == nullptr)
     {
         *bufferSize2 = 0;
@@ -14662,9 +22327,6 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
         // Need to store temporary space for indices array used in hipsparseSpGEMM_copy Axpby
         *bufferSize2 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
-        // Need to store temporary space for host/device 1 value used in hipsparseSpGEMM_copy Axpby
-        *bufferSize2 += ((computeTypeSize - 1) / 256 + 1) * 256;
-
         spgemmDescr->bufferSize2 = *bufferSize2;
     }
     else
@@ -14721,12 +22383,30 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
                                        hipsparseSpGEMMAlg_t       alg,
                                        hipsparseSpGEMMDescr_t     spgemmDescr)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       spgemmDescr);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || spgemmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
+    if(spgemmDescr->mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        return hipsparse::spgemmSingleArenaCopy(
+            handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+    }
+
     // Get data stored in C matrix
     int64_t              rowsC, colsC, nnzC;
     void*                csrRowOffsetsC;
@@ -14766,59 +22446,13 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
     byteOffset2 += ((csrValueTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
     void* indicesArray = (static_cast<char*>(spgemmDescr->externalBuffer2) + byteOffset2);
-    byteOffset2 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
-
-    void* device_one = (static_cast<char*>(spgemmDescr->externalBuffer2) + byteOffset2);
-
-    // Get pointer mode
-    hipsparsePointerMode_t pointer_mode;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &pointer_mode));
 
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
 
-    float            host_sone = 1.0f;
-    double           host_done = 1.0f;
-    hipComplex       host_cone = make_hipComplex(1.0f, 0.0f);
-    hipDoubleComplex host_zone = make_hipDoubleComplex(1.0, 0.0);
-
-    void* one = nullptr;
-    if(pointer_mode == HIPSPARSE_POINTER_MODE_HOST)
-    {
-        if(computeType == HIP_R_32F)
-            one = &host_sone;
-        if(computeType == HIP_R_64F)
-            one = &host_done;
-        if(computeType == HIP_C_32F)
-            one = &host_cone;
-        if(computeType == HIP_C_64F)
-            one = &host_zone;
-    }
-    else
-    {
-        if(computeType == HIP_R_32F)
-        {
-            hipMemcpyAsync(device_one, &host_sone, sizeof(float), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_R_64F)
-        {
-            hipMemcpyAsync(device_one, &host_done, sizeof(double), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_32F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_cone, sizeof(hipComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_64F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_zone, sizeof(hipDoubleComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-    }
+    // Cached constant 1 that matches the pointer mode
+    const void* one;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getConstant(handle, computeType, 1, &one));
 
     if(csrColIndTypeC == HIPSPARSE_INDEX_32I)
     {
@@ -14893,6 +22527,17 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t
                                                       size_t*                    bufferSize1,
                                                       void*                      externalBuffer1)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       matA,
+                       matB,
+                       matC,
+                       alg,
+                       spgemmDescr,
+                       bufferSize1,
+                       externalBuffer1);
+
     const void* alpha = (const void*)0x4;
     const void* beta  = (const void*)0x4;
 
@@ -14949,6 +22594,21 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
                                            size_t*                    bufferSize4,
                                            void*                      externalBuffer4)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       matA,
+                       matB,
+                       matC,
+                       alg,
+                       spgemmDescr,
+                       bufferSize2,
+                       externalBuffer2,
+                       bufferSize3,
+                       externalBuffer3,
+                       bufferSize4,
+                       externalBuffer4);
+
     // Match cusparse error handling
     if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
        || spgemmDescr == nullptr || bufferSize2 == nullptr || bufferSize3 == nullptr
@@ -15073,6 +22733,17 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
                                             size_t*                    bufferSize5,
                                             void*                      externalBuffer5)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       matA,
+                       matB,
+                       matC,
+                       alg,
+                       spgemmDescr,
+                       bufferSize5,
+                       externalBuffer5);
+
     if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
        || bufferSize5 == nullptr || spgemmDescr == nullptr)
     {
@@ -15118,9 +22789,6 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
         // Need to store temporary space for indices array used in hipsparseSpGEMM_copy Axpby
         *bufferSize5 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
-        // Need to store temporary space for host/device 1 value used in hipsparseSpGEMM_copy Axpby
-        *bufferSize5 += ((16 - 1) / 256 + 1) * 256;
-
         spgemmDescr->bufferSize5 = *bufferSize5;
     }
     else
@@ -15160,6 +22828,18 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
                                                hipsparseSpGEMMAlg_t       alg,
                                                hipsparseSpGEMMDescr_t     spgemmDescr)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       spgemmDescr);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || spgemmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15201,9 +22881,6 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
     byteOffset5 += ((csrValueTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
     void* indicesArray = (static_cast<char*>(spgemmDescr->externalBuffer5) + byteOffset5);
-    byteOffset5 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
-
-    void* device_one = (static_cast<char*>(spgemmDescr->externalBuffer5) + byteOffset5);
 
     // Use external buffer for values array as the original values array may have data in it
     // that must be accounted for when multiplying by beta. See below.
@@ -15227,55 +22904,9 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
                          &bufferSize,
                          static_cast<char*>(spgemmDescr->externalBuffer4) + byteOffset4));
 
-    // Get pointer mode
-    hipsparsePointerMode_t pointer_mode;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &pointer_mode));
-
-    hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
-
-    float            host_sone = 1.0f;
-    double           host_done = 1.0f;
-    hipComplex       host_cone = make_hipComplex(1.0f, 0.0f);
-    hipDoubleComplex host_zone = make_hipDoubleComplex(1.0, 0.0);
-
-    void* one = nullptr;
-    if(pointer_mode == HIPSPARSE_POINTER_MODE_HOST)
-    {
-        if(computeType == HIP_R_32F)
-            one = &host_sone;
-        if(computeType == HIP_R_64F)
-            one = &host_done;
-        if(computeType == HIP_C_32F)
-            one = &host_cone;
-        if(computeType == HIP_C_64F)
-            one = &host_zone;
-    }
-    else
-    {
-        if(computeType == HIP_R_32F)
-        {
-            hipMemcpyAsync(device_one, &host_sone, sizeof(float), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_R_64F)
-        {
-            hipMemcpyAsync(device_one, &host_done, sizeof(double), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_32F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_cone, sizeof(hipComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_64F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_zone, sizeof(hipDoubleComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-    }
+    // Cached constant 1 that matches the pointer mode
+    const void* one;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getConstant(handle, computeType, 1, &one));
 
     if(csrColIndTypeC == HIPSPARSE_INDEX_32I)
     {
@@ -15337,6 +22968,18 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
                                  hipsparseSDDMMAlg_t        alg,
                                  void*                      tempBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       tempBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm((rocsparse_handle)handle,
                         hipsparse::hipOperationToHCCOperation(opA),
@@ -15363,6 +23006,18 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             size_t*                    pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_buffer_size((rocsparse_handle)handle,
                                     hipsparse::hipOperationToHCCOperation(opA),
@@ -15389,6 +23044,18 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             void*                      tempBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       beta,
+                       matC,
+                       computeType,
+                       alg,
+                       tempBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_preprocess((rocsparse_handle)handle,
                                    hipsparse::hipOperationToHCCOperation(opA),
@@ -15406,6 +23073,10 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
 struct hipsparseSpSVDescr
 {
     void* externalBuffer{};
+
+    // BSR solves run on the legacy rocSPARSE bsrsv routines
+    hipsparseMatDescr_t bsrDescr{};
+    bsrsv2Info_t        bsrInfo{};
 };
 
 hipsparseStatus_t hipsparseSpSV_createDescr(hipsparseSpSVDescr_t* descr)
@@ -15418,6 +23089,15 @@ hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
 {
     if(descr != nullptr)
     {
+        if(descr->bsrDescr != nullptr)
+        {
+            hipsparseDestroyMatDescr(descr->bsrDescr);
+        }
+        if(descr->bsrInfo != nullptr)
+        {
+            hipsparseDestroyBsrsv2Info(descr->bsrInfo);
+        }
+
         descr->externalBuffer = nullptr;
         delete descr;
     }
@@ -15425,6 +23105,40 @@ hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+namespace hipsparse
+{
+    // Sets up the legacy descriptor and info of a BSR solve, the info keeps the analysis
+    // between hipsparseSpSV_analysis() and hipsparseSpSV_solve()
+    static hipsparseStatus_t spsvBsrSetup(hipsparseConstSpMatDescr_t matA,
+                                          hipDataType                computeType,
+                                          hipsparseSpSVDescr_t       spsvDescr,
+                                          bsrMatrix&                 A)
+    {
+        if(spsvDescr == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(getBsrMatrix(matA, A));
+
+        if(computeType != A.valueType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(spsvDescr->bsrDescr == nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateMatDescr(&spsvDescr->bsrDescr));
+        }
+        if(spsvDescr->bsrInfo == nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateBsrsv2Info(&spsvDescr->bsrInfo));
+        }
+
+        return setLegacyMatDescr(matA, A.base, spsvDescr->bsrDescr);
+    }
+}
+
 hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseOperation_t        opA,
                                            const void*                 alpha,
@@ -15436,6 +23150,30 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSVDescr_t        spsvDescr,
                                            size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       alpha,
+                       matA,
+                       x,
+                       y,
+                       computeType,
+                       alg,
+                       spsvDescr,
+                       pBufferSizeInBytes);
+
+    if(handle == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(hipsparse::isBsrMatrix(matA))
+    {
+        hipsparse::bsrMatrix A;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::spsvBsrSetup(matA, computeType, spsvDescr, A));
+        return hipsparse::bsrsvBufferSize(
+            handle, opA, A, spsvDescr->bsrDescr, spsvDescr->bsrInfo, pBufferSizeInBytes);
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spsv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
@@ -15461,11 +23199,24 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSVDescr_t        spsvDescr,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr, externalBuffer);
+
 
     if(spsvDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
+
+    if(hipsparse::isBsrMatrix(matA))
+    {
+        hipsparse::bsrMatrix A;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::spsvBsrSetup(matA, computeType, spsvDescr, A));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::bsrsvAnalysis(
+            handle, opA, A, spsvDescr->bsrDescr, spsvDescr->bsrInfo, externalBuffer));
+        spsvDescr->externalBuffer = externalBuffer;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spsv((rocsparse_handle)handle,
                                              hipsparse::hipOperationToHCCOperation(opA),
                                              alpha,
@@ -15491,10 +23242,40 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSVAlg_t          alg,
                                       hipsparseSpSVDescr_t        spsvDescr)
 {
+    HIPSPARSE_LOG_CALL(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr);
+
     if(spsvDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
+
+    if(hipsparse::isBsrMatrix(matA))
+    {
+        // The analysis of hipsparseSpSV_analysis() is kept in the descriptor
+        if(spsvDescr->bsrInfo == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipsparse::bsrMatrix A;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::getBsrMatrix(matA, A));
+
+        const void* xValues;
+        void*       yValues;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseConstDnVecGetValues(x, &xValues));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseDnVecGetValues(y, &yValues));
+
+        return hipsparse::bsrsvSolve(handle,
+                                     opA,
+                                     alpha,
+                                     A,
+                                     spsvDescr->bsrDescr,
+                                     spsvDescr->bsrInfo,
+                                     xValues,
+                                     yValues,
+                                     spsvDescr->externalBuffer);
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spsv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
@@ -15543,6 +23324,18 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSMDescr_t        spsmDescr,
                                            size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       matC,
+                       computeType,
+                       alg,
+                       spsmDescr,
+                       pBufferSizeInBytes);
+
     if(spsmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15578,6 +23371,18 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSMDescr_t        spsmDescr,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       matC,
+                       computeType,
+                       alg,
+                       spsmDescr,
+                       externalBuffer);
+
     if(spsmDescr == nullptr || externalBuffer == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15613,6 +23418,18 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSMDescr_t        spsmDescr,
                                       void*                       externalBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       opA,
+                       opB,
+                       alpha,
+                       matA,
+                       matB,
+                       matC,
+                       computeType,
+                       alg,
+                       spsmDescr,
+                       externalBuffer);
+
     if(spsmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15643,6 +23460,8 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15670,6 +23489,8 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15697,6 +23518,8 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15724,6 +23547,8 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t
                                                             int                     batchStride,
                                                             size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15752,6 +23577,8 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_no_pivot_strided_batch(
         (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
 }
@@ -15767,6 +23594,8 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_no_pivot_strided_batch(
         (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
 }
@@ -15781,6 +23610,8 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
                                               int               batchStride,
                                               void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
@@ -15804,6 +23635,8 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
                                               void*                   pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
@@ -15826,6 +23659,8 @@ hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15845,6 +23680,8 @@ hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15864,6 +23701,8 @@ hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15891,6 +23730,8 @@ hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
                                                 int                     ldb,
                                                 size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15919,6 +23760,8 @@ hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -15934,6 +23777,8 @@ hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -15948,6 +23793,8 @@ hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
                                   int               ldb,
                                   void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cgtsv((rocsparse_handle)handle,
                                                                  m,
                                                                  n,
@@ -15970,6 +23817,8 @@ hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
                                   void*                   pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv((rocsparse_handle)handle,
                         m,
@@ -15992,6 +23841,8 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16011,6 +23862,8 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16030,6 +23883,8 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16057,6 +23912,8 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t
                                                         int                     ldb,
                                                         size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16085,6 +23942,8 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -16100,6 +23959,8 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -16115,6 +23976,8 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot((rocsparse_handle)handle,
                                  m,
@@ -16138,6 +24001,8 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
                                           void*                   pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot((rocsparse_handle)handle,
                                  m,
@@ -16160,6 +24025,8 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16188,6 +24055,8 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16216,6 +24085,8 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16244,6 +24115,8 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16273,6 +24146,8 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -16297,6 +24172,8 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -16320,6 +24197,8 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -16344,6 +24223,8 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -16369,6 +24250,8 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16401,6 +24284,8 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16433,6 +24318,8 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16465,6 +24352,8 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16497,6 +24386,8 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -16524,6 +24415,8 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -16551,6 +24444,8 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -16578,6 +24473,8 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LOG_CALL(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -16606,6 +24503,19 @@ hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       fractionToColor,
+                       ncolors,
+                       coloring,
+                       reordering,
+                       info);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrcolor((rocsparse_handle)handle,
                             m,
@@ -16634,6 +24544,19 @@ hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       fractionToColor,
+                       ncolors,
+                       coloring,
+                       reordering,
+                       info);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrcolor((rocsparse_handle)handle,
                             m,
@@ -16662,6 +24585,19 @@ hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       fractionToColor,
+                       ncolors,
+                       coloring,
+                       reordering,
+                       info);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrcolor((rocsparse_handle)handle,
                             m,
@@ -16690,6 +24626,19 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_LOG_CALL(handle,
+                       m,
+                       nnz,
+                       descrA,
+                       csrValA,
+                       csrRowPtrA,
+                       csrColIndA,
+                       fractionToColor,
+                       ncolors,
+                       coloring,
+                       reordering,
+                       info);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrcolor((rocsparse_handle)handle,
                             m,
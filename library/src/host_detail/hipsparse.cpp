@@ -0,0 +1,1187 @@
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "hipsparse_host.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <new>
+#include <numeric>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define TO_STR2(x) #x
+#define TO_STR(x) TO_STR2(x)
+
+namespace hipsparse
+{
+    hipsparseStatus_t getIndexTypeSize(hipsparseIndexType_t indexType, size_t& size)
+    {
+        switch(indexType)
+        {
+        case HIPSPARSE_INDEX_16U:
+        {
+            size = sizeof(uint16_t);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIPSPARSE_INDEX_32I:
+        {
+            size = sizeof(int32_t);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIPSPARSE_INDEX_64I:
+        {
+            size = sizeof(int64_t);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        }
+
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseStatus_t getDataTypeSize(hipDataType dataType, size_t& size)
+    {
+        switch(dataType)
+        {
+        case HIP_R_32F:
+        {
+            size = sizeof(float);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIP_R_64F:
+        {
+            size = sizeof(double);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIP_C_32F:
+        {
+            size = sizeof(std::complex<float>);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIP_C_64F:
+        {
+            size = sizeof(std::complex<double>);
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    int getNumThreads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    int getThreadNum()
+    {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+}
+
+hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *handle = new(std::nothrow) hipsparse::handle;
+
+    return (*handle != nullptr) ? HIPSPARSE_STATUS_SUCCESS : HIPSPARSE_STATUS_ALLOC_FAILED;
+}
+
+hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
+{
+    delete(hipsparse::handle*)handle;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+const char* hipsparseGetErrorName(hipsparseStatus_t status)
+{
+    switch(status)
+    {
+    case HIPSPARSE_STATUS_SUCCESS:
+        return "HIPSPARSE_STATUS_SUCCESS";
+    case HIPSPARSE_STATUS_NOT_INITIALIZED:
+        return "HIPSPARSE_STATUS_NOT_INITIALIZED";
+    case HIPSPARSE_STATUS_ALLOC_FAILED:
+        return "HIPSPARSE_STATUS_ALLOC_FAILED";
+    case HIPSPARSE_STATUS_INVALID_VALUE:
+        return "HIPSPARSE_STATUS_INVALID_VALUE";
+    case HIPSPARSE_STATUS_ARCH_MISMATCH:
+        return "HIPSPARSE_STATUS_ARCH_MISMATCH";
+    case HIPSPARSE_STATUS_MAPPING_ERROR:
+        return "HIPSPARSE_STATUS_MAPPING_ERROR";
+    case HIPSPARSE_STATUS_EXECUTION_FAILED:
+        return "HIPSPARSE_STATUS_EXECUTION_FAILED";
+    case HIPSPARSE_STATUS_INTERNAL_ERROR:
+        return "HIPSPARSE_STATUS_INTERNAL_ERROR";
+    case HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED:
+        return "HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED";
+    case HIPSPARSE_STATUS_ZERO_PIVOT:
+        return "HIPSPARSE_STATUS_ZERO_PIVOT";
+    case HIPSPARSE_STATUS_NOT_SUPPORTED:
+        return "HIPSPARSE_STATUS_NOT_SUPPORTED";
+    case HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES:
+        return "HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES";
+    }
+
+    return "Unrecognized status code";
+}
+
+const char* hipsparseGetErrorString(hipsparseStatus_t status)
+{
+    switch(status)
+    {
+    case HIPSPARSE_STATUS_SUCCESS:
+        return "function succeeds";
+    case HIPSPARSE_STATUS_NOT_INITIALIZED:
+        return "hipSPARSE was not initialized";
+    case HIPSPARSE_STATUS_ALLOC_FAILED:
+        return "resource allocation failed";
+    case HIPSPARSE_STATUS_INVALID_VALUE:
+        return "unsupported value was passed to the function";
+    case HIPSPARSE_STATUS_ARCH_MISMATCH:
+        return "device architecture not supported";
+    case HIPSPARSE_STATUS_MAPPING_ERROR:
+        return "access to memory space failed";
+    case HIPSPARSE_STATUS_EXECUTION_FAILED:
+        return "program failed to execute";
+    case HIPSPARSE_STATUS_INTERNAL_ERROR:
+        return "an internal hipSPARSE operation failed";
+    case HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED:
+        return "matrix type not supported";
+    case HIPSPARSE_STATUS_ZERO_PIVOT:
+        return "zero pivot was computed";
+    case HIPSPARSE_STATUS_NOT_SUPPORTED:
+        return "operation is not supported by the host backend";
+    case HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES:
+        return "resources are insufficient";
+    }
+
+    return "unrecognized status code";
+}
+
+hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(version == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *version = hipsparseVersionMajor * 100000 + hipsparseVersionMinor * 100 + hipsparseVersionPatch;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
+{
+    // Get hipSPARSE revision
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(rev == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    static constexpr char v[] = TO_STR(hipsparseVersionTweak);
+
+    sprintf(rev, "%s (host)", v);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::handle*)handle)->stream = streamId;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
+{
+    if(handle == nullptr || streamId == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *streamId = ((hipsparse::handle*)handle)->stream;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(mode != HIPSPARSE_POINTER_MODE_HOST && mode != HIPSPARSE_POINTER_MODE_DEVICE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Both modes read the scalars from host addressable memory
+    ((hipsparse::handle*)handle)->pointerMode = mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
+{
+    if(handle == nullptr || mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = ((hipsparse::handle*)handle)->pointerMode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetWorkspacePoolSize(hipsparseHandle_t handle, size_t size)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::handle* state = (hipsparse::handle*)handle;
+
+    if(size > state->workspace.size())
+    {
+        try
+        {
+            state->workspace.resize(size);
+        }
+        catch(const std::bad_alloc&)
+        {
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+    }
+
+    state->workspaceHighWater = std::max(state->workspaceHighWater, size);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t
+    hipsparseGetWorkspacePoolInfo(hipsparseHandle_t handle, size_t* size, size_t* highWaterMark)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(size == nullptr || highWaterMark == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *size          = ((hipsparse::handle*)handle)->workspace.size();
+    *highWaterMark = ((hipsparse::handle*)handle)->workspaceHighWater;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseTrimWorkspacePool(hipsparseHandle_t handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::handle* state = (hipsparse::handle*)handle;
+
+    std::vector<char>().swap(state->workspace);
+    state->workspaceHighWater = 0;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetExecutionPolicy(hipsparseHandle_t          handle,
+                                              hipsparseExecutionPolicy_t policy)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(policy != HIPSPARSE_EXECUTION_POLICY_BLOCKING
+       && policy != HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE
+       && policy != HIPSPARSE_EXECUTION_POLICY_ASYNC)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::handle*)handle)->executionPolicy = policy;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetExecutionPolicy(hipsparseHandle_t           handle,
+                                              hipsparseExecutionPolicy_t* policy)
+{
+    if(handle == nullptr || policy == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *policy = ((hipsparse::handle*)handle)->executionPolicy;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descrA = new(std::nothrow) hipsparse::matDescr;
+
+    return (*descrA != nullptr) ? HIPSPARSE_STATUS_SUCCESS : HIPSPARSE_STATUS_ALLOC_FAILED;
+}
+
+hipsparseStatus_t hipsparseDestroyMatDescr(hipsparseMatDescr_t descrA)
+{
+    delete(hipsparse::matDescr*)descrA;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCopyMatDescr(hipsparseMatDescr_t dest, const hipsparseMatDescr_t src)
+{
+    if(dest == nullptr || src == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *(hipsparse::matDescr*)dest = *(const hipsparse::matDescr*)src;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetMatType(hipsparseMatDescr_t descrA, hipsparseMatrixType_t type)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(type != HIPSPARSE_MATRIX_TYPE_GENERAL && type != HIPSPARSE_MATRIX_TYPE_SYMMETRIC
+       && type != HIPSPARSE_MATRIX_TYPE_HERMITIAN && type != HIPSPARSE_MATRIX_TYPE_TRIANGULAR)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::matDescr*)descrA)->type = type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseMatrixType_t hipsparseGetMatType(const hipsparseMatDescr_t descrA)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_MATRIX_TYPE_GENERAL;
+    }
+
+    return ((const hipsparse::matDescr*)descrA)->type;
+}
+
+hipsparseStatus_t hipsparseSetMatFillMode(hipsparseMatDescr_t descrA, hipsparseFillMode_t fillMode)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(fillMode != HIPSPARSE_FILL_MODE_LOWER && fillMode != HIPSPARSE_FILL_MODE_UPPER)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::matDescr*)descrA)->fillMode = fillMode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseFillMode_t hipsparseGetMatFillMode(const hipsparseMatDescr_t descrA)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_FILL_MODE_LOWER;
+    }
+
+    return ((const hipsparse::matDescr*)descrA)->fillMode;
+}
+
+hipsparseStatus_t hipsparseSetMatDiagType(hipsparseMatDescr_t descrA, hipsparseDiagType_t diagType)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(diagType != HIPSPARSE_DIAG_TYPE_NON_UNIT && diagType != HIPSPARSE_DIAG_TYPE_UNIT)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::matDescr*)descrA)->diagType = diagType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseDiagType_t hipsparseGetMatDiagType(const hipsparseMatDescr_t descrA)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_DIAG_TYPE_NON_UNIT;
+    }
+
+    return ((const hipsparse::matDescr*)descrA)->diagType;
+}
+
+hipsparseStatus_t hipsparseSetMatIndexBase(hipsparseMatDescr_t descrA, hipsparseIndexBase_t base)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(base != HIPSPARSE_INDEX_BASE_ZERO && base != HIPSPARSE_INDEX_BASE_ONE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::matDescr*)descrA)->base = base;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_INDEX_BASE_ZERO;
+    }
+
+    return ((const hipsparse::matDescr*)descrA)->base;
+}
+
+/*
+ * ===========================================================================
+ *    format conversions
+ * ===========================================================================
+ */
+
+hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
+                                    const int*           csrRowPtr,
+                                    int                  nnz,
+                                    int                  m,
+                                    int*                 cooRowInd,
+                                    hipsparseIndexBase_t idxBase)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m < 0 || nnz < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m == 0 || nnz == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(csrRowPtr == nullptr || cooRowInd == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = csrRowPtr[i] - idxBase; j < csrRowPtr[i + 1] - idxBase; ++j)
+        {
+            cooRowInd[j] = i + idxBase;
+        }
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
+                                    const int*           cooRowInd,
+                                    int                  nnz,
+                                    int                  m,
+                                    int*                 csrRowPtr,
+                                    hipsparseIndexBase_t idxBase)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m < 0 || nnz < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(csrRowPtr == nullptr || (nnz > 0 && cooRowInd == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::fill(csrRowPtr, csrRowPtr + m + 1, 0);
+
+    for(int j = 0; j < nnz; ++j)
+    {
+        int row = cooRowInd[j] - idxBase;
+        if(row < 0 || row >= m)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        ++csrRowPtr[row + 1];
+    }
+
+    csrRowPtr[0] = idxBase;
+    for(int i = 0; i < m; ++i)
+    {
+        csrRowPtr[i + 1] += csrRowPtr[i];
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(n < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(n == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(p == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int i = 0; i < n; ++i)
+    {
+        p[i] = i;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
+                                                 int                   m,
+                                                 int                   n,
+                                                 int                   nnz,
+                                                 const void*           csrVal,
+                                                 const int*            csrRowPtr,
+                                                 const int*            csrColInd,
+                                                 void*                 cscVal,
+                                                 int*                  cscColPtr,
+                                                 int*                  cscRowInd,
+                                                 hipDataType           valType,
+                                                 hipsparseAction_t     copyValues,
+                                                 hipsparseIndexBase_t  idxBase,
+                                                 hipsparseCsr2CscAlg_t alg,
+                                                 size_t*               pBufferSizeInBytes)
+{
+    if(handle == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The transposition counts the columns in place, no workspace is needed
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace hipsparse
+{
+    template <typename T>
+    static void csr2cscHost(int                  m,
+                            int                  n,
+                            int                  nnz,
+                            const T*             csrVal,
+                            const int*           csrRowPtr,
+                            const int*           csrColInd,
+                            T*                   cscVal,
+                            int*                 cscColPtr,
+                            int*                 cscRowInd,
+                            hipsparseAction_t    copyValues,
+                            hipsparseIndexBase_t idxBase)
+    {
+        std::fill(cscColPtr, cscColPtr + n + 1, 0);
+
+        for(int j = 0; j < nnz; ++j)
+        {
+            ++cscColPtr[csrColInd[j] - idxBase + 1];
+        }
+
+        for(int i = 0; i < n; ++i)
+        {
+            cscColPtr[i + 1] += cscColPtr[i];
+        }
+
+        // Rows are visited in order, so that the row indices of each column stay sorted
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = csrRowPtr[i] - idxBase; j < csrRowPtr[i + 1] - idxBase; ++j)
+            {
+                int idx = cscColPtr[csrColInd[j] - idxBase]++;
+
+                cscRowInd[idx] = i + idxBase;
+
+                if(copyValues == HIPSPARSE_ACTION_NUMERIC)
+                {
+                    cscVal[idx] = csrVal[j];
+                }
+            }
+        }
+
+        // Shift the offsets back and apply the index base
+        for(int i = n; i > 0; --i)
+        {
+            cscColPtr[i] = cscColPtr[i - 1] + idxBase;
+        }
+
+        cscColPtr[0] = idxBase;
+    }
+}
+
+hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
+                                      int                   m,
+                                      int                   n,
+                                      int                   nnz,
+                                      const void*           csrVal,
+                                      const int*            csrRowPtr,
+                                      const int*            csrColInd,
+                                      void*                 cscVal,
+                                      int*                  cscColPtr,
+                                      int*                  cscRowInd,
+                                      hipDataType           valType,
+                                      hipsparseAction_t     copyValues,
+                                      hipsparseIndexBase_t  idxBase,
+                                      hipsparseCsr2CscAlg_t alg,
+                                      void*                 buffer)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m == 0 || n == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(csrRowPtr == nullptr || cscColPtr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(nnz > 0
+       && (csrColInd == nullptr || cscRowInd == nullptr
+           || (copyValues == HIPSPARSE_ACTION_NUMERIC && (csrVal == nullptr || cscVal == nullptr))))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::dispatchDataType(valType, [&](auto t) {
+        using T = decltype(t);
+
+        hipsparse::csr2cscHost(m,
+                               n,
+                               nnz,
+                               (const T*)csrVal,
+                               csrRowPtr,
+                               csrColInd,
+                               (T*)cscVal,
+                               cscColPtr,
+                               cscRowInd,
+                               copyValues,
+                               idxBase);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    });
+}
+
+hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const float*         csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    float*               cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return hipsparseCsr2cscEx2(handle,
+                               m,
+                               n,
+                               nnz,
+                               csrSortedVal,
+                               csrSortedRowPtr,
+                               csrSortedColInd,
+                               cscSortedVal,
+                               cscSortedColPtr,
+                               cscSortedRowInd,
+                               HIP_R_32F,
+                               copyValues,
+                               idxBase,
+                               HIPSPARSE_CSR2CSC_ALG1,
+                               nullptr);
+}
+
+hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const double*        csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    double*              cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return hipsparseCsr2cscEx2(handle,
+                               m,
+                               n,
+                               nnz,
+                               csrSortedVal,
+                               csrSortedRowPtr,
+                               csrSortedColInd,
+                               cscSortedVal,
+                               cscSortedColPtr,
+                               cscSortedRowInd,
+                               HIP_R_64F,
+                               copyValues,
+                               idxBase,
+                               HIPSPARSE_CSR2CSC_ALG1,
+                               nullptr);
+}
+
+hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const hipComplex*    csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    hipComplex*          cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return hipsparseCsr2cscEx2(handle,
+                               m,
+                               n,
+                               nnz,
+                               csrSortedVal,
+                               csrSortedRowPtr,
+                               csrSortedColInd,
+                               cscSortedVal,
+                               cscSortedColPtr,
+                               cscSortedRowInd,
+                               HIP_C_32F,
+                               copyValues,
+                               idxBase,
+                               HIPSPARSE_CSR2CSC_ALG1,
+                               nullptr);
+}
+
+hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
+                                    int                     m,
+                                    int                     n,
+                                    int                     nnz,
+                                    const hipDoubleComplex* csrSortedVal,
+                                    const int*              csrSortedRowPtr,
+                                    const int*              csrSortedColInd,
+                                    hipDoubleComplex*       cscSortedVal,
+                                    int*                    cscSortedRowInd,
+                                    int*                    cscSortedColPtr,
+                                    hipsparseAction_t       copyValues,
+                                    hipsparseIndexBase_t    idxBase)
+{
+    return hipsparseCsr2cscEx2(handle,
+                               m,
+                               n,
+                               nnz,
+                               csrSortedVal,
+                               csrSortedRowPtr,
+                               csrSortedColInd,
+                               cscSortedVal,
+                               cscSortedColPtr,
+                               cscSortedRowInd,
+                               HIP_C_64F,
+                               copyValues,
+                               idxBase,
+                               HIPSPARSE_CSR2CSC_ALG1,
+                               nullptr);
+}
+
+namespace hipsparse
+{
+    // Sliced ELL row of position r, see hipsparseXcsr2sellNnz()
+    static int sellRow(const int* perm, int r)
+    {
+        return (perm != nullptr) ? perm[r] : r;
+    }
+
+    template <typename T>
+    static hipsparseStatus_t csr2sellHost(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       n,
+                                          const hipsparseMatDescr_t descrA,
+                                          const T*                  csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          int                       sliceSize,
+                                          const int*                sellSliceOffsets,
+                                          const int*                perm,
+                                          int*                      sellColInd,
+                                          T*                        sellVal)
+    {
+        if(handle == nullptr || descrA == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m < 0 || n < 0 || sliceSize <= 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(csrRowPtrA == nullptr || sellSliceOffsets == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int nslices  = (m + sliceSize - 1) / sliceSize;
+        const int sellSize = sellSliceOffsets[nslices];
+
+        if(sellSize > 0
+           && (csrValA == nullptr || csrColIndA == nullptr || sellColInd == nullptr
+               || sellVal == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int base = ((const matDescr*)descrA)->base;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+        for(int s = 0; s < nslices; ++s)
+        {
+            const int width = (sellSliceOffsets[s + 1] - sellSliceOffsets[s]) / sliceSize;
+            for(int lr = 0; lr < sliceSize; ++lr)
+            {
+                const int r     = s * sliceSize + lr;
+                const int begin = (r < m) ? csrRowPtrA[sellRow(perm, r)] - base : 0;
+                const int end   = (r < m) ? csrRowPtrA[sellRow(perm, r) + 1] - base : 0;
+
+                // Columns are stored slot by slot, the rows of a slice are contiguous
+                for(int j = 0; j < width; ++j)
+                {
+                    const int k = sellSliceOffsets[s] + j * sliceSize + lr;
+                    if(begin + j < end)
+                    {
+                        sellColInd[k] = csrColIndA[begin + j];
+                        sellVal[k]    = csrValA[begin + j];
+                    }
+                    else
+                    {
+                        sellColInd[k] = -1;
+                        sellVal[k]    = static_cast<T>(0);
+                    }
+                }
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseXcsr2sellNnz(hipsparseHandle_t         handle,
+                                        int                       m,
+                                        int                       n,
+                                        const hipsparseMatDescr_t descrA,
+                                        const int*                csrRowPtrA,
+                                        int                       sliceSize,
+                                        int                       sigma,
+                                        int*                      sellSliceOffsets,
+                                        int*                      perm,
+                                        int*                      sellValuesSize)
+{
+    if(handle == nullptr || descrA == nullptr || sellValuesSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m < 0 || n < 0 || sliceSize <= 0 || sigma <= 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m == 0)
+    {
+        *sellValuesSize = 0;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(csrRowPtrA == nullptr || sellSliceOffsets == nullptr || (sigma > 1 && perm == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(perm != nullptr)
+    {
+        std::iota(perm, perm + m, 0);
+
+        // Sorting the rows of a window by decreasing length groups rows of similar lengths
+        // in the same slices, the stable sort keeps the original order between equal lengths
+        if(sigma > 1)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for(int w = 0; w < m; w += sigma)
+            {
+                std::stable_sort(perm + w, perm + std::min(w + sigma, m), [&](int a, int b) {
+                    return csrRowPtrA[a + 1] - csrRowPtrA[a] > csrRowPtrA[b + 1] - csrRowPtrA[b];
+                });
+            }
+        }
+    }
+
+    const int nslices = (m + sliceSize - 1) / sliceSize;
+
+    sellSliceOffsets[0] = 0;
+    for(int s = 0; s < nslices; ++s)
+    {
+        int width = 0;
+        for(int r = s * sliceSize; r < std::min((s + 1) * sliceSize, m); ++r)
+        {
+            const int row = hipsparse::sellRow(perm, r);
+            width         = std::max(width, csrRowPtrA[row + 1] - csrRowPtrA[row]);
+        }
+
+        sellSliceOffsets[s + 1] = sellSliceOffsets[s] + width * sliceSize;
+    }
+
+    // Host and device pointer modes both address host memory here
+    *sellValuesSize = sellSliceOffsets[nslices];
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseScsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const float*              csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     float*                    sellVal)
+{
+    return hipsparse::csr2sellHost(handle,
+                                   m,
+                                   n,
+                                   descrA,
+                                   csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   sliceSize,
+                                   sellSliceOffsets,
+                                   perm,
+                                   sellColInd,
+                                   sellVal);
+}
+
+hipsparseStatus_t hipsparseDcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const double*             csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     double*                   sellVal)
+{
+    return hipsparse::csr2sellHost(handle,
+                                   m,
+                                   n,
+                                   descrA,
+                                   csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   sliceSize,
+                                   sellSliceOffsets,
+                                   perm,
+                                   sellColInd,
+                                   sellVal);
+}
+
+hipsparseStatus_t hipsparseCcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipComplex*         csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     hipComplex*               sellVal)
+{
+    return hipsparse::csr2sellHost(handle,
+                                   m,
+                                   n,
+                                   descrA,
+                                   (const std::complex<float>*)csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   sliceSize,
+                                   sellSliceOffsets,
+                                   perm,
+                                   sellColInd,
+                                   (std::complex<float>*)sellVal);
+}
+
+hipsparseStatus_t hipsparseZcsr2sell(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipDoubleComplex*   csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     int                       sliceSize,
+                                     const int*                sellSliceOffsets,
+                                     const int*                perm,
+                                     int*                      sellColInd,
+                                     hipDoubleComplex*         sellVal)
+{
+    return hipsparse::csr2sellHost(handle,
+                                   m,
+                                   n,
+                                   descrA,
+                                   (const std::complex<double>*)csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   sliceSize,
+                                   sellSliceOffsets,
+                                   perm,
+                                   sellColInd,
+                                   (std::complex<double>*)sellVal);
+}
@@ -0,0 +1,1760 @@
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "hipsparse_host.hpp"
+
+#include <new>
+
+/*
+ * ===========================================================================
+ *    generic descriptors
+ * ===========================================================================
+ */
+
+namespace hipsparse
+{
+    static hipsparseStatus_t checkIndexAndDataTypes(hipsparseIndexType_t indexType,
+                                                    hipDataType          dataType)
+    {
+        size_t size;
+        RETURN_IF_HIPSPARSE_ERROR(getIndexTypeSize(indexType, size));
+        RETURN_IF_HIPSPARSE_ERROR(getDataTypeSize(dataType, size));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t createSpMat(hipsparseSpMatDescr_t* spMatDescr,
+                                         hipsparseFormat_t      format,
+                                         int64_t                rows,
+                                         int64_t                cols,
+                                         int64_t                nnz,
+                                         void*                  offsets,
+                                         void*                  indices,
+                                         void*                  values,
+                                         hipsparseIndexType_t   offsetsType,
+                                         hipsparseIndexType_t   indicesType,
+                                         hipsparseIndexBase_t   idxBase,
+                                         hipDataType            valueType)
+    {
+        if(spMatDescr == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(rows < 0 || cols < 0 || nnz < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(idxBase != HIPSPARSE_INDEX_BASE_ZERO && idxBase != HIPSPARSE_INDEX_BASE_ONE)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(checkIndexAndDataTypes(offsetsType, valueType));
+        RETURN_IF_HIPSPARSE_ERROR(checkIndexAndDataTypes(indicesType, valueType));
+
+        hipsparse::spMatDescr* descr = new(std::nothrow) hipsparse::spMatDescr;
+        if(descr == nullptr)
+        {
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+
+        descr->format      = format;
+        descr->rows        = rows;
+        descr->cols        = cols;
+        descr->nnz         = nnz;
+        descr->offsets     = offsets;
+        descr->indices     = indices;
+        descr->values      = values;
+        descr->offsetsType = offsetsType;
+        descr->indicesType = indicesType;
+        descr->base        = idxBase;
+        descr->valueType   = valueType;
+
+        *spMatDescr = descr;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static const spMatDescr* getSpMat(hipsparseConstSpMatDescr_t matDescr, hipsparseFormat_t format)
+    {
+        const spMatDescr* descr = (const spMatDescr*)matDescr;
+        return (descr != nullptr && descr->format == format) ? descr : nullptr;
+    }
+}
+
+hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
+                                       int64_t                size,
+                                       int64_t                nnz,
+                                       void*                  indices,
+                                       void*                  values,
+                                       hipsparseIndexType_t   idxType,
+                                       hipsparseIndexBase_t   idxBase,
+                                       hipDataType            valueType)
+{
+    if(spVecDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(size < 0 || nnz < 0 || nnz > size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(nnz > 0 && (indices == nullptr || values == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkIndexAndDataTypes(idxType, valueType));
+
+    hipsparse::spVecDescr* descr = new(std::nothrow) hipsparse::spVecDescr;
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    descr->size      = size;
+    descr->nnz       = nnz;
+    descr->indices   = indices;
+    descr->values    = values;
+    descr->idxType   = idxType;
+    descr->base      = idxBase;
+    descr->valueType = valueType;
+
+    *spVecDescr = descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateConstSpVec(hipsparseConstSpVecDescr_t* spVecDescr,
+                                            int64_t                     size,
+                                            int64_t                     nnz,
+                                            const void*                 indices,
+                                            const void*                 values,
+                                            hipsparseIndexType_t        idxType,
+                                            hipsparseIndexBase_t        idxBase,
+                                            hipDataType                 valueType)
+{
+    return hipsparseCreateSpVec((hipsparseSpVecDescr_t*)spVecDescr,
+                                size,
+                                nnz,
+                                const_cast<void*>(indices),
+                                const_cast<void*>(values),
+                                idxType,
+                                idxBase,
+                                valueType);
+}
+
+hipsparseStatus_t hipsparseDestroySpVec(hipsparseConstSpVecDescr_t spVecDescr)
+{
+    if(spVecDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(const hipsparse::spVecDescr*)spVecDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
+                                    int64_t*                    size,
+                                    int64_t*                    nnz,
+                                    void**                      indices,
+                                    void**                      values,
+                                    hipsparseIndexType_t*       idxType,
+                                    hipsparseIndexBase_t*       idxBase,
+                                    hipDataType*                valueType)
+{
+    if(spVecDescr == nullptr || size == nullptr || nnz == nullptr || indices == nullptr
+       || values == nullptr || idxType == nullptr || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spVecDescr* descr = (const hipsparse::spVecDescr*)spVecDescr;
+
+    *size      = descr->size;
+    *nnz       = descr->nnz;
+    *indices   = descr->indices;
+    *values    = descr->values;
+    *idxType   = descr->idxType;
+    *idxBase   = descr->base;
+    *valueType = descr->valueType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstSpVecGet(hipsparseConstSpVecDescr_t spVecDescr,
+                                         int64_t*                   size,
+                                         int64_t*                   nnz,
+                                         const void**               indices,
+                                         const void**               values,
+                                         hipsparseIndexType_t*      idxType,
+                                         hipsparseIndexBase_t*      idxBase,
+                                         hipDataType*               valueType)
+{
+    return hipsparseSpVecGet(const_cast<void*>(spVecDescr),
+                             size,
+                             nnz,
+                             (void**)indices,
+                             (void**)values,
+                             idxType,
+                             idxBase,
+                             valueType);
+}
+
+hipsparseStatus_t hipsparseSpVecGetIndexBase(const hipsparseConstSpVecDescr_t spVecDescr,
+                                             hipsparseIndexBase_t*            idxBase)
+{
+    if(spVecDescr == nullptr || idxBase == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *idxBase = ((const hipsparse::spVecDescr*)spVecDescr)->base;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpVecGetValues(const hipsparseSpVecDescr_t spVecDescr, void** values)
+{
+    if(spVecDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *values = ((const hipsparse::spVecDescr*)spVecDescr)->values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstSpVecGetValues(hipsparseConstSpVecDescr_t spVecDescr,
+                                               const void**               values)
+{
+    return hipsparseSpVecGetValues(const_cast<void*>(spVecDescr), (void**)values);
+}
+
+hipsparseStatus_t hipsparseSpVecSetValues(hipsparseSpVecDescr_t spVecDescr, void* values)
+{
+    if(spVecDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::spVecDescr*)spVecDescr)->values = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cooRowInd,
+                                     void*                  cooColInd,
+                                     void*                  cooValues,
+                                     hipsparseIndexType_t   cooIdxType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    if(nnz > 0 && (cooRowInd == nullptr || cooColInd == nullptr || cooValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::createSpMat(spMatDescr,
+                                  HIPSPARSE_FORMAT_COO,
+                                  rows,
+                                  cols,
+                                  nnz,
+                                  cooRowInd,
+                                  cooColInd,
+                                  cooValues,
+                                  cooIdxType,
+                                  cooIdxType,
+                                  idxBase,
+                                  valueType);
+}
+
+hipsparseStatus_t hipsparseCreateConstCoo(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     nnz,
+                                          const void*                 cooRowInd,
+                                          const void*                 cooColInd,
+                                          const void*                 cooValues,
+                                          hipsparseIndexType_t        cooIdxType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+{
+    return hipsparseCreateCoo((hipsparseSpMatDescr_t*)spMatDescr,
+                              rows,
+                              cols,
+                              nnz,
+                              const_cast<void*>(cooRowInd),
+                              const_cast<void*>(cooColInd),
+                              const_cast<void*>(cooValues),
+                              cooIdxType,
+                              idxBase,
+                              valueType);
+}
+
+hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
+                                        int64_t                rows,
+                                        int64_t                cols,
+                                        int64_t                nnz,
+                                        void*                  cooInd,
+                                        void*                  cooValues,
+                                        hipsparseIndexType_t   cooIdxType,
+                                        hipsparseIndexBase_t   idxBase,
+                                        hipDataType            valueType)
+{
+    if(nnz > 0 && (cooInd == nullptr || cooValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::createSpMat(spMatDescr,
+                                  HIPSPARSE_FORMAT_COO_AOS,
+                                  rows,
+                                  cols,
+                                  nnz,
+                                  cooInd,
+                                  nullptr,
+                                  cooValues,
+                                  cooIdxType,
+                                  cooIdxType,
+                                  idxBase,
+                                  valueType);
+}
+
+hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  csrRowOffsets,
+                                     void*                  csrColInd,
+                                     void*                  csrValues,
+                                     hipsparseIndexType_t   csrRowOffsetsType,
+                                     hipsparseIndexType_t   csrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    // The offsets may be set later, e.g. for the output of SpGEMM
+    if(nnz > 0 && (csrRowOffsets == nullptr || csrColInd == nullptr || csrValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::createSpMat(spMatDescr,
+                                  HIPSPARSE_FORMAT_CSR,
+                                  rows,
+                                  cols,
+                                  nnz,
+                                  csrRowOffsets,
+                                  csrColInd,
+                                  csrValues,
+                                  csrRowOffsetsType,
+                                  csrColIndType,
+                                  idxBase,
+                                  valueType);
+}
+
+hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     nnz,
+                                          const void*                 csrRowOffsets,
+                                          const void*                 csrColInd,
+                                          const void*                 csrValues,
+                                          hipsparseIndexType_t        csrRowOffsetsType,
+                                          hipsparseIndexType_t        csrColIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+{
+    return hipsparseCreateCsr((hipsparseSpMatDescr_t*)spMatDescr,
+                              rows,
+                              cols,
+                              nnz,
+                              const_cast<void*>(csrRowOffsets),
+                              const_cast<void*>(csrColInd),
+                              const_cast<void*>(csrValues),
+                              csrRowOffsetsType,
+                              csrColIndType,
+                              idxBase,
+                              valueType);
+}
+
+hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cscColOffsets,
+                                     void*                  cscRowInd,
+                                     void*                  cscValues,
+                                     hipsparseIndexType_t   cscColOffsetsType,
+                                     hipsparseIndexType_t   cscRowIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    if(nnz > 0 && (cscColOffsets == nullptr || cscRowInd == nullptr || cscValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::createSpMat(spMatDescr,
+                                  HIPSPARSE_FORMAT_CSC,
+                                  rows,
+                                  cols,
+                                  nnz,
+                                  cscColOffsets,
+                                  cscRowInd,
+                                  cscValues,
+                                  cscColOffsetsType,
+                                  cscRowIndType,
+                                  idxBase,
+                                  valueType);
+}
+
+hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     nnz,
+                                          const void*                 cscColOffsets,
+                                          const void*                 cscRowInd,
+                                          const void*                 cscValues,
+                                          hipsparseIndexType_t        cscColOffsetsType,
+                                          hipsparseIndexType_t        cscRowIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+{
+    return hipsparseCreateCsc((hipsparseSpMatDescr_t*)spMatDescr,
+                              rows,
+                              cols,
+                              nnz,
+                              const_cast<void*>(cscColOffsets),
+                              const_cast<void*>(cscRowInd),
+                              const_cast<void*>(cscValues),
+                              cscColOffsetsType,
+                              cscRowIndType,
+                              idxBase,
+                              valueType);
+}
+
+hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
+                                            int64_t                rows,
+                                            int64_t                cols,
+                                            int64_t                ellBlockSize,
+                                            int64_t                ellCols,
+                                            void*                  ellColInd,
+                                            void*                  ellValue,
+                                            hipsparseIndexType_t   ellIdxType,
+                                            hipsparseIndexBase_t   idxBase,
+                                            hipDataType            valueType)
+{
+    if(ellBlockSize < 0 || ellCols < 0 || (ellBlockSize == 0 && ellCols > 0))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(rows > 0 && ellCols > 0 && (ellColInd == nullptr || ellValue == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::createSpMat(spMatDescr,
+                                                     HIPSPARSE_FORMAT_BLOCKED_ELL,
+                                                     rows,
+                                                     cols,
+                                                     rows * ellCols,
+                                                     nullptr,
+                                                     ellColInd,
+                                                     ellValue,
+                                                     ellIdxType,
+                                                     ellIdxType,
+                                                     idxBase,
+                                                     valueType));
+
+    hipsparse::spMatDescr* descr = (hipsparse::spMatDescr*)*spMatDescr;
+
+    descr->ellBlockDim = ellBlockSize;
+    descr->ellCols     = ellCols;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spMatDescr,
+                                                 int64_t                     rows,
+                                                 int64_t                     cols,
+                                                 int64_t                     ellBlockSize,
+                                                 int64_t                     ellCols,
+                                                 const void*                 ellColInd,
+                                                 const void*                 ellValue,
+                                                 hipsparseIndexType_t        ellIdxType,
+                                                 hipsparseIndexBase_t        idxBase,
+                                                 hipDataType                 valueType)
+{
+    return hipsparseCreateBlockedEll((hipsparseSpMatDescr_t*)spMatDescr,
+                                     rows,
+                                     cols,
+                                     ellBlockSize,
+                                     ellCols,
+                                     const_cast<void*>(ellColInd),
+                                     const_cast<void*>(ellValue),
+                                     ellIdxType,
+                                     idxBase,
+                                     valueType);
+}
+
+hipsparseStatus_t hipsparseCreateSlicedEll(hipsparseSpMatDescr_t* spMatDescr,
+                                           int64_t                rows,
+                                           int64_t                cols,
+                                           int64_t                nnz,
+                                           int64_t                sellValuesSize,
+                                           int64_t                sliceSize,
+                                           void*                  sellSliceOffsets,
+                                           void*                  sellColInd,
+                                           void*                  sellValues,
+                                           hipsparseIndexType_t   sellSliceOffsetsType,
+                                           hipsparseIndexType_t   sellColIndType,
+                                           hipsparseIndexBase_t   idxBase,
+                                           hipDataType            valueType)
+{
+    if(sliceSize <= 0 || sellValuesSize < nnz)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(rows > 0 && sellSliceOffsets == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(sellValuesSize > 0 && (sellColInd == nullptr || sellValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::createSpMat(spMatDescr,
+                                                     HIPSPARSE_FORMAT_SLICED_ELLPACK,
+                                                     rows,
+                                                     cols,
+                                                     nnz,
+                                                     sellSliceOffsets,
+                                                     sellColInd,
+                                                     sellValues,
+                                                     sellSliceOffsetsType,
+                                                     sellColIndType,
+                                                     idxBase,
+                                                     valueType));
+
+    hipsparse::spMatDescr* descr = (hipsparse::spMatDescr*)*spMatDescr;
+
+    descr->sliceSize      = sliceSize;
+    descr->sellValuesSize = sellValuesSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateConstSlicedEll(hipsparseConstSpMatDescr_t* spMatDescr,
+                                                int64_t                     rows,
+                                                int64_t                     cols,
+                                                int64_t                     nnz,
+                                                int64_t                     sellValuesSize,
+                                                int64_t                     sliceSize,
+                                                const void*                 sellSliceOffsets,
+                                                const void*                 sellColInd,
+                                                const void*                 sellValues,
+                                                hipsparseIndexType_t        sellSliceOffsetsType,
+                                                hipsparseIndexType_t        sellColIndType,
+                                                hipsparseIndexBase_t        idxBase,
+                                                hipDataType                 valueType)
+{
+    return hipsparseCreateSlicedEll((hipsparseSpMatDescr_t*)spMatDescr,
+                                    rows,
+                                    cols,
+                                    nnz,
+                                    sellValuesSize,
+                                    sliceSize,
+                                    const_cast<void*>(sellSliceOffsets),
+                                    const_cast<void*>(sellColInd),
+                                    const_cast<void*>(sellValues),
+                                    sellSliceOffsetsType,
+                                    sellColIndType,
+                                    idxBase,
+                                    valueType);
+}
+
+hipsparseStatus_t hipsparseCreateBsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                brows,
+                                     int64_t                bcols,
+                                     int64_t                bnnz,
+                                     int64_t                rowBlockSize,
+                                     int64_t                colBlockSize,
+                                     void*                  bsrRowOffsets,
+                                     void*                  bsrColInd,
+                                     void*                  bsrValues,
+                                     hipsparseIndexType_t   bsrRowOffsetsType,
+                                     hipsparseIndexType_t   bsrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType,
+                                     hipsparseOrder_t       order)
+{
+    if(rowBlockSize <= 0 || colBlockSize <= 0 || brows < 0 || bcols < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(order != HIPSPARSE_ORDER_ROW && order != HIPSPARSE_ORDER_COL)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(brows > 0 && bsrRowOffsets == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(bnnz > 0 && (bsrColInd == nullptr || bsrValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::createSpMat(spMatDescr,
+                                                     HIPSPARSE_FORMAT_BSR,
+                                                     brows * rowBlockSize,
+                                                     bcols * colBlockSize,
+                                                     bnnz,
+                                                     bsrRowOffsets,
+                                                     bsrColInd,
+                                                     bsrValues,
+                                                     bsrRowOffsetsType,
+                                                     bsrColIndType,
+                                                     idxBase,
+                                                     valueType));
+
+    hipsparse::spMatDescr* descr = (hipsparse::spMatDescr*)*spMatDescr;
+
+    descr->rowBlockDim = rowBlockSize;
+    descr->colBlockDim = colBlockSize;
+    descr->blockOrder  = order;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateConstBsr(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     brows,
+                                          int64_t                     bcols,
+                                          int64_t                     bnnz,
+                                          int64_t                     rowBlockSize,
+                                          int64_t                     colBlockSize,
+                                          const void*                 bsrRowOffsets,
+                                          const void*                 bsrColInd,
+                                          const void*                 bsrValues,
+                                          hipsparseIndexType_t        bsrRowOffsetsType,
+                                          hipsparseIndexType_t        bsrColIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType,
+                                          hipsparseOrder_t            order)
+{
+    return hipsparseCreateBsr((hipsparseSpMatDescr_t*)spMatDescr,
+                              brows,
+                              bcols,
+                              bnnz,
+                              rowBlockSize,
+                              colBlockSize,
+                              const_cast<void*>(bsrRowOffsets),
+                              const_cast<void*>(bsrColInd),
+                              const_cast<void*>(bsrValues),
+                              bsrRowOffsetsType,
+                              bsrColIndType,
+                              idxBase,
+                              valueType,
+                              order);
+}
+
+hipsparseStatus_t hipsparseDestroySpMat(hipsparseConstSpMatDescr_t spMatDescr)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(const hipsparse::spMatDescr*)spMatDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                         int64_t*                    rows,
+                                         int64_t*                    cols,
+                                         int64_t*                    ellBlockSize,
+                                         int64_t*                    ellCols,
+                                         void**                      ellColInd,
+                                         void**                      ellValue,
+                                         hipsparseIndexType_t*       ellIdxType,
+                                         hipsparseIndexBase_t*       idxBase,
+                                         hipDataType*                valueType)
+{
+    const hipsparse::spMatDescr* descr
+        = hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_BLOCKED_ELL);
+
+    if(descr == nullptr || rows == nullptr || cols == nullptr || ellBlockSize == nullptr
+       || ellCols == nullptr || ellColInd == nullptr || ellValue == nullptr
+       || ellIdxType == nullptr || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows         = descr->rows;
+    *cols         = descr->cols;
+    *ellBlockSize = descr->ellBlockDim;
+    *ellCols      = descr->ellCols;
+    *ellColInd    = descr->indices;
+    *ellValue     = descr->values;
+    *ellIdxType   = descr->indicesType;
+    *idxBase      = descr->base;
+    *valueType    = descr->valueType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                              int64_t*                   rows,
+                                              int64_t*                   cols,
+                                              int64_t*                   ellBlockSize,
+                                              int64_t*                   ellCols,
+                                              const void**               ellColInd,
+                                              const void**               ellValue,
+                                              hipsparseIndexType_t*      ellIdxType,
+                                              hipsparseIndexBase_t*      idxBase,
+                                              hipDataType*               valueType)
+{
+    return hipsparseBlockedEllGet(const_cast<void*>(spMatDescr),
+                                  rows,
+                                  cols,
+                                  ellBlockSize,
+                                  ellCols,
+                                  (void**)ellColInd,
+                                  (void**)ellValue,
+                                  ellIdxType,
+                                  idxBase,
+                                  valueType);
+}
+
+hipsparseStatus_t hipsparseSlicedEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                        int64_t*                    rows,
+                                        int64_t*                    cols,
+                                        int64_t*                    nnz,
+                                        int64_t*                    sellValuesSize,
+                                        int64_t*                    sliceSize,
+                                        void**                      sellSliceOffsets,
+                                        void**                      sellColInd,
+                                        void**                      sellValues,
+                                        hipsparseIndexType_t*       sellSliceOffsetsType,
+                                        hipsparseIndexType_t*       sellColIndType,
+                                        hipsparseIndexBase_t*       idxBase,
+                                        hipDataType*                valueType)
+{
+    const hipsparse::spMatDescr* descr
+        = hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_SLICED_ELLPACK);
+
+    if(descr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || sellValuesSize == nullptr || sliceSize == nullptr || sellSliceOffsets == nullptr
+       || sellColInd == nullptr || sellValues == nullptr || sellSliceOffsetsType == nullptr
+       || sellColIndType == nullptr || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows                 = descr->rows;
+    *cols                 = descr->cols;
+    *nnz                  = descr->nnz;
+    *sellValuesSize       = descr->sellValuesSize;
+    *sliceSize            = descr->sliceSize;
+    *sellSliceOffsets     = descr->offsets;
+    *sellColInd           = descr->indices;
+    *sellValues           = descr->values;
+    *sellSliceOffsetsType = descr->offsetsType;
+    *sellColIndType       = descr->indicesType;
+    *idxBase              = descr->base;
+    *valueType            = descr->valueType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstSlicedEllGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                             int64_t*                   rows,
+                                             int64_t*                   cols,
+                                             int64_t*                   nnz,
+                                             int64_t*                   sellValuesSize,
+                                             int64_t*                   sliceSize,
+                                             const void**               sellSliceOffsets,
+                                             const void**               sellColInd,
+                                             const void**               sellValues,
+                                             hipsparseIndexType_t*      sellSliceOffsetsType,
+                                             hipsparseIndexType_t*      sellColIndType,
+                                             hipsparseIndexBase_t*      idxBase,
+                                             hipDataType*               valueType)
+{
+    return hipsparseSlicedEllGet(const_cast<void*>(spMatDescr),
+                                 rows,
+                                 cols,
+                                 nnz,
+                                 sellValuesSize,
+                                 sliceSize,
+                                 (void**)sellSliceOffsets,
+                                 (void**)sellColInd,
+                                 (void**)sellValues,
+                                 sellSliceOffsetsType,
+                                 sellColIndType,
+                                 idxBase,
+                                 valueType);
+}
+
+hipsparseStatus_t hipsparseBsrGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    brows,
+                                  int64_t*                    bcols,
+                                  int64_t*                    bnnz,
+                                  int64_t*                    rowBlockSize,
+                                  int64_t*                    colBlockSize,
+                                  void**                      bsrRowOffsets,
+                                  void**                      bsrColInd,
+                                  void**                      bsrValues,
+                                  hipsparseIndexType_t*       bsrRowOffsetsType,
+                                  hipsparseIndexType_t*       bsrColIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType,
+                                  hipsparseOrder_t*           order)
+{
+    const hipsparse::spMatDescr* descr = hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_BSR);
+
+    if(descr == nullptr || brows == nullptr || bcols == nullptr || bnnz == nullptr
+       || rowBlockSize == nullptr || colBlockSize == nullptr || bsrRowOffsets == nullptr
+       || bsrColInd == nullptr || bsrValues == nullptr || bsrRowOffsetsType == nullptr
+       || bsrColIndType == nullptr || idxBase == nullptr || valueType == nullptr
+       || order == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *brows             = descr->rows / descr->rowBlockDim;
+    *bcols             = descr->cols / descr->colBlockDim;
+    *bnnz              = descr->nnz;
+    *rowBlockSize      = descr->rowBlockDim;
+    *colBlockSize      = descr->colBlockDim;
+    *bsrRowOffsets     = descr->offsets;
+    *bsrColInd         = descr->indices;
+    *bsrValues         = descr->values;
+    *bsrRowOffsetsType = descr->offsetsType;
+    *bsrColIndType     = descr->indicesType;
+    *idxBase           = descr->base;
+    *valueType         = descr->valueType;
+    *order             = descr->blockOrder;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstBsrGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   brows,
+                                       int64_t*                   bcols,
+                                       int64_t*                   bnnz,
+                                       int64_t*                   rowBlockSize,
+                                       int64_t*                   colBlockSize,
+                                       const void**               bsrRowOffsets,
+                                       const void**               bsrColInd,
+                                       const void**               bsrValues,
+                                       hipsparseIndexType_t*      bsrRowOffsetsType,
+                                       hipsparseIndexType_t*      bsrColIndType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType,
+                                       hipsparseOrder_t*          order)
+{
+    return hipsparseBsrGet(const_cast<void*>(spMatDescr),
+                           brows,
+                           bcols,
+                           bnnz,
+                           rowBlockSize,
+                           colBlockSize,
+                           (void**)bsrRowOffsets,
+                           (void**)bsrColInd,
+                           (void**)bsrValues,
+                           bsrRowOffsetsType,
+                           bsrColIndType,
+                           idxBase,
+                           valueType,
+                           order);
+}
+
+hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      cooRowInd,
+                                  void**                      cooColInd,
+                                  void**                      cooValues,
+                                  hipsparseIndexType_t*       idxType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    const hipsparse::spMatDescr* descr = hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_COO);
+
+    if(descr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || cooRowInd == nullptr || cooColInd == nullptr || cooValues == nullptr
+       || idxType == nullptr || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows      = descr->rows;
+    *cols      = descr->cols;
+    *nnz       = descr->nnz;
+    *cooRowInd = descr->offsets;
+    *cooColInd = descr->indices;
+    *cooValues = descr->values;
+    *idxType   = descr->indicesType;
+    *idxBase   = descr->base;
+    *valueType = descr->valueType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstCooGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   nnz,
+                                       const void**               cooRowInd,
+                                       const void**               cooColInd,
+                                       const void**               cooValues,
+                                       hipsparseIndexType_t*      idxType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType)
+{
+    return hipsparseCooGet(const_cast<void*>(spMatDescr),
+                           rows,
+                           cols,
+                           nnz,
+                           (void**)cooRowInd,
+                           (void**)cooColInd,
+                           (void**)cooValues,
+                           idxType,
+                           idxBase,
+                           valueType);
+}
+
+hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
+                                     int64_t*                    rows,
+                                     int64_t*                    cols,
+                                     int64_t*                    nnz,
+                                     void**                      cooInd,
+                                     void**                      cooValues,
+                                     hipsparseIndexType_t*       idxType,
+                                     hipsparseIndexBase_t*       idxBase,
+                                     hipDataType*                valueType)
+{
+    const hipsparse::spMatDescr* descr
+        = hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_COO_AOS);
+
+    if(descr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || cooInd == nullptr || cooValues == nullptr || idxType == nullptr || idxBase == nullptr
+       || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows      = descr->rows;
+    *cols      = descr->cols;
+    *nnz       = descr->nnz;
+    *cooInd    = descr->offsets;
+    *cooValues = descr->values;
+    *idxType   = descr->indicesType;
+    *idxBase   = descr->base;
+    *valueType = descr->valueType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      csrRowOffsets,
+                                  void**                      csrColInd,
+                                  void**                      csrValues,
+                                  hipsparseIndexType_t*       csrRowOffsetsType,
+                                  hipsparseIndexType_t*       csrColIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    const hipsparse::spMatDescr* descr = hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_CSR);
+
+    if(descr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || csrRowOffsets == nullptr || csrColInd == nullptr || csrValues == nullptr
+       || csrRowOffsetsType == nullptr || csrColIndType == nullptr || idxBase == nullptr
+       || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows              = descr->rows;
+    *cols              = descr->cols;
+    *nnz               = descr->nnz;
+    *csrRowOffsets     = descr->offsets;
+    *csrColInd         = descr->indices;
+    *csrValues         = descr->values;
+    *csrRowOffsetsType = descr->offsetsType;
+    *csrColIndType     = descr->indicesType;
+    *idxBase           = descr->base;
+    *valueType         = descr->valueType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstCsrGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   nnz,
+                                       const void**               csrRowOffsets,
+                                       const void**               csrColInd,
+                                       const void**               csrValues,
+                                       hipsparseIndexType_t*      csrRowOffsetsType,
+                                       hipsparseIndexType_t*      csrColIndType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType)
+{
+    return hipsparseCsrGet(const_cast<void*>(spMatDescr),
+                           rows,
+                           cols,
+                           nnz,
+                           (void**)csrRowOffsets,
+                           (void**)csrColInd,
+                           (void**)csrValues,
+                           csrRowOffsetsType,
+                           csrColIndType,
+                           idxBase,
+                           valueType);
+}
+
+hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 csrRowOffsets,
+                                          void*                 csrColInd,
+                                          void*                 csrValues)
+{
+    hipsparse::spMatDescr* descr
+        = const_cast<hipsparse::spMatDescr*>(hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_CSR));
+
+    if(descr == nullptr || csrRowOffsets == nullptr
+       || (descr->nnz > 0 && (csrColInd == nullptr || csrValues == nullptr)))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->offsets = csrRowOffsets;
+    descr->indices = csrColInd;
+    descr->values  = csrValues;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCscGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      cscColOffsets,
+                                  void**                      cscRowInd,
+                                  void**                      cscValues,
+                                  hipsparseIndexType_t*       cscColOffsetsType,
+                                  hipsparseIndexType_t*       cscRowIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    const hipsparse::spMatDescr* descr = hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_CSC);
+
+    if(descr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || cscColOffsets == nullptr || cscRowInd == nullptr || cscValues == nullptr
+       || cscColOffsetsType == nullptr || cscRowIndType == nullptr || idxBase == nullptr
+       || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows              = descr->rows;
+    *cols              = descr->cols;
+    *nnz               = descr->nnz;
+    *cscColOffsets     = descr->offsets;
+    *cscRowInd         = descr->indices;
+    *cscValues         = descr->values;
+    *cscColOffsetsType = descr->offsetsType;
+    *cscRowIndType     = descr->indicesType;
+    *idxBase           = descr->base;
+    *valueType         = descr->valueType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstCscGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   nnz,
+                                       const void**               cscColOffsets,
+                                       const void**               cscRowInd,
+                                       const void**               cscValues,
+                                       hipsparseIndexType_t*      cscColOffsetsType,
+                                       hipsparseIndexType_t*      cscRowIndType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType)
+{
+    return hipsparseCscGet(const_cast<void*>(spMatDescr),
+                           rows,
+                           cols,
+                           nnz,
+                           (void**)cscColOffsets,
+                           (void**)cscRowInd,
+                           (void**)cscValues,
+                           cscColOffsetsType,
+                           cscRowIndType,
+                           idxBase,
+                           valueType);
+}
+
+hipsparseStatus_t hipsparseCscSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 cscColOffsets,
+                                          void*                 cscRowInd,
+                                          void*                 cscValues)
+{
+    hipsparse::spMatDescr* descr
+        = const_cast<hipsparse::spMatDescr*>(hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_CSC));
+
+    if(descr == nullptr || cscColOffsets == nullptr
+       || (descr->nnz > 0 && (cscRowInd == nullptr || cscValues == nullptr)))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->offsets = cscColOffsets;
+    descr->indices = cscRowInd;
+    descr->values  = cscValues;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 cooRowInd,
+                                          void*                 cooColInd,
+                                          void*                 cooValues)
+{
+    hipsparse::spMatDescr* descr
+        = const_cast<hipsparse::spMatDescr*>(hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_COO));
+
+    if(descr == nullptr
+       || (descr->nnz > 0
+           && (cooRowInd == nullptr || cooColInd == nullptr || cooValues == nullptr)))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->offsets = cooRowInd;
+    descr->indices = cooColInd;
+    descr->values  = cooValues;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseBsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 bsrRowOffsets,
+                                          void*                 bsrColInd,
+                                          void*                 bsrValues)
+{
+    hipsparse::spMatDescr* descr
+        = const_cast<hipsparse::spMatDescr*>(hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_BSR));
+
+    if(descr == nullptr || bsrRowOffsets == nullptr
+       || (descr->nnz > 0 && (bsrColInd == nullptr || bsrValues == nullptr)))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->offsets = bsrRowOffsets;
+    descr->indices = bsrColInd;
+    descr->values  = bsrValues;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
+                                        int64_t*                   rows,
+                                        int64_t*                   cols,
+                                        int64_t*                   nnz)
+{
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* descr = (const hipsparse::spMatDescr*)spMatDescr;
+
+    *rows = descr->rows;
+    *cols = descr->cols;
+    *nnz  = descr->nnz;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetFormat(hipsparseConstSpMatDescr_t spMatDescr,
+                                          hipsparseFormat_t*         format)
+{
+    if(spMatDescr == nullptr || format == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *format = ((const hipsparse::spMatDescr*)spMatDescr)->format;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetIndexBase(hipsparseConstSpMatDescr_t spMatDescr,
+                                             hipsparseIndexBase_t*      idxBase)
+{
+    if(spMatDescr == nullptr || idxBase == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *idxBase = ((const hipsparse::spMatDescr*)spMatDescr)->base;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
+{
+    if(spMatDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *values = ((const hipsparse::spMatDescr*)spMatDescr)->values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstSpMatGetValues(hipsparseConstSpMatDescr_t spMatDescr,
+                                               const void**               values)
+{
+    return hipsparseSpMatGetValues(const_cast<void*>(spMatDescr), (void**)values);
+}
+
+hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values)
+{
+    if(spMatDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::spMatDescr*)spMatDescr)->values = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseConstSpMatDescr_t spMatDescr,
+                                                int*                       batchCount)
+{
+    if(spMatDescr == nullptr || batchCount == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *batchCount = ((const hipsparse::spMatDescr*)spMatDescr)->batchCount;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatSetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int batchCount)
+{
+    if(spMatDescr == nullptr || batchCount <= 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::spMatDescr*)spMatDescr)->batchCount = batchCount;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCooSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               batchStride)
+{
+    hipsparse::spMatDescr* descr
+        = const_cast<hipsparse::spMatDescr*>(hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_COO));
+
+    if(descr == nullptr || batchCount <= 0 || batchStride < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->batchCount         = batchCount;
+    descr->offsetsBatchStride = batchStride;
+    descr->indicesBatchStride = batchStride;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               offsetsBatchStride,
+                                              int64_t               columnsValuesBatchStride)
+{
+    hipsparse::spMatDescr* descr = (hipsparse::spMatDescr*)spMatDescr;
+
+    if(descr == nullptr
+       || (descr->format != HIPSPARSE_FORMAT_CSR && descr->format != HIPSPARSE_FORMAT_CSC))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(batchCount <= 0 || offsetsBatchStride < 0 || columnsValuesBatchStride < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->batchCount         = batchCount;
+    descr->offsetsBatchStride = offsetsBatchStride;
+    descr->indicesBatchStride = columnsValuesBatchStride;
+
+    // Strided batches replace a variable size batch partition
+    if(batchCount > 1)
+    {
+        descr->batchRowOffsets.clear();
+        descr->batchColOffsets.clear();
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsrSetVariableBatch(hipsparseSpMatDescr_t spMatDescr,
+                                               int                   batchCount,
+                                               const int64_t*        batchRowOffsets,
+                                               const int64_t*        batchColOffsets)
+{
+    hipsparse::spMatDescr* descr
+        = const_cast<hipsparse::spMatDescr*>(hipsparse::getSpMat(spMatDescr, HIPSPARSE_FORMAT_CSR));
+
+    if(descr == nullptr || batchRowOffsets == nullptr || batchColOffsets == nullptr
+       || batchCount <= 0 || descr->batchCount > 1)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    for(int b = 0; b < batchCount; ++b)
+    {
+        if(batchRowOffsets[b + 1] < batchRowOffsets[b]
+           || batchColOffsets[b + 1] < batchColOffsets[b])
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+    }
+
+    if(batchRowOffsets[0] != 0 || batchColOffsets[0] != 0
+       || batchRowOffsets[batchCount] != descr->rows || batchColOffsets[batchCount] != descr->cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->batchRowOffsets.assign(batchRowOffsets, batchRowOffsets + batchCount + 1);
+    descr->batchColOffsets.assign(batchColOffsets, batchColOffsets + batchCount + 1);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseConstSpMatDescr_t spMatDescr,
+                                             hipsparseSpMatAttribute_t  attribute,
+                                             void*                      data,
+                                             size_t                     dataSize)
+{
+    if(spMatDescr == nullptr || data == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* descr = (const hipsparse::spMatDescr*)spMatDescr;
+
+    switch(attribute)
+    {
+    case HIPSPARSE_SPMAT_FILL_MODE:
+    {
+        if(dataSize != sizeof(hipsparseFillMode_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *(hipsparseFillMode_t*)data = descr->fillMode;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    case HIPSPARSE_SPMAT_DIAG_TYPE:
+    {
+        if(dataSize != sizeof(hipsparseDiagType_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *(hipsparseDiagType_t*)data = descr->diagType;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    }
+
+    return HIPSPARSE_STATUS_INVALID_VALUE;
+}
+
+hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDescr,
+                                             hipsparseSpMatAttribute_t attribute,
+                                             const void*               data,
+                                             size_t                    dataSize)
+{
+    if(spMatDescr == nullptr || data == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::spMatDescr* descr = (hipsparse::spMatDescr*)spMatDescr;
+
+    switch(attribute)
+    {
+    case HIPSPARSE_SPMAT_FILL_MODE:
+    {
+        hipsparseFillMode_t fillMode = *(const hipsparseFillMode_t*)data;
+        if(dataSize != sizeof(hipsparseFillMode_t)
+           || (fillMode != HIPSPARSE_FILL_MODE_LOWER && fillMode != HIPSPARSE_FILL_MODE_UPPER))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        descr->fillMode = fillMode;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    case HIPSPARSE_SPMAT_DIAG_TYPE:
+    {
+        hipsparseDiagType_t diagType = *(const hipsparseDiagType_t*)data;
+        if(dataSize != sizeof(hipsparseDiagType_t)
+           || (diagType != HIPSPARSE_DIAG_TYPE_NON_UNIT && diagType != HIPSPARSE_DIAG_TYPE_UNIT))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        descr->diagType = diagType;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    }
+
+    return HIPSPARSE_STATUS_INVALID_VALUE;
+}
+
+hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
+                                       int64_t                size,
+                                       void*                  values,
+                                       hipDataType            valueType)
+{
+    if(dnVecDescr == nullptr || size < 0 || (size > 0 && values == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    size_t typeSize;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getDataTypeSize(valueType, typeSize));
+
+    hipsparse::dnVecDescr* descr = new(std::nothrow) hipsparse::dnVecDescr;
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    descr->size      = size;
+    descr->values    = values;
+    descr->valueType = valueType;
+
+    *dnVecDescr = descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateConstDnVec(hipsparseConstDnVecDescr_t* dnVecDescr,
+                                            int64_t                     size,
+                                            const void*                 values,
+                                            hipDataType                 valueType)
+{
+    return hipsparseCreateDnVec(
+        (hipsparseDnVecDescr_t*)dnVecDescr, size, const_cast<void*>(values), valueType);
+}
+
+hipsparseStatus_t hipsparseDestroyDnVec(hipsparseConstDnVecDescr_t dnVecDescr)
+{
+    if(dnVecDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(const hipsparse::dnVecDescr*)dnVecDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
+                                    int64_t*                    size,
+                                    void**                      values,
+                                    hipDataType*                valueType)
+{
+    if(dnVecDescr == nullptr || size == nullptr || values == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::dnVecDescr* descr = (const hipsparse::dnVecDescr*)dnVecDescr;
+
+    *size      = descr->size;
+    *values    = descr->values;
+    *valueType = descr->valueType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
+                                         int64_t*                   size,
+                                         const void**               values,
+                                         hipDataType*               valueType)
+{
+    return hipsparseDnVecGet(const_cast<void*>(dnVecDescr), size, (void**)values, valueType);
+}
+
+hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr, void** values)
+{
+    if(dnVecDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *values = ((const hipsparse::dnVecDescr*)dnVecDescr)->values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstDnVecGetValues(hipsparseConstDnVecDescr_t dnVecDescr,
+                                               const void**               values)
+{
+    return hipsparseDnVecGetValues(const_cast<void*>(dnVecDescr), (void**)values);
+}
+
+hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values)
+{
+    if(dnVecDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::dnVecDescr*)dnVecDescr)->values = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
+                                       int64_t                rows,
+                                       int64_t                cols,
+                                       int64_t                ld,
+                                       void*                  values,
+                                       hipDataType            valueType,
+                                       hipsparseOrder_t       order)
+{
+    if(dnMatDescr == nullptr || rows < 0 || cols < 0 || ld < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(order != HIPSPARSE_ORDER_COL && order != HIPSPARSE_ORDER_ROW)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(ld < ((order == HIPSPARSE_ORDER_COL) ? rows : cols))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(rows > 0 && cols > 0 && values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    size_t typeSize;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getDataTypeSize(valueType, typeSize));
+
+    hipsparse::dnMatDescr* descr = new(std::nothrow) hipsparse::dnMatDescr;
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    descr->rows      = rows;
+    descr->cols      = cols;
+    descr->ld        = ld;
+    descr->values    = values;
+    descr->valueType = valueType;
+    descr->order     = order;
+
+    *dnMatDescr = descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateConstDnMat(hipsparseConstDnMatDescr_t* dnMatDescr,
+                                            int64_t                     rows,
+                                            int64_t                     cols,
+                                            int64_t                     ld,
+                                            const void*                 values,
+                                            hipDataType                 valueType,
+                                            hipsparseOrder_t            order)
+{
+    return hipsparseCreateDnMat((hipsparseDnMatDescr_t*)dnMatDescr,
+                                rows,
+                                cols,
+                                ld,
+                                const_cast<void*>(values),
+                                valueType,
+                                order);
+}
+
+hipsparseStatus_t hipsparseDestroyDnMat(hipsparseConstDnMatDescr_t dnMatDescr)
+{
+    if(dnMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(const hipsparse::dnMatDescr*)dnMatDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
+                                    int64_t*                    rows,
+                                    int64_t*                    cols,
+                                    int64_t*                    ld,
+                                    void**                      values,
+                                    hipDataType*                valueType,
+                                    hipsparseOrder_t*           order)
+{
+    if(dnMatDescr == nullptr || rows == nullptr || cols == nullptr || ld == nullptr
+       || values == nullptr || valueType == nullptr || order == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::dnMatDescr* descr = (const hipsparse::dnMatDescr*)dnMatDescr;
+
+    *rows      = descr->rows;
+    *cols      = descr->cols;
+    *ld        = descr->ld;
+    *values    = descr->values;
+    *valueType = descr->valueType;
+    *order     = descr->order;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstDnMatGet(hipsparseConstDnMatDescr_t dnMatDescr,
+                                         int64_t*                   rows,
+                                         int64_t*                   cols,
+                                         int64_t*                   ld,
+                                         const void**               values,
+                                         hipDataType*               valueType,
+                                         hipsparseOrder_t*          order)
+{
+    return hipsparseDnMatGet(
+        const_cast<void*>(dnMatDescr), rows, cols, ld, (void**)values, valueType, order);
+}
+
+hipsparseStatus_t hipsparseDnMatGetValues(const hipsparseDnMatDescr_t dnMatDescr, void** values)
+{
+    if(dnMatDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *values = ((const hipsparse::dnMatDescr*)dnMatDescr)->values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstDnMatGetValues(hipsparseConstDnMatDescr_t dnMatDescr,
+                                               const void**               values)
+{
+    return hipsparseDnMatGetValues(const_cast<void*>(dnMatDescr), (void**)values);
+}
+
+hipsparseStatus_t hipsparseDnMatSetValues(hipsparseDnMatDescr_t dnMatDescr, void* values)
+{
+    if(dnMatDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((hipsparse::dnMatDescr*)dnMatDescr)->values = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnMatGetStridedBatch(hipsparseConstDnMatDescr_t dnMatDescr,
+                                                int*                       batchCount,
+                                                int64_t*                   batchStride)
+{
+    if(dnMatDescr == nullptr || batchCount == nullptr || batchStride == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::dnMatDescr* descr = (const hipsparse::dnMatDescr*)dnMatDescr;
+
+    *batchCount  = descr->batchCount;
+    *batchStride = descr->batchStride;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnMatSetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
+                                                int                   batchCount,
+                                                int64_t               batchStride)
+{
+    if(dnMatDescr == nullptr || batchCount <= 0 || batchStride < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::dnMatDescr* descr = (hipsparse::dnMatDescr*)dnMatDescr;
+
+    descr->batchCount  = batchCount;
+    descr->batchStride = batchStride;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
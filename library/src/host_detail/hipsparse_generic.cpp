@@ -0,0 +1,2763 @@
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "hipsparse_host.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+/*
+ * ===========================================================================
+ *    generic API, host kernels
+ * ===========================================================================
+ */
+
+namespace hipsparse
+{
+    // Dense matrix (or vector, seen as a column) with its strided batches
+    template <typename T>
+    struct denseView
+    {
+        T*               values{};
+        int64_t          rows{};
+        int64_t          cols{};
+        int64_t          ld{};
+        hipsparseOrder_t order{HIPSPARSE_ORDER_COL};
+        int              batchCount{1};
+        int64_t          batchStride{};
+
+        T& at(int batch, int64_t i, int64_t j) const
+        {
+            return denseAt(values + ((batchCount > 1) ? batch * batchStride : 0), ld, order, i, j);
+        }
+    };
+
+    template <typename T>
+    static denseView<T> makeView(const dnMatDescr* descr)
+    {
+        return {(T*)descr->values,
+                descr->rows,
+                descr->cols,
+                descr->ld,
+                descr->order,
+                descr->batchCount,
+                descr->batchStride};
+    }
+
+    template <typename T>
+    static denseView<T> makeView(const dnVecDescr* descr)
+    {
+        return {(T*)descr->values, descr->size, 1, descr->size, HIPSPARSE_ORDER_COL, 1, 0};
+    }
+
+    // Element (i, j) of op(B)
+    template <typename T>
+    static T opAt(const denseView<T>& B, hipsparseOperation_t op, int batch, int64_t i, int64_t j)
+    {
+        return (op == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? B.at(batch, i, j)
+                                                         : applyOperation(op, B.at(batch, j, i));
+    }
+
+    // Calls f(i, j, value) for each stored entry of the given batch of A. With parallel, the
+    // entries are split between the threads along the compressed dimension (rows of CSR, BSR and
+    // Blocked ELL, columns of CSC) or along the entries (COO), each entry is visited once.
+    template <typename I, typename J, typename T, typename F>
+    static void forEachEntry(const spMatDescr* A, int batch, bool parallel, F&& f)
+    {
+        if(A->nnz == 0 || A->rows == 0 || A->cols == 0)
+        {
+            return;
+        }
+
+        const int64_t b    = (A->batchCount > 1) ? batch : 0;
+        const I*      ptr  = (const I*)A->offsets + b * A->offsetsBatchStride;
+        const J*      ind  = (const J*)A->indices + b * A->indicesBatchStride;
+        T*            val  = (T*)A->values + b * A->indicesBatchStride;
+        const int64_t base = A->base;
+
+        switch(A->format)
+        {
+        case HIPSPARSE_FORMAT_CSR:
+        case HIPSPARSE_FORMAT_CSC:
+        {
+            const bool    csc   = (A->format == HIPSPARSE_FORMAT_CSC);
+            const int64_t outer = csc ? A->cols : A->rows;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256) if(parallel)
+#endif
+            for(int64_t o = 0; o < outer; ++o)
+            {
+                for(int64_t k = ptr[o] - base; k < ptr[o + 1] - base; ++k)
+                {
+                    const int64_t in = ind[k] - base;
+                    csc ? f(in, o, val[k]) : f(o, in, val[k]);
+                }
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_COO:
+        {
+#ifdef _OPENMP
+#pragma omp parallel for if(parallel)
+#endif
+            for(int64_t k = 0; k < A->nnz; ++k)
+            {
+                f(ptr[k] - base, ind[k] - base, val[k]);
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_COO_AOS:
+        {
+#ifdef _OPENMP
+#pragma omp parallel for if(parallel)
+#endif
+            for(int64_t k = 0; k < A->nnz; ++k)
+            {
+                f(ptr[2 * k] - base, ptr[2 * k + 1] - base, val[k]);
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_BLOCKED_ELL:
+        {
+            const int64_t bs        = A->ellBlockDim;
+            const int64_t mb        = (A->rows + bs - 1) / bs;
+            const int64_t ellBlocks = A->ellCols / bs;
+
+#ifdef _OPENMP
+#pragma omp parallel for if(parallel)
+#endif
+            for(int64_t bi = 0; bi < mb; ++bi)
+            {
+                for(int64_t p = 0; p < ellBlocks; ++p)
+                {
+                    const int64_t bj = ind[bi * ellBlocks + p] - base;
+                    if(bj < 0)
+                    {
+                        continue;
+                    }
+
+                    T* block = val + (bi * ellBlocks + p) * bs * bs;
+                    for(int64_t c = 0; c < bs; ++c)
+                    {
+                        for(int64_t r = 0; r < bs; ++r)
+                        {
+                            const int64_t i = bi * bs + r;
+                            const int64_t j = bj * bs + c;
+                            if(i < A->rows && j < A->cols)
+                            {
+                                f(i, j, block[c * bs + r]);
+                            }
+                        }
+                    }
+                }
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_BSR:
+        {
+            const int64_t rbd = A->rowBlockDim;
+            const int64_t cbd = A->colBlockDim;
+            const int64_t mb  = A->rows / rbd;
+            const bool    row = (A->blockOrder == HIPSPARSE_ORDER_ROW);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64) if(parallel)
+#endif
+            for(int64_t bi = 0; bi < mb; ++bi)
+            {
+                for(int64_t k = ptr[bi] - base; k < ptr[bi + 1] - base; ++k)
+                {
+                    const int64_t bj    = ind[k] - base;
+                    T*            block = val + k * rbd * cbd;
+                    for(int64_t r = 0; r < rbd; ++r)
+                    {
+                        for(int64_t c = 0; c < cbd; ++c)
+                        {
+                            f(bi * rbd + r, bj * cbd + c, block[row ? r * cbd + c : c * rbd + r]);
+                        }
+                    }
+                }
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_SLICED_ELLPACK:
+        {
+            const int64_t C       = A->sliceSize;
+            const int64_t nslices = (A->rows + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64) if(parallel)
+#endif
+            for(int64_t s = 0; s < nslices; ++s)
+            {
+                const int64_t width = (ptr[s + 1] - ptr[s]) / C;
+                for(int64_t r = 0; r < C; ++r)
+                {
+                    const int64_t i = s * C + r;
+                    if(i >= A->rows)
+                    {
+                        break;
+                    }
+
+                    for(int64_t p = 0; p < width; ++p)
+                    {
+                        const int64_t k = ptr[s] + p * C + r;
+                        if(ind[k] >= 0)
+                        {
+                            f(i, ind[k] - base, val[k]);
+                        }
+                    }
+                }
+            }
+            break;
+        }
+        }
+    }
+
+    // Calls f(I{}, J{}, T{}) with the index and value types of A
+    template <typename F>
+    static hipsparseStatus_t dispatchSpMat(const spMatDescr* A, F&& f)
+    {
+        return dispatchIndexType(A->offsetsType, [&](auto i) {
+            return dispatchIndexType(A->indicesType, [&](auto j) {
+                return dispatchDataType(A->valueType,
+                                        [&](auto t) { return f(i, j, t); });
+            });
+        });
+    }
+
+    static bool isValidOperation(hipsparseOperation_t op)
+    {
+        return op == HIPSPARSE_OPERATION_NON_TRANSPOSE || op == HIPSPARSE_OPERATION_TRANSPOSE
+               || op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE;
+    }
+
+    //
+    // C = alpha * op(A) * op(B) + beta * C, B and C are dense
+    //
+    template <typename I, typename J, typename T>
+    static hipsparseStatus_t spmmHost(hipsparseOperation_t  opA,
+                                      hipsparseOperation_t  opB,
+                                      T                     alpha,
+                                      const spMatDescr*     A,
+                                      const denseView<T>&   B,
+                                      T                     beta,
+                                      const denseView<T>&   C)
+    {
+        const bool    transA = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        const int64_t m      = transA ? A->cols : A->rows;
+        const int64_t k      = transA ? A->rows : A->cols;
+        const int64_t n      = C.cols;
+
+        if(C.rows != m
+           || ((opB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? B.rows : B.cols) != k
+           || ((opB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? B.cols : B.rows) != n)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // Each row of op(A) belongs to a single thread when A is split along that dimension
+        const bool rowParallel
+            = transA ? (A->format == HIPSPARSE_FORMAT_CSC)
+                     : (A->format == HIPSPARSE_FORMAT_CSR
+                        || A->format == HIPSPARSE_FORMAT_BLOCKED_ELL
+                        || A->format == HIPSPARSE_FORMAT_SLICED_ELLPACK
+                        || A->format == HIPSPARSE_FORMAT_BSR);
+
+        for(int b = 0; b < C.batchCount; ++b)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t j = 0; j < n; ++j)
+            {
+                for(int64_t i = 0; i < m; ++i)
+                {
+                    T& c = C.at(b, i, j);
+                    c    = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * c;
+                }
+            }
+
+            auto update = [&](int64_t j0, int64_t j1, bool parallel) {
+                forEachEntry<I, J, T>(A, b, parallel, [&](int64_t i, int64_t l, T& v) {
+                    const T       a   = alpha * applyOperation(opA, v);
+                    const int64_t row = transA ? l : i;
+                    const int64_t col = transA ? i : l;
+                    for(int64_t j = j0; j < j1; ++j)
+                    {
+                        C.at(b, row, j) += a * opAt(B, opB, b, col, j);
+                    }
+                });
+            };
+
+            const int64_t nthreads = getNumThreads();
+
+            // Private copies of C are only used as long as they fit
+            const bool partialFits = (nthreads * m * n <= (int64_t(1) << 26));
+
+            if(rowParallel || nthreads == 1 || (n < nthreads && !partialFits))
+            {
+                update(0, n, rowParallel);
+            }
+            else if(n < nthreads)
+            {
+                // Too few columns to go around, e.g. SpMV with COO or a transposed CSR matrix.
+                // The threads scatter their share of the entries into private copies of C, which
+                // are then summed into C
+                std::vector<T> partial;
+                try
+                {
+                    partial.assign(nthreads * m * n, static_cast<T>(0));
+                }
+                catch(const std::bad_alloc&)
+                {
+                    return HIPSPARSE_STATUS_ALLOC_FAILED;
+                }
+
+                forEachEntry<I, J, T>(A, b, true, [&](int64_t i, int64_t l, T& v) {
+                    const T       a   = alpha * applyOperation(opA, v);
+                    const int64_t row = transA ? l : i;
+                    const int64_t col = transA ? i : l;
+                    T*            p   = partial.data() + getThreadNum() * m * n;
+                    for(int64_t j = 0; j < n; ++j)
+                    {
+                        p[row + j * m] += a * opAt(B, opB, b, col, j);
+                    }
+                });
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for(int64_t i = 0; i < m; ++i)
+                {
+                    for(int64_t j = 0; j < n; ++j)
+                    {
+                        T s = static_cast<T>(0);
+                        for(int64_t t = 0; t < nthreads; ++t)
+                        {
+                            s += partial[t * m * n + i + j * m];
+                        }
+                        C.at(b, i, j) += s;
+                    }
+                }
+            }
+            else
+            {
+                // Otherwise, the threads own disjoint sets of columns of C
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for(int64_t j = 0; j < n; ++j)
+                {
+                    update(j, j + 1, false);
+                }
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Loads the values of op(A) into the triangle built from its structure
+    //
+    template <typename I, typename J, typename T>
+    static void loadTriangle(hipsparseOperation_t opA, const spMatDescr* A, triangle<T>& tri)
+    {
+        std::fill(tri.diag.begin(), tri.diag.end(), static_cast<T>(0));
+
+        int64_t e = 0;
+        forEachEntry<I, J, T>(A, 0, false, [&](int64_t i, int64_t j, T& v) {
+            const int64_t k = tri.entryMap[e++];
+            if(k >= 0)
+            {
+                tri.L.val[k] = applyOperation(opA, v);
+            }
+            else if(k != triangle<T>::entryDropped)
+            {
+                tri.diag[-1 - k] += applyOperation(opA, v);
+            }
+        });
+    }
+
+    //
+    // Triangular part of op(A) in CSR, without its diagonal which is kept separately
+    //
+    template <typename I, typename J, typename T>
+    static hipsparseStatus_t
+        buildTriangle(hipsparseOperation_t opA, const spMatDescr* A, triangle<T>& tri)
+    {
+        if(A->rows != A->cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const bool    transA = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        const bool    lowerA = (A->fillMode == HIPSPARSE_FILL_MODE_LOWER);
+        const int64_t m      = A->rows;
+
+        csrMatrix<T>& L = tri.L;
+
+        tri.lower = (lowerA != transA);
+
+        L.rows = m;
+        L.cols = m;
+        L.rowPtr.assign(m + 1, 0);
+        tri.diag.assign(m, static_cast<T>(0));
+        tri.entryMap.clear();
+
+        // (column, entry of A) pairs of every row of the triangle
+        std::vector<std::vector<std::pair<int64_t, int64_t>>> rows(m);
+        forEachEntry<I, J, T>(A, 0, false, [&](int64_t i, int64_t j, T&) {
+            const int64_t e = tri.entryMap.size();
+            if(i == j)
+            {
+                tri.entryMap.push_back(-1 - i);
+            }
+            else if((j < i) == lowerA)
+            {
+                transA ? rows[j].emplace_back(i, e) : rows[i].emplace_back(j, e);
+                tri.entryMap.push_back(0);
+            }
+            else
+            {
+                tri.entryMap.push_back(triangle<T>::entryDropped);
+            }
+        });
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            L.rowPtr[i + 1] = L.rowPtr[i] + rows[i].size();
+        }
+
+        L.colInd.resize(L.rowPtr[m]);
+        L.val.resize(L.rowPtr[m]);
+        for(int64_t i = 0; i < m; ++i)
+        {
+            int64_t k = L.rowPtr[i];
+            for(const auto& e : rows[i])
+            {
+                L.colInd[k]            = e.first;
+                tri.entryMap[e.second] = k;
+                ++k;
+            }
+        }
+
+        loadTriangle<I, J, T>(opA, A, tri);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Triangle of op(A) kept in the cache of a SpSV or SpSM descriptor. The structure is only
+    // built if the cache holds another matrix, the values are reloaded on every call.
+    //
+    template <typename I, typename J, typename T>
+    static hipsparseStatus_t cachedTriangle(triangleCache&       cache,
+                                            hipsparseOperation_t opA,
+                                            const spMatDescr*    A,
+                                            const triangle<T>*&  tri)
+    {
+        triangle<T>* cached = (triangle<T>*)cache.triangle.get();
+
+        if(cached == nullptr || cache.opA != opA || cache.valueType != A->valueType
+           || cache.fillMode != A->fillMode || cache.offsets != A->offsets
+           || cache.indices != A->indices || cache.rows != A->rows || cache.nnz != A->nnz)
+        {
+            std::shared_ptr<triangle<T>> built;
+            try
+            {
+                built = std::make_shared<triangle<T>>();
+                RETURN_IF_HIPSPARSE_ERROR((buildTriangle<I, J, T>(opA, A, *built)));
+            }
+            catch(const std::bad_alloc&)
+            {
+                return HIPSPARSE_STATUS_ALLOC_FAILED;
+            }
+
+            cache.triangle  = built;
+            cache.opA       = opA;
+            cache.valueType = A->valueType;
+            cache.fillMode  = A->fillMode;
+            cache.offsets   = A->offsets;
+            cache.indices   = A->indices;
+            cache.rows      = A->rows;
+            cache.nnz       = A->nnz;
+
+            tri = built.get();
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        loadTriangle<I, J, T>(opA, A, *cached);
+
+        tri = cached;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // y = alpha * op(A)^-1 * x on the rows [begin, end), which must not depend on the other
+    // rows, with x(i) and y(i) accessors. Rows are solved in sequence.
+    template <typename T, typename X, typename Y>
+    static void triangularSolve(const csrMatrix<T>&   L,
+                                const std::vector<T>& diag,
+                                bool                  lower,
+                                bool                  unit,
+                                T                     alpha,
+                                X&&                   x,
+                                Y&&                   y,
+                                int64_t               begin,
+                                int64_t               end)
+    {
+        for(int64_t r = begin; r < end; ++r)
+        {
+            const int64_t i = lower ? r : begin + end - 1 - r;
+
+            T s = alpha * x(i);
+            for(int64_t k = L.rowPtr[i]; k < L.rowPtr[i + 1]; ++k)
+            {
+                s -= L.val[k] * y(L.colInd[k]);
+            }
+
+            y(i) = unit ? s : s / diag[i];
+        }
+    }
+
+    // y = alpha * op(A)^-1 * x
+    template <typename T, typename X, typename Y>
+    static void triangularSolve(const csrMatrix<T>&   L,
+                                const std::vector<T>& diag,
+                                bool                  lower,
+                                bool                  unit,
+                                T                     alpha,
+                                X&&                   x,
+                                Y&&                   y)
+    {
+        triangularSolve(L, diag, lower, unit, alpha, x, y, 0, L.rows);
+    }
+
+    //
+    // y = alpha * op(A) * x + beta * y, A is a CSR matrix partitioned in variable size batches.
+    // The batches are block diagonal, so each one is computed by a single thread.
+    //
+    template <typename I, typename J, typename T>
+    static hipsparseStatus_t spmvVariableBatch(hipsparseOperation_t opA,
+                                               T                    alpha,
+                                               const spMatDescr*    A,
+                                               const T*             x,
+                                               T                    beta,
+                                               T*                   y)
+    {
+        const bool     transA = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        const int      count  = static_cast<int>(A->batchRowOffsets.size()) - 1;
+        const I*       ptr    = (const I*)A->offsets;
+        const J*       ind    = (const J*)A->indices;
+        const T*       val    = (const T*)A->values;
+        const int64_t  base   = A->base;
+        const int64_t* rows   = A->batchRowOffsets.data();
+        const int64_t* cols   = A->batchColOffsets.data();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for(int b = 0; b < count; ++b)
+        {
+            if(!transA)
+            {
+                for(int64_t i = rows[b]; i < rows[b + 1]; ++i)
+                {
+                    T sum = static_cast<T>(0);
+                    for(int64_t k = ptr[i] - base; k < ptr[i + 1] - base; ++k)
+                    {
+                        sum += val[k] * x[ind[k] - base];
+                    }
+
+                    y[i] = (beta == static_cast<T>(0)) ? alpha * sum : alpha * sum + beta * y[i];
+                }
+            }
+            else
+            {
+                for(int64_t j = cols[b]; j < cols[b + 1]; ++j)
+                {
+                    y[j] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[j];
+                }
+
+                for(int64_t i = rows[b]; i < rows[b + 1]; ++i)
+                {
+                    const T a = alpha * x[i];
+                    for(int64_t k = ptr[i] - base; k < ptr[i + 1] - base; ++k)
+                    {
+                        y[ind[k] - base] += applyOperation(opA, val[k]) * a;
+                    }
+                }
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // The fused reductions sum the entries in chunks of fixed size and add the partial sums in
+    // order, the result does not depend on the number of threads
+    constexpr int64_t reductionChunkSize = 4096;
+
+    //
+    // y = alpha * op(A) * x + beta * y, then returns the sum of epilogue(i, y(i)) over the
+    // entries of y in result. Non transposed CSR matrices are computed in a single pass, each
+    // row of y is reduced as soon as it is written.
+    //
+    template <typename I, typename J, typename T, typename S, typename E>
+    static hipsparseStatus_t spmvFused(hipsparseOperation_t opA,
+                                       T                    alpha,
+                                       const spMatDescr*    A,
+                                       const dnVecDescr*    x,
+                                       T                    beta,
+                                       const dnVecDescr*    y,
+                                       E&&                  epilogue,
+                                       S&                   result)
+    {
+        const bool    transA = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        const int64_t m      = transA ? A->cols : A->rows;
+        const int64_t chunks = (m + reductionChunkSize - 1) / reductionChunkSize;
+
+        if(x->size != (transA ? A->rows : A->cols) || y->size != m)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const T* xval = (const T*)x->values;
+        T*       yval = (T*)y->values;
+
+        std::vector<S> partial(chunks, static_cast<S>(0));
+
+        if(A->format == HIPSPARSE_FORMAT_CSR && !transA && A->batchCount == 1)
+        {
+            const I*      ptr  = (const I*)A->offsets;
+            const J*      ind  = (const J*)A->indices;
+            const T*      val  = (const T*)A->values;
+            const int64_t base = A->base;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for(int64_t c = 0; c < chunks; ++c)
+            {
+                S sum = static_cast<S>(0);
+                for(int64_t i = c * reductionChunkSize;
+                    i < std::min(m, (c + 1) * reductionChunkSize);
+                    ++i)
+                {
+                    T s = static_cast<T>(0);
+                    if(A->nnz > 0)
+                    {
+                        for(int64_t k = ptr[i] - base; k < ptr[i + 1] - base; ++k)
+                        {
+                            s += val[k] * xval[ind[k] - base];
+                        }
+                    }
+
+                    yval[i] = (beta == static_cast<T>(0)) ? alpha * s : alpha * s + beta * yval[i];
+                    sum += epilogue(i, yval[i]);
+                }
+
+                partial[c] = sum;
+            }
+        }
+        else
+        {
+            // The other formats and operations scatter into y, which is reduced afterwards
+            if(A->batchRowOffsets.empty())
+            {
+                RETURN_IF_HIPSPARSE_ERROR((spmmHost<I, J, T>(opA,
+                                                             HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                             alpha,
+                                                             A,
+                                                             makeView<T>(x),
+                                                             beta,
+                                                             makeView<T>(y))));
+            }
+            else
+            {
+                RETURN_IF_HIPSPARSE_ERROR(
+                    (spmvVariableBatch<I, J, T>(opA, alpha, A, xval, beta, yval)));
+            }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t c = 0; c < chunks; ++c)
+            {
+                S sum = static_cast<S>(0);
+                for(int64_t i = c * reductionChunkSize;
+                    i < std::min(m, (c + 1) * reductionChunkSize);
+                    ++i)
+                {
+                    sum += epilogue(i, yval[i]);
+                }
+
+                partial[c] = sum;
+            }
+        }
+
+        result = static_cast<S>(0);
+        for(int64_t c = 0; c < chunks; ++c)
+        {
+            result += partial[c];
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // D = alpha * A * B (+ beta * C), CSR matrices with the index types of A
+    //
+    template <typename I, typename J, typename T>
+    static void spgemmHost(T                 alpha,
+                           const spMatDescr* A,
+                           const spMatDescr* B,
+                           T                 beta,
+                           const spMatDescr* C,
+                           csrMatrix<T>&     D)
+    {
+        const int64_t m = A->rows;
+        const int64_t n = B->cols;
+
+        const I* ptrA = (const I*)A->offsets;
+        const J* indA = (const J*)A->indices;
+        const T* valA = (const T*)A->values;
+        const I* ptrB = (const I*)B->offsets;
+        const J* indB = (const J*)B->indices;
+        const T* valB = (const T*)B->values;
+        const I* ptrC = (const I*)C->offsets;
+        const J* indC = (const J*)C->indices;
+        const T* valC = (const T*)C->values;
+
+        const int64_t baseA = A->base;
+        const int64_t baseB = B->base;
+        const int64_t baseC = C->base;
+
+        const bool addC = (beta != static_cast<T>(0)) && C->nnz > 0 && C->values != nullptr;
+
+        std::vector<std::vector<int64_t>> cols(m);
+        std::vector<std::vector<T>>       vals(m);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // Dense accumulator of the row, marker holds the last row that touched a column
+            std::vector<int64_t> marker(n, -1);
+            std::vector<T>       acc(n);
+
+            auto accumulate = [&](int64_t i, int64_t j, T v) {
+                if(marker[j] != i)
+                {
+                    marker[j] = i;
+                    acc[j]    = static_cast<T>(0);
+                    cols[i].push_back(j);
+                }
+                acc[j] += v;
+            };
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(int64_t i = 0; i < m; ++i)
+            {
+                if(A->nnz > 0)
+                {
+                    for(int64_t k = ptrA[i] - baseA; k < ptrA[i + 1] - baseA; ++k)
+                    {
+                        const int64_t l = indA[k] - baseA;
+                        const T       a = alpha * valA[k];
+                        for(int64_t p = ptrB[l] - baseB; p < ptrB[l + 1] - baseB; ++p)
+                        {
+                            accumulate(i, indB[p] - baseB, a * valB[p]);
+                        }
+                    }
+                }
+
+                if(addC)
+                {
+                    for(int64_t k = ptrC[i] - baseC; k < ptrC[i + 1] - baseC; ++k)
+                    {
+                        accumulate(i, indC[k] - baseC, beta * valC[k]);
+                    }
+                }
+
+                std::sort(cols[i].begin(), cols[i].end());
+                vals[i].resize(cols[i].size());
+                for(size_t k = 0; k < cols[i].size(); ++k)
+                {
+                    vals[i][k] = acc[cols[i][k]];
+                }
+            }
+        }
+
+        D.rows = m;
+        D.cols = n;
+        D.rowPtr.assign(m + 1, 0);
+        for(int64_t i = 0; i < m; ++i)
+        {
+            D.rowPtr[i + 1] = D.rowPtr[i] + cols[i].size();
+        }
+
+        D.colInd.resize(D.rowPtr[m]);
+        D.val.resize(D.rowPtr[m]);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t i = 0; i < m; ++i)
+        {
+            std::copy(cols[i].begin(), cols[i].end(), D.colInd.begin() + D.rowPtr[i]);
+            std::copy(vals[i].begin(), vals[i].end(), D.val.begin() + D.rowPtr[i]);
+        }
+    }
+
+    // Writes the row offsets, the column indices and the values of the product to C
+    template <typename I, typename J, typename T>
+    static void writeCsr(const hipsparseSpGEMMDescr* descr,
+                         spMatDescr*                 C,
+                         bool                        rowPtr,
+                         bool                        colInd,
+                         bool                        values)
+    {
+        const int64_t base = C->base;
+
+        if(rowPtr && C->offsets != nullptr)
+        {
+            I* ptr = (I*)C->offsets;
+            for(int64_t i = 0; i <= descr->rows; ++i)
+            {
+                ptr[i] = static_cast<I>(descr->rowPtr[i] + base);
+            }
+        }
+
+        const int64_t nnz = descr->colInd.size();
+
+        if(colInd && C->indices != nullptr)
+        {
+            J* ind = (J*)C->indices;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                ind[k] = static_cast<J>(descr->colInd[k] + base);
+            }
+        }
+
+        if(values && C->values != nullptr && nnz > 0)
+        {
+            std::memcpy(C->values, descr->val.data(), nnz * sizeof(T));
+        }
+    }
+
+    //
+    // Values of C = alpha * A * B + beta * C on the structure of the product kept in the
+    // descriptor, C holds that structure
+    //
+    template <typename I, typename J, typename T>
+    static void spgemmNumericHost(T                           alpha,
+                                  const spMatDescr*           A,
+                                  const spMatDescr*           B,
+                                  T                           beta,
+                                  const hipsparseSpGEMMDescr* descr,
+                                  T*                          valC)
+    {
+        const int64_t m = A->rows;
+        const int64_t n = B->cols;
+
+        const I* ptrA = (const I*)A->offsets;
+        const J* indA = (const J*)A->indices;
+        const T* valA = (const T*)A->values;
+        const I* ptrB = (const I*)B->offsets;
+        const J* indB = (const J*)B->indices;
+        const T* valB = (const T*)B->values;
+
+        const int64_t baseA = A->base;
+        const int64_t baseB = B->base;
+
+        const std::vector<int64_t>& rowPtr = descr->rowPtr;
+        const std::vector<int64_t>& colInd = descr->colInd;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // Dense accumulator of the row, only the columns of its structure are cleared
+            std::vector<T> acc(n);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(int64_t i = 0; i < m; ++i)
+            {
+                for(int64_t k = rowPtr[i]; k < rowPtr[i + 1]; ++k)
+                {
+                    acc[colInd[k]] = static_cast<T>(0);
+                }
+
+                if(A->nnz > 0)
+                {
+                    for(int64_t k = ptrA[i] - baseA; k < ptrA[i + 1] - baseA; ++k)
+                    {
+                        const int64_t l = indA[k] - baseA;
+                        const T       a = alpha * valA[k];
+                        for(int64_t p = ptrB[l] - baseB; p < ptrB[l + 1] - baseB; ++p)
+                        {
+                            acc[indB[p] - baseB] += a * valB[p];
+                        }
+                    }
+                }
+
+                for(int64_t k = rowPtr[i]; k < rowPtr[i + 1]; ++k)
+                {
+                    valC[k] = (beta == static_cast<T>(0)) ? acc[colInd[k]]
+                                                          : acc[colInd[k]] + beta * valC[k];
+                }
+            }
+        }
+    }
+
+    static hipsparseStatus_t spgemmCheck(const spMatDescr* A,
+                                         const spMatDescr* B,
+                                         const spMatDescr* C,
+                                         hipDataType       computeType)
+    {
+        if(A->format != HIPSPARSE_FORMAT_CSR || B->format != HIPSPARSE_FORMAT_CSR
+           || C->format != HIPSPARSE_FORMAT_CSR)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->offsetsType != B->offsetsType || A->offsetsType != C->offsetsType
+           || A->indicesType != B->indicesType || A->indicesType != C->indicesType
+           || A->valueType != B->valueType || A->valueType != C->valueType
+           || A->valueType != computeType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->cols != B->rows || C->rows != A->rows || C->cols != B->cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Runs the product of A and B, the structure and the values are stored in the descriptor
+    static hipsparseStatus_t spgemmCompute(const void*             alpha,
+                                           const spMatDescr*       A,
+                                           const spMatDescr*       B,
+                                           const void*             beta,
+                                           spMatDescr*             C,
+                                           hipDataType             computeType,
+                                           hipsparseSpGEMMDescr_t  descr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(spgemmCheck(A, B, C, computeType));
+
+        return dispatchSpMat(A, [&](auto i, auto j, auto t) {
+            using I = decltype(i);
+            using J = decltype(j);
+            using T = decltype(t);
+
+            const T zero = static_cast<T>(0);
+
+            csrMatrix<T> D;
+            spgemmHost<I, J, T>((alpha != nullptr) ? *(const T*)alpha : static_cast<T>(1),
+                                A,
+                                B,
+                                (beta != nullptr) ? *(const T*)beta : zero,
+                                C,
+                                D);
+
+            descr->rows   = D.rows;
+            descr->cols   = D.cols;
+            descr->rowPtr = std::move(D.rowPtr);
+            descr->colInd = std::move(D.colInd);
+            descr->val.resize(D.val.size() * sizeof(T));
+            if(!D.val.empty())
+            {
+                std::memcpy(descr->val.data(), D.val.data(), descr->val.size());
+            }
+
+            C->nnz = descr->colInd.size();
+            writeCsr<I, J, T>(descr, C, true, false, false);
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+
+    static hipsparseStatus_t spgemmWrite(spMatDescr*                 C,
+                                         const hipsparseSpGEMMDescr* descr,
+                                         bool                        colInd,
+                                         bool                        values)
+    {
+        if(C->nnz != (int64_t)descr->colInd.size() || C->rows != descr->rows)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return dispatchSpMat(C, [&](auto i, auto j, auto t) {
+            writeCsr<decltype(i), decltype(j), decltype(t)>(descr, C, true, colInd, values);
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+
+    // Recomputes the values of C in place on the structure found by a previous spgemmCompute()
+    static hipsparseStatus_t spgemmNumeric(const void*                 alpha,
+                                           const spMatDescr*           A,
+                                           const spMatDescr*           B,
+                                           const void*                 beta,
+                                           spMatDescr*                 C,
+                                           hipDataType                 computeType,
+                                           const hipsparseSpGEMMDescr* descr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(spgemmCheck(A, B, C, computeType));
+
+        if(descr->rows != C->rows || descr->cols != C->cols
+           || C->nnz != (int64_t)descr->colInd.size() || (C->nnz > 0 && C->values == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return dispatchSpMat(A, [&](auto i, auto j, auto t) {
+            using T = decltype(t);
+            spgemmNumericHost<decltype(i), decltype(j), T>(
+                *(const T*)alpha, A, B, *(const T*)beta, descr, (T*)C->values);
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t          handle,
+                                 const void*                alpha,
+                                 hipsparseConstSpVecDescr_t vecX,
+                                 const void*                beta,
+                                 hipsparseDnVecDescr_t      vecY)
+{
+    if(handle == nullptr || alpha == nullptr || vecX == nullptr || beta == nullptr
+       || vecY == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spVecDescr* x = (const hipsparse::spVecDescr*)vecX;
+    const hipsparse::dnVecDescr* y = (const hipsparse::dnVecDescr*)vecY;
+
+    if(x->valueType != y->valueType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::dispatchIndexType(x->idxType, [&](auto i) {
+        return hipsparse::dispatchDataType(x->valueType, [&](auto t) {
+            using I = decltype(i);
+            using T = decltype(t);
+
+            const T  a    = *(const T*)alpha;
+            const T  b    = *(const T*)beta;
+            const I* ind  = (const I*)x->indices;
+            const T* xval = (const T*)x->values;
+            T*       yval = (T*)y->values;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t k = 0; k < y->size; ++k)
+            {
+                yval[k] = (b == static_cast<T>(0)) ? static_cast<T>(0) : b * yval[k];
+            }
+
+            for(int64_t k = 0; k < x->nnz; ++k)
+            {
+                yval[ind[k] - x->base] += a * xval[k];
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseGather(hipsparseHandle_t          handle,
+                                  hipsparseConstDnVecDescr_t vecY,
+                                  hipsparseSpVecDescr_t      vecX)
+{
+    if(handle == nullptr || vecY == nullptr || vecX == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::dnVecDescr* y = (const hipsparse::dnVecDescr*)vecY;
+    const hipsparse::spVecDescr* x = (const hipsparse::spVecDescr*)vecX;
+
+    if(x->valueType != y->valueType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::dispatchIndexType(x->idxType, [&](auto i) {
+        return hipsparse::dispatchDataType(x->valueType, [&](auto t) {
+            using I = decltype(i);
+            using T = decltype(t);
+
+            const I* ind  = (const I*)x->indices;
+            T*       xval = (T*)x->values;
+            const T* yval = (const T*)y->values;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t k = 0; k < x->nnz; ++k)
+            {
+                xval[k] = yval[ind[k] - x->base];
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseScatter(hipsparseHandle_t          handle,
+                                   hipsparseConstSpVecDescr_t vecX,
+                                   hipsparseDnVecDescr_t      vecY)
+{
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spVecDescr* x = (const hipsparse::spVecDescr*)vecX;
+    const hipsparse::dnVecDescr* y = (const hipsparse::dnVecDescr*)vecY;
+
+    if(x->valueType != y->valueType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::dispatchIndexType(x->idxType, [&](auto i) {
+        return hipsparse::dispatchDataType(x->valueType, [&](auto t) {
+            using I = decltype(i);
+            using T = decltype(t);
+
+            const I* ind  = (const I*)x->indices;
+            const T* xval = (const T*)x->values;
+            T*       yval = (T*)y->values;
+
+            for(int64_t k = 0; k < x->nnz; ++k)
+            {
+                yval[ind[k] - x->base] = xval[k];
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
+                               const void*           c_coeff,
+                               const void*           s_coeff,
+                               hipsparseSpVecDescr_t vecX,
+                               hipsparseDnVecDescr_t vecY)
+{
+    if(handle == nullptr || c_coeff == nullptr || s_coeff == nullptr || vecX == nullptr
+       || vecY == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spVecDescr* x = (const hipsparse::spVecDescr*)vecX;
+    const hipsparse::dnVecDescr* y = (const hipsparse::dnVecDescr*)vecY;
+
+    if(x->valueType != y->valueType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::dispatchIndexType(x->idxType, [&](auto i) {
+        return hipsparse::dispatchDataType(x->valueType, [&](auto t) {
+            using I = decltype(i);
+            using T = decltype(t);
+
+            const T  c    = *(const T*)c_coeff;
+            const T  s    = *(const T*)s_coeff;
+            const I* ind  = (const I*)x->indices;
+            T*       xval = (T*)x->values;
+            T*       yval = (T*)y->values;
+
+            for(int64_t k = 0; k < x->nnz; ++k)
+            {
+                T&      yk = yval[ind[k] - x->base];
+                const T xk = xval[k];
+
+                xval[k] = c * xk + s * yk;
+                yk      = c * yk - s * xk;
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t           handle,
+                                                    hipsparseConstSpMatDescr_t  matA,
+                                                    hipsparseDnMatDescr_t       matB,
+                                                    hipsparseSparseToDenseAlg_t alg,
+                                                    size_t*                     pBufferSizeInBytes)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
+                                         hipsparseConstSpMatDescr_t  matA,
+                                         hipsparseDnMatDescr_t       matB,
+                                         hipsparseSparseToDenseAlg_t alg,
+                                         void*                       externalBuffer)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+    const hipsparse::dnMatDescr* B = (const hipsparse::dnMatDescr*)matB;
+
+    if(A->valueType != B->valueType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(A->rows != B->rows || A->cols != B->cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using I = decltype(i);
+        using J = decltype(j);
+        using T = decltype(t);
+
+        const hipsparse::denseView<T> dense = hipsparse::makeView<T>(B);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t c = 0; c < dense.cols; ++c)
+        {
+            for(int64_t r = 0; r < dense.rows; ++r)
+            {
+                dense.at(0, r, c) = static_cast<T>(0);
+            }
+        }
+
+        // Duplicated COO entries are summed, their updates must not race
+        const bool parallel
+            = (A->format != HIPSPARSE_FORMAT_COO && A->format != HIPSPARSE_FORMAT_COO_AOS);
+
+        hipsparse::forEachEntry<I, J, T>(
+            A, 0, parallel, [&](int64_t r, int64_t c, T& v) { dense.at(0, r, c) += v; });
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    });
+}
+
+namespace hipsparse
+{
+    // Counts the nonzero blocks of each block row of dense and, with convert, writes them to
+    // the BSR matrix B. A block is stored as soon as one of its entries is nonzero.
+    template <typename I, typename J, typename T>
+    static hipsparseStatus_t denseToBsr(const denseView<T>& dense, spMatDescr* B, bool convert)
+    {
+        const int64_t rbd  = B->rowBlockDim;
+        const int64_t cbd  = B->colBlockDim;
+        const int64_t mb   = B->rows / rbd;
+        const int64_t nb   = B->cols / cbd;
+        const bool    row  = (B->blockOrder == HIPSPARSE_ORDER_ROW);
+        const int64_t base = B->base;
+
+        auto nonzeroBlock = [&](int64_t bi, int64_t bj) {
+            for(int64_t c = 0; c < cbd; ++c)
+            {
+                for(int64_t r = 0; r < rbd; ++r)
+                {
+                    if(dense.at(0, bi * rbd + r, bj * cbd + c) != static_cast<T>(0))
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+        std::vector<int64_t> ptr(mb + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t bi = 0; bi < mb; ++bi)
+        {
+            int64_t count = 0;
+            for(int64_t bj = 0; bj < nb; ++bj)
+            {
+                count += nonzeroBlock(bi, bj);
+            }
+            ptr[bi + 1] = count;
+        }
+
+        for(int64_t bi = 0; bi < mb; ++bi)
+        {
+            ptr[bi + 1] += ptr[bi];
+        }
+
+        if(!convert)
+        {
+            B->nnz = ptr[mb];
+        }
+        else if(B->nnz != ptr[mb])
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(B->offsets != nullptr)
+        {
+            I* offsets = (I*)B->offsets;
+            for(int64_t bi = 0; bi <= mb; ++bi)
+            {
+                offsets[bi] = static_cast<I>(ptr[bi] + base);
+            }
+        }
+
+        if(!convert || B->nnz == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        J* ind = (J*)B->indices;
+        T* val = (T*)B->values;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t bi = 0; bi < mb; ++bi)
+        {
+            int64_t k = ptr[bi];
+            for(int64_t bj = 0; bj < nb; ++bj)
+            {
+                if(!nonzeroBlock(bi, bj))
+                {
+                    continue;
+                }
+
+                ind[k]   = static_cast<J>(bj + base);
+                T* block = val + k * rbd * cbd;
+                for(int64_t r = 0; r < rbd; ++r)
+                {
+                    for(int64_t c = 0; c < cbd; ++c)
+                    {
+                        block[row ? r * cbd + c : c * rbd + r]
+                            = dense.at(0, bi * rbd + r, bj * cbd + c);
+                    }
+                }
+                ++k;
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Counts the nonzeros of each row (CSR, COO) or column (CSC) of A and, with convert,
+    // writes the entries to B. BSR matrices are handled by denseToBsr.
+    static hipsparseStatus_t
+        denseToSparse(const dnMatDescr* A, spMatDescr* B, bool convert)
+    {
+        if(B->format != HIPSPARSE_FORMAT_CSR && B->format != HIPSPARSE_FORMAT_CSC
+           && B->format != HIPSPARSE_FORMAT_COO && B->format != HIPSPARSE_FORMAT_BSR)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->valueType != B->valueType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->rows != B->rows || A->cols != B->cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return dispatchSpMat(B, [&](auto i, auto j, auto t) {
+            using I = decltype(i);
+            using J = decltype(j);
+            using T = decltype(t);
+
+            const denseView<T> dense = makeView<T>(A);
+            if(B->format == HIPSPARSE_FORMAT_BSR)
+            {
+                return denseToBsr<I, J, T>(dense, B, convert);
+            }
+
+            const bool         csc   = (B->format == HIPSPARSE_FORMAT_CSC);
+            const int64_t      outer = csc ? A->cols : A->rows;
+            const int64_t      inner = csc ? A->rows : A->cols;
+            const int64_t      base  = B->base;
+
+            auto value = [&](int64_t o, int64_t in) -> T& {
+                return csc ? dense.at(0, in, o) : dense.at(0, o, in);
+            };
+
+            std::vector<int64_t> ptr(outer + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t o = 0; o < outer; ++o)
+            {
+                int64_t count = 0;
+                for(int64_t in = 0; in < inner; ++in)
+                {
+                    count += (value(o, in) != static_cast<T>(0));
+                }
+                ptr[o + 1] = count;
+            }
+
+            for(int64_t o = 0; o < outer; ++o)
+            {
+                ptr[o + 1] += ptr[o];
+            }
+
+            if(!convert)
+            {
+                B->nnz = ptr[outer];
+            }
+            else if(B->nnz != ptr[outer])
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            if(B->format != HIPSPARSE_FORMAT_COO && B->offsets != nullptr)
+            {
+                I* offsets = (I*)B->offsets;
+                for(int64_t o = 0; o <= outer; ++o)
+                {
+                    offsets[o] = static_cast<I>(ptr[o] + base);
+                }
+            }
+
+            if(!convert || B->nnz == 0)
+            {
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+
+            I* rowInd = (B->format == HIPSPARSE_FORMAT_COO) ? (I*)B->offsets : nullptr;
+            J* ind    = (J*)B->indices;
+            T* val    = (T*)B->values;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t o = 0; o < outer; ++o)
+            {
+                int64_t k = ptr[o];
+                for(int64_t in = 0; in < inner; ++in)
+                {
+                    const T v = value(o, in);
+                    if(v != static_cast<T>(0))
+                    {
+                        if(rowInd != nullptr)
+                        {
+                            rowInd[k] = static_cast<I>(o + base);
+                        }
+                        ind[k] = static_cast<J>(in + base);
+                        val[k] = v;
+                        ++k;
+                    }
+                }
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t           handle,
+                                                    hipsparseConstDnMatDescr_t  matA,
+                                                    hipsparseSpMatDescr_t       matB,
+                                                    hipsparseDenseToSparseAlg_t alg,
+                                                    size_t*                     pBufferSizeInBytes)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           handle,
+                                                  hipsparseConstDnMatDescr_t  matA,
+                                                  hipsparseSpMatDescr_t       matB,
+                                                  hipsparseDenseToSparseAlg_t alg,
+                                                  void*                       externalBuffer)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::denseToSparse(
+        (const hipsparse::dnMatDescr*)matA, (hipsparse::spMatDescr*)matB, false);
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           handle,
+                                                 hipsparseConstDnMatDescr_t  matA,
+                                                 hipsparseSpMatDescr_t       matB,
+                                                 hipsparseDenseToSparseAlg_t alg,
+                                                 void*                       externalBuffer)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::denseToSparse(
+        (const hipsparse::dnMatDescr*)matA, (hipsparse::spMatDescr*)matB, true);
+}
+
+hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
+                                           hipsparseOperation_t       opX,
+                                           hipsparseConstSpVecDescr_t vecX,
+                                           hipsparseConstDnVecDescr_t vecY,
+                                           void*                      result,
+                                           hipDataType                computeType,
+                                           size_t*                    pBufferSizeInBytes)
+{
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr || result == nullptr
+       || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
+                                hipsparseOperation_t       opX,
+                                hipsparseConstSpVecDescr_t vecX,
+                                hipsparseConstDnVecDescr_t vecY,
+                                void*                      result,
+                                hipDataType                computeType,
+                                void*                      externalBuffer)
+{
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr || result == nullptr
+       || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(opX != HIPSPARSE_OPERATION_NON_TRANSPOSE && opX != HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spVecDescr* x = (const hipsparse::spVecDescr*)vecX;
+    const hipsparse::dnVecDescr* y = (const hipsparse::dnVecDescr*)vecY;
+
+    if(x->valueType != y->valueType || x->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::dispatchIndexType(x->idxType, [&](auto i) {
+        return hipsparse::dispatchDataType(x->valueType, [&](auto t) {
+            using I = decltype(i);
+            using T = decltype(t);
+
+            const I* ind  = (const I*)x->indices;
+            const T* xval = (const T*)x->values;
+            const T* yval = (const T*)y->values;
+
+            T dot = static_cast<T>(0);
+            for(int64_t k = 0; k < x->nnz; ++k)
+            {
+                dot += hipsparse::applyOperation(opX, xval[k]) * yval[ind[k] - x->base];
+            }
+
+            *(T*)result = dot;
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           size_t*                     pBufferSizeInBytes)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                const void*                 alpha,
+                                hipsparseConstSpMatDescr_t  matA,
+                                hipsparseConstDnVecDescr_t  vecX,
+                                const void*                 beta,
+                                const hipsparseDnVecDescr_t vecY,
+                                hipDataType                 computeType,
+                                hipsparseSpMVAlg_t          alg,
+                                void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!hipsparse::isValidOperation(opA))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+    const hipsparse::dnVecDescr* x = (const hipsparse::dnVecDescr*)vecX;
+    const hipsparse::dnVecDescr* y = (const hipsparse::dnVecDescr*)vecY;
+
+    if(A->valueType != computeType || x->valueType != computeType
+       || y->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(!A->batchRowOffsets.empty())
+    {
+        const bool transA = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        if(x->size != (transA ? A->rows : A->cols) || y->size != (transA ? A->cols : A->rows))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+            using T = decltype(t);
+            return hipsparse::spmvVariableBatch<decltype(i), decltype(j), T>(opA,
+                                                                             *(const T*)alpha,
+                                                                             A,
+                                                                             (const T*)x->values,
+                                                                             *(const T*)beta,
+                                                                             (T*)y->values);
+        });
+    }
+
+    return hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+        return hipsparse::spmmHost<decltype(i), decltype(j), T>(opA,
+                                                                HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                                *(const T*)alpha,
+                                                                A,
+                                                                hipsparse::makeView<T>(x),
+                                                                *(const T*)beta,
+                                                                hipsparse::makeView<T>(y));
+    });
+}
+
+hipsparseStatus_t hipsparseSpMVDot_bufferSize(hipsparseHandle_t           handle,
+                                              hipsparseOperation_t        opA,
+                                              const void*                 alpha,
+                                              hipsparseConstSpMatDescr_t  matA,
+                                              hipsparseConstDnVecDescr_t  vecX,
+                                              const void*                 beta,
+                                              const hipsparseDnVecDescr_t vecY,
+                                              hipDataType                 computeType,
+                                              hipsparseSpMVAlg_t          alg,
+                                              size_t*                     pBufferSizeInBytes)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMVDot(hipsparseHandle_t           handle,
+                                   hipsparseOperation_t        opA,
+                                   const void*                 alpha,
+                                   hipsparseConstSpMatDescr_t  matA,
+                                   hipsparseConstDnVecDescr_t  vecX,
+                                   const void*                 beta,
+                                   const hipsparseDnVecDescr_t vecY,
+                                   void*                       result,
+                                   hipDataType                 computeType,
+                                   hipsparseSpMVAlg_t          alg,
+                                   void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || result == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!hipsparse::isValidOperation(opA))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+    const hipsparse::dnVecDescr* x = (const hipsparse::dnVecDescr*)vecX;
+    const hipsparse::dnVecDescr* y = (const hipsparse::dnVecDescr*)vecY;
+
+    if(A->valueType != computeType || x->valueType != computeType
+       || y->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // x and y are multiplied entrywise, op(A) must be square
+    if(x->size != y->size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+
+        const T* xval = (const T*)x->values;
+
+        return hipsparse::spmvFused<decltype(i), decltype(j), T>(
+            opA,
+            *(const T*)alpha,
+            A,
+            x,
+            *(const T*)beta,
+            y,
+            [&](int64_t r, T yr) { return hipsparse::conj(xval[r]) * yr; },
+            *(T*)result);
+    });
+}
+
+hipsparseStatus_t hipsparseSpMVResidual_bufferSize(hipsparseHandle_t           handle,
+                                                   hipsparseOperation_t        opA,
+                                                   const void*                 alpha,
+                                                   hipsparseConstSpMatDescr_t  matA,
+                                                   hipsparseConstDnVecDescr_t  vecX,
+                                                   const void*                 beta,
+                                                   const hipsparseDnVecDescr_t vecY,
+                                                   hipsparseConstDnVecDescr_t  vecB,
+                                                   const hipsparseDnVecDescr_t vecR,
+                                                   hipDataType                 computeType,
+                                                   hipsparseSpMVAlg_t          alg,
+                                                   size_t*                     pBufferSizeInBytes)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || vecB == nullptr || vecR == nullptr
+       || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMVResidual(hipsparseHandle_t           handle,
+                                        hipsparseOperation_t        opA,
+                                        const void*                 alpha,
+                                        hipsparseConstSpMatDescr_t  matA,
+                                        hipsparseConstDnVecDescr_t  vecX,
+                                        const void*                 beta,
+                                        const hipsparseDnVecDescr_t vecY,
+                                        hipsparseConstDnVecDescr_t  vecB,
+                                        const hipsparseDnVecDescr_t vecR,
+                                        void*                       result,
+                                        hipDataType                 computeType,
+                                        hipsparseSpMVAlg_t          alg,
+                                        void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || vecB == nullptr || vecR == nullptr
+       || result == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!hipsparse::isValidOperation(opA))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+    const hipsparse::dnVecDescr* x = (const hipsparse::dnVecDescr*)vecX;
+    const hipsparse::dnVecDescr* y = (const hipsparse::dnVecDescr*)vecY;
+    const hipsparse::dnVecDescr* b = (const hipsparse::dnVecDescr*)vecB;
+    const hipsparse::dnVecDescr* r = (const hipsparse::dnVecDescr*)vecR;
+
+    if(A->valueType != computeType || x->valueType != computeType
+       || y->valueType != computeType || b->valueType != computeType
+       || r->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(b->size != y->size || r->size != y->size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+        using S = typename hipsparse::realType<T>::type;
+
+        // r may alias b, each entry of b is read before the entry of r is written
+        const T* bval = (const T*)b->values;
+        T*       rval = (T*)r->values;
+
+        S norm2{};
+        RETURN_IF_HIPSPARSE_ERROR((hipsparse::spmvFused<decltype(i), decltype(j), T>(
+            opA,
+            *(const T*)alpha,
+            A,
+            x,
+            *(const T*)beta,
+            y,
+            [&](int64_t k, T yk) {
+                rval[k] = bval[k] - yk;
+                return hipsparse::absSquare(rval[k]);
+            },
+            norm2)));
+
+        *(S*)result = std::sqrt(norm2);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    });
+}
+
+hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnMatDescr_t  matB,
+                                           const void*                 beta,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMMAlg_t          alg,
+                                           size_t*                     pBufferSizeInBytes)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnMatDescr_t  matB,
+                                           const void*                 beta,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMMAlg_t          alg,
+                                           void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                hipsparseOperation_t        opB,
+                                const void*                 alpha,
+                                hipsparseConstSpMatDescr_t  matA,
+                                hipsparseConstDnMatDescr_t  matB,
+                                const void*                 beta,
+                                const hipsparseDnMatDescr_t matC,
+                                hipDataType                 computeType,
+                                hipsparseSpMMAlg_t          alg,
+                                void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!hipsparse::isValidOperation(opA) || !hipsparse::isValidOperation(opB))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+    const hipsparse::dnMatDescr* B = (const hipsparse::dnMatDescr*)matB;
+    const hipsparse::dnMatDescr* C = (const hipsparse::dnMatDescr*)matC;
+
+    if(A->valueType != computeType || B->valueType != computeType
+       || C->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+        return hipsparse::spmmHost<decltype(i), decltype(j), T>(opA,
+                                                                opB,
+                                                                *(const T*)alpha,
+                                                                A,
+                                                                hipsparse::makeView<T>(B),
+                                                                *(const T*)beta,
+                                                                hipsparse::makeView<T>(C));
+    });
+}
+
+hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new(std::nothrow) hipsparseSpGEMMDescr;
+
+    return (*descr != nullptr) ? HIPSPARSE_STATUS_SUCCESS : HIPSPARSE_STATUS_ALLOC_FAILED;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_setMode(hipsparseSpGEMMDescr_t descr, hipsparseSpGEMMMode_t mode)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(mode != HIPSPARSE_SPGEMM_MODE_DEFAULT && mode != HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->mode = mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_getMode(hipsparseSpGEMMDescr_t descr, hipsparseSpGEMMMode_t* mode)
+{
+    if(descr == nullptr || mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = descr->mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          handle,
+                                                 hipsparseOperation_t       opA,
+                                                 hipsparseOperation_t       opB,
+                                                 const void*                alpha,
+                                                 hipsparseConstSpMatDescr_t matA,
+                                                 hipsparseConstSpMatDescr_t matB,
+                                                 const void*                beta,
+                                                 hipsparseSpMatDescr_t      matC,
+                                                 hipDataType                computeType,
+                                                 hipsparseSpGEMMAlg_t       alg,
+                                                 hipsparseSpGEMMDescr_t     spgemmDescr,
+                                                 size_t*                    bufferSize1,
+                                                 void*                      externalBuffer1)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr || spgemmDescr == nullptr || bufferSize1 == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE || opB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(externalBuffer1 == nullptr)
+    {
+        *bufferSize1 = hipsparse::hostBufferSize;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // In single arena mode, the product is computed here, so that the number of non-zeros of
+    // C is known before hipsparseSpGEMM_compute(). The values of C are overwritten by the copy.
+    if(spgemmDescr->mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        return hipsparse::spgemmCompute(alpha,
+                                        (const hipsparse::spMatDescr*)matA,
+                                        (const hipsparse::spMatDescr*)matB,
+                                        nullptr,
+                                        (hipsparse::spMatDescr*)matC,
+                                        computeType,
+                                        spgemmDescr);
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
+                                          hipsparseOperation_t       opA,
+                                          hipsparseOperation_t       opB,
+                                          const void*                alpha,
+                                          hipsparseConstSpMatDescr_t matA,
+                                          hipsparseConstSpMatDescr_t matB,
+                                          const void*                beta,
+                                          hipsparseSpMatDescr_t      matC,
+                                          hipDataType                computeType,
+                                          hipsparseSpGEMMAlg_t       alg,
+                                          hipsparseSpGEMMDescr_t     spgemmDescr,
+                                          size_t*                    bufferSize2,
+                                          void*                      externalBuffer2)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr || spgemmDescr == nullptr || bufferSize2 == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE || opB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // In single arena mode, the product has been computed by the work estimation
+    if(spgemmDescr->mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        *bufferSize2 = 0;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(externalBuffer2 == nullptr)
+    {
+        *bufferSize2 = hipsparse::hostBufferSize;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    return hipsparse::spgemmCompute(alpha,
+                                    (const hipsparse::spMatDescr*)matA,
+                                    (const hipsparse::spMatDescr*)matB,
+                                    beta,
+                                    (hipsparse::spMatDescr*)matC,
+                                    computeType,
+                                    spgemmDescr);
+}
+
+hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
+                                       hipsparseOperation_t       opA,
+                                       hipsparseOperation_t       opB,
+                                       const void*                alpha,
+                                       hipsparseConstSpMatDescr_t matA,
+                                       hipsparseConstSpMatDescr_t matB,
+                                       const void*                beta,
+                                       hipsparseSpMatDescr_t      matC,
+                                       hipDataType                computeType,
+                                       hipsparseSpGEMMAlg_t       alg,
+                                       hipsparseSpGEMMDescr_t     spgemmDescr)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr || spgemmDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // In single arena mode, the values of C are overwritten, see hipsparseSpGEMM_copy()
+    if(spgemmDescr->mode == HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::dispatchDataType(computeType, [&](auto t) {
+            using T = decltype(t);
+            return (*(const T*)beta == static_cast<T>(0)) ? HIPSPARSE_STATUS_SUCCESS
+                                                          : HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }));
+    }
+
+    return hipsparse::spgemmWrite((hipsparse::spMatDescr*)matC, spgemmDescr, true, true);
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t          handle,
+                                                      hipsparseOperation_t       opA,
+                                                      hipsparseOperation_t       opB,
+                                                      hipsparseConstSpMatDescr_t matA,
+                                                      hipsparseConstSpMatDescr_t matB,
+                                                      hipsparseSpMatDescr_t      matC,
+                                                      hipsparseSpGEMMAlg_t       alg,
+                                                      hipsparseSpGEMMDescr_t     spgemmDescr,
+                                                      size_t*                    bufferSize1,
+                                                      void*                      externalBuffer1)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
+       || spgemmDescr == nullptr || bufferSize1 == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE || opB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(externalBuffer1 == nullptr)
+    {
+        *bufferSize1 = hipsparse::hostBufferSize;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
+                                           hipsparseOperation_t       opA,
+                                           hipsparseOperation_t       opB,
+                                           hipsparseConstSpMatDescr_t matA,
+                                           hipsparseConstSpMatDescr_t matB,
+                                           hipsparseSpMatDescr_t      matC,
+                                           hipsparseSpGEMMAlg_t       alg,
+                                           hipsparseSpGEMMDescr_t     spgemmDescr,
+                                           size_t*                    bufferSize2,
+                                           void*                      externalBuffer2,
+                                           size_t*                    bufferSize3,
+                                           void*                      externalBuffer3,
+                                           size_t*                    bufferSize4,
+                                           void*                      externalBuffer4)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
+       || spgemmDescr == nullptr || bufferSize2 == nullptr || bufferSize3 == nullptr
+       || bufferSize4 == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE || opB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(externalBuffer2 == nullptr || externalBuffer3 == nullptr || externalBuffer4 == nullptr)
+    {
+        *bufferSize2 = hipsparse::hostBufferSize;
+        *bufferSize3 = hipsparse::hostBufferSize;
+        *bufferSize4 = hipsparse::hostBufferSize;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // The structure does not depend on the scalars, the values are recomputed by
+    // hipsparseSpGEMMreuse_compute()
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+
+    return hipsparse::spgemmCompute(nullptr,
+                                    A,
+                                    (const hipsparse::spMatDescr*)matB,
+                                    nullptr,
+                                    (hipsparse::spMatDescr*)matC,
+                                    A->valueType,
+                                    spgemmDescr);
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
+                                            hipsparseOperation_t       opA,
+                                            hipsparseOperation_t       opB,
+                                            hipsparseConstSpMatDescr_t matA,
+                                            hipsparseConstSpMatDescr_t matB,
+                                            hipsparseSpMatDescr_t      matC,
+                                            hipsparseSpGEMMAlg_t       alg,
+                                            hipsparseSpGEMMDescr_t     spgemmDescr,
+                                            size_t*                    bufferSize5,
+                                            void*                      externalBuffer5)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
+       || spgemmDescr == nullptr || bufferSize5 == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(externalBuffer5 == nullptr)
+    {
+        *bufferSize5 = hipsparse::hostBufferSize;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    return hipsparse::spgemmWrite((hipsparse::spMatDescr*)matC, spgemmDescr, true, false);
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle,
+                                               hipsparseOperation_t       opA,
+                                               hipsparseOperation_t       opB,
+                                               const void*                alpha,
+                                               hipsparseConstSpMatDescr_t matA,
+                                               hipsparseConstSpMatDescr_t matB,
+                                               const void*                beta,
+                                               hipsparseSpMatDescr_t      matC,
+                                               hipDataType                computeType,
+                                               hipsparseSpGEMMAlg_t       alg,
+                                               hipsparseSpGEMMDescr_t     spgemmDescr)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr || spgemmDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE || opB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // C already holds the structure of the product found by hipsparseSpGEMMreuse_nnz(), only
+    // the values are computed, beta scales the current ones
+    return hipsparse::spgemmNumeric(alpha,
+                                    (const hipsparse::spMatDescr*)matA,
+                                    (const hipsparse::spMatDescr*)matB,
+                                    beta,
+                                    (hipsparse::spMatDescr*)matC,
+                                    computeType,
+                                    spgemmDescr);
+}
+
+namespace hipsparse
+{
+    static hipsparseStatus_t sddmmCheck(hipsparseHandle_t          handle,
+                                        hipsparseOperation_t       opA,
+                                        hipsparseOperation_t       opB,
+                                        const void*                alpha,
+                                        hipsparseConstDnMatDescr_t matA,
+                                        hipsparseConstDnMatDescr_t matB,
+                                        const void*                beta,
+                                        hipsparseSpMatDescr_t      matC,
+                                        const void*                buffer)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+           || beta == nullptr || matC == nullptr || buffer == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(!isValidOperation(opA) || !isValidOperation(opB))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
+                                            hipsparseOperation_t       opA,
+                                            hipsparseOperation_t       opB,
+                                            const void*                alpha,
+                                            hipsparseConstDnMatDescr_t matA,
+                                            hipsparseConstDnMatDescr_t matB,
+                                            const void*                beta,
+                                            hipsparseSpMatDescr_t      matC,
+                                            hipDataType                computeType,
+                                            hipsparseSDDMMAlg_t        alg,
+                                            size_t*                    pBufferSizeInBytes)
+{
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::sddmmCheck(
+        handle, opA, opB, alpha, matA, matB, beta, matC, pBufferSizeInBytes));
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
+                                            hipsparseOperation_t       opA,
+                                            hipsparseOperation_t       opB,
+                                            const void*                alpha,
+                                            hipsparseConstDnMatDescr_t matA,
+                                            hipsparseConstDnMatDescr_t matB,
+                                            const void*                beta,
+                                            hipsparseSpMatDescr_t      matC,
+                                            hipDataType                computeType,
+                                            hipsparseSDDMMAlg_t        alg,
+                                            void*                      tempBuffer)
+{
+    return hipsparse::sddmmCheck(handle, opA, opB, alpha, matA, matB, beta, matC, tempBuffer);
+}
+
+hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
+                                 hipsparseOperation_t       opA,
+                                 hipsparseOperation_t       opB,
+                                 const void*                alpha,
+                                 hipsparseConstDnMatDescr_t matA,
+                                 hipsparseConstDnMatDescr_t matB,
+                                 const void*                beta,
+                                 hipsparseSpMatDescr_t      matC,
+                                 hipDataType                computeType,
+                                 hipsparseSDDMMAlg_t        alg,
+                                 void*                      tempBuffer)
+{
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::sddmmCheck(handle, opA, opB, alpha, matA, matB, beta, matC, tempBuffer));
+
+    const hipsparse::dnMatDescr* A = (const hipsparse::dnMatDescr*)matA;
+    const hipsparse::dnMatDescr* B = (const hipsparse::dnMatDescr*)matB;
+    const hipsparse::spMatDescr* C = (const hipsparse::spMatDescr*)matC;
+
+    if(A->valueType != computeType || B->valueType != computeType
+       || C->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const bool    transA = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+    const int64_t k      = transA ? A->rows : A->cols;
+
+    if((transA ? A->cols : A->rows) != C->rows
+       || ((opB != HIPSPARSE_OPERATION_NON_TRANSPOSE) ? B->cols : B->rows) != k
+       || ((opB != HIPSPARSE_OPERATION_NON_TRANSPOSE) ? B->rows : B->cols) != C->cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::dispatchSpMat(C, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+
+        const T                       a     = *(const T*)alpha;
+        const T                       b     = *(const T*)beta;
+        const hipsparse::denseView<T> denseA = hipsparse::makeView<T>(A);
+        const hipsparse::denseView<T> denseB = hipsparse::makeView<T>(B);
+
+        hipsparse::forEachEntry<decltype(i), decltype(j), T>(
+            C, 0, true, [&](int64_t r, int64_t c, T& v) {
+                T dot = static_cast<T>(0);
+                for(int64_t l = 0; l < k; ++l)
+                {
+                    dot += hipsparse::opAt(denseA, opA, 0, r, l)
+                           * hipsparse::opAt(denseB, opB, 0, l, c);
+                }
+
+                v = (b == static_cast<T>(0)) ? a * dot : a * dot + b * v;
+            });
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    });
+}
+
+hipsparseStatus_t hipsparseSpSV_createDescr(hipsparseSpSVDescr_t* descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new(std::nothrow) hipsparseSpSVDescr;
+
+    return (*descr != nullptr) ? HIPSPARSE_STATUS_SUCCESS : HIPSPARSE_STATUS_ALLOC_FAILED;
+}
+
+hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  x,
+                                           const hipsparseDnVecDescr_t y,
+                                           hipDataType                 computeType,
+                                           hipsparseSpSVAlg_t          alg,
+                                           hipsparseSpSVDescr_t        spsvDescr,
+                                           size_t*                     pBufferSizeInBytes)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr || y == nullptr
+       || spsvDescr == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         const void*                 alpha,
+                                         hipsparseConstSpMatDescr_t  matA,
+                                         hipsparseConstDnVecDescr_t  x,
+                                         const hipsparseDnVecDescr_t y,
+                                         hipDataType                 computeType,
+                                         hipsparseSpSVAlg_t          alg,
+                                         hipsparseSpSVDescr_t        spsvDescr,
+                                         void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr || y == nullptr
+       || spsvDescr == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!hipsparse::isValidOperation(opA))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+
+    if(A->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // The triangle of op(A) is built once here, the solves only reload its values. It is
+    // always built again, the structure of A may have changed in place
+    spsvDescr->cache.triangle.reset();
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+
+        const hipsparse::triangle<T>* tri;
+        return hipsparse::cachedTriangle<decltype(i), decltype(j), T>(
+            spsvDescr->cache, opA, A, tri);
+    }));
+
+    spsvDescr->analysed = true;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
+                                      hipsparseOperation_t        opA,
+                                      const void*                 alpha,
+                                      hipsparseConstSpMatDescr_t  matA,
+                                      hipsparseConstDnVecDescr_t  x,
+                                      const hipsparseDnVecDescr_t y,
+                                      hipDataType                 computeType,
+                                      hipsparseSpSVAlg_t          alg,
+                                      hipsparseSpSVDescr_t        spsvDescr)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr || y == nullptr
+       || spsvDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!hipsparse::isValidOperation(opA))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A    = (const hipsparse::spMatDescr*)matA;
+    const hipsparse::dnVecDescr* vecX = (const hipsparse::dnVecDescr*)x;
+    const hipsparse::dnVecDescr* vecY = (const hipsparse::dnVecDescr*)y;
+
+    if(A->valueType != computeType || vecX->valueType != computeType
+       || vecY->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(vecX->size != A->rows || vecY->size != A->rows)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The batches are solved independently, they must be square
+    if(A->batchRowOffsets != A->batchColOffsets)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+
+        const hipsparse::triangle<T>* tri;
+        RETURN_IF_HIPSPARSE_ERROR((hipsparse::cachedTriangle<decltype(i), decltype(j), T>(
+            spsvDescr->cache, opA, A, tri)));
+
+        const T* xval = (const T*)vecX->values;
+        T*       yval = (T*)vecY->values;
+
+        // Without a variable batch partition, the whole matrix is a single batch
+        const std::vector<int64_t>& rows  = A->batchRowOffsets;
+        const int                   count = rows.empty() ? 1 : static_cast<int>(rows.size()) - 1;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(count > 1)
+#endif
+        for(int b = 0; b < count; ++b)
+        {
+            hipsparse::triangularSolve(
+                tri->L,
+                tri->diag,
+                tri->lower,
+                A->diagType == HIPSPARSE_DIAG_TYPE_UNIT,
+                *(const T*)alpha,
+                [&](int64_t r) { return xval[r]; },
+                [&](int64_t r) -> T& { return yval[r]; },
+                rows.empty() ? 0 : rows[b],
+                rows.empty() ? tri->L.rows : rows[b + 1]);
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    });
+}
+
+hipsparseStatus_t hipsparseSpSM_createDescr(hipsparseSpSMDescr_t* descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new(std::nothrow) hipsparseSpSMDescr;
+
+    return (*descr != nullptr) ? HIPSPARSE_STATUS_SUCCESS : HIPSPARSE_STATUS_ALLOC_FAILED;
+}
+
+hipsparseStatus_t hipsparseSpSM_destroyDescr(hipsparseSpSMDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnMatDescr_t  matB,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpSMAlg_t          alg,
+                                           hipsparseSpSMDescr_t        spsmDescr,
+                                           size_t*                     pBufferSizeInBytes)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || matC == nullptr || spsmDescr == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *pBufferSizeInBytes = hipsparse::hostBufferSize;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         hipsparseOperation_t        opB,
+                                         const void*                 alpha,
+                                         hipsparseConstSpMatDescr_t  matA,
+                                         hipsparseConstDnMatDescr_t  matB,
+                                         const hipsparseDnMatDescr_t matC,
+                                         hipDataType                 computeType,
+                                         hipsparseSpSMAlg_t          alg,
+                                         hipsparseSpSMDescr_t        spsmDescr,
+                                         void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || matC == nullptr || spsmDescr == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!hipsparse::isValidOperation(opA) || !hipsparse::isValidOperation(opB))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+
+    if(A->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // The triangle of op(A) is built once here, the solves only reload its values. It is
+    // always built again, the structure of A may have changed in place
+    spsmDescr->cache.triangle.reset();
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+
+        const hipsparse::triangle<T>* tri;
+        return hipsparse::cachedTriangle<decltype(i), decltype(j), T>(
+            spsmDescr->cache, opA, A, tri);
+    }));
+
+    spsmDescr->analysed = true;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
+                                      hipsparseOperation_t        opA,
+                                      hipsparseOperation_t        opB,
+                                      const void*                 alpha,
+                                      hipsparseConstSpMatDescr_t  matA,
+                                      hipsparseConstDnMatDescr_t  matB,
+                                      const hipsparseDnMatDescr_t matC,
+                                      hipDataType                 computeType,
+                                      hipsparseSpSMAlg_t          alg,
+                                      hipsparseSpSMDescr_t        spsmDescr,
+                                      void*                       externalBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || matC == nullptr || spsmDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!hipsparse::isValidOperation(opA) || !hipsparse::isValidOperation(opB))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::spMatDescr* A = (const hipsparse::spMatDescr*)matA;
+    const hipsparse::dnMatDescr* B = (const hipsparse::dnMatDescr*)matB;
+    const hipsparse::dnMatDescr* C = (const hipsparse::dnMatDescr*)matC;
+
+    if(A->valueType != computeType || B->valueType != computeType
+       || C->valueType != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const bool transB = (opB != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+    if(C->rows != A->rows || (transB ? B->cols : B->rows) != A->rows
+       || (transB ? B->rows : B->cols) != C->cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::dispatchSpMat(A, [&](auto i, auto j, auto t) {
+        using T = decltype(t);
+
+        const hipsparse::triangle<T>* tri;
+        RETURN_IF_HIPSPARSE_ERROR((hipsparse::cachedTriangle<decltype(i), decltype(j), T>(
+            spsmDescr->cache, opA, A, tri)));
+
+        const hipsparse::denseView<T> denseB = hipsparse::makeView<T>(B);
+        const hipsparse::denseView<T> denseC = hipsparse::makeView<T>(C);
+        const T                       a      = *(const T*)alpha;
+        const bool                    unit   = (A->diagType == HIPSPARSE_DIAG_TYPE_UNIT);
+
+        // The right-hand sides are independent
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t c = 0; c < C->cols; ++c)
+        {
+            hipsparse::triangularSolve(
+                tri->L,
+                tri->diag,
+                tri->lower,
+                unit,
+                a,
+                [&](int64_t r) { return hipsparse::opAt(denseB, opB, 0, r, c); },
+                [&](int64_t r) -> T& { return denseC.at(0, r, c); });
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    });
+}
@@ -0,0 +1,317 @@
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+
+#include "hipsparse.h"
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime_api.h>
+
+#include <complex>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+#define RETURN_IF_HIPSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                \
+    {                                                                    \
+        hipsparseStatus_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
+        if(TMP_STATUS_FOR_CHECK != HIPSPARSE_STATUS_SUCCESS)             \
+        {                                                                \
+            return TMP_STATUS_FOR_CHECK;                                 \
+        }                                                                \
+    }
+
+// The host backend runs every routine on the calling thread (and its OpenMP team). All the
+// pointers handed to the library, including the ones allocated with hipMalloc, must be host
+// addressable, which is the case with the HIP-CPU runtime.
+namespace hipsparse
+{
+    struct handle
+    {
+        hipStream_t            stream{};
+        hipsparsePointerMode_t pointerMode{HIPSPARSE_POINTER_MODE_HOST};
+
+        // Kept for API compatibility, host routines always complete before returning
+        hipsparseExecutionPolicy_t executionPolicy{HIPSPARSE_EXECUTION_POLICY_BLOCKING};
+
+        // Host workspace pool, see hipsparseSetWorkspacePoolSize()
+        std::vector<char> workspace;
+        size_t            workspaceHighWater{};
+    };
+
+    struct matDescr
+    {
+        hipsparseMatrixType_t type{HIPSPARSE_MATRIX_TYPE_GENERAL};
+        hipsparseFillMode_t   fillMode{HIPSPARSE_FILL_MODE_LOWER};
+        hipsparseDiagType_t   diagType{HIPSPARSE_DIAG_TYPE_NON_UNIT};
+        hipsparseIndexBase_t  base{HIPSPARSE_INDEX_BASE_ZERO};
+    };
+
+    struct spVecDescr
+    {
+        int64_t              size{};
+        int64_t              nnz{};
+        void*                indices{};
+        void*                values{};
+        hipsparseIndexType_t idxType{HIPSPARSE_INDEX_32I};
+        hipsparseIndexBase_t base{HIPSPARSE_INDEX_BASE_ZERO};
+        hipDataType          valueType{HIP_R_32F};
+    };
+
+    struct dnVecDescr
+    {
+        int64_t     size{};
+        void*       values{};
+        hipDataType valueType{HIP_R_32F};
+    };
+
+    struct dnMatDescr
+    {
+        int64_t          rows{};
+        int64_t          cols{};
+        int64_t          ld{};
+        void*            values{};
+        hipDataType      valueType{HIP_R_32F};
+        hipsparseOrder_t order{HIPSPARSE_ORDER_COL};
+
+        int     batchCount{1};
+        int64_t batchStride{};
+    };
+
+    // Sparse matrix descriptor. The meaning of the index arrays depends on the format:
+    //  - CSR: offsets are the row offsets, indices the column indices,
+    //  - CSC: offsets are the column offsets, indices the row indices,
+    //  - COO: offsets are the row indices, indices the column indices,
+    //  - COO AoS: offsets are the interleaved (row, column) pairs,
+    //  - Blocked ELL: indices are the block column indices of the mb x ellCols / ellBlockDim
+    //    array, each block is stored contiguously in column major order.
+    //  - Sliced ELL: offsets are the zero based slice offsets, entry j of row i is stored at
+    //    offsets[i / sliceSize] + j * sliceSize + i % sliceSize, padding has column index -1.
+    //  - BSR: offsets are the block row offsets, indices the block column indices, nnz is the
+    //    number of blocks, each block is stored contiguously in blockOrder.
+    struct spMatDescr
+    {
+        hipsparseFormat_t    format{HIPSPARSE_FORMAT_CSR};
+        int64_t              rows{};
+        int64_t              cols{};
+        int64_t              nnz{};
+        void*                offsets{};
+        void*                indices{};
+        void*                values{};
+        hipsparseIndexType_t offsetsType{HIPSPARSE_INDEX_32I};
+        hipsparseIndexType_t indicesType{HIPSPARSE_INDEX_32I};
+        hipsparseIndexBase_t base{HIPSPARSE_INDEX_BASE_ZERO};
+        hipDataType          valueType{HIP_R_32F};
+
+        int64_t ellBlockDim{};
+        int64_t ellCols{};
+
+        int64_t sliceSize{};
+        int64_t sellValuesSize{};
+
+        int64_t          rowBlockDim{};
+        int64_t          colBlockDim{};
+        hipsparseOrder_t blockOrder{HIPSPARSE_ORDER_ROW};
+
+        int     batchCount{1};
+        int64_t offsetsBatchStride{};
+        int64_t indicesBatchStride{};
+
+        // Variable size batches of a block diagonal CSR matrix, see
+        // hipsparseCsrSetVariableBatch(), empty when the matrix is not partitioned
+        std::vector<int64_t> batchRowOffsets;
+        std::vector<int64_t> batchColOffsets;
+
+        hipsparseFillMode_t fillMode{HIPSPARSE_FILL_MODE_LOWER};
+        hipsparseDiagType_t diagType{HIPSPARSE_DIAG_TYPE_NON_UNIT};
+    };
+
+    // Matrix assembled by the host routines (SpGEMM, SpSV and SpSM work on CSR copies)
+    template <typename T>
+    struct csrMatrix
+    {
+        int64_t              rows{};
+        int64_t              cols{};
+        std::vector<int64_t> rowPtr;
+        std::vector<int64_t> colInd;
+        std::vector<T>       val;
+    };
+
+    // Triangular part of op(A) in CSR, without its diagonal which is kept separately. entryMap
+    // gives, for every entry of A in the order of a sequential forEachEntry(), its position in
+    // L.val, -1 - i for the diagonal entry of row i, or entryDropped if it is not used.
+    template <typename T>
+    struct triangle
+    {
+        static constexpr int64_t entryDropped = INT64_MIN;
+
+        csrMatrix<T>         L;
+        std::vector<T>       diag;
+        std::vector<int64_t> entryMap;
+        bool                 lower{};
+    };
+
+    // Triangle of the matrix a SpSV or SpSM descriptor was analysed with, a triangle<T> of its
+    // value type. It is built again for another matrix or operation, the solves only reload
+    // its values.
+    struct triangleCache
+    {
+        std::shared_ptr<void> triangle;
+        hipsparseOperation_t  opA{HIPSPARSE_OPERATION_NON_TRANSPOSE};
+        hipDataType           valueType{HIP_R_32F};
+        hipsparseFillMode_t   fillMode{HIPSPARSE_FILL_MODE_LOWER};
+        const void*           offsets{};
+        const void*           indices{};
+        int64_t               rows{};
+        int64_t               nnz{};
+    };
+
+    // The host routines do not need any buffer, a small size is reported so that the callers
+    // always allocate a valid pointer
+    constexpr size_t hostBufferSize = 4;
+
+    hipsparseStatus_t getIndexTypeSize(hipsparseIndexType_t indexType, size_t& size);
+    hipsparseStatus_t getDataTypeSize(hipDataType dataType, size_t& size);
+
+    // Calls f with a value of the C++ type of the index type
+    template <typename F>
+    hipsparseStatus_t dispatchIndexType(hipsparseIndexType_t indexType, F&& f)
+    {
+        switch(indexType)
+        {
+        case HIPSPARSE_INDEX_32I:
+            return f(int32_t{});
+        case HIPSPARSE_INDEX_64I:
+            return f(int64_t{});
+        case HIPSPARSE_INDEX_16U:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Calls f with a value of the C++ type of the data type, mixed precisions are not supported
+    template <typename F>
+    hipsparseStatus_t dispatchDataType(hipDataType dataType, F&& f)
+    {
+        switch(dataType)
+        {
+        case HIP_R_32F:
+            return f(float{});
+        case HIP_R_64F:
+            return f(double{});
+        case HIP_C_32F:
+            return f(std::complex<float>{});
+        case HIP_C_64F:
+            return f(std::complex<double>{});
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    template <typename T>
+    inline T conj(T x)
+    {
+        return x;
+    }
+
+    template <typename T>
+    inline std::complex<T> conj(std::complex<T> x)
+    {
+        return std::conj(x);
+    }
+
+    template <typename T>
+    inline T applyOperation(hipsparseOperation_t op, T x)
+    {
+        return (op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE) ? hipsparse::conj(x) : x;
+    }
+
+    // Real type of T, e.g. the type of a norm
+    template <typename T>
+    struct realType
+    {
+        using type = T;
+    };
+
+    template <typename T>
+    struct realType<std::complex<T>>
+    {
+        using type = T;
+    };
+
+    // |x|^2
+    template <typename T>
+    inline T absSquare(T x)
+    {
+        return x * x;
+    }
+
+    template <typename T>
+    inline T absSquare(std::complex<T> x)
+    {
+        return std::norm(x);
+    }
+
+    // Element (i, j) of a dense matrix
+    template <typename T>
+    inline T& denseAt(T* A, int64_t ld, hipsparseOrder_t order, int64_t i, int64_t j)
+    {
+        return (order == HIPSPARSE_ORDER_COL) ? A[i + j * ld] : A[i * ld + j];
+    }
+
+    // Number of threads used by the host kernels
+    int getNumThreads();
+
+    // Index of the calling thread within the current parallel region
+    int getThreadNum();
+}
+
+struct hipsparseSpGEMMDescr
+{
+    hipsparseSpGEMMMode_t mode{HIPSPARSE_SPGEMM_MODE_DEFAULT};
+
+    // Product computed by hipsparseSpGEMM_compute() (or hipsparseSpGEMMreuse_nnz() for the
+    // structure) and written to C by the copy routines, values are stored as bytes of the
+    // compute type
+    int64_t              rows{};
+    int64_t              cols{};
+    std::vector<int64_t> rowPtr;
+    std::vector<int64_t> colInd;
+    std::vector<char>    val;
+};
+
+struct hipsparseSpSVDescr
+{
+    bool analysed{};
+
+    hipsparse::triangleCache cache;
+};
+
+struct hipsparseSpSMDescr
+{
+    bool analysed{};
+
+    hipsparse::triangleCache cache;
+};
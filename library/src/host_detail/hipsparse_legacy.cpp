@@ -0,0 +1,1080 @@
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "hipsparse_host.hpp"
+
+#include <algorithm>
+#include <utility>
+
+/*
+ * ===========================================================================
+ *    legacy level 2 and level 3 routines, host kernels
+ * ===========================================================================
+ */
+
+// Only the legacy CSR routines the clients run by default are implemented on the host,
+// csrmv, csrmm, csrmm2 and csrgemm. The other legacy routines are in
+// hipsparse_unsupported.cpp.
+
+namespace hipsparse
+{
+    // The legacy host routines take general matrices with 32 bit indices
+    static hipsparseStatus_t checkGeneralMatrix(const hipsparseMatDescr_t descr)
+    {
+        if(descr == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return (((const matDescr*)descr)->type == HIPSPARSE_MATRIX_TYPE_GENERAL)
+                   ? HIPSPARSE_STATUS_SUCCESS
+                   : HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    //
+    // C = alpha * op(A) * op(B) + beta * C, A is an m x k CSR matrix, B and C are column major
+    //
+    template <typename T>
+    static hipsparseStatus_t csrmmHost(hipsparseHandle_t         handle,
+                                       hipsparseOperation_t      transA,
+                                       hipsparseOperation_t      transB,
+                                       int                       m,
+                                       int                       n,
+                                       int                       k,
+                                       int                       nnz,
+                                       const T*                  alpha,
+                                       const hipsparseMatDescr_t descrA,
+                                       const T*                  csrVal,
+                                       const int*                csrRowPtr,
+                                       const int*                csrColInd,
+                                       const T*                  B,
+                                       int                       ldb,
+                                       const T*                  beta,
+                                       T*                        C,
+                                       int                       ldc)
+    {
+        if(handle == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m < 0 || n < 0 || k < 0 || nnz < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(checkGeneralMatrix(descrA));
+
+        // op(A) is m x k, or k x m when A is transposed
+        const bool nonTransA = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        const bool nonTransB = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        const int  rowsB     = nonTransA ? k : m;
+        const int  rowsC     = nonTransA ? m : k;
+
+        if(rowsC == 0 || n == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(alpha == nullptr || beta == nullptr || csrRowPtr == nullptr || B == nullptr
+           || C == nullptr || (nnz > 0 && (csrVal == nullptr || csrColInd == nullptr)))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(ldb < (nonTransB ? rowsB : n) || ldc < rowsC)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int base = ((const matDescr*)descrA)->base;
+
+        // Both pointer modes hand over host addressable scalars
+        const T a = *alpha;
+        const T b = *beta;
+
+        // Element (i, j) of op(B)
+        auto opB = [&](int64_t i, int64_t j) {
+            return nonTransB ? B[i + j * ldb] : applyOperation(transB, B[j + i * ldb]);
+        };
+
+        if(nonTransA)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+            for(int i = 0; i < m; ++i)
+            {
+                for(int j = 0; j < n; ++j)
+                {
+                    T sum = static_cast<T>(0);
+                    for(int p = csrRowPtr[i] - base; p < csrRowPtr[i + 1] - base; ++p)
+                    {
+                        sum += csrVal[p] * opB(csrColInd[p] - base, j);
+                    }
+
+                    T& c = C[i + static_cast<int64_t>(j) * ldc];
+                    c    = (b == static_cast<T>(0)) ? a * sum : a * sum + b * c;
+                }
+            }
+        }
+        else
+        {
+            // The rows of A scatter into the columns of C, each column is owned by one thread
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int j = 0; j < n; ++j)
+            {
+                T* c = C + static_cast<int64_t>(j) * ldc;
+                for(int i = 0; i < rowsC; ++i)
+                {
+                    c[i] = (b == static_cast<T>(0)) ? static_cast<T>(0) : b * c[i];
+                }
+
+                for(int i = 0; i < m; ++i)
+                {
+                    const T x = a * opB(i, j);
+                    for(int p = csrRowPtr[i] - base; p < csrRowPtr[i + 1] - base; ++p)
+                    {
+                        c[csrColInd[p] - base] += applyOperation(transA, csrVal[p]) * x;
+                    }
+                }
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // y = alpha * op(A) * x + beta * y, A is an m x n CSR matrix
+    //
+    template <typename T>
+    static hipsparseStatus_t csrmvHost(hipsparseHandle_t         handle,
+                                       hipsparseOperation_t      transA,
+                                       int                       m,
+                                       int                       n,
+                                       int                       nnz,
+                                       const T*                  alpha,
+                                       const hipsparseMatDescr_t descrA,
+                                       const T*                  csrVal,
+                                       const int*                csrRowPtr,
+                                       const int*                csrColInd,
+                                       const T*                  x,
+                                       const T*                  beta,
+                                       T*                        y)
+    {
+        // x and y are single columns of op(A) rows and op(A) columns
+        const int sizeX = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+        const int sizeY = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+        return csrmmHost(handle,
+                         transA,
+                         HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                         m,
+                         1,
+                         n,
+                         nnz,
+                         alpha,
+                         descrA,
+                         csrVal,
+                         csrRowPtr,
+                         csrColInd,
+                         x,
+                         std::max(1, sizeX),
+                         beta,
+                         y,
+                         std::max(1, sizeY));
+    }
+
+    //
+    // Structure and values of C = A * B, the legacy csrgemm has no transposed operands
+    //
+    static hipsparseStatus_t csrgemmCheck(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          hipsparseOperation_t      transB,
+                                          int                       m,
+                                          int                       n,
+                                          int                       k,
+                                          const hipsparseMatDescr_t descrA,
+                                          int                       nnzA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          const hipsparseMatDescr_t descrB,
+                                          int                       nnzB,
+                                          const int*                csrRowPtrB,
+                                          const int*                csrColIndB,
+                                          const hipsparseMatDescr_t descrC,
+                                          const int*                csrRowPtrC)
+    {
+        if(handle == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m < 0 || n < 0 || k < 0 || nnzA < 0 || nnzB < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(checkGeneralMatrix(descrA));
+        RETURN_IF_HIPSPARSE_ERROR(checkGeneralMatrix(descrB));
+        RETURN_IF_HIPSPARSE_ERROR(checkGeneralMatrix(descrC));
+
+        if(csrRowPtrA == nullptr || csrRowPtrB == nullptr || csrRowPtrC == nullptr
+           || (nnzA > 0 && csrColIndA == nullptr) || (nnzB > 0 && csrColIndB == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE
+           || transB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t csrgemmNnzHost(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            int*                      csrRowPtrC,
+                                            int*                      nnzTotalDevHostPtr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(csrgemmCheck(handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               k,
+                                               descrA,
+                                               nnzA,
+                                               csrRowPtrA,
+                                               csrColIndA,
+                                               descrB,
+                                               nnzB,
+                                               csrRowPtrB,
+                                               csrColIndB,
+                                               descrC,
+                                               csrRowPtrC));
+
+        if(nnzTotalDevHostPtr == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int baseA = ((const matDescr*)descrA)->base;
+        const int baseB = ((const matDescr*)descrB)->base;
+        const int baseC = ((const matDescr*)descrC)->base;
+
+        const bool empty = (n == 0 || k == 0 || nnzA == 0 || nnzB == 0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // marker holds the last row that touched a column
+            std::vector<int> marker(empty ? 0 : n, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(int i = 0; i < m; ++i)
+            {
+                int rowNnz = 0;
+                for(int p = csrRowPtrA[i] - baseA; !empty && p < csrRowPtrA[i + 1] - baseA; ++p)
+                {
+                    const int l = csrColIndA[p] - baseA;
+                    for(int q = csrRowPtrB[l] - baseB; q < csrRowPtrB[l + 1] - baseB; ++q)
+                    {
+                        const int j = csrColIndB[q] - baseB;
+                        if(marker[j] != i)
+                        {
+                            marker[j] = i;
+                            ++rowNnz;
+                        }
+                    }
+                }
+
+                csrRowPtrC[i + 1] = rowNnz;
+            }
+        }
+
+        csrRowPtrC[0] = baseC;
+        for(int i = 0; i < m; ++i)
+        {
+            csrRowPtrC[i + 1] += csrRowPtrC[i];
+        }
+
+        // Both pointer modes hand over a host addressable pointer
+        *nnzTotalDevHostPtr = csrRowPtrC[m] - baseC;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    static hipsparseStatus_t csrgemmHost(hipsparseHandle_t         handle,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transB,
+                                         int                       m,
+                                         int                       n,
+                                         int                       k,
+                                         const hipsparseMatDescr_t descrA,
+                                         int                       nnzA,
+                                         const T*                  csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         const hipsparseMatDescr_t descrB,
+                                         int                       nnzB,
+                                         const T*                  csrValB,
+                                         const int*                csrRowPtrB,
+                                         const int*                csrColIndB,
+                                         const hipsparseMatDescr_t descrC,
+                                         T*                        csrValC,
+                                         const int*                csrRowPtrC,
+                                         int*                      csrColIndC)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(csrgemmCheck(handle,
+                                               transA,
+                                               transB,
+                                               m,
+                                               n,
+                                               k,
+                                               descrA,
+                                               nnzA,
+                                               csrRowPtrA,
+                                               csrColIndA,
+                                               descrB,
+                                               nnzB,
+                                               csrRowPtrB,
+                                               csrColIndB,
+                                               descrC,
+                                               csrRowPtrC));
+
+        const int baseA = ((const matDescr*)descrA)->base;
+        const int baseB = ((const matDescr*)descrB)->base;
+        const int baseC = ((const matDescr*)descrC)->base;
+
+        // The structure of C comes from hipsparseXcsrgemmNnz()
+        const int nnzC = csrRowPtrC[m] - baseC;
+
+        if((nnzA > 0 && csrValA == nullptr) || (nnzB > 0 && csrValB == nullptr)
+           || (nnzC > 0 && (csrValC == nullptr || csrColIndC == nullptr)))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnzC == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // marker holds the last row that touched a column, position its entry in C
+            std::vector<int>                marker(n, -1);
+            std::vector<int>                position(n);
+            std::vector<std::pair<int, T>> row;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(int i = 0; i < m; ++i)
+            {
+                row.clear();
+                for(int p = csrRowPtrA[i] - baseA; p < csrRowPtrA[i + 1] - baseA; ++p)
+                {
+                    const int l = csrColIndA[p] - baseA;
+                    const T   a = csrValA[p];
+                    for(int q = csrRowPtrB[l] - baseB; q < csrRowPtrB[l + 1] - baseB; ++q)
+                    {
+                        const int j = csrColIndB[q] - baseB;
+                        if(marker[j] != i)
+                        {
+                            marker[j]   = i;
+                            position[j] = static_cast<int>(row.size());
+                            row.emplace_back(j, a * csrValB[q]);
+                        }
+                        else
+                        {
+                            row[position[j]].second += a * csrValB[q];
+                        }
+                    }
+                }
+
+                std::sort(row.begin(),
+                          row.end(),
+                          [](const std::pair<int, T>& x, const std::pair<int, T>& y) {
+                              return x.first < y.first;
+                          });
+
+                const int begin = csrRowPtrC[i] - baseC;
+                for(size_t p = 0; p < row.size(); ++p)
+                {
+                    csrColIndC[begin + p] = row[p].first + baseC;
+                    csrValC[begin + p]    = row[p].second;
+                }
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    legacy level 2 and level 3 routines
+ * ===========================================================================
+ */
+
+hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       nnz,
+                                  const float*              alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const float*              csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y)
+{
+    return hipsparse::csrmvHost(handle,
+                                transA,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descrA,
+                                csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                x,
+                                beta,
+                                y);
+}
+
+hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       nnz,
+                                  const double*             alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const double*             csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y)
+{
+    return hipsparse::csrmvHost(handle,
+                                transA,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descrA,
+                                csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                x,
+                                beta,
+                                y);
+}
+
+hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       nnz,
+                                  const hipComplex*         alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipComplex*         csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const hipComplex*         x,
+                                  const hipComplex*         beta,
+                                  hipComplex*               y)
+{
+    return hipsparse::csrmvHost(handle,
+                                transA,
+                                m,
+                                n,
+                                nnz,
+                                (const std::complex<float>*)alpha,
+                                descrA,
+                                (const std::complex<float>*)csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                (const std::complex<float>*)x,
+                                (const std::complex<float>*)beta,
+                                (std::complex<float>*)y);
+}
+
+hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       nnz,
+                                  const hipDoubleComplex*   alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipDoubleComplex*   csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const hipDoubleComplex*   x,
+                                  const hipDoubleComplex*   beta,
+                                  hipDoubleComplex*         y)
+{
+    return hipsparse::csrmvHost(handle,
+                                transA,
+                                m,
+                                n,
+                                nnz,
+                                (const std::complex<double>*)alpha,
+                                descrA,
+                                (const std::complex<double>*)csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                (const std::complex<double>*)x,
+                                (const std::complex<double>*)beta,
+                                (std::complex<double>*)y);
+}
+
+hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       k,
+                                  int                       nnz,
+                                  const float*              alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const float*              csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const float*              B,
+                                  int                       ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  int                       ldc)
+{
+    return hipsparse::csrmmHost(handle,
+                                transA,
+                                HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                descrA,
+                                csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                B,
+                                ldb,
+                                beta,
+                                C,
+                                ldc);
+}
+
+hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       k,
+                                  int                       nnz,
+                                  const double*             alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const double*             csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const double*             B,
+                                  int                       ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  int                       ldc)
+{
+    return hipsparse::csrmmHost(handle,
+                                transA,
+                                HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                descrA,
+                                csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                B,
+                                ldb,
+                                beta,
+                                C,
+                                ldc);
+}
+
+hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       k,
+                                  int                       nnz,
+                                  const hipComplex*         alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipComplex*         csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const hipComplex*         B,
+                                  int                       ldb,
+                                  const hipComplex*         beta,
+                                  hipComplex*               C,
+                                  int                       ldc)
+{
+    return hipsparse::csrmmHost(handle,
+                                transA,
+                                HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                (const std::complex<float>*)alpha,
+                                descrA,
+                                (const std::complex<float>*)csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                (const std::complex<float>*)B,
+                                ldb,
+                                (const std::complex<float>*)beta,
+                                (std::complex<float>*)C,
+                                ldc);
+}
+
+hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       k,
+                                  int                       nnz,
+                                  const hipDoubleComplex*   alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipDoubleComplex*   csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const hipDoubleComplex*   B,
+                                  int                       ldb,
+                                  const hipDoubleComplex*   beta,
+                                  hipDoubleComplex*         C,
+                                  int                       ldc)
+{
+    return hipsparse::csrmmHost(handle,
+                                transA,
+                                HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                (const std::complex<double>*)alpha,
+                                descrA,
+                                (const std::complex<double>*)csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                (const std::complex<double>*)B,
+                                ldb,
+                                (const std::complex<double>*)beta,
+                                (std::complex<double>*)C,
+                                ldc);
+}
+
+hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
+                                   hipsparseOperation_t      transA,
+                                   hipsparseOperation_t      transB,
+                                   int                       m,
+                                   int                       n,
+                                   int                       k,
+                                   int                       nnz,
+                                   const float*              alpha,
+                                   const hipsparseMatDescr_t descrA,
+                                   const float*              csrSortedValA,
+                                   const int*                csrSortedRowPtrA,
+                                   const int*                csrSortedColIndA,
+                                   const float*              B,
+                                   int                       ldb,
+                                   const float*              beta,
+                                   float*                    C,
+                                   int                       ldc)
+{
+    return hipsparse::csrmmHost(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                descrA,
+                                csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                B,
+                                ldb,
+                                beta,
+                                C,
+                                ldc);
+}
+
+hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
+                                   hipsparseOperation_t      transA,
+                                   hipsparseOperation_t      transB,
+                                   int                       m,
+                                   int                       n,
+                                   int                       k,
+                                   int                       nnz,
+                                   const double*             alpha,
+                                   const hipsparseMatDescr_t descrA,
+                                   const double*             csrSortedValA,
+                                   const int*                csrSortedRowPtrA,
+                                   const int*                csrSortedColIndA,
+                                   const double*             B,
+                                   int                       ldb,
+                                   const double*             beta,
+                                   double*                   C,
+                                   int                       ldc)
+{
+    return hipsparse::csrmmHost(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                descrA,
+                                csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                B,
+                                ldb,
+                                beta,
+                                C,
+                                ldc);
+}
+
+hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
+                                   hipsparseOperation_t      transA,
+                                   hipsparseOperation_t      transB,
+                                   int                       m,
+                                   int                       n,
+                                   int                       k,
+                                   int                       nnz,
+                                   const hipComplex*         alpha,
+                                   const hipsparseMatDescr_t descrA,
+                                   const hipComplex*         csrSortedValA,
+                                   const int*                csrSortedRowPtrA,
+                                   const int*                csrSortedColIndA,
+                                   const hipComplex*         B,
+                                   int                       ldb,
+                                   const hipComplex*         beta,
+                                   hipComplex*               C,
+                                   int                       ldc)
+{
+    return hipsparse::csrmmHost(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                (const std::complex<float>*)alpha,
+                                descrA,
+                                (const std::complex<float>*)csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                (const std::complex<float>*)B,
+                                ldb,
+                                (const std::complex<float>*)beta,
+                                (std::complex<float>*)C,
+                                ldc);
+}
+
+hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
+                                   hipsparseOperation_t      transA,
+                                   hipsparseOperation_t      transB,
+                                   int                       m,
+                                   int                       n,
+                                   int                       k,
+                                   int                       nnz,
+                                   const hipDoubleComplex*   alpha,
+                                   const hipsparseMatDescr_t descrA,
+                                   const hipDoubleComplex*   csrSortedValA,
+                                   const int*                csrSortedRowPtrA,
+                                   const int*                csrSortedColIndA,
+                                   const hipDoubleComplex*   B,
+                                   int                       ldb,
+                                   const hipDoubleComplex*   beta,
+                                   hipDoubleComplex*         C,
+                                   int                       ldc)
+{
+    return hipsparse::csrmmHost(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                (const std::complex<double>*)alpha,
+                                descrA,
+                                (const std::complex<double>*)csrSortedValA,
+                                csrSortedRowPtrA,
+                                csrSortedColIndA,
+                                (const std::complex<double>*)B,
+                                ldb,
+                                (const std::complex<double>*)beta,
+                                (std::complex<double>*)C,
+                                ldc);
+}
+
+hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
+                                       hipsparseOperation_t      transA,
+                                       hipsparseOperation_t      transB,
+                                       int                       m,
+                                       int                       n,
+                                       int                       k,
+                                       const hipsparseMatDescr_t descrA,
+                                       int                       nnzA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const hipsparseMatDescr_t descrB,
+                                       int                       nnzB,
+                                       const int*                csrRowPtrB,
+                                       const int*                csrColIndB,
+                                       const hipsparseMatDescr_t descrC,
+                                       int*                      csrRowPtrC,
+                                       int*                      nnzTotalDevHostPtr)
+{
+    return hipsparse::csrgemmNnzHost(handle,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     descrA,
+                                     nnzA,
+                                     csrRowPtrA,
+                                     csrColIndA,
+                                     descrB,
+                                     nnzB,
+                                     csrRowPtrB,
+                                     csrColIndB,
+                                     descrC,
+                                     csrRowPtrC,
+                                     nnzTotalDevHostPtr);
+}
+
+hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
+                                    hipsparseOperation_t      transA,
+                                    hipsparseOperation_t      transB,
+                                    int                       m,
+                                    int                       n,
+                                    int                       k,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const float*              csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const float*              csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    float*                    csrValC,
+                                    const int*                csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return hipsparse::csrgemmHost(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  descrA,
+                                  nnzA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  descrB,
+                                  nnzB,
+                                  csrValB,
+                                  csrRowPtrB,
+                                  csrColIndB,
+                                  descrC,
+                                  csrValC,
+                                  csrRowPtrC,
+                                  csrColIndC);
+}
+
+hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
+                                    hipsparseOperation_t      transA,
+                                    hipsparseOperation_t      transB,
+                                    int                       m,
+                                    int                       n,
+                                    int                       k,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const double*             csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const double*             csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    double*                   csrValC,
+                                    const int*                csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return hipsparse::csrgemmHost(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  descrA,
+                                  nnzA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  descrB,
+                                  nnzB,
+                                  csrValB,
+                                  csrRowPtrB,
+                                  csrColIndB,
+                                  descrC,
+                                  csrValC,
+                                  csrRowPtrC,
+                                  csrColIndC);
+}
+
+hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
+                                    hipsparseOperation_t      transA,
+                                    hipsparseOperation_t      transB,
+                                    int                       m,
+                                    int                       n,
+                                    int                       k,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const hipComplex*         csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const hipComplex*         csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipComplex*               csrValC,
+                                    const int*                csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return hipsparse::csrgemmHost(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  descrA,
+                                  nnzA,
+                                  (const std::complex<float>*)csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  descrB,
+                                  nnzB,
+                                  (const std::complex<float>*)csrValB,
+                                  csrRowPtrB,
+                                  csrColIndB,
+                                  descrC,
+                                  (std::complex<float>*)csrValC,
+                                  csrRowPtrC,
+                                  csrColIndC);
+}
+
+hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
+                                    hipsparseOperation_t      transA,
+                                    hipsparseOperation_t      transB,
+                                    int                       m,
+                                    int                       n,
+                                    int                       k,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const hipDoubleComplex*   csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const hipDoubleComplex*   csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipDoubleComplex*         csrValC,
+                                    const int*                csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return hipsparse::csrgemmHost(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  descrA,
+                                  nnzA,
+                                  (const std::complex<double>*)csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  descrB,
+                                  nnzB,
+                                  (const std::complex<double>*)csrValB,
+                                  csrRowPtrB,
+                                  csrColIndB,
+                                  descrC,
+                                  (std::complex<double>*)csrValC,
+                                  csrRowPtrC,
+                                  csrColIndC);
+}
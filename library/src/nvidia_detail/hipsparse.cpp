@@ -462,6 +462,16 @@ namespace hipsparse
             return CUDA_C_32F;
         case HIP_C_64F:
             return CUDA_C_64F;
+        case HIP_R_16F:
+            return CUDA_R_16F;
+        case HIP_R_8I:
+            return CUDA_R_8I;
+        case HIP_R_32I:
+            return CUDA_R_32I;
+#if(CUDART_VERSION >= 11000)
+        case HIP_R_16BF:
+            return CUDA_R_16BF;
+#endif
         default:
             throw "Non existent hipDataType";
         }
@@ -479,6 +489,16 @@ namespace hipsparse
             return HIP_C_32F;
         case CUDA_C_64F:
             return HIP_C_64F;
+        case CUDA_R_16F:
+            return HIP_R_16F;
+        case CUDA_R_8I:
+            return HIP_R_8I;
+        case CUDA_R_32I:
+            return HIP_R_32I;
+#if(CUDART_VERSION >= 11000)
+        case CUDA_R_16BF:
+            return HIP_R_16BF;
+#endif
         default:
             throw "Non existent cudaDataType";
         }
@@ -579,6 +599,79 @@ hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePoi
     return hipsparse::hipCUSPARSEStatusToHIPStatus(status);
 }
 
+// cuSPARSE routines do not allocate temporary storage on our behalf, so there is
+// no workspace pool to manage with this backend.
+hipsparseStatus_t hipsparseSetWorkspacePoolSize(hipsparseHandle_t handle, size_t size)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t
+    hipsparseGetWorkspacePoolInfo(hipsparseHandle_t handle, size_t* size, size_t* highWaterMark)
+{
+    if(handle == nullptr || size == nullptr || highWaterMark == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *size          = 0;
+    *highWaterMark = 0;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseTrimWorkspacePool(hipsparseHandle_t handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetExecutionPolicy(hipsparseHandle_t          handle,
+                                              hipsparseExecutionPolicy_t policy)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(policy != HIPSPARSE_EXECUTION_POLICY_BLOCKING
+       && policy != HIPSPARSE_EXECUTION_POLICY_ASYNC_DEVICE
+       && policy != HIPSPARSE_EXECUTION_POLICY_ASYNC)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // cuSPARSE decides which routines are blocking, there is no synchronization to skip
+    if(policy != HIPSPARSE_EXECUTION_POLICY_BLOCKING)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetExecutionPolicy(hipsparseHandle_t           handle,
+                                              hipsparseExecutionPolicy_t* policy)
+{
+    if(handle == nullptr || policy == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *policy = HIPSPARSE_EXECUTION_POLICY_BLOCKING;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 {
     return hipsparse::hipCUSPARSEStatusToHIPStatus(
@@ -781,6 +874,32 @@ hipsparseStatus_t hipsparseDestroyCsrgemm2Info(csrgemm2Info_t info)
 }
 #endif
 
+#if CUDART_VERSION < 11000
+// cuSPARSE has no reusable csrgemm analysis, the plan is only a placeholder
+struct csrgemmPlan
+{
+};
+
+hipsparseStatus_t hipsparseCreateCsrgemmPlan(csrgemmPlan_t* plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *plan = new csrgemmPlan;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyCsrgemmPlan(csrgemmPlan_t plan)
+{
+    delete plan;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreatePruneInfo(pruneInfo_t* info)
 {
@@ -5103,6 +5222,245 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                          csrRowPtrC,
                          csrColIndC));
 }
+
+hipsparseStatus_t hipsparseXcsrgemmNnzWithPlan(hipsparseHandle_t         handle,
+                                               hipsparseOperation_t      transA,
+                                               hipsparseOperation_t      transB,
+                                               int                       m,
+                                               int                       n,
+                                               int                       k,
+                                               const hipsparseMatDescr_t descrA,
+                                               int                       nnzA,
+                                               const int*                csrRowPtrA,
+                                               const int*                csrColIndA,
+                                               const hipsparseMatDescr_t descrB,
+                                               int                       nnzB,
+                                               const int*                csrRowPtrB,
+                                               const int*                csrColIndB,
+                                               const hipsparseMatDescr_t descrC,
+                                               int*                      csrRowPtrC,
+                                               int*                      nnzTotalDevHostPtr,
+                                               csrgemmPlan_t             plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparseXcsrgemmNnz(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                descrA,
+                                nnzA,
+                                csrRowPtrA,
+                                csrColIndA,
+                                descrB,
+                                nnzB,
+                                csrRowPtrB,
+                                csrColIndB,
+                                descrC,
+                                csrRowPtrC,
+                                nnzTotalDevHostPtr);
+}
+
+hipsparseStatus_t hipsparseScsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const float*              csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const float*              csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            float*                    csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparseScsrgemm(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             descrA,
+                             nnzA,
+                             csrValA,
+                             csrRowPtrA,
+                             csrColIndA,
+                             descrB,
+                             nnzB,
+                             csrValB,
+                             csrRowPtrB,
+                             csrColIndB,
+                             descrC,
+                             csrValC,
+                             csrRowPtrC,
+                             csrColIndC);
+}
+
+hipsparseStatus_t hipsparseDcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const double*             csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const double*             csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            double*                   csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparseDcsrgemm(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             descrA,
+                             nnzA,
+                             csrValA,
+                             csrRowPtrA,
+                             csrColIndA,
+                             descrB,
+                             nnzB,
+                             csrValB,
+                             csrRowPtrB,
+                             csrColIndB,
+                             descrC,
+                             csrValC,
+                             csrRowPtrC,
+                             csrColIndC);
+}
+
+hipsparseStatus_t hipsparseCcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipComplex*         csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipComplex*         csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            hipComplex*               csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparseCcsrgemm(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             descrA,
+                             nnzA,
+                             csrValA,
+                             csrRowPtrA,
+                             csrColIndA,
+                             descrB,
+                             nnzB,
+                             csrValB,
+                             csrRowPtrB,
+                             csrColIndB,
+                             descrC,
+                             csrValC,
+                             csrRowPtrC,
+                             csrColIndC);
+}
+
+hipsparseStatus_t hipsparseZcsrgemmWithPlan(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipDoubleComplex*   csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipDoubleComplex*   csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipsparseMatDescr_t descrC,
+                                            hipDoubleComplex*         csrValC,
+                                            const int*                csrRowPtrC,
+                                            int*                      csrColIndC,
+                                            csrgemmPlan_t             plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparseZcsrgemm(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             descrA,
+                             nnzA,
+                             csrValA,
+                             csrRowPtrA,
+                             csrColIndA,
+                             descrB,
+                             nnzB,
+                             csrValB,
+                             csrRowPtrB,
+                             csrColIndB,
+                             descrC,
+                             csrValC,
+                             csrRowPtrC,
+                             csrColIndC);
+}
 #endif
 
 #if CUDART_VERSION < 12000
@@ -10756,6 +11114,12 @@ namespace hipsparse
             return CUSPARSE_FORMAT_COO;
         case HIPSPARSE_FORMAT_BLOCKED_ELL:
             return CUSPARSE_FORMAT_BLOCKED_ELL;
+#if(CUDART_VERSION >= 12010)
+        case HIPSPARSE_FORMAT_SLICED_ELLPACK:
+            return CUSPARSE_FORMAT_SLICED_ELLPACK;
+        case HIPSPARSE_FORMAT_BSR:
+            return CUSPARSE_FORMAT_BSR;
+#endif
         default:
             throw "Non existent hipsparseFormat_t";
         }
@@ -10809,6 +11173,12 @@ namespace hipsparse
             return HIPSPARSE_FORMAT_COO;
         case CUSPARSE_FORMAT_BLOCKED_ELL:
             return HIPSPARSE_FORMAT_BLOCKED_ELL;
+#if(CUDART_VERSION >= 12010)
+        case CUSPARSE_FORMAT_SLICED_ELLPACK:
+            return HIPSPARSE_FORMAT_SLICED_ELLPACK;
+        case CUSPARSE_FORMAT_BSR:
+            return HIPSPARSE_FORMAT_BSR;
+#endif
         default:
             throw "Non existent cusparseFormat_t";
         }
@@ -10937,6 +11307,7 @@ namespace hipsparse
         switch(alg)
         {
         case HIPSPARSE_SPMV_ALG_DEFAULT:
+        case HIPSPARSE_SPMV_ALG_AUTO:
             return CUSPARSE_SPMV_ALG_DEFAULT;
         case HIPSPARSE_SPMV_COO_ALG1:
             return CUSPARSE_SPMV_COO_ALG1;
@@ -10957,6 +11328,7 @@ namespace hipsparse
         {
         // case HIPSPARSE_MV_ALG_DEFAULT:
         case HIPSPARSE_SPMV_ALG_DEFAULT:
+        case HIPSPARSE_SPMV_ALG_AUTO:
             return CUSPARSE_SPMV_ALG_DEFAULT;
         // case HIPSPARSE_COOMV_ALG:
         case HIPSPARSE_SPMV_COO_ALG1:
@@ -11641,6 +12013,132 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
 }
 #endif
 
+#if(CUDART_VERSION >= 12010)
+hipsparseStatus_t hipsparseCreateSlicedEll(hipsparseSpMatDescr_t* spMatDescr,
+                                           int64_t                rows,
+                                           int64_t                cols,
+                                           int64_t                nnz,
+                                           int64_t                sellValuesSize,
+                                           int64_t                sliceSize,
+                                           void*                  sellSliceOffsets,
+                                           void*                  sellColInd,
+                                           void*                  sellValues,
+                                           hipsparseIndexType_t   sellSliceOffsetsType,
+                                           hipsparseIndexType_t   sellColIndType,
+                                           hipsparseIndexBase_t   idxBase,
+                                           hipDataType            valueType)
+{
+    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateSlicedEll((cusparseSpMatDescr_t*)spMatDescr,
+                                rows,
+                                cols,
+                                nnz,
+                                sellValuesSize,
+                                sliceSize,
+                                sellSliceOffsets,
+                                sellColInd,
+                                sellValues,
+                                hipsparse::hipIndexTypeToCudaIndexType(sellSliceOffsetsType),
+                                hipsparse::hipIndexTypeToCudaIndexType(sellColIndType),
+                                hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
+                                hipsparse::hipDataTypeToCudaDataType(valueType)));
+}
+
+hipsparseStatus_t hipsparseCreateConstSlicedEll(hipsparseConstSpMatDescr_t* spMatDescr,
+                                                int64_t                     rows,
+                                                int64_t                     cols,
+                                                int64_t                     nnz,
+                                                int64_t                     sellValuesSize,
+                                                int64_t                     sliceSize,
+                                                const void*                 sellSliceOffsets,
+                                                const void*                 sellColInd,
+                                                const void*                 sellValues,
+                                                hipsparseIndexType_t        sellSliceOffsetsType,
+                                                hipsparseIndexType_t        sellColIndType,
+                                                hipsparseIndexBase_t        idxBase,
+                                                hipDataType                 valueType)
+{
+    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateConstSlicedEll((cusparseConstSpMatDescr_t*)spMatDescr,
+                                     rows,
+                                     cols,
+                                     nnz,
+                                     sellValuesSize,
+                                     sliceSize,
+                                     sellSliceOffsets,
+                                     sellColInd,
+                                     sellValues,
+                                     hipsparse::hipIndexTypeToCudaIndexType(sellSliceOffsetsType),
+                                     hipsparse::hipIndexTypeToCudaIndexType(sellColIndType),
+                                     hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
+                                     hipsparse::hipDataTypeToCudaDataType(valueType)));
+}
+
+hipsparseStatus_t hipsparseCreateBsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                brows,
+                                     int64_t                bcols,
+                                     int64_t                bnnz,
+                                     int64_t                rowBlockSize,
+                                     int64_t                colBlockSize,
+                                     void*                  bsrRowOffsets,
+                                     void*                  bsrColInd,
+                                     void*                  bsrValues,
+                                     hipsparseIndexType_t   bsrRowOffsetsType,
+                                     hipsparseIndexType_t   bsrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType,
+                                     hipsparseOrder_t       order)
+{
+    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateBsr((cusparseSpMatDescr_t*)spMatDescr,
+                          brows,
+                          bcols,
+                          bnnz,
+                          rowBlockSize,
+                          colBlockSize,
+                          bsrRowOffsets,
+                          bsrColInd,
+                          bsrValues,
+                          hipsparse::hipIndexTypeToCudaIndexType(bsrRowOffsetsType),
+                          hipsparse::hipIndexTypeToCudaIndexType(bsrColIndType),
+                          hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
+                          hipsparse::hipDataTypeToCudaDataType(valueType),
+                          hipsparse::hipOrderToCudaOrder(order)));
+}
+
+hipsparseStatus_t hipsparseCreateConstBsr(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     brows,
+                                          int64_t                     bcols,
+                                          int64_t                     bnnz,
+                                          int64_t                     rowBlockSize,
+                                          int64_t                     colBlockSize,
+                                          const void*                 bsrRowOffsets,
+                                          const void*                 bsrColInd,
+                                          const void*                 bsrValues,
+                                          hipsparseIndexType_t        bsrRowOffsetsType,
+                                          hipsparseIndexType_t        bsrColIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType,
+                                          hipsparseOrder_t            order)
+{
+    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateConstBsr((cusparseConstSpMatDescr_t*)spMatDescr,
+                               brows,
+                               bcols,
+                               bnnz,
+                               rowBlockSize,
+                               colBlockSize,
+                               bsrRowOffsets,
+                               bsrColInd,
+                               bsrValues,
+                               hipsparse::hipIndexTypeToCudaIndexType(bsrRowOffsetsType),
+                               hipsparse::hipIndexTypeToCudaIndexType(bsrColIndType),
+                               hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
+                               hipsparse::hipDataTypeToCudaDataType(valueType),
+                               hipsparse::hipOrderToCudaOrder(order)));
+}
+#endif
+
 #if(CUDART_VERSION >= 12000)
 hipsparseStatus_t hipsparseDestroySpMat(hipsparseConstSpMatDescr_t spMatDescr)
 {
@@ -12154,6 +12652,47 @@ hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
                                    offsetsBatchStride,
                                    columnsValuesBatchStride));
 }
+
+hipsparseStatus_t hipsparseCsrSetVariableBatch(hipsparseSpMatDescr_t spMatDescr,
+                                               int                   batchCount,
+                                               const int64_t*        batchRowOffsets,
+                                               const int64_t*        batchColOffsets)
+{
+    if(spMatDescr == nullptr || batchRowOffsets == nullptr || batchColOffsets == nullptr
+       || batchCount <= 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t          rows, cols, nnz;
+    cusparseFormat_t format;
+    RETURN_IF_CUSPARSE_ERROR(
+        cusparseSpMatGetSize((cusparseSpMatDescr_t)spMatDescr, &rows, &cols, &nnz));
+    RETURN_IF_CUSPARSE_ERROR(cusparseSpMatGetFormat((cusparseSpMatDescr_t)spMatDescr, &format));
+
+    if(format != CUSPARSE_FORMAT_CSR)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    for(int b = 0; b < batchCount; ++b)
+    {
+        if(batchRowOffsets[b + 1] < batchRowOffsets[b]
+           || batchColOffsets[b + 1] < batchColOffsets[b])
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+    }
+
+    if(batchRowOffsets[0] != 0 || batchColOffsets[0] != 0 || batchRowOffsets[batchCount] != rows
+       || batchColOffsets[batchCount] != cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // cuSPARSE has no variable size batches, the block diagonal matrix is computed as a whole
+    return HIPSPARSE_STATUS_SUCCESS;
+}
 #endif
 
 #if(CUDART_VERSION >= 12000)
@@ -13093,6 +13632,36 @@ hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
 }
 #endif
 
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseSpGEMM_setMode(hipsparseSpGEMMDescr_t descr, hipsparseSpGEMMMode_t mode)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(mode != HIPSPARSE_SPGEMM_MODE_DEFAULT && mode != HIPSPARSE_SPGEMM_MODE_SINGLE_ARENA)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // cuSPARSE manages its own buffers, the mode has no effect
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_getMode(hipsparseSpGEMMDescr_t descr, hipsparseSpGEMMMode_t* mode)
+{
+    if(descr == nullptr || mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = HIPSPARSE_SPGEMM_MODE_DEFAULT;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
 #if(CUDART_VERSION >= 12000)
 hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          handle,
                                                  hipsparseOperation_t       opA,
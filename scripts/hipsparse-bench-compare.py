@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+# ########################################################################
+
+import argparse
+import csv
+import json
+import os
+import random
+import sys
+
+#
+#
+# This script compares two hipsparse-bench result files (--bench-o, .json or .csv).
+# Cases are aligned on their arguments, a case regresses when its throughput drops
+# by more than the threshold and the drop is larger than the measured noise:
+#  - with several runs per case (--bench-n), the bootstrap confidence interval of the
+#    ratio of the medians must exclude 1,
+#  - otherwise, the threshold is widened by the p90/median spread of the timer.
+# The exit status is 1 when a regression is found, 2 when the inputs are invalid.
+#
+
+# Arguments that do not change what is measured.
+IGNORED_ARGUMENTS = ['iters', 'warmup', 'timing', 'unit_check', 'device_id']
+
+METRICS = {'gflops': ('flops', 'gflops', True),
+           'gbs': ('bandwidth', 'gbs', True),
+           'time': ('time', 'msec', False)}
+
+def to_float(s, default = 0.0):
+    try:
+        return float(s)
+    except (TypeError, ValueError):
+        return default
+
+def median(v):
+    s = sorted(v)
+    n = len(s)
+    if n == 0:
+        return 0.0
+    return s[n // 2] if n % 2 == 1 else 0.5 * (s[n // 2 - 1] + s[n // 2])
+
+def case_key(arguments, cmdline):
+    if not arguments:
+        return cmdline.strip()
+    key = []
+    for name in sorted(arguments):
+        if name in IGNORED_ARGUMENTS:
+            continue
+        value = arguments[name]
+        if name == 'filename':
+            value = os.path.basename(value)
+        key.append(name + '=' + value)
+    return ' '.join(key)
+
+def timer_noise(timer):
+    median_us = to_float(timer.get('median_us'))
+    p90_us = to_float(timer.get('p90_us'))
+    if median_us <= 0.0 or p90_us <= 0.0:
+        return 0.0
+    return max(0.0, p90_us / median_us - 1.0)
+
+def load_json(filename, metric):
+    with open(filename) as f:
+        data = json.load(f)
+    json_name, _, _ = METRICS[metric]
+    cases = {}
+    for result in data.get('results', []):
+        cmdline = result.get('cmdline', '')
+        samples = result.get('samples', {}).get(json_name)
+        if not samples:
+            samples = [to_float(result.get('timing', {}).get(json_name, ['0'])[0])]
+        cases[case_key(result.get('arguments'), cmdline)] = {
+            'cmdline': cmdline.strip(),
+            'samples': [to_float(x) for x in samples],
+            'noise': timer_noise(result.get('timer', {}))}
+    return cases
+
+def load_csv(filename, metric):
+    _, csv_name, _ = METRICS[metric]
+    cases = {}
+    with open(filename, newline = '') as f:
+        for row in csv.DictReader(f):
+            arguments = {k[4:]: v for k, v in row.items() if k.startswith('arg.')}
+            timer = {k[6:]: v for k, v in row.items() if k.startswith('timer.')}
+            cmdline = row.get('cmdline', '')
+            cases[case_key(arguments, cmdline)] = {
+                'cmdline': cmdline.strip(),
+                'samples': [to_float(row.get(csv_name))],
+                'noise': timer_noise(timer)}
+    return cases
+
+def load(filename, metric):
+    if os.path.splitext(filename)[1] == '.csv':
+        return load_csv(filename, metric)
+    return load_json(filename, metric)
+
+#
+# Bootstrap confidence interval of median(new) / median(base).
+#
+def bootstrap_ratio(base, new, alpha, nboots, rng):
+    ratios = []
+    for _ in range(nboots):
+        b = median([rng.choice(base) for _ in base])
+        n = median([rng.choice(new) for _ in new])
+        if b > 0.0:
+            ratios.append(n / b)
+    if not ratios:
+        return (0.0, 0.0)
+    ratios.sort()
+    lo = ratios[int((1.0 - alpha) * 0.5 * (len(ratios) - 1))]
+    hi = ratios[int((1.0 - (1.0 - alpha) * 0.5) * (len(ratios) - 1))]
+    return (lo, hi)
+
+def compare(base, new, higher_is_better, threshold, alpha, nboots, rng):
+    b = median(base['samples'])
+    n = median(new['samples'])
+    if b <= 0.0 or n <= 0.0:
+        return None
+
+    # Speedup, > 1 is an improvement whatever the metric.
+    speedup = n / b if higher_is_better else b / n
+
+    if len(base['samples']) > 1 and len(new['samples']) > 1:
+        lo, hi = bootstrap_ratio(base['samples'], new['samples'], alpha, nboots, rng)
+        if not higher_is_better:
+            lo, hi = (1.0 / hi if hi > 0.0 else 0.0), (1.0 / lo if lo > 0.0 else 0.0)
+        significant_drop = hi < 1.0
+        significant_gain = lo > 1.0
+        noise = 0.0
+    else:
+        noise = max(base['noise'], new['noise'])
+        significant_drop = significant_gain = True
+
+    if speedup < 1.0 - (threshold + noise) and significant_drop:
+        status = 'REGRESSION'
+    elif speedup > 1.0 + (threshold + noise) and significant_gain:
+        status = 'improvement'
+    else:
+        status = 'ok'
+    return (b, n, speedup, noise, status)
+
+def main():
+    parser = argparse.ArgumentParser(description = 'Compare two hipsparse-bench result files.')
+    parser.add_argument('base', help = 'baseline result file (.json or .csv).')
+    parser.add_argument('new', help = 'new result file (.json or .csv).')
+    parser.add_argument('-m', '--metric', required=False, default = 'gflops', choices = sorted(METRICS),
+                        help = 'metric to compare.')
+    parser.add_argument('-t', '--threshold', required=False, default = 0.05, type = float,
+                        help = 'relative change tolerated on top of the noise.')
+    parser.add_argument('-a', '--alpha', required=False, default = 0.95, type = float,
+                        help = 'confidence level of the bootstrap interval.')
+    parser.add_argument('-n', '--nboots', required=False, default = 1000, type = int,
+                        help = 'number of bootstrap resamples.')
+    parser.add_argument('-s', '--seed', required=False, default = 0, type = int,
+                        help = 'seed of the bootstrap resampling.')
+    parser.add_argument('--fail-on-missing', required=False, default = False, action = 'store_true',
+                        help = 'cases of the baseline missing from the new file are failures.')
+    parser.add_argument('-v', '--verbose', required=False, default = False, action = 'store_true',
+                        help = 'print every case, not only the changed ones.')
+
+    user_args = parser.parse_args()
+    _, _, higher_is_better = METRICS[user_args.metric]
+    rng = random.Random(user_args.seed)
+
+    try:
+        base = load(user_args.base, user_args.metric)
+        new = load(user_args.new, user_args.metric)
+    except (OSError, ValueError, KeyError) as e:
+        print('error: ' + str(e), file = sys.stderr)
+        return 2
+
+    if not base:
+        print('error: no case in ' + user_args.base, file = sys.stderr)
+        return 2
+
+    nregressions = 0
+    missing = [key for key in base if key not in new]
+    rows = []
+    for key in base:
+        if key not in new:
+            continue
+        r = compare(base[key], new[key], higher_is_better, user_args.threshold,
+                    user_args.alpha, user_args.nboots, rng)
+        if r is None:
+            continue
+        if r[4] == 'REGRESSION':
+            nregressions += 1
+        if user_args.verbose or r[4] != 'ok':
+            rows.append((r, new[key]['cmdline']))
+
+    rows.sort(key = lambda x: x[0][2])
+    print('%-12s %12s %12s %9s %7s  %s' % ('status', 'base', 'new', 'speedup', 'noise', 'case'))
+    for r, cmdline in rows:
+        print('%-12s %12.4g %12.4g %9.3f %6.1f%%  %s' % (r[4], r[0], r[1], r[2], 100.0 * r[3], cmdline))
+    for key in missing:
+        print('%-12s %12s %12s %9s %7s  %s' % ('missing', '-', '-', '-', '-', base[key]['cmdline']))
+
+    print('// %d cases compared, %d regressions, %d missing (metric %s, threshold %.1f%%)'
+          % (len(base) - len(missing), nregressions, len(missing), user_args.metric,
+             100.0 * user_args.threshold))
+
+    if nregressions > 0 or (user_args.fail_on_missing and missing):
+        return 1
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())